@@ -28,11 +28,13 @@ void Tiger_Scene::UI::sidebar()
     bl_scoped(scale_lines);
     bl_scoped(scale_sizes);
     bl_scoped(rotate_text);
+    bl_scoped(use_path_cache);
 
     ImGui::Checkbox("Transform coordinates", &transform_coordinates);
     ImGui::Checkbox("Scale Lines", &scale_lines);
     ImGui::Checkbox("Scale Sizes", &scale_sizes);
     ImGui::Checkbox("Rotate Text", &rotate_text);
+    ImGui::Checkbox("Cache Paths", &use_path_cache);
 
     if (ImGui::Section("View", true)) 
     {
@@ -43,7 +45,9 @@ void Tiger_Scene::UI::sidebar()
 }
 
 void Tiger_Scene::sceneStart()
-{}
+{
+    draw_tiger(&tiger_paths);
+}
 
 void Tiger_Scene::sceneMounted(Viewport* ctx)
 {
@@ -67,20 +71,36 @@ void Tiger_Scene::viewportProcess(Viewport*, double)
 {
     // Process your scene...
     ///camera.setRotation(camera.rotation() + 0.01);
-    if (Changed(camera, transform_coordinates, scale_lines, scale_sizes))
+    if (Changed(camera, transform_coordinates, scale_lines, scale_sizes, use_path_cache))
         requestRedraw(true);
 }
 
+void Tiger_Scene::snapshotDrawState(int slot)
+{
+    DrawState& s = draw_state[slot];
+    s.transform = camera.getTransform().stageTransform<f128>();
+    s.transform_coordinates = transform_coordinates;
+    s.scale_lines = scale_lines;
+    s.scale_sizes = scale_sizes;
+    s.use_path_cache = use_path_cache;
+}
+
 void Tiger_Scene::viewportDraw(Viewport* ctx) const
 {
-    ctx->transform(camera.getTransform());
+    // may run while the worker processes the next frame, read only the snapshot
+    const DrawState& s = draw_state[drawSlot()];
+
+    ctx->transform(s.transform);
     ctx->drawWorldAxis();
 
-    ctx->worldCoordinates(transform_coordinates);
-    ctx->scalingLines(scale_lines);
-    ctx->scalingSizes(scale_sizes);
+    ctx->worldCoordinates(s.transform_coordinates);
+    ctx->scalingLines(s.scale_lines);
+    ctx->scalingSizes(s.scale_sizes);
 
-    draw_tiger(ctx);
+    if (s.use_path_cache)
+        ctx->drawPathCache(tiger_paths);
+    else
+        draw_tiger(ctx);
 }
 
 void Tiger_Scene::onEvent(Event e)
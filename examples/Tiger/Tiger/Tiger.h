@@ -11,10 +11,26 @@ struct Tiger_Scene : public Scene<Tiger_Scene>
     bool scale_lines = true;
     bool scale_sizes = true;
     bool rotate_text = true;
+    bool use_path_cache = true;
 
     CameraInfo       camera;
     CameraNavigator  navigator;
 
+    // tiger recorded once, re-flattened only when the zoom changes enough (only touched when drawing)
+    mutable PathCache tiger_paths;
+
+    // everything viewportDraw() reads, copied per published frame so drawing can overlap processing
+    struct DrawState
+    {
+        DDMat3 transform = DDMat3(f128{ 1 });
+        bool transform_coordinates = true;
+        bool scale_lines = true;
+        bool scale_sizes = true;
+        bool use_path_cache = true;
+    };
+
+    DrawState draw_state[SharedSync::max_pipeline_depth];
+
     /// ─────── Provide default Scene launch config ─────── 
     struct Config { 
         // double speed = 10;
@@ -45,6 +61,10 @@ struct Tiger_Scene : public Scene<Tiger_Scene>
     void viewportProcess(Viewport* ctx, double dt) override;
     void viewportDraw(Viewport* ctx) const override;
 
+    /// ─────── Pipelined drawing ─────── 
+    bool supportsPipelinedDraw() const override { return true; }
+    void snapshotDrawState(int slot) override;
+
     /// ─────── Input handling ─────── 
     void onEvent(Event e) override;
 };
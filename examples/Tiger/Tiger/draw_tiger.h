@@ -1,5 +1,6 @@
 // Auto-generated from SVG: tiger.svg
-void draw_tiger(bl::Painter* ctx) {
+template<class PainterT> // bl::Painter, or bl::PathCache to record it
+void draw_tiger(PainterT* ctx) {
     auto path_0 = [&]() {
         ctx->beginPath();
         ctx->moveTo(108.969, 403.827);
@@ -3,6 +3,8 @@
 #include "debug.h"
 #include "input.h"
 #include <bitloop/util/math_util.h>
+#include <bitloop/util/fltx/f128_simd.h>
+#include <bitloop/core/threads.h>
 
 BL_BEGIN_NS
 
@@ -42,6 +44,7 @@ class Event;
 template<class T> concept is_f32  = std::is_same_v<T, f32>;
 template<class T> concept is_f64  = std::is_same_v<T, f64>;
 template<class T> concept is_f128 = std::is_same_v<T, f128>;
+template<class T> concept is_floatexp = std::is_same_v<T, floatexp>;
 
 class WorldStageTransform
 {
@@ -130,6 +133,64 @@ public:
     template<class T = f64> requires is_f64<T>  [[nodiscard]] DVec2 toStage(DVec2 p)  const { return m64.mulPoint(p); }
     template<class T>       requires is_f128<T> [[nodiscard]] DVec2 toStage(DDVec2 p) const { return static_cast<DVec2>(m128.mulPoint(p)); }
 
+    // ────── toStage (batch) ──────
+    // Affine toStage() for 'n' points in packed lanes (f128 lanes match the scalar result bit-for-bit)
+    template<class T = f64> requires is_f64<T>
+    void toStage(const DVec2* world, DVec2* stage, size_t n) const
+    {
+        using D = simd2::dvec4;
+        constexpr int L = D::lanes;
+
+        const typename D::V va = D::set1(m64(0, 0)), vb = D::set1(m64(0, 1)), vc = D::set1(m64(0, 2));
+        const typename D::V vd = D::set1(m64(1, 0)), ve = D::set1(m64(1, 1)), vf = D::set1(m64(1, 2));
+
+        size_t i = 0;
+        for (; i + L <= n; i += L)
+        {
+            double x[L], y[L];
+            for (int l = 0; l < L; l++) { x[l] = world[i + l].x; y[l] = world[i + l].y; }
+
+            const typename D::V vx = D::load(x), vy = D::load(y);
+            D::store(x, D::add(D::add(D::mul(va, vx), D::mul(vb, vy)), vc));
+            D::store(y, D::add(D::add(D::mul(vd, vx), D::mul(ve, vy)), vf));
+
+            for (int l = 0; l < L; l++) stage[i + l] = { x[l], y[l] };
+        }
+
+        for (; i < n; i++)
+            stage[i] = toStage<f64>(world[i]);
+    }
+
+    template<class T> requires is_f128<T>
+    void toStage(const DDVec2* world, DVec2* stage, size_t n) const
+    {
+        using V = simd2::f128xN;
+        constexpr int L = V::lanes;
+
+        const V a = V::broadcast(m128(0, 0)), b = V::broadcast(m128(0, 1)), c = V::broadcast(m128(0, 2));
+        const V d = V::broadcast(m128(1, 0)), e = V::broadcast(m128(1, 1)), f = V::broadcast(m128(1, 2));
+
+        size_t i = 0;
+        for (; i + L <= n; i += L)
+        {
+            double xh[L], xl[L], yh[L], yl[L];
+            for (int l = 0; l < L; l++)
+            {
+                xh[l] = world[i + l].x.hi; xl[l] = world[i + l].x.lo;
+                yh[l] = world[i + l].y.hi; yl[l] = world[i + l].y.lo;
+            }
+
+            const V x = V::load(xh, xl), y = V::load(yh, yl);
+            (a * x + b * y + c).store(xh, xl);
+            (d * x + e * y + f).store(yh, yl);
+
+            for (int l = 0; l < L; l++) stage[i + l] = { xh[l] + xl[l], yh[l] + yl[l] };
+        }
+
+        for (; i < n; i++)
+            stage[i] = toStage<f128>(world[i]);
+    }
+
     // ────── toWorld ──────                                                                            
     template<class T>       requires is_f32<T>  [[nodiscard]] Vec2<T> toWorld(f64 sx, f64 sy)  const { return static_cast<FVec2>(  inv_m64.mulPoint({ sx, sy }) ); }
     template<class T = f64> requires is_f64<T>  [[nodiscard]] Vec2<T> toWorld(f64 sx, f64 sy)  const { return static_cast<DVec2>(  inv_m64.mulPoint({ sx, sy }) ); }
@@ -143,12 +204,22 @@ public:
     template<class T>       requires is_f32<T> [[nodiscard]] DVec2 toStageOffset(FVec2 o)   const { return static_cast<DVec2>( m64.mulVector(DVec2{(f64)o.x, (f64)o.y})); }
     template<class T = f64> requires is_f64<T> [[nodiscard]] DVec2 toStageOffset(DVec2 o)   const { return static_cast<DVec2>( m64.mulVector(o)); }
     template<class T>       requires is_f128<T> [[nodiscard]] DVec2 toStageOffset(DDVec2 o) const { return static_cast<DVec2>( m128.mulVector(o)); }
+    template<class T>       requires is_floatexp<T> [[nodiscard]] DVec2 toStageOffset(Vec2<floatexp> o) const {
+        return static_cast<DVec2>(Vec2<floatexp>{ floatexp(m128(0, 0)) * o.x + floatexp(m128(0, 1)) * o.y,
+                                                  floatexp(m128(1, 0)) * o.x + floatexp(m128(1, 1)) * o.y });
+    }
 
     // ────── stageToWorldOffset ──────                                                                 
     template<class T>       requires is_f32<T> [[nodiscard]] FVec2 toWorldOffset(DVec2 o)   const { return static_cast<FVec2>(  inv_m64.mulVector(o) ); }
     template<class T = f64> requires is_f64<T> [[nodiscard]] DVec2 toWorldOffset(DVec2 o)   const { return static_cast<DVec2>(  inv_m64.mulVector(o) ); }
     template<class T>       requires is_f128<T> [[nodiscard]] DDVec2 toWorldOffset(DVec2 o) const { return static_cast<DDVec2>( inv_m128.mulVector(DDVec2{f128{o.x}, f128{o.y}}) ); }
 
+    // pixel -> world deltas that keep their exponent however deep the zoom (e.g. perturbation dc steps)
+    template<class T>       requires is_floatexp<T> [[nodiscard]] Vec2<floatexp> toWorldOffset(DVec2 o) const {
+        return { floatexp(inv_m128(0, 0)) * o.x + floatexp(inv_m128(0, 1)) * o.y,
+                 floatexp(inv_m128(1, 0)) * o.x + floatexp(inv_m128(1, 1)) * o.y };
+    }
+
     template<typename T=f64>
     [[nodiscard]] Vec2<T> toWorldOffset(f64 sx, f64 sy) const {
         return toWorldOffset<T>({ sx, sy });
@@ -306,7 +377,10 @@ class CameraInfo
     // rather than return a new transform with each const getTransform call, reset and rebuild when dirty
     mutable bool is_dirty = false;
     mutable WorldStageTransform* t = nullptr;
-    void dirty() { is_dirty = true; }
+    void dirty() { is_dirty = true; change_token.cancel(); }
+
+    // tripped on every view change so in-flight raster work for the old view can be abandoned
+    Thread::CancellationToken change_token;
 
     // helpers for updating cache variables and flagging transform as dirty
     void posDirty()  { pos_64 = (DVec2)pos_128; dirty(); }
@@ -326,6 +400,9 @@ public:
     void setSurface(SurfaceInfo* s) { surface = s; }
     const WorldStageTransform& getTransform() const;
 
+    // pass to raster traversals (e.g. forEachWorldTilePixel) to stop them once the view changes
+    [[nodiscard]] const Thread::CancellationToken& changeToken() const { return change_token; }
+
     // ─────── f64 getters ────────────────────────────────────────────────────────────────────────────────────────────────
     [[nodiscard]] constexpr f64 panX()       const  { return pan_x; }
     [[nodiscard]] constexpr f64 panY()       const  { return pan_y; }
@@ -347,12 +424,15 @@ public:
     template<class T>       requires is_f32<T>  [[nodiscard]] constexpr f32    zoom() const { return (f32)zoom_64; }
     template<class T = f64> requires is_f64<T>  [[nodiscard]] constexpr f64    zoom() const { return zoom_64; }
     template<class T>       requires is_f128<T> [[nodiscard]] constexpr f128   zoom() const { return zoom_128; }
+    template<class T>       requires is_floatexp<T> [[nodiscard]] constexpr floatexp zoom() const { return floatexp(zoom_128); }
 
     /// includes stretch
     template<class T = f64> requires is_f64<T>  [[nodiscard]] constexpr f64    zoomX() const { return zoom_x_64; } 
     template<class T>       requires is_f128<T> [[nodiscard]] constexpr f128   zoomX() const { return zoom_x; }   
     template<class T = f64> requires is_f64<T>  [[nodiscard]] constexpr f64    zoomY() const { return zoom_y_64; }
     template<class T>       requires is_f128<T> [[nodiscard]] constexpr f128   zoomY() const { return zoom_y; }   
+    template<class T>       requires is_floatexp<T> [[nodiscard]] constexpr floatexp zoomX() const { return floatexp(zoom_x); }
+    template<class T>       requires is_floatexp<T> [[nodiscard]] constexpr floatexp zoomY() const { return floatexp(zoom_y); }
 
     // ─────── f128 setters ───────────────────────────────────────────────────────────────────────────────────────────────
     bool setX(f128 x)           { if (x_128 != x)        { x_128 = x;         posDirty();  return true; }  return false; }
@@ -365,6 +445,7 @@ public:
     bool setX(f64 x)            { if (x_64  != x)        { x_128  = x;        posDirty();  return true; }  return false; }
     bool setY(f64 y)            { if (y_64  != y)        { y_128  = y;        posDirty();  return true; }  return false; }
     bool setZoom(f64 z)         { if (zoom_64 != z)      { zoom_128 = z;      zoomDirty(); return true; }  return false; }
+    bool setZoom(floatexp z)    { return setZoom(static_cast<f128>(z)); } // saturates to the f128 range
     bool setStretchX(f64 x)     { if (sx_64 != x)        { sx_64 = x;         zoomDirty(); return true; }  return false; }
     bool setStretchY(f64 y)     { if (sy_64 != y)        { sy_64 = y;         zoomDirty(); return true; }  return false; }
     bool setStretch(DVec2 s)    { if (stretch_64 != s)   { stretch_64 = s;    zoomDirty(); return true; }  return false; }                                                                                              
@@ -259,6 +259,9 @@ class CaptureManager
     std::atomic<bool> encoder_busy{ false };
     std::atomic<bool> finalize_requested{ false };
 
+    // frames queued for asynchronous GPU readback, not yet submitted to the encoder
+    std::atomic<int>  frames_in_readback{ 0 };
+
     // sim worker waits on this to know encoder is ready for a new frame
     std::condition_variable encoder_ready_cond;
     std::mutex              encoder_ready_mutex;
@@ -340,10 +343,18 @@ public:
     // sim worker calls this avoid triggering a draw a frame until ffmpeg worker is ready for it
     void  waitUntilReadyForNewFrame();
 
+    // GUI reserves a frame while its pixels are read back asynchronously, sim worker waits until
+    // fewer than 'max_in_flight' frames are reserved before processing another captured frame
+    void  beginFrameReadback()            { frames_in_readback.fetch_add(1, std::memory_order_acq_rel); }
+    void  endFrameReadback();
+    void  waitForFrameReadbackSlot(int max_in_flight);
+    int   framesInReadback() const        { return frames_in_readback.load(std::memory_order_acquire); }
+
     // ────── [start capture] => [encode frames] => [finalize capture] ──────
 
     bool startCapture(CaptureConfig _config);
     bool encodeFrame(const EncodeFrame& frame);
+    bool submitFrame(EncodeFrame& frame); // as encodeFrame, but takes the frame's buffers instead of copying
     void finalizeCapture();
 
 };
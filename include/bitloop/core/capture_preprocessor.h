@@ -43,6 +43,9 @@ public:
     // internal output GL_TEXTURE_2D. Valid after any successful internal-output preprocess call
     uint32_t outputTexture() const { return output_tex; }
 
+    // framebuffer with outputTexture() attached, e.g. for an asynchronous readback
+    uint32_t outputFramebuffer() const { return fbo_out; }
+
     // internal output resolution
     IVec2 outputResolution() const { return target_size; }
 
@@ -0,0 +1,46 @@
+#pragma once
+#include <bitloop/util/cpu_dispatch.h>
+#include <bitloop/core/types.h>
+
+#include <cstddef>
+#include <cstdint>
+
+BL_BEGIN_NS;
+
+namespace detail { template<typename WorldT> struct WorldScan; } // raster_grid.h
+
+// Hot kernels compiled once per CpuLevel (src/core/cpu_kernels.cpp). Every variant runs the same
+// operation sequence, so results are bit-identical whichever level is active - only throughput
+// changes. Fetch the table once per batch, not per element:
+//
+//   const CpuKernels& k = cpuKernels();
+//   k.world_row_f128(scan, row, x0, x1, wx, wy);
+//
+// Used by the WorldRasterGridT traversals (row coordinates) and ImGradient::mapRGBA (colour mapping).
+struct CpuKernels
+{
+    CpuLevel level;
+
+    // out[i] = a[i] op b[i] for i in [0, n)
+    void (*f128_add)(const f128* a, const f128* b, f128* out, size_t n);
+    void (*f128_sub)(const f128* a, const f128* b, f128* out, size_t n);
+    void (*f128_mul)(const f128* a, const f128* b, f128* out, size_t n);
+    void (*f128_div)(const f128* a, const f128* b, f128* out, size_t n);
+    void (*f128_sqrt)(const f128* a, f128* out, size_t n);
+
+    // pixel-centre world coordinates of raster row 'row' for x in [x0, x1), written to wx/wy[x - x0]
+    // (same values the world traversals pass to their callbacks)
+    void (*world_row_f64)(const detail::WorldScan<f64>& scan, int row, int x0, int x1, f64* wx, f64* wy);
+    void (*world_row_f128)(const detail::WorldScan<f128>& scan, int row, int x0, int x1, f128* wx, f128* wy);
+
+    // out[i] = lut[round(t[i] * (lut_size - 1))], t clamped to [0, 1] (NaN -> lut[0])
+    void (*map_colors)(const float* t, uint32_t* out, size_t n, const uint32_t* lut, int lut_size);
+};
+
+// kernels for the active cpuLevel()
+[[nodiscard]] const CpuKernels& cpuKernels();
+
+// kernels for a specific level, nullptr if this CPU can't run it
+[[nodiscard]] const CpuKernels* cpuKernelsFor(CpuLevel level);
+
+BL_END_NS;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <deque>
 
 #include <bitloop/core/threads.h>
 #include <bitloop/core/project.h>
@@ -71,7 +72,9 @@ class MainWindow
     using time_point   = std::chrono::steady_clock::time_point;
     using steady_clock = std::chrono::steady_clock;
 
-    FPSTimer             worker_fps_timer;
+    FPSTimer             worker_fps_timer; // GUI draws of worker frames
+    FPSTimer             pacer_fps_timer{ 30 }; // worker frame intervals, as measured by its FramePacer
+    FrameHandoffStats    handoff_stats; // copied from shared_sync each GUI frame
     time_point           last_frame_time = steady_clock::now();
 
     // fonts
@@ -139,6 +142,17 @@ class MainWindow
     EncodeFrame          preprocessed_frame; // intermediate buffer for preprocessor output (rescaled, sharpened, etc before encoding)
     bool                 use_preprocessor_texture = false;
 
+    // captured frames still being read back from the GPU, with the metadata they were captured with (oldest first)
+    struct PendingCaptureFrame
+    {
+        int              request_id;
+        CapturePreset    preset;
+        std::string      payload; // filled by onEncodeFrame() when the frame was captured
+    };
+
+    PixelReadbackRing    frame_readback;
+    std::deque<PendingCaptureFrame> pending_capture_frames;
+
     // thread communication
     SharedSync&          shared_sync;
     ThreadQueue          thread_queue;
@@ -173,6 +187,7 @@ public:
     [[nodiscard]] CaptureManager*              getCaptureManager() { return &capture_manager; }
     [[nodiscard]] SettingsConfig*              getSettingsConfig() { return &settings_panel.getConfig(); }
     [[nodiscard]] const SettingsConfig*        getSettingsConfig() const { return &settings_panel.getConfig(); }
+    [[nodiscard]] SharedSync&                  sharedSync() { return shared_sync; }
     [[nodiscard]] SnapshotPresetManager*       getSnapshotPresetManager() { return &settings_panel.getConfig().snapshot_preset_manager; }
     [[nodiscard]] const SnapshotPresetManager* getSnapshotPresetManager() const { return &settings_panel.getConfig().snapshot_preset_manager; }
 
@@ -182,6 +197,7 @@ public:
     }
 
     int getFPS() const { return getSettingsConfig()->record_fps; }
+    int getPipelineDepth() const { return getSettingsConfig()->pipeline_depth; }
     void setFixedFrameTimeDelta(bool b) { getSettingsConfig()->fixed_time_delta = b; }
     bool isFixedFrameTimeDelta() const { return getSettingsConfig()->fixed_time_delta; }
 
@@ -224,6 +240,9 @@ public:
     void endRecording();
     void checkCaptureComplete();
 
+    // hand finished readbacks to the encoder (oldest first), 'wait' blocks until all are done
+    void completeFrameReadbacks(bool wait, bool state_locked = false);
+
     void captureFrame(bool b) { permit_frame_capture = b; }
     bool capturingNextFrame() const { return permit_frame_capture; }
     bool capturedLastFrame() const { return captured_last_frame; }
@@ -0,0 +1,207 @@
+#pragma once
+#include <bitloop/core/raster_grid.h>
+#include <bitloop/core/types.h>
+
+#include <vector>
+#include <atomic>
+
+BL_BEGIN_NS;
+
+// Perturbation rendering for escape-time fractals past f64 precision.
+//
+// A single reference orbit Z_n is iterated in high precision (RefT) at the view centre and stored
+// rounded to double. Each pixel then iterates only its offset dz_n = z_n - Z_n from the reference
+// in DeltaT (double by default), so per-pixel cost no longer depends on the zoom depth.
+//
+// Glitches (the delta losing all precision because z_n passes close to 0, or the reference escaping
+// before the pixel does) are detected per iteration and resolved by rebasing: when |z| < |dz| or
+// the reference orbit runs out, the pixel continues from dz = z against the start of the same
+// reference (Z_0 = 0). This avoids the need for secondary references.
+//
+// A formula supplies both iterations, e.g.:
+//
+//   struct MandelbrotFormula
+//   {
+//       // full-precision step, used for the reference orbit
+//       template<typename T> Complex<T> step(const Complex<T>& z, const Complex<T>& c) const { return z * z + c; }
+//
+//       // delta step: z_{n+1} - Z_{n+1} expressed in the reference Z_n, the delta dz_n and dc
+//       template<typename D> Complex<D> perturb(const Complex<D>& Z, const Complex<D>& dz, const Complex<D>& dc) const {
+//           return (Z + Z + dz) * dz + dc;
+//       }
+//   };
+//
+// Formulas must start from z_0 = 0 (Mandelbrot-like families) for rebasing to be valid.
+
+struct MandelbrotFormula
+{
+    template<typename T>
+    [[nodiscard]] Complex<T> step(const Complex<T>& z, const Complex<T>& c) const
+    {
+        return z * z + c;
+    }
+
+    // (Z + dz)^2 + (C + dc) - (Z^2 + C) = (2Z + dz) * dz + dc
+    template<typename D>
+    [[nodiscard]] Complex<D> perturb(const Complex<D>& Z, const Complex<D>& dz, const Complex<D>& dc) const
+    {
+        return (Z + Z + dz) * dz + dc;
+    }
+};
+
+struct PerturbationResult
+{
+    int    iter;     // iterations completed (== max_iter when the pixel didn't escape)
+    double mag2;     // |z|^2 at the final iteration (for smooth colouring)
+    bool   escaped;
+};
+
+struct PerturbationStats
+{
+    uint64_t reference_orbits = 0; // reference recomputes
+    int      reference_length = 0; // iterations before the reference escaped (or max_iter)
+    uint64_t rebases = 0;          // glitch rebases over the last render call
+};
+
+template<typename RefT = f128, typename DeltaT = f64>
+class PerturbationEngine
+{
+    Complex<RefT> ref_c{ RefT{0}, RefT{0} };
+    std::vector<Complex<DeltaT>> orbit; // Z_0 .. Z_n, rounded to DeltaT
+
+    int    ref_max_iter = -1;
+    double ref_bailout2 = 0;
+    bool   dirty = true;
+
+    PerturbationStats stats;
+
+public:
+
+    // force a new reference on the next render (e.g. formula parameters changed)
+    void invalidate() { dirty = true; }
+
+    [[nodiscard]] const PerturbationStats& getStats() const      { return stats; }
+    [[nodiscard]] const Complex<RefT>&     referencePoint() const { return ref_c; }
+    [[nodiscard]] int                      referenceLength() const { return (int)orbit.size() - 1; }
+
+    // Iterate the reference orbit at 'c' in RefT until it escapes 'bailout2' or reaches max_iter
+    template<typename Formula>
+    void computeReference(const Formula& formula, const Complex<RefT>& c, int max_iter, double bailout2 = 4.0)
+    {
+        ref_c = c;
+        ref_max_iter = max_iter;
+        ref_bailout2 = bailout2;
+        dirty = false;
+
+        orbit.clear();
+        orbit.reserve(max_iter + 1);
+
+        Complex<RefT> z{ RefT{0}, RefT{0} };
+        orbit.push_back(static_cast<Complex<DeltaT>>(z));
+
+        for (int i = 0; i < max_iter; ++i)
+        {
+            z = formula.step(z, c);
+            orbit.push_back(static_cast<Complex<DeltaT>>(z));
+
+            if (static_cast<double>(z.mag2()) > bailout2)
+                break;
+        }
+
+        stats.reference_orbits++;
+        stats.reference_length = referenceLength();
+    }
+
+    // Does the current reference still serve this view? (it only has to lie inside it)
+    template<typename GridT>
+    [[nodiscard]] bool referenceValidFor(const GridT& grid, int max_iter, double bailout2 = 4.0) const
+    {
+        if (dirty || orbit.empty() || max_iter != ref_max_iter || bailout2 != ref_bailout2)
+            return false;
+
+        const Quad<RefT> q = static_cast<Quad<RefT>>(grid.worldQuad());
+        const RefT min_x = std::min(std::min(q.a.x, q.b.x), std::min(q.c.x, q.d.x));
+        const RefT max_x = std::max(std::max(q.a.x, q.b.x), std::max(q.c.x, q.d.x));
+        const RefT min_y = std::min(std::min(q.a.y, q.b.y), std::min(q.c.y, q.d.y));
+        const RefT max_y = std::max(std::max(q.a.y, q.b.y), std::max(q.c.y, q.d.y));
+
+        return ref_c.x >= min_x && ref_c.x <= max_x &&
+               ref_c.y >= min_y && ref_c.y <= max_y;
+    }
+
+    // Iterate one pixel at offset 'dc' from the reference point
+    template<typename Formula>
+    [[nodiscard]] PerturbationResult iteratePixel(const Formula& formula, const Complex<DeltaT>& dc, int max_iter, uint64_t& rebases) const
+    {
+        const int ref_len = referenceLength();
+        const DeltaT bailout2 = DeltaT{ ref_bailout2 };
+
+        Complex<DeltaT> dz{ DeltaT{0}, DeltaT{0} };
+        int m = 0; // index into the reference orbit
+
+        for (int i = 0; i < max_iter; ++i)
+        {
+            dz = formula.perturb(orbit[m], dz, dc);
+            ++m;
+
+            const Complex<DeltaT> z = orbit[m] + dz;
+            const DeltaT z_mag2 = z.mag2();
+
+            if (z_mag2 > bailout2)
+                return { i + 1, static_cast<double>(z_mag2), true };
+
+            // glitch: delta dominates the full value (or the reference escaped), rebase onto Z_0
+            if (z_mag2 < dz.mag2() || m == ref_len)
+            {
+                dz = z;
+                m = 0;
+                ++rebases;
+            }
+        }
+
+        const Complex<DeltaT> z = orbit[m] + dz;
+        return { max_iter, static_cast<double>(z.mag2()), false };
+    }
+
+    // Render every pixel of 'grid' with progressive/budgeted traversal (see forEachWorldTilePixel).
+    // The reference is recomputed at the view centre when it no longer serves the view.
+    //
+    //   store: void(int x, int y, const PerturbationResult& r)
+    template<typename GridT, typename Formula, typename Store>
+    bool render(
+        GridT& grid,
+        TileBlockProgress& P,
+        const Formula& formula,
+        int max_iter,
+        Store&& store,
+        double bailout2 = 4.0,
+        int tile_w = 64, int tile_h = 64,
+        int thread_count = Thread::threadCount(),
+        int budget_ms = 16,
+        const Thread::CancellationToken* cancel = nullptr)
+    {
+        if (!referenceValidFor(grid, max_iter, bailout2))
+        {
+            const Quad<RefT> q = static_cast<Quad<RefT>>(grid.worldQuad());
+            const RefT half{ 0.5 };
+            computeReference(formula, Complex<RefT>{ (q.a.x + q.c.x) * half, (q.a.y + q.c.y) * half }, max_iter, bailout2);
+        }
+
+        std::atomic<uint64_t> rebases{ 0 };
+
+        const bool finished = grid.template forEachWorldTilePixel<RefT>(tile_w, tile_h, P,
+            [&](int x, int y, const RefT& wx, const RefT& wy)
+        {
+            uint64_t pixel_rebases = 0;
+            const Complex<DeltaT> dc{ static_cast<DeltaT>(wx - ref_c.x), static_cast<DeltaT>(wy - ref_c.y) };
+            store(x, y, iteratePixel(formula, dc, max_iter, pixel_rebases));
+
+            if (pixel_rebases) rebases.fetch_add(pixel_rebases, std::memory_order_relaxed);
+        }, thread_count, budget_ms, 64, 8, cancel);
+
+        stats.rebases = rebases.load(std::memory_order_relaxed);
+        return finished;
+    }
+};
+
+BL_END_NS;
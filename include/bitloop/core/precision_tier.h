@@ -0,0 +1,178 @@
+#pragma once
+#include <bitloop/core/types.h>
+#include <bitloop/core/raster_grid.h>
+#include <bitloop/util/constexpr_dispatch.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+BL_BEGIN_NS
+
+// significant bits carried by each FloatingPointType
+[[nodiscard]] constexpr int mantissaBits(FloatingPointType type)
+{
+    switch (type)
+    {
+    case FloatingPointType::F32:  return 24;
+    case FloatingPointType::F64:  return 53;
+    case FloatingPointType::F128: return 106;
+    default:                      return 0;
+    }
+}
+
+[[nodiscard]] constexpr const char* floatingPointTypeName(FloatingPointType type)
+{
+    switch (type)
+    {
+    case FloatingPointType::F32:  return "f32";
+    case FloatingPointType::F64:  return "f64";
+    case FloatingPointType::F128: return "f128";
+    default:                      return "?";
+    }
+}
+
+// Latest PrecisionTierSelector::update() of any selector, shown in the debug UI ("Render" tab).
+// Written by the selector (worker thread), read on the GUI thread.
+struct PrecisionTierReport
+{
+    std::atomic<int>      tier{ -1 };          // FloatingPointType, -1 until a selector has been updated
+    std::atomic<int>      required_bits{ 0 };
+    std::atomic<bool>     exhausted{ false };
+    std::atomic<uint64_t> switches{ 0 };       // tier changes across all selectors
+};
+
+[[nodiscard]] inline PrecisionTierReport& precisionTierReport()
+{
+    static PrecisionTierReport report;
+    return report;
+}
+
+// Picks the cheapest FloatingPointType that can still resolve individual pixels of the current view,
+// and invokes a scene kernel instantiated for it (via table_invoke). Moving to a wider type happens
+// as soon as it's required, narrowing back only once the narrower type has 'hysteresis_bits' spare,
+// so zooming around a tier boundary doesn't flip-flop between instantiations.
+//
+//   tier.update(grid);
+//   tier.dispatch([&]<typename T>() {
+//       grid.forEachWorldTilePixel<T>(64, 64, progress, [&](int x, int y, T wx, T wy) { ... });
+//   });
+class PrecisionTierSelector
+{
+    FloatingPointType current = FloatingPointType::F64;
+    FloatingPointType min_type = FloatingPointType::F32;
+    FloatingPointType max_type = FloatingPointType::F128;
+
+    int guard_bits = 8;      // headroom for the kernel's own rounding (e.g. iterated error growth)
+    int hysteresis_bits = 4; // spare bits required before dropping to a narrower type
+
+    int required_bits = 0;
+    bool exhausted = false;  // even max_type can't resolve a pixel
+    uint64_t switches = 0;
+
+    [[nodiscard]] static constexpr int index(FloatingPointType t) { return static_cast<int>(t); }
+
+public:
+
+    PrecisionTierSelector() = default;
+    PrecisionTierSelector(FloatingPointType min, FloatingPointType max) { setRange(min, max); }
+
+    // restrict to the types the scene's kernel supports/needs
+    void setRange(FloatingPointType min, FloatingPointType max)
+    {
+        min_type = min;
+        max_type = max;
+        if (index(current) < index(min_type)) current = min_type;
+        if (index(current) > index(max_type)) current = max_type;
+    }
+
+    void setGuardBits(int bits)      { guard_bits = std::max(bits, 0); }
+    void setHysteresisBits(int bits) { hysteresis_bits = std::max(bits, 0); }
+
+    [[nodiscard]] FloatingPointType tier() const         { return current; }
+    [[nodiscard]] int               requiredBits() const { return required_bits; }
+    [[nodiscard]] bool              precisionExhausted() const { return exhausted; }
+    [[nodiscard]] uint64_t          switchCount() const  { return switches; }
+    [[nodiscard]] int guardBits() const      { return guard_bits; }
+    [[nodiscard]] int hysteresisBits() const { return hysteresis_bits; }
+
+    // Bits needed to tell apart neighbouring pixels 'pixel_world_size' apart at coordinates up to 'coord_magnitude'
+    [[nodiscard]] static int bitsToResolve(f128 coord_magnitude, f128 pixel_world_size)
+    {
+        const double mag = static_cast<double>(abs(coord_magnitude));
+        const double px  = static_cast<double>(abs(pixel_world_size));
+        if (!(px > 0.0)) return std::numeric_limits<int>::max() / 2;
+        if (mag <= px)   return 1;
+        return static_cast<int>(std::ceil(std::log2(mag / px)));
+    }
+
+    FloatingPointType update(f128 coord_magnitude, f128 pixel_world_size)
+    {
+        required_bits = bitsToResolve(coord_magnitude, pixel_world_size) + guard_bits;
+
+        // cheapest sufficient type in range
+        FloatingPointType wanted = max_type;
+        for (int i = index(min_type); i <= index(max_type); ++i)
+        {
+            if (mantissaBits(FloatingPointType(i)) >= required_bits)
+            {
+                wanted = FloatingPointType(i);
+                break;
+            }
+        }
+        exhausted = mantissaBits(max_type) < required_bits;
+
+        const bool widen  = index(wanted) > index(current);
+        const bool narrow = index(wanted) < index(current) &&
+            mantissaBits(FloatingPointType(index(current) - 1)) >= required_bits + hysteresis_bits;
+
+        if (widen || narrow)
+        {
+            // when narrowing, step down as far as the hysteresis margin allows
+            FloatingPointType next = wanted;
+            if (narrow)
+            {
+                next = current;
+                while (index(next) > index(wanted) &&
+                       mantissaBits(FloatingPointType(index(next) - 1)) >= required_bits + hysteresis_bits)
+                    next = FloatingPointType(index(next) - 1);
+            }
+
+            current = next;
+            switches++;
+            precisionTierReport().switches.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        PrecisionTierReport& report = precisionTierReport();
+        report.required_bits.store(required_bits, std::memory_order_relaxed);
+        report.exhausted.store(exhausted, std::memory_order_relaxed);
+        report.tier.store(index(current), std::memory_order_relaxed);
+        return current;
+    }
+
+    // derive coordinate magnitude and pixel size from the grid's world quad and raster resolution
+    template<typename T>
+    FloatingPointType update(const WorldRasterGridT<T>& grid)
+    {
+        const Quad<f128> q = static_cast<Quad<f128>>(grid.worldQuad());
+
+        f128 mag = f128{ 0 };
+        for (const Vec2<f128>& p : { q.a, q.b, q.c, q.d })
+            mag = std::max(mag, std::max(abs(p.x), abs(p.y)));
+
+        const f128 px_w = (q.b - q.a).mag() / f128{ (double)std::max(grid.rasterWidth(), 1) };
+        const f128 px_h = (q.d - q.a).mag() / f128{ (double)std::max(grid.rasterHeight(), 1) };
+        return update(mag, std::min(px_w, px_h));
+    }
+
+    // invoke kernel.template operator()<T>() with T the current tier's type
+    template<typename Kernel>
+    decltype(auto) dispatch(Kernel&& kernel) const
+    {
+        return table_invoke(std::forward<Kernel>(kernel), current);
+    }
+
+    void populateUI();
+};
+
+BL_END_NS
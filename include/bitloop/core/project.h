@@ -10,6 +10,7 @@
 #include <bitloop/core/interface_model.h>
 #include <bitloop/core/snapshot_presets.h>
 #include <bitloop/core/capture_manager.h>
+#include <bitloop/core/threads.h>
 #include <bitloop/imguix/imguix.h>
 
 #include "input.h"
@@ -202,6 +203,7 @@ class ProjectBase
     SimpleTimer project_timer;
     SimpleTimer scene_timer;
     SimpleTimer frame_timer;
+    SimpleTimer viewport_timer;
 
     double      project_dt = 0;
     double      frame_dt = 0;
@@ -212,6 +214,13 @@ class ProjectBase
     Viewport* ctx_focused = nullptr;
     Viewport* ctx_hovered = nullptr;
 
+    // Focus as seen by each published frame (worker writes in _snapshotDrawState, GUI reads in _projectDraw).
+    // The flash countdown itself (Viewport::focused_dt) is only touched by the GUI.
+    bool focus_changed = false;
+    int  draw_focused_index[SharedSync::max_pipeline_depth]{ -1, -1, -1 };
+    bool draw_focus_flash[SharedSync::max_pipeline_depth]{};
+    std::atomic<bool> focus_flash_active{ false }; // GUI -> worker, keep the canvas dirty while flashing
+
 
     friend class ProjectWorker;
     friend class Layout;
@@ -251,12 +260,18 @@ protected:
     void _projectResume();
     void _projectDestroy();
     void _projectProcess();
-    void _projectDraw();
+    void _projectDraw(int frame_slot);
     void _onEndFrame(); // called after worker process & after gui render, just before next project process
 
+    // ----- pipelined frame handoff -----
+    [[nodiscard]] bool _supportsPipelinedDraw() const; // true if every scene snapshots its draw state
+    void _snapshotDrawState(int frame_slot);
+
     // ----- capturing -----
 
+    // when a frame is captured (live state matches the frame) / once its pixels have been read back
     void _onEncodeFrame(EncodeFrame& data, int request_id, const CapturePreset& preset);
+    void _onFrameReadBack(EncodeFrame& data, int request_id, const CapturePreset& preset);
 
     // ----- input -----
     std::vector<FingerInfo> pressed_fingers;
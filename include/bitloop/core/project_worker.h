@@ -2,6 +2,7 @@
 #include <bitloop/core/threads.h>
 #include <bitloop/core/types.h>
 #include <bitloop/core/snapshot_presets.h>
+#include <bitloop/util/frame_pacer.h>
 
 #include <SDL3/SDL.h>
 
@@ -51,6 +52,8 @@ class ProjectWorker
 
     ProjectBase* current_project = nullptr;
 
+    FramePacer frame_pacer; // worker thread only
+
     void _destroyActiveProject();
 
     void _onEvent(SDL_Event& e);
@@ -64,11 +67,12 @@ protected:
     friend class MainWindow;
     friend class ProjectBase;
 
-    void draw();
+    void draw(int frame_slot);
     void populateAttributes();
     void populateOverlay();
 
     void onEncodeFrame(EncodeFrame& data, int request_id, const CapturePreset& preset);
+    void onFrameReadBack(EncodeFrame& data, int request_id, const CapturePreset& preset);
 
 public:
 
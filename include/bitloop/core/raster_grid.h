@@ -3,7 +3,10 @@
 #include <bitloop/core/types.h>
 #include <bitloop/core/threads.h>
 #include <bitloop/core/camera.h>
+#include <bitloop/core/cpu_kernels.h>
 #include <bitloop/util/math_util.h>
+#include <bitloop/util/simd_wide.h>
+#include <bitloop/util/fltx/f128_simd.h>
 
 BL_BEGIN_NS;
 
@@ -13,6 +16,36 @@ struct TileBlock
     int x0, y0, x1, y1;
 };
 
+// Order in which micro-blocks are claimed (progressive renders resolve the first blocks first)
+enum struct BlockOrder
+{
+    RASTER,         // tile by tile, top to bottom
+    SPIRAL,         // outward ring by ring from the raster centre
+    FOCUS_DISTANCE, // nearest to the focus point first (e.g. the cursor)
+    HILBERT         // Hilbert curve over the raster (cache-friendly, no focus)
+};
+
+namespace detail
+{
+    // Hilbert index of (x, y) on an n*n grid (n a power of 2)
+    inline uint64_t hilbertIndex(uint32_t n, uint32_t x, uint32_t y)
+    {
+        uint64_t d = 0;
+        for (uint32_t s = n / 2; s > 0; s /= 2)
+        {
+            const uint32_t rx = (x & s) ? 1 : 0;
+            const uint32_t ry = (y & s) ? 1 : 0;
+            d += uint64_t(s) * s * ((3 * rx) ^ ry);
+            if (ry == 0)
+            {
+                if (rx == 1) { x = n - 1 - x; y = n - 1 - y; }
+                std::swap(x, y);
+            }
+        }
+        return d;
+    }
+}
+
 struct TileBlockProgress
 {
     // build params (to detect changes)
@@ -23,38 +56,198 @@ struct TileBlockProgress
 
     // one micro-block = one job
     std::vector<TileBlock> blocks;       // size = sum over tiles of ceil(tile_w/block_w)*ceil(tile_h/block_h)
-    std::atomic<int>  next_block{ 0 };   // global cursor (persists across frames)
+    std::atomic<int>  next_block{ 0 };   // global cursor (persists across frames), blocks before it are done
+
+    // claim order, blocks[order[i]] is the i'th block of a pass (blocks[] itself is never reordered)
+    std::vector<int> order;
+    BlockOrder order_mode = BlockOrder::RASTER;
+    double focus_x = 0, focus_y = 0; // raster px (FOCUS_DISTANCE)
+    std::vector<double> sort_keys;   // scratch for reorder_pending()
 
     // per-tile progress
     std::vector<uint32_t> blocks_total_per_tile;
     std::vector<uint32_t> blocks_done_per_tile; // incremented via atomic_ref
 
-    int owner_count = 0;            // threads used when plan was initialized
-    std::vector<int> owner_cursor;  // blocks consumed per owner (size = owner_count)
+    // cancellation (see Thread::CancellationToken)
+    uint64_t pass_generation = 0; // token snapshot the current pass is being rendered for
+    bool     cancelled = false;   // last call was abandoned, blocks rendered so far are stale
 
-    // call this when blocks (or thread_count) may have changed
-    void ensure_owner_slots(int threads) {
-        if (owner_count != threads || owner_cursor.size() != (size_t)threads) {
-            owner_count = threads;
-            owner_cursor.assign(threads, 0); // reset resume state (mapping changed)
-        }
+    // reset after the plan changes
+    void reset_progress_only() {
+        next_block.store(0, std::memory_order_relaxed);
+        std::fill(blocks_done_per_tile.begin(), blocks_done_per_tile.end(), 0u);
     }
 
-    // reset after completion
-    void reset_progress_only() {
-        std::fill(owner_cursor.begin(), owner_cursor.end(), 0);
+    // called by workers once every pixel of a block has been passed to the callback
+    void mark_block_done(int tile_index) {
+        std::atomic_ref<uint32_t>(blocks_done_per_tile[tile_index]).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool finished() const
+    {
+        return next_block.load(std::memory_order_relaxed) >= static_cast<int>(blocks.size());
+    }
+
+    // ======== Ordering ========
+    //
+    // Changing the order only re-sorts blocks that haven't been claimed yet, so it's cheap enough
+    // to call every frame (e.g. as the cursor moves) and never repeats or drops finished blocks.
+    // Call between traversal calls, not during one.
+
+    void set_order(BlockOrder mode)
+    {
+        if (order_mode == mode) return;
+        order_mode = mode;
+        reorder_pending();
+    }
+
+    void set_focus(double x, double y)
+    {
+        // ignore sub-block movement, it wouldn't change the order meaningfully
+        const double min_step = 0.5 * std::min(block_w, block_h);
+        if (std::abs(x - focus_x) < min_step && std::abs(y - focus_y) < min_step) return;
+
+        focus_x = x;
+        focus_y = y;
+        if (order_mode == BlockOrder::FOCUS_DISTANCE)
+            reorder_pending();
     }
 
-    bool finished()
+    void reorder_pending()
     {
         const int N = static_cast<int>(blocks.size());
-        bool ret = true;
-        for (int k = 0; k < owner_count; ++k) {
-            const int bi = k + owner_cursor[k] * owner_count;
-            if (bi < N) { ret = false; break; }
+        if (static_cast<int>(order.size()) != N)
+        {
+            order.resize(N);
+            for (int i = 0; i < N; ++i) order[i] = i;
+        }
+
+        const int first = std::clamp(next_block.load(std::memory_order_relaxed), 0, N);
+        if (first >= N) return;
+
+        if (order_mode == BlockOrder::RASTER)
+        {
+            std::sort(order.begin() + first, order.end());
+            return;
+        }
+
+        const double cx = 0.5 * bmp_w, cy = 0.5 * bmp_h;
+        const double unit = std::max(1, std::min(block_w, block_h));
+
+        uint32_t hilbert_n = 1;
+        while (hilbert_n < uint32_t(std::max(bmp_w, bmp_h) / unit) + 1) hilbert_n *= 2;
+
+        sort_keys.resize(N);
+        for (int k = first; k < N; ++k)
+        {
+            const TileBlock& b = blocks[order[k]];
+            const double bx = 0.5 * (b.x0 + b.x1);
+            const double by = 0.5 * (b.y0 + b.y1);
+
+            double key = 0;
+            switch (order_mode)
+            {
+            case BlockOrder::SPIRAL:
+            {
+                // ring (in block units), then angle within the ring
+                const double dx = (bx - cx) / std::max(1, block_w);
+                const double dy = (by - cy) / std::max(1, block_h);
+                const double ring = std::floor(std::max(std::abs(dx), std::abs(dy)));
+                key = ring + 0.999 * (std::atan2(dy, dx) + math::pi) * math::inv_tau;
+                break;
+            }
+            case BlockOrder::FOCUS_DISTANCE:
+            {
+                const double dx = bx - focus_x, dy = by - focus_y;
+                key = dx * dx + dy * dy;
+                break;
+            }
+            case BlockOrder::HILBERT:
+                key = double(detail::hilbertIndex(hilbert_n, uint32_t(bx / unit), uint32_t(by / unit)));
+                break;
+            default:
+                break;
+            }
+            sort_keys[order[k]] = key;
         }
-        return ret;
+
+        std::sort(order.begin() + first, order.end(), [&](int a, int b) {
+            return sort_keys[a] < sort_keys[b] || (sort_keys[a] == sort_keys[b] && a < b);
+        });
     }
+
+    // per-tile queries (only valid between traversal calls)
+    [[nodiscard]] bool tileFinished(int tile_index) const {
+        return blocks_done_per_tile[tile_index] == blocks_total_per_tile[tile_index];
+    }
+    [[nodiscard]] float tileProgress(int tile_index) const {
+        const uint32_t total = blocks_total_per_tile[tile_index];
+        return total ? float(blocks_done_per_tile[tile_index]) / float(total) : 1.0f;
+    }
+};
+
+// Row cursor for forEachWorldPixel, persists across frames like TileBlockProgress
+struct RowProgress
+{
+    int current_row = 0; // rows before it are done
+
+    // cancellation (see Thread::CancellationToken)
+    uint64_t pass_generation = 0; // token snapshot the current pass is being rendered for
+    bool     cancelled = false;   // last call was abandoned, rows rendered so far are stale
+};
+
+// Counters for forEachWorldPixelAdaptive (accumulated across calls until reset by the caller)
+struct AdaptiveFillStats
+{
+    std::atomic<uint64_t> evaluated{ 0 }; // callback invocations
+    std::atomic<uint64_t> filled{ 0 };    // pixels filled from a uniform rectangle border
+
+    void reset()
+    {
+        evaluated.store(0, std::memory_order_relaxed);
+        filled.store(0, std::memory_order_relaxed);
+    }
+};
+
+// How forEachWorld* traversals produce world coordinates along a scanline
+enum struct WorldStepMode
+{
+    PER_PIXEL,  // lerp every pixel in WorldT (one divide + lerps per pixel)
+    INCREMENTAL // evaluate the row start once, then step by a precomputed per-pixel delta (f32/f64/f128,
+                // other world types always lerp per pixel)
+};
+
+// Lanes per PixelBatch for WorldT, the widest packed type the active SIMD backend holds in
+// registers (simd::native_lanes for f32/f64, simd2::f128xN for f128)
+template<typename WorldT>
+[[nodiscard]] consteval int pixelBatchWidth()
+{
+    if constexpr (std::is_same_v<WorldT, f128>)
+        return simd2::f128xN::lanes;
+    else if constexpr (std::is_same_v<WorldT, f64> || std::is_same_v<WorldT, f32>)
+        return simd::native_lanes<WorldT>;
+    else
+        return 1;
+}
+
+// A run of up to W horizontally adjacent pixels from one raster row, world coordinates held as
+// SoA lanes ready for packed loads (simd::v4d::load(batch.wx), simd2::f128x4::load(batch.wx), ...).
+// Lanes past 'count' repeat the last valid pixel, so kernels can run every lane and drop the tail.
+template<typename WorldT, int W>
+struct PixelBatch
+{
+    static constexpr int lanes = W;
+
+    alignas(64) WorldT wx[W];
+    alignas(64) WorldT wy[W];
+    int x[W];         // raster x per lane
+    int y;            // raster row
+    int count;        // valid lanes [0, count)
+    int tile_index;
+    int thread_index; // worker [0, thread_count), e.g. for per-thread scratch
+
+    [[nodiscard]] bool full() const     { return count == W; }
+    [[nodiscard]] int  tailMask() const { return (1 << count) - 1; } // bit per valid lane
 };
 
 namespace detail
@@ -121,9 +314,253 @@ namespace detail
         P.blocks = std::move(blocks);
         P.blocks_total_per_tile = std::move(total);
         P.blocks_done_per_tile = std::move(done);
-        P.next_block.store(0, std::memory_order_relaxed);
+        P.reset_progress_only();
+
+        P.order.clear();
+        P.reorder_pending();
         return true;
     }
+
+    // Called at the start of each traversal call. Returns the token snapshot to check against.
+    inline uint64_t beginPass(TileBlockProgress& P, const Thread::CancellationToken* cancel)
+    {
+        P.cancelled = false;
+        if (!cancel) return 0;
+
+        const uint64_t generation = cancel->snapshot();
+        if (generation != P.pass_generation)
+        {
+            // the view changed since the pass began, restart it
+            if (P.next_block.load(std::memory_order_relaxed) > 0)
+            {
+                P.reset_progress_only();
+                P.reorder_pending();
+            }
+            P.pass_generation = generation;
+        }
+        return generation;
+    }
+
+    inline uint64_t beginPass(RowProgress& P, const Thread::CancellationToken* cancel)
+    {
+        P.cancelled = false;
+        if (!cancel) return 0;
+
+        const uint64_t generation = cancel->snapshot();
+        if (generation != P.pass_generation)
+        {
+            // the view changed between calls, rows solved so far belong to the old view
+            P.current_row = 0;
+            P.pass_generation = generation;
+        }
+        return generation;
+    }
+
+    // Called when the token trips mid-call, finished blocks belong to the old view
+    inline void cancelPass(TileBlockProgress& P)
+    {
+        P.reset_progress_only();
+        P.reorder_pending();
+        P.cancelled = true;
+    }
+
+    // Steps w(x) = left + (right - left) * (x + 0.5) / width along a scanline without a per-pixel divide.
+    // The start is evaluated once with the same formula as the per-pixel path, each pixel then adds
+    // k * step to it, with step held as a double-word so the offset doesn't drift across a wide row.
+    template<typename WorldT>
+    struct ScanlineStepper
+    {
+        // the offset is carried in doubles, only exact enough for types no wider than f64
+        static_assert(std::is_same_v<WorldT, f32> || std::is_same_v<WorldT, f64>,
+            "ScanlineStepper: no incremental stepper for this world type");
+
+        double origin = 0;
+        double step_hi = 0, step_lo = 0; // (right - left) / width, as a double-word
+        double k = 0;
+
+        FORCE_INLINE void begin(WorldT left, WorldT right, WorldT width, int x0)
+        {
+            const WorldT span = right - left;
+            const double D = static_cast<double>(span);
+            const double W = static_cast<double>(width);
+
+            // step = D / W, residual recovered exactly from p + e == step_hi * W
+            double p, e;
+            step_hi = D / W;
+            #ifdef FMA_AVAILABLE
+            two_prod_precise_fma(step_hi, W, p, e);
+            #else
+            two_prod_precise_dekker(step_hi, W, p, e);
+            #endif
+            step_lo = ((D - p) - e) / W;
+
+            const WorldT u = (static_cast<WorldT>(x0) + WorldT{ 0.5 }) / width;
+            origin = static_cast<double>(left + span * u);
+            k = 0;
+        }
+
+        FORCE_INLINE WorldT value() const { return static_cast<WorldT>(origin + (step_hi * k + step_lo * k)); }
+        FORCE_INLINE void advance() { k += 1.0; }
+    };
+
+    // f128: the row origin is evaluated once in full precision and each pixel is origin + k * step.
+    // Once the row span is below an f64 ulp of its coordinates (deep zoom), the offset k * step is
+    // exact enough in f64, so each pixel costs a single double-double + double add.
+    template<>
+    struct ScanlineStepper<f128>
+    {
+        f128   origin{ 0, 0 };
+        f128   step{ 0, 0 };
+        double step_d = 0;
+        double k = 0;
+        bool   relative = false;
+
+        FORCE_INLINE void begin(f128 left, f128 right, f128 width, int x0)
+        {
+            const f128 span = right - left;
+            const f128 u = (static_cast<f128>(x0) + f128{ 0.5 }) / width;
+            origin = left + span * u;
+            step = span / width;
+            step_d = static_cast<double>(step);
+            k = 0;
+
+            const double scale = std::max(std::fabs(left.hi), std::fabs(right.hi));
+            relative = std::fabs(span.hi) <= scale * 0x1p-54;
+        }
+
+        FORCE_INLINE f128 value() const
+        {
+            return relative ? (origin + step_d * k) : (origin + step * k);
+        }
+
+        FORCE_INLINE void advance() { k += 1.0; }
+    };
+
+    template<typename WorldT>
+    inline constexpr bool has_scanline_stepper =
+        std::is_same_v<WorldT, f32> || std::is_same_v<WorldT, f64> || std::is_same_v<WorldT, f128>;
+
+    // World quad corners and raster size, used to produce pixel-centre world coordinates row by row
+    template<typename WorldT>
+    struct WorldScan
+    {
+        WorldT ax, ay, bx, by, cx, cy, dx, dy;
+        WorldT t_bmp_w, t_bmp_h;
+        WorldStepMode mode;
+
+        WorldScan(const Quad<WorldT>& q, int raster_w, int raster_h, WorldStepMode step_mode) :
+            ax(q.a.x), ay(q.a.y), bx(q.b.x), by(q.b.y),
+            cx(q.c.x), cy(q.c.y), dx(q.d.x), dy(q.d.y),
+            t_bmp_w(static_cast<WorldT>(raster_w)),
+            t_bmp_h(static_cast<WorldT>(raster_h)),
+            mode(step_mode)
+        {}
+
+        // fn(int bmp_x, WorldT wx, WorldT wy) for bmp_x in [x0, x1)
+        template<typename Fn>
+        FORCE_INLINE void forEachRowPixel(int row, int x0, int x1, Fn&& fn) const
+        {
+            // Interpolate left and right edges of the scanline
+            const WorldT bmp_fy = static_cast<WorldT>(row) + WorldT{ 0.5 };
+            const WorldT v = bmp_fy / t_bmp_h;
+            const WorldT scan_left_x  = ax + (dx - ax) * v;
+            const WorldT scan_left_y  = ay + (dy - ay) * v;
+            const WorldT scan_right_x = bx + (cx - bx) * v;
+            const WorldT scan_right_y = by + (cy - by) * v;
+
+            if constexpr (has_scanline_stepper<WorldT>)
+            {
+                if (mode == WorldStepMode::INCREMENTAL)
+                {
+                    ScanlineStepper<WorldT> sx, sy;
+                    sx.begin(scan_left_x, scan_right_x, t_bmp_w, x0);
+                    sy.begin(scan_left_y, scan_right_y, t_bmp_w, x0);
+                    for (int bmp_x = x0; bmp_x < x1; ++bmp_x)
+                    {
+                        fn(bmp_x, sx.value(), sy.value());
+                        sx.advance();
+                        sy.advance();
+                    }
+                    return;
+                }
+            }
+
+            for (int bmp_x = x0; bmp_x < x1; ++bmp_x)
+            {
+                const WorldT bmp_fx = static_cast<WorldT>(bmp_x) + WorldT{ 0.5 };
+                const WorldT u = bmp_fx / t_bmp_w;
+                const WorldT wx = scan_left_x + (scan_right_x - scan_left_x) * u;
+                const WorldT wy = scan_left_y + (scan_right_y - scan_left_y) * u;
+                fn(bmp_x, wx, wy);
+            }
+        }
+    };
+
+    // forEachRowPixel for the world traversals (rows, tile blocks, adaptive cells). f64/f128 spans are
+    // generated in one go by the active CPU kernel variant (bit-identical to forEachRowPixel at every
+    // level), other types step inline.
+    template<typename WorldT, typename Fn>
+    FORCE_INLINE void forEachWorldRowPixel(const WorldScan<WorldT>& scan, int row, int x0, int x1, Fn&& fn)
+    {
+        if constexpr (std::is_same_v<WorldT, f64> || std::is_same_v<WorldT, f128>)
+        {
+            // whole row at once, an incremental stepper restarted mid-row wouldn't match bit-for-bit
+            thread_local std::vector<WorldT> wx, wy;
+            const size_t n = static_cast<size_t>(std::max(0, x1 - x0));
+            if (wx.size() < n)
+            {
+                wx.resize(n);
+                wy.resize(n);
+            }
+
+            const CpuKernels& k = cpuKernels();
+            if constexpr (std::is_same_v<WorldT, f64>)
+                k.world_row_f64(scan, row, x0, x1, wx.data(), wy.data());
+            else
+                k.world_row_f128(scan, row, x0, x1, wx.data(), wy.data());
+
+            for (int bmp_x = x0; bmp_x < x1; ++bmp_x)
+                fn(bmp_x, wx[bmp_x - x0], wy[bmp_x - x0]);
+        }
+        else
+        {
+            scan.forEachRowPixel(row, x0, x1, std::forward<Fn>(fn));
+        }
+    }
+
+    // fn(const PixelBatch<WorldT, W>&) for each run of W pixels in [x0, x1), the last one padded
+    template<typename WorldT, int W, typename Fn>
+    FORCE_INLINE void forEachWorldRowBatch(const WorldScan<WorldT>& scan, int row, int x0, int x1, PixelBatch<WorldT, W>& batch, Fn&& fn)
+    {
+        batch.y = row;
+        batch.count = 0;
+
+        forEachWorldRowPixel(scan, row, x0, x1, [&](int bmp_x, const WorldT& wx, const WorldT& wy)
+        {
+            const int l = batch.count++;
+            batch.x[l] = bmp_x;
+            batch.wx[l] = wx;
+            batch.wy[l] = wy;
+
+            if (l == W - 1)
+            {
+                fn(static_cast<const PixelBatch<WorldT, W>&>(batch));
+                batch.count = 0;
+            }
+        });
+
+        if (batch.count > 0)
+        {
+            const int last = batch.count - 1;
+            for (int l = batch.count; l < W; ++l)
+            {
+                batch.x[l] = batch.x[last];
+                batch.wx[l] = batch.wx[last];
+                batch.wy[l] = batch.wy[last];
+            }
+            fn(static_cast<const PixelBatch<WorldT, W>&>(batch));
+        }
+    }
 }
 
 // w/h info for both 'Image' and 'RasterGrid' (diamond inheritance)
@@ -149,6 +586,16 @@ struct RasterGrid
         raster_h = h;
     }
 
+    // Pixels in [x0, x1) x [y0, y1) were written. Every traversal below reports the rows, tiles or
+    // blocks it finished, Image overrides this to upload only the changed regions. May be called
+    // from worker threads.
+    virtual void markDirty(int /*x0*/, int /*y0*/, int /*x1*/, int /*y1*/) {}
+
+    void markDirtyRows(int y0, int y1)
+    {
+        if (y1 > y0) markDirty(0, y0, raster_w, y1);
+    }
+
     template<typename Callback>
     bool forEachPixel(
         int& current_row,
@@ -163,6 +610,7 @@ struct RasterGrid
             "Callback must be: void(int x, int y) or bool(int x, int y)");
 
         CallbackT cb = std::forward<Callback>(callback);
+        const int first_row = current_row;
 
         auto timeout = timeout_ms ?
             std::chrono::milliseconds{ timeout_ms } :
@@ -170,63 +618,37 @@ struct RasterGrid
 
         if constexpr (std::is_void_v<Ret>)
         {
-            if (thread_count > 0)
+            if (thread_count > 0 && timeout_ms == 0)
             {
-                auto start_time = std::chrono::steady_clock::now();
-
-                std::vector<std::future<void>> futures(thread_count);
-                std::vector<std::atomic<bool>> active_threads(thread_count);
-
-                for (int ti = 0; ti < thread_count; ti++)
-                    active_threads[ti].store(false, std::memory_order_relaxed);
+                // No time budget, rows can be balanced by stealing
+                Thread::forEachRange(current_row, raster_h, [&](int y0, int y1, int)
+                {
+                    for (int row = y0; row < y1; ++row)
+                        for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
+                            std::invoke(cb, bmp_x, row);
+                }, thread_count, 1);
 
+                current_row = raster_h;
+                markDirtyRows(first_row, raster_h);
+            }
+            else if (thread_count > 0)
+            {
+                auto start_time = std::chrono::steady_clock::now();
                 std::atomic<bool> timed_out{ false };
 
-                while (!timed_out.load(std::memory_order_relaxed))
+                // Workers claim rows from a shared cursor, caller sleeps until they're done
+                current_row = Thread::forEachClaimed(current_row, raster_h, [&](int row, int)
                 {
-                    for (int ti = 0; ti < thread_count; ti++)
-                    {
-                        if (timed_out.load(std::memory_order_relaxed))
-                            break;
-
-                        if (active_threads[ti].load(std::memory_order_relaxed))
-                            continue;
-
-                        const int thread_index = ti;
-                        const int row = current_row++;
-
-                        if (row >= raster_h)
-                        {
-                            timed_out.store(true, std::memory_order_relaxed);
-                            break;
-                        }
-
-                        active_threads[ti].store(true, std::memory_order_relaxed);
-
-                        futures[ti] = Thread::pool().submit_task([&, row, thread_index]()
-                        {
-                            for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
-                                std::invoke(cb, bmp_x, row);
-
-                            if (std::chrono::steady_clock::now() - start_time >= timeout)
-                            {
-                                timed_out.store(true, std::memory_order_relaxed);
-                            }
-                            else
-                            {
-                                active_threads[thread_index].store(false, std::memory_order_relaxed);
-                            }
-                        });
-                    }
+                    for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
+                        std::invoke(cb, bmp_x, row);
 
-                    std::this_thread::yield();
-                }
+                    if (std::chrono::steady_clock::now() - start_time >= timeout)
+                        timed_out.store(true, std::memory_order_relaxed);
+                },
+                [&] { return timed_out.load(std::memory_order_relaxed); },
+                thread_count);
 
-                for (int ti = 0; ti < thread_count; ti++)
-                {
-                    if (futures[ti].valid())
-                        futures[ti].get();
-                }
+                markDirtyRows(first_row, current_row);
             }
             else
             {
@@ -235,6 +657,7 @@ struct RasterGrid
                     for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
                         std::invoke(cb, bmp_x, bmp_y);
                 }
+                markDirtyRows(0, raster_h);
             }
 
             if (current_row >= raster_h)
@@ -248,73 +671,63 @@ struct RasterGrid
         {
             std::atomic<bool> stop_requested{ false };
 
-            if (thread_count > 0)
+            if (thread_count > 0 && timeout_ms == 0)
             {
-                auto start_time = std::chrono::steady_clock::now();
-
-                std::vector<std::future<void>> futures(thread_count);
-                std::vector<std::atomic<bool>> active_threads(thread_count);
+                Thread::WorkStealingScheduler scheduler;
+                scheduler.reset(current_row, raster_h, thread_count, 1);
+                scheduler.run([&](int y0, int y1, int)
+                {
+                    for (int row = y0; row < y1; ++row)
+                    {
+                        for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
+                        {
+                            if (std::invoke(cb, bmp_x, row))
+                            {
+                                stop_requested.store(true, std::memory_order_relaxed);
+                                return;
+                            }
+                        }
+                    }
+                }, [&] { return stop_requested.load(std::memory_order_relaxed); });
 
-                for (int ti = 0; ti < thread_count; ti++)
-                    active_threads[ti].store(false, std::memory_order_relaxed);
+                if (!stop_requested.load(std::memory_order_relaxed))
+                    current_row = raster_h;
 
+                // rows may be partly written when stopped early
+                markDirtyRows(first_row, raster_h);
+            }
+            else if (thread_count > 0)
+            {
+                auto start_time = std::chrono::steady_clock::now();
                 std::atomic<bool> timed_out{ false };
 
-                while (!timed_out.load(std::memory_order_relaxed) &&
-                    !stop_requested.load(std::memory_order_relaxed))
+                current_row = Thread::forEachClaimed(current_row, raster_h, [&](int row, int)
                 {
-                    for (int ti = 0; ti < thread_count; ti++)
+                    for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
                     {
-                        if (timed_out.load(std::memory_order_relaxed) ||
-                            stop_requested.load(std::memory_order_relaxed))
+                        if (stop_requested.load(std::memory_order_relaxed))
                             break;
 
-                        if (active_threads[ti].load(std::memory_order_relaxed))
-                            continue;
-
-                        const int thread_index = ti;
-                        const int row = current_row++;
-
-                        if (row >= raster_h)
+                        if (std::invoke(cb, bmp_x, row))
                         {
-                            timed_out.store(true, std::memory_order_relaxed);
+                            stop_requested.store(true, std::memory_order_relaxed);
                             break;
                         }
-
-                        active_threads[ti].store(true, std::memory_order_relaxed);
-
-                        futures[ti] = Thread::pool().submit_task([&, row, thread_index]()
-                        {
-                            for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
-                            {
-                                if (stop_requested.load(std::memory_order_relaxed))
-                                    break;
-
-                                if (std::invoke(cb, bmp_x, row))
-                                {
-                                    stop_requested.store(true, std::memory_order_relaxed);
-                                    break;
-                                }
-                            }
-
-                            active_threads[thread_index].store(false, std::memory_order_relaxed);
-
-                            if (!stop_requested.load(std::memory_order_relaxed) &&
-                                std::chrono::steady_clock::now() - start_time >= timeout)
-                            {
-                                timed_out.store(true, std::memory_order_relaxed);
-                            }
-                        });
                     }
 
-                    std::this_thread::yield();
-                }
-
-                for (int ti = 0; ti < thread_count; ti++)
-                {
-                    if (futures[ti].valid())
-                        futures[ti].get();
-                }
+                    if (!stop_requested.load(std::memory_order_relaxed) &&
+                        std::chrono::steady_clock::now() - start_time >= timeout)
+                    {
+                        timed_out.store(true, std::memory_order_relaxed);
+                    }
+                },
+                [&] {
+                    return timed_out.load(std::memory_order_relaxed) ||
+                        stop_requested.load(std::memory_order_relaxed);
+                },
+                thread_count);
+
+                markDirtyRows(first_row, stop_requested.load(std::memory_order_relaxed) ? raster_h : current_row);
             }
             else
             {
@@ -330,8 +743,14 @@ struct RasterGrid
                     }
 
                     if (stop_requested.load(std::memory_order_relaxed))
+                    {
+                        markDirtyRows(0, bmp_y + 1);
                         break;
+                    }
                 }
+
+                if (!stop_requested.load(std::memory_order_relaxed))
+                    markDirtyRows(0, raster_h);
             }
 
             if (stop_requested.load(std::memory_order_relaxed))
@@ -365,8 +784,13 @@ struct RasterGrid
 template<typename T=f64>
 class WorldRasterGridT : public WorldObjectT<T>, public virtual RasterGrid
 {
+    WorldStepMode world_step_mode = WorldStepMode::PER_PIXEL;
+
 public:
 
+    void setWorldStepMode(WorldStepMode mode) { world_step_mode = mode; }
+    [[nodiscard]] WorldStepMode worldStepMode() const { return world_step_mode; }
+
     // todo: p could be a lower-precision world coord
     [[nodiscard]] IVec2 pixelPosFromWorld(Vec2<T> p)
     {
@@ -401,142 +825,120 @@ public:
         wy = scan_left_y + (scan_right_y - scan_left_y) * _u;
     }
 
+    // Rows are resumed from P.current_row on the next call when timeout_ms runs out. With 'cancel', a
+    // pass is tied to the token generation it started on: if the token moved since (between calls or
+    // mid-call), the rows solved so far are abandoned and the pass restarts from row 0.
     template<typename WorldT = T, typename Callback>
     bool forEachWorldPixel(
-        int& current_row,
+        RowProgress& P, // progress tracker
         Callback&& callback,
         int thread_count = Thread::threadCount(),
         int timeout_ms = 0,
-        std::atomic<bool>* busy = nullptr
+        std::atomic<bool>* busy = nullptr,
+        const Thread::CancellationToken* cancel = nullptr // checked between rows, e.g. camera.changeToken()
     )
     {
         auto timeout = timeout_ms ?
             std::chrono::milliseconds{ timeout_ms } :
             std::chrono::steady_clock::duration::max();
 
-        // World quad might be higher precision than is requested for the current zoom level, downgrade to requested WorldT
-        Quad<WorldT> world_quad = static_cast<Quad<WorldT>>(WorldObjectT<T>::worldQuad());
+        const uint64_t generation = detail::beginPass(P, cancel);
+        auto cancelled = [&] { return cancel && cancel->cancelledSince(generation); };
 
-        WorldT ax = world_quad.a.x, ay = world_quad.a.y;
-        WorldT bx = world_quad.b.x, by = world_quad.b.y;
-        WorldT cx = world_quad.c.x, cy = world_quad.c.y;
-        WorldT dx = world_quad.d.x, dy = world_quad.d.y;
+        int& current_row = P.current_row;
+        const int first_row = current_row;
 
-        WorldT t_bmp_w = static_cast<WorldT>(raster_w);
-        WorldT t_bmp_h = static_cast<WorldT>(raster_h);
+        // World quad might be higher precision than is requested for the current zoom level, downgrade to requested WorldT
+        const detail::WorldScan<WorldT> scan(
+            static_cast<Quad<WorldT>>(WorldObjectT<T>::worldQuad()),
+            raster_w, raster_h, world_step_mode);
 
-        if (thread_count > 0)
+        if (thread_count > 0 && timeout_ms == 0)
         {
+            // No time budget, rows can be balanced by stealing
             if (busy)
             {
                 for (int i = 0; i < thread_count; ++i)
                     busy[i].store(false, std::memory_order_relaxed);
             }
 
-            auto start_time = std::chrono::steady_clock::now();
-
-            std::vector<std::future<void>> futures(thread_count);
-            std::vector<std::atomic<bool>> active_threads(thread_count);
-
-            for (int ti = 0; ti < thread_count; ti++)
-                active_threads[ti].store(false);
-
-            std::atomic<bool> timed_out{ false };
-
-            // Continuously spin checking for idle threads and scheduling new rows...
-            while (!timed_out.load(std::memory_order_relaxed))
+            Thread::WorkStealingScheduler scheduler;
+            scheduler.reset(current_row, raster_h, thread_count, 1);
+            scheduler.run([&](int y0, int y1, int thread_index)
             {
-                for (int ti = 0; ti < thread_count; ti++)
-                {
-                    if (timed_out.load(std::memory_order_relaxed))
-                        break;
-
-                    if (active_threads[ti].load(std::memory_order_relaxed))
-                        continue;
+                if (busy) busy[thread_index].store(true, std::memory_order_relaxed);
 
-                    // Found an idle thread...
-
-                    const int thread_index = ti;
-                    const int row = current_row++;
-
-                    if (row >= raster_h)
-                    {
-                        timed_out.store(true);
-                        break;
-                    }
-
-                    active_threads[thread_index].store(true, std::memory_order_relaxed);
-                    if (busy) busy[thread_index].store(true, std::memory_order_relaxed);
-
-                    futures[ti] = Thread::pool().submit_task([&, row, thread_index]()
+                for (int row = y0; row < y1 && !cancelled(); ++row)
+                {
+                    detail::forEachWorldRowPixel(scan, row, 0, raster_w, [&](int bmp_x, const WorldT& wx, const WorldT& wy)
                     {
-                        // Interpolate row pixel coordinate and invoke callback
-                        WorldT bmp_fx, bmp_fy = static_cast<WorldT>(row) + WorldT{ 0.5 };
-                        WorldT _v = bmp_fy / t_bmp_h;
-                        WorldT scan_left_x = ax + (dx - ax) * _v;
-                        WorldT scan_left_y = ay + (dy - ay) * _v;
-                        WorldT scan_right_x = bx + (cx - bx) * _v;
-                        WorldT scan_right_y = by + (cy - by) * _v;
-                        for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
-                        {
-                            bmp_fx = static_cast<WorldT>(bmp_x) + WorldT{ 0.5 };
-                            WorldT _u = bmp_fx / t_bmp_w;
-                            WorldT wx = scan_left_x + (scan_right_x - scan_left_x) * _u;
-                            WorldT wy = scan_left_y + (scan_right_y - scan_left_y) * _u;
-
-                            if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int>)
-                                std::forward<Callback>(callback)(bmp_x, row, wx, wy, thread_index);
-                            else if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT>)
-                                std::forward<Callback>(callback)(bmp_x, row, wx, wy);
-                            else
-                                static_assert(sizeof(Callback) == 0,
-                                "Callback must be: void( int x, int y, float_t wx, float_y wy, [[optional]] int thread_index)");
-                        }
-
-                        // After each row solved, check if timeout exceeded
-                        if (std::chrono::steady_clock::now() - start_time >= timeout)
-                        {
-                            // If so, signal that we shouldn't pick up any new tasks - break out the loop
-                            timed_out.store(true);
-                        }
+                        if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int>)
+                            std::forward<Callback>(callback)(bmp_x, row, wx, wy, thread_index);
+                        else if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT>)
+                            std::forward<Callback>(callback)(bmp_x, row, wx, wy);
                         else
-                        {
-                            // Otherwise, schedule the next available row
-                            active_threads[thread_index].store(false);
-                            if (busy) busy[thread_index].store(false, std::memory_order_relaxed);
-                        }
+                            static_assert(sizeof(Callback) == 0,
+                            "Callback must be: void( int x, int y, float_t wx, float_y wy, [[optional]] int thread_index)");
                     });
                 }
 
-                std::this_thread::yield();
-            }
+                if (busy) busy[thread_index].store(false, std::memory_order_relaxed);
+            }, cancelled);
 
-            // After timing out, wait for remaining threads to finalize
-            for (int ti = 0; ti < thread_count; ti++)
+            current_row = raster_h;
+            markDirtyRows(first_row, raster_h);
+        }
+        else if (thread_count > 0)
+        {
+            if (busy)
             {
-                if (futures[ti].valid())
-                    futures[ti].get();
+                for (int i = 0; i < thread_count; ++i)
+                    busy[i].store(false, std::memory_order_relaxed);
             }
+
+            auto start_time = std::chrono::steady_clock::now();
+            std::atomic<bool> timed_out{ false };
+
+            // Persistent workers claim the next row from a shared cursor (no dispatcher thread)
+            current_row = Thread::forEachClaimed(current_row, raster_h, [&](int row, int thread_index)
+            {
+                if (busy) busy[thread_index].store(true, std::memory_order_relaxed);
+
+                // Interpolate row pixel coordinates and invoke callback
+                detail::forEachWorldRowPixel(scan, row, 0, raster_w, [&](int bmp_x, const WorldT& wx, const WorldT& wy)
+                {
+                    if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int>)
+                        std::forward<Callback>(callback)(bmp_x, row, wx, wy, thread_index);
+                    else if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT>)
+                        std::forward<Callback>(callback)(bmp_x, row, wx, wy);
+                    else
+                        static_assert(sizeof(Callback) == 0,
+                        "Callback must be: void( int x, int y, float_t wx, float_y wy, [[optional]] int thread_index)");
+                });
+
+                // After each row solved, check if timeout exceeded
+                if (std::chrono::steady_clock::now() - start_time >= timeout)
+                {
+                    // If so, signal that no worker should claim a new row (busy stays raised)
+                    timed_out.store(true, std::memory_order_relaxed);
+                }
+                else
+                {
+                    if (busy) busy[thread_index].store(false, std::memory_order_relaxed);
+                }
+            },
+            [&] { return timed_out.load(std::memory_order_relaxed) || cancelled(); },
+            thread_count);
+
+            markDirtyRows(first_row, cancelled() ? raster_h : current_row);
         }
         else
         {
-            WorldT bmp_fx, bmp_fy;
-            for (int bmp_y = 0; bmp_y < raster_h; ++bmp_y)
+            for (; current_row < raster_h && !cancelled(); ++current_row)
             {
-                // Interpolate left and right edges of the scanline
-                bmp_fy = static_cast<WorldT>(bmp_y) + WorldT{ 0.5 };
-                WorldT _v = bmp_fy / t_bmp_h;
-                WorldT scan_left_x = ax + (dx - ax) * _v;
-                WorldT scan_left_y = ay + (dy - ay) * _v;
-                WorldT scan_right_x = bx + (cx - bx) * _v;
-                WorldT scan_right_y = by + (cy - by) * _v;
-                for (int bmp_x = 0; bmp_x < raster_w; ++bmp_x)
+                const int bmp_y = current_row;
+                detail::forEachWorldRowPixel(scan, bmp_y, 0, raster_w, [&](int bmp_x, const WorldT& wx, const WorldT& wy)
                 {
-                    bmp_fx = static_cast<WorldT>(bmp_x) + WorldT{ 0.5 };
-                    WorldT _u = bmp_fx / t_bmp_w;
-                    WorldT wx = scan_left_x + (scan_right_x - scan_left_x) * _u;
-                    WorldT wy = scan_left_y + (scan_right_y - scan_left_y) * _u;
-
                     if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int>)
                         std::forward<Callback>(callback)(bmp_x, bmp_y, wx, wy, 0);
                     else if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT>)
@@ -544,8 +946,17 @@ public:
                     else
                         static_assert(sizeof(Callback) == 0,
                         "Callback must be: void( int x, int y, float_t wx, float_y wy, [[optional]] int thread_index)");
-                }
+                });
             }
+            markDirtyRows(first_row, cancelled() ? raster_h : current_row);
+        }
+
+        // rows solved for a stale view are abandoned, the next call starts over
+        if (cancelled())
+        {
+            current_row = 0;
+            P.cancelled = true;
+            return false;
         }
 
         if (current_row >= raster_h)
@@ -556,6 +967,22 @@ public:
         return false;
     }
 
+    // Same as above without cancellation, for callers that keep a plain row index
+    template<typename WorldT = T, typename Callback>
+    bool forEachWorldPixel(
+        int& current_row,
+        Callback&& callback,
+        int thread_count = Thread::threadCount(),
+        int timeout_ms = 0,
+        std::atomic<bool>* busy = nullptr)
+    {
+        RowProgress P;
+        P.current_row = current_row;
+        const bool done = forEachWorldPixel<WorldT>(P, std::forward<Callback>(callback), thread_count, timeout_ms, busy);
+        current_row = P.current_row;
+        return done;
+    }
+
     template<typename WorldT, typename Callback>
     bool forEachWorldTile(
         int tile_w, int tile_h,
@@ -563,8 +990,6 @@ public:
         int thread_count = Thread::threadCount()
     )
     {
-        int current_tile = 0;
-
         // World quad might be higher precision than is requested for the current zoom level, downgrade to requested WorldT
         Quad<WorldT> world_quad = static_cast<Quad<WorldT>>(WorldObjectT<T>::worldQuad());
 
@@ -580,96 +1005,110 @@ public:
         const int tiles_y = (raster_h + tile_h - 1) / tile_h;
         const int tile_count = tiles_x * tiles_y;
 
-        auto start_time = std::chrono::steady_clock::now();
-
-        std::vector<std::future<void>> futures(thread_count);
-        std::vector<std::atomic<bool>> active_threads(thread_count);
-        for (int ti = 0; ti < thread_count; ++ti)
-            active_threads[ti].store(false, std::memory_order_relaxed);
-
-        std::atomic<bool> timed_out{ false };
-
-        // Continuously spin checking for idle threads and scheduling new tiles...
-        while (!timed_out.load(std::memory_order_relaxed))
+        // Persistent workers claim the next tile from a shared cursor (no dispatcher thread)
+        Thread::forEachClaimed(0, tile_count, [&](int tile_index, int)
         {
-            for (int ti = 0; ti < thread_count; ++ti)
+            const int tx = tile_index % tiles_x;
+            const int ty = tile_index / tiles_x;
+
+            const int x0 = tx * tile_w;
+            const int y0 = ty * tile_h;
+            const int x1 = std::min(x0 + tile_w, raster_w);
+            const int y1 = std::min(y0 + tile_h, raster_h);
+
+            const int px = x0 + (x1 - x0 - 1) / 2;
+            const int py = y0 + (y1 - y0 - 1) / 2;
+
+            // Pixel-center sampling
+            const WorldT bmp_fx = static_cast<WorldT>(px) + WorldT{ 0.5 };
+            const WorldT bmp_fy = static_cast<WorldT>(py) + WorldT{ 0.5 };
+
+            // Interpolate world coords along the two vertical edges at this scanline
+            const WorldT v = bmp_fy / t_bmp_h;
+            const WorldT scan_left_x  = ax + (dx - ax) * v;
+            const WorldT scan_left_y  = ay + (dy - ay) * v;
+            const WorldT scan_right_x = bx + (cx - bx) * v;
+            const WorldT scan_right_y = by + (cy - by) * v;
+
+            // Interpolate across the scanline
+            const WorldT u = bmp_fx / t_bmp_w;
+            const WorldT wx = scan_left_x + (scan_right_x - scan_left_x) * u;
+            const WorldT wy = scan_left_y + (scan_right_y - scan_left_y) * u;
+
+            if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int, int, int, int, int>)
             {
-                if (timed_out.load(std::memory_order_relaxed))
-                    break;
-
-                if (active_threads[ti].load(std::memory_order_relaxed))
-                    continue;
-
-                // Found an idle thread...
-                const int thread_index = ti;
-                const int tile_index = current_tile++;
+                std::forward<Callback>(callback)(px, py, wx, wy, tile_index, x0, y0, x1, y1);
+            }
+            else
+            {
+                std::forward<Callback>(callback)(px, py, wx, wy, tile_index);
+            }
+            markDirty(x0, y0, x1, y1);
+        },
+        [] { return false; },
+        thread_count);
 
-                if (tile_index >= tile_count)
-                {
-                    timed_out.store(true, std::memory_order_relaxed);
-                    break;
-                }
+        return true;
+    }
 
-                const int tx = tile_index % tiles_x;
-                const int ty = tile_index / tiles_x;
+    // Claims the micro-blocks of P in plan order and hands each to render(const TileBlock&, int thread_index),
+    // until every block is done, the budget runs out or 'cancel' fires. Workers claim from a shared
+    // cursor, so blocks finish in plan order and progress is a single index that doesn't depend on
+    // thread_count.
+    template<typename RenderBlock>
+    bool forEachTileBlock(
+        int tile_w, int tile_h,
+        TileBlockProgress& P,
+        RenderBlock&& render,
+        int thread_count,
+        int budget_ms,
+        int block_w,
+        int block_h,
+        const Thread::CancellationToken* cancel)
+    {
+        using namespace detail;
 
-                const int x0 = tx * tile_w;
-                const int y0 = ty * tile_h;
-                const int x1 = std::min(x0 + tile_w, raster_w);
-                const int y1 = std::min(y0 + tile_h, raster_h);
+        ensureBlocksBuilt(P, raster_w, raster_h, tile_w, tile_h, block_w, block_h);
 
-                active_threads[thread_index].store(true, std::memory_order_relaxed);
+        const int N = static_cast<int>(P.blocks.size());
+        if (N == 0) return true;
 
-                futures[ti] = Thread::pool().submit_task([&, x0, y0, x1, y1, thread_index, tile_index]()
-                {
-                    const int px = x0 + (x1 - x0 - 1) / 2;
-                    const int py = y0 + (y1 - y0 - 1) / 2;
-
-                    // Pixel-center sampling
-                    const WorldT bmp_fx = static_cast<WorldT>(px) + WorldT{ 0.5 };
-                    const WorldT bmp_fy = static_cast<WorldT>(py) + WorldT{ 0.5 };
-
-                    // Interpolate world coords along the two vertical edges at this scanline
-                    const WorldT v = bmp_fy / t_bmp_h;
-                    const WorldT scan_left_x  = ax + (dx - ax) * v;
-                    const WorldT scan_left_y  = ay + (dy - ay) * v;
-                    const WorldT scan_right_x = bx + (cx - bx) * v;
-                    const WorldT scan_right_y = by + (cy - by) * v;
-
-                    // Interpolate across the scanline
-                    const WorldT u = bmp_fx / t_bmp_w;
-                    const WorldT wx = scan_left_x + (scan_right_x - scan_left_x) * u;
-                    const WorldT wy = scan_left_y + (scan_right_y - scan_left_y) * u;
-
-                    if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int, int, int, int, int>)
-                    {
-                        std::forward<Callback>(callback)(px, py, wx, wy, tile_index, x0, y0, x1, y1);
-                    }
-                    else
-                    {
-                        std::forward<Callback>(callback)(px, py, wx, wy, tile_index);
-                    }
+        // A new pass starts at block 0. Per-tile counts from the previous (completed) pass are
+        // kept until now so they can still be displayed after the final call returns.
+        // a pass left unfinished for an older view is discarded rather than mixed in
+        const uint64_t generation = beginPass(P, cancel);
 
-                    // Allow this worker to grab another tile
-                    active_threads[thread_index].store(false, std::memory_order_relaxed);
-                });
-            }
+        const int first_block = P.next_block.load(std::memory_order_relaxed);
+        if (first_block == 0)
+            std::fill(P.blocks_done_per_tile.begin(), P.blocks_done_per_tile.end(), 0u);
 
-            std::this_thread::yield();
-        }
+        const bool no_timeout = (budget_ms == 0);
+        const double t_end = no_timeout ? std::numeric_limits<double>::max() : (now_ms() + double(budget_ms));
 
-        // After timing out (or finishing), wait for remaining tasks
-        for (int ti = 0; ti < thread_count; ++ti)
+        auto render_block = [&](int bi, int thread_index)
         {
-            if (futures[ti].valid())
-                futures[ti].get();
+            const TileBlock& b = P.blocks[P.order[bi]];
+            render(b, thread_index);
+            markDirty(b.x0, b.y0, b.x1, b.y1);
+            P.mark_block_done(b.tile_index);
+        };
+
+        // stop between blocks only (a claimed block is always finished)
+        const int resume_block = Thread::forEachClaimed(first_block, N, render_block, [&] {
+            return (!no_timeout && now_ms() >= t_end) || (cancel && cancel->cancelledSince(generation));
+        }, thread_count);
+
+        if (cancel && cancel->cancelledSince(generation)) {
+            cancelPass(P);
+            return false;
         }
 
-        if (current_tile >= tile_count)
-        {
-            current_tile = 0;
+        if (resume_block >= N) {
+            P.next_block.store(0, std::memory_order_relaxed);
             return true;
         }
+
+        P.next_block.store(resume_block, std::memory_order_relaxed);
         return false;
     }
 
@@ -681,105 +1120,251 @@ public:
         int thread_count = Thread::threadCount(),
         int budget_ms = 16, // 0 = no timeout (finish in this call)
         int block_w = 64,
-        int block_h = 8
+        int block_h = 8,
+        const Thread::CancellationToken* cancel = nullptr // checked between blocks, e.g. camera.changeToken()
+    )
+    {
+        // world quad
+        const detail::WorldScan<WorldT> scan(
+            static_cast<Quad<WorldT>>(WorldObjectT<T>::worldQuad()),
+            raster_w, raster_h, world_step_mode);
+
+        return forEachTileBlock(tile_w, tile_h, P, [&](const TileBlock& b, int)
+        {
+            // render micro-block
+            for (int row = b.y0; row < b.y1; ++row)
+            {
+                detail::forEachWorldRowPixel(scan, row, b.x0, b.x1, [&](int bmp_x, const WorldT& wx, const WorldT& wy)
+                {
+                    if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int>)
+                        std::forward<Callback>(callback)(bmp_x, row, wx, wy, b.tile_index);
+                    else if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT>)
+                        std::forward<Callback>(callback)(bmp_x, row, wx, wy);
+                });
+            }
+        }, thread_count, budget_ms, block_w, block_h, cancel);
+    }
+
+    // Same traversal as forEachWorldTilePixel (progress, budget, resume and cancellation), but the
+    // callback receives up to W adjacent pixels of a row at once as a PixelBatch, so SIMD kernels
+    // can load world coordinates straight into packed lanes:
+    //
+    //   grid.forEachWorldTilePixelBatch<f64>(64, 64, P, [&](const PixelBatch<f64, 4>& b)
+    //   {
+    //       const simd::v4d cx = simd::v4d::load(b.wx), cy = simd::v4d::load(b.wy);
+    //       ...
+    //       for (int l = 0; l < b.count; ++l) store(b.x[l], b.y, result[l]);
+    //   });
+    //
+    // W defaults to pixelBatchWidth<WorldT>(). Batches never span rows or micro-blocks, so a block
+    // width that's a multiple of W keeps every batch full except at the raster's right edge.
+    template<typename WorldT, int W = pixelBatchWidth<WorldT>(), typename Callback>
+    bool forEachWorldTilePixelBatch(
+        int tile_w, int tile_h,
+        TileBlockProgress& P, // progress tracker
+        Callback&& callback,
+        int thread_count = Thread::threadCount(),
+        int budget_ms = 16, // 0 = no timeout (finish in this call)
+        int block_w = 64,
+        int block_h = 8,
+        const Thread::CancellationToken* cancel = nullptr // checked between blocks, e.g. camera.changeToken()
+    )
+    {
+        static_assert(W >= 1 && W <= 16, "PixelBatch width must be in [1, 16]");
+        static_assert(std::is_invocable_v<Callback&, const PixelBatch<WorldT, W>&>,
+            "Callback must be: void(const PixelBatch<WorldT, W>& batch)");
+
+        const detail::WorldScan<WorldT> scan(
+            static_cast<Quad<WorldT>>(WorldObjectT<T>::worldQuad()),
+            raster_w, raster_h, world_step_mode);
+
+        return forEachTileBlock(tile_w, tile_h, P, [&](const TileBlock& b, int thread_index)
+        {
+            PixelBatch<WorldT, W> batch;
+            batch.tile_index = b.tile_index;
+            batch.thread_index = thread_index;
+
+            for (int row = b.y0; row < b.y1; ++row)
+                detail::forEachWorldRowBatch(scan, row, b.x0, b.x1, batch, callback);
+        }, thread_count, budget_ms, block_w, block_h, cancel);
+    }
+
+    // Mariani-Silver fill: each cell's rectangle border is evaluated first. If every border value is
+    // the same (by 'same'), the interior is handed to 'fill' without invoking the callback, otherwise
+    // the rectangle is split in two along its longer side (sharing the split line) and each half is
+    // processed the same way. Features thinner than a pixel that don't touch any border are missed,
+    // which is the usual trade-off for escape-time renders.
+    //
+    //   callback: Value(int x, int y, WorldT wx, WorldT wy)      (caller stores the value)
+    //   same:     bool(const Value& a, const Value& b)
+    //   fill:     void(int x0, int y0, int x1, int y1, const Value& v)   (half-open pixel rect)
+    //
+    // Cells are claimed in plan order from P like forEachWorldTilePixel and a cell is never split
+    // across frames, so the budget is checked between cells.
+    template<typename WorldT = T, typename Callback, typename SameFn, typename FillFn>
+    bool forEachWorldPixelAdaptive(
+        TileBlockProgress& P, // progress tracker
+        Callback&& callback,
+        SameFn&& same,
+        FillFn&& fill,
+        int thread_count = Thread::threadCount(),
+        int budget_ms = 16, // 0 = no timeout (finish in this call)
+        int cell_size = 64,
+        AdaptiveFillStats* stats = nullptr,
+        const Thread::CancellationToken* cancel = nullptr // checked between cells
     )
     {
         using namespace detail;
+        using Value = std::remove_cvref_t<std::invoke_result_t<Callback&, int, int, WorldT, WorldT>>;
 
-        ensureBlocksBuilt(P, raster_w, raster_h, tile_w, tile_h, block_w, block_h);
+        static_assert(!std::is_void_v<Value>,
+            "Callback must return a comparable value: Value(int x, int y, float_t wx, float_t wy)");
+        static_assert(std::is_invocable_r_v<bool, SameFn&, const Value&, const Value&>,
+            "Same predicate must be: bool(const Value& a, const Value& b)");
 
-        // initialize cursors if thread_count changed
-        P.ensure_owner_slots(thread_count);
+        // one block per cell
+        ensureBlocksBuilt(P, raster_w, raster_h, cell_size, cell_size, cell_size, cell_size);
 
         const int N = static_cast<int>(P.blocks.size());
         if (N == 0) return true;
 
+        // a pass left unfinished for an older view is discarded rather than mixed in
+        const uint64_t generation = beginPass(P, cancel);
+
+        const int first_block = P.next_block.load(std::memory_order_relaxed);
+        if (first_block == 0)
+            std::fill(P.blocks_done_per_tile.begin(), P.blocks_done_per_tile.end(), 0u);
+
         const bool no_timeout = (budget_ms == 0);
         const double t_end = no_timeout ? std::numeric_limits<double>::max() : (now_ms() + double(budget_ms));
 
-        // world quad
-        Quad<WorldT> world_quad = static_cast<Quad<WorldT>>(WorldObjectT<T>::worldQuad());
-        const WorldT ax = world_quad.a.x, ay = world_quad.a.y;
-        const WorldT bx = world_quad.b.x, by = world_quad.b.y;
-        const WorldT cx = world_quad.c.x, cy = world_quad.c.y;
-        const WorldT dx = world_quad.d.x, dy = world_quad.d.y;
+        const WorldScan<WorldT> scan(
+            static_cast<Quad<WorldT>>(WorldObjectT<T>::worldQuad()),
+            raster_w, raster_h, world_step_mode);
 
-        const WorldT t_bmp_w = static_cast<WorldT>(raster_w);
-        const WorldT t_bmp_h = static_cast<WorldT>(raster_h);
+        // Rectangles are inclusive and cell-local
+        struct Rect { int x0, y0, x1, y1; };
 
-        // one persistent task per worker
-        std::vector<std::future<void>> futs;
-        futs.reserve(thread_count);
+        // Rectangles with an interior this thin are evaluated directly instead of being split further
+        constexpr int min_interior = 4;
 
-        for (int k = 0; k < thread_count; ++k)
+        struct Scratch
         {
-            futs.push_back(Thread::pool().submit_task([&, owner_id = k]()
-            {
-                int M = P.owner_count;              // threads used for this plan
-                int cur = P.owner_cursor[owner_id]; // blocks already consumed by this owner
-                auto idx_from_cur = [&](int c) {
-                    return owner_id + c * M;
-                };
+            std::vector<Value>   values;
+            std::vector<uint8_t> known;
+            std::vector<Rect>    stack;
+        };
+        std::vector<Scratch> scratch(std::max(1, thread_count));
 
-                while (true)
-                {
-                    // stop between blocks only
-                    if (!no_timeout && now_ms() >= t_end)
-                        break;
+        auto render_cell = [&](int bi, int wi)
+        {
+            const TileBlock& b = P.blocks[P.order[bi]];
+            const int cw = b.x1 - b.x0;
+            const int ch = b.y1 - b.y0;
 
-                    int bi = idx_from_cur(cur);
-                    if (bi >= N)
-                        break; // this owner finished its sequence
+            Scratch& S = scratch[wi];
+            S.values.resize(size_t(cw) * ch);
+            S.known.assign(size_t(cw) * ch, 0);
+            S.stack.clear();
 
-                    const TileBlock b = P.blocks[bi];
-                    const int x0 = b.x0, x1 = b.x1, y0 = b.y0, y1 = b.y1;
+            uint64_t evaluated = 0, filled = 0;
 
-                    // render micro-block
-                    for (int row = y0; row < y1; ++row)
-                    {
-                        const WorldT bmp_fy = static_cast<WorldT>(row) + WorldT{ 0.5 };
-                        const WorldT v = bmp_fy / t_bmp_h;
+            // evaluate cell-local pixels [lx0, lx1) of 'row' that haven't been evaluated yet
+            auto evalSpan = [&](int row, int lx0, int lx1)
+            {
+                forEachWorldRowPixel(scan, b.y0 + row, b.x0 + lx0, b.x0 + lx1, [&](int bmp_x, const WorldT& wx, const WorldT& wy)
+                {
+                    const size_t i = size_t(row) * cw + (bmp_x - b.x0);
+                    if (S.known[i]) return;
+                    S.values[i] = callback(bmp_x, b.y0 + row, wx, wy);
+                    S.known[i] = 1;
+                    ++evaluated;
+                });
+            };
 
-                        const WorldT scan_left_x = ax + (dx - ax) * v;
-                        const WorldT scan_left_y = ay + (dy - ay) * v;
-                        const WorldT scan_right_x = bx + (cx - bx) * v;
-                        const WorldT scan_right_y = by + (cy - by) * v;
+            S.stack.push_back(Rect{ 0, 0, cw - 1, ch - 1 });
+            while (!S.stack.empty())
+            {
+                const Rect r = S.stack.back();
+                S.stack.pop_back();
 
-                        for (int bmp_x = x0; bmp_x < x1; ++bmp_x)
-                        {
-                            const WorldT bmp_fx = static_cast<WorldT>(bmp_x) + WorldT{ 0.5 };
-                            const WorldT u = bmp_fx / t_bmp_w; // TODO: Not efficient for f128 WorldT. Either cache or calculate offset in double precision
+                // border
+                evalSpan(r.y0, r.x0, r.x1 + 1);
+                evalSpan(r.y1, r.x0, r.x1 + 1);
+                for (int y = r.y0 + 1; y < r.y1; ++y)
+                {
+                    evalSpan(y, r.x0, r.x0 + 1);
+                    evalSpan(y, r.x1, r.x1 + 1);
+                }
 
-                            const WorldT wx = scan_left_x + (scan_right_x - scan_left_x) * u;
-                            const WorldT wy = scan_left_y + (scan_right_y - scan_left_y) * u;
+                const int inner_w = r.x1 - r.x0 - 1;
+                const int inner_h = r.y1 - r.y0 - 1;
+                if (inner_w <= 0 || inner_h <= 0)
+                    continue;
 
-                            if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT, int>)
-                                std::forward<Callback>(callback)(bmp_x, row, wx, wy, b.tile_index);
-                            else if constexpr (std::is_invocable_r_v<void, Callback, int, int, WorldT, WorldT>)
-                                std::forward<Callback>(callback)(bmp_x, row, wx, wy);
-                        }
-                    }
-                    ++cur; // advance owner's local cursor
+                const Value& v = S.values[size_t(r.y0) * cw + r.x0];
+                bool uniform = true;
+                for (int x = r.x0; x <= r.x1 && uniform; ++x)
+                {
+                    uniform = same(v, S.values[size_t(r.y0) * cw + x]) &&
+                              same(v, S.values[size_t(r.y1) * cw + x]);
+                }
+                for (int y = r.y0 + 1; y < r.y1 && uniform; ++y)
+                {
+                    uniform = same(v, S.values[size_t(y) * cw + r.x0]) &&
+                              same(v, S.values[size_t(y) * cw + r.x1]);
                 }
 
-                // write back owner's progress
-                P.owner_cursor[owner_id] = cur;
-            }));
-        }
+                if (uniform)
+                {
+                    fill(b.x0 + r.x0 + 1, b.y0 + r.y0 + 1, b.x0 + r.x1, b.y0 + r.y1, v);
+                    filled += uint64_t(inner_w) * inner_h;
+                }
+                else if (inner_w <= min_interior || inner_h <= min_interior)
+                {
+                    for (int y = r.y0 + 1; y < r.y1; ++y)
+                        evalSpan(y, r.x0 + 1, r.x1);
+                }
+                else if (r.x1 - r.x0 >= r.y1 - r.y0)
+                {
+                    const int mx = (r.x0 + r.x1) / 2;
+                    S.stack.push_back(Rect{ r.x0, r.y0, mx, r.y1 });
+                    S.stack.push_back(Rect{ mx, r.y0, r.x1, r.y1 });
+                }
+                else
+                {
+                    const int my = (r.y0 + r.y1) / 2;
+                    S.stack.push_back(Rect{ r.x0, r.y0, r.x1, my });
+                    S.stack.push_back(Rect{ r.x0, my, r.x1, r.y1 });
+                }
+            }
 
-        for (auto& f : futs)
-            f.get();
+            markDirty(b.x0, b.y0, b.x1, b.y1);
+            P.mark_block_done(b.tile_index);
 
-        bool finished = true;
-        for (int k = 0; k < P.owner_count; ++k) {
-            const int bi = k + P.owner_cursor[k] * P.owner_count;
-            if (bi < N) { finished = false; break; }
+            if (stats)
+            {
+                stats->evaluated.fetch_add(evaluated, std::memory_order_relaxed);
+                stats->filled.fetch_add(filled, std::memory_order_relaxed);
+            }
+        };
+
+        // stop between cells only
+        const int resume_block = Thread::forEachClaimed(first_block, N, render_cell, [&] {
+            return (!no_timeout && now_ms() >= t_end) || (cancel && cancel->cancelledSince(generation));
+        }, thread_count);
+
+        if (cancel && cancel->cancelledSince(generation)) {
+            cancelPass(P);
+            return false;
         }
 
-        if (finished) {
-            P.reset_progress_only();
+        if (resume_block >= N) {
+            P.next_block.store(0, std::memory_order_relaxed);
             return true;
         }
+
+        P.next_block.store(resume_block, std::memory_order_relaxed);
         return false;
     }
 };
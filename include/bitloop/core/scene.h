@@ -43,6 +43,7 @@ class SceneBase : public ChangeTracker
     std::vector<std::pair<int, SnapshotBatchCallbacks>> snapshot_callbacks;
 
     bool needs_redraw = false;
+    int  draw_slot = 0; // snapshot slot of the frame being drawn
 
     virtual void _initGUI() {}
     virtual void _destroyGUI() {}
@@ -98,6 +99,7 @@ class SceneBase : public ChangeTracker
     //
 
     void _onEncodeFrame(EncodeFrame& data, int request_id, const CapturePreset& preset);
+    void _onFrameReadBack(EncodeFrame& data, int request_id, const CapturePreset& preset);
 
     //
 
@@ -158,6 +160,13 @@ public:
     virtual void viewportDraw(Viewport*) const = 0;
     virtual void onEndFrame() {}
 
+    // Pipelined drawing (opt-in). Return true if viewportDraw() only reads state copied in
+    // snapshotDrawState(slot), so the worker can process the next frame while this one is drawn.
+    // Keep one copy per slot (see SharedSync::max_pipeline_depth) and read it back with drawSlot().
+    [[nodiscard]] virtual bool supportsPipelinedDraw() const { return false; }
+    virtual void snapshotDrawState(int slot [[maybe_unused]]) {}
+    [[nodiscard]] int drawSlot() const { return draw_slot; }
+
     virtual void onEvent(Event) {}
 
     virtual void onPointerEvent(PointerEvent) {}
@@ -191,6 +200,9 @@ public:
     void permitCaptureFrame(bool b);
 
     virtual void onBeginSnapshot() {}
+    // Called as the frame is captured, while the scene state still matches it. The pixels are read back
+    // asynchronously and aren't in 'data' yet: attach metadata (data.payload) here, and use the snapshot
+    // complete callback for anything that needs the pixels.
     virtual void onEncodeFrame(EncodeFrame& data [[maybe_unused]], const CapturePreset& preset [[maybe_unused]]) {}
 
     void beginSnapshotList(
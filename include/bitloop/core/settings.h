@@ -3,6 +3,7 @@
 #include <bitloop/core/capture_manager.h>
 #include <bitloop/core/snapshot_presets.h>
 #include <bitloop/imguix/imguix.h>
+#include <bitloop/util/frame_pacer.h>
 
 BL_BEGIN_NS;
 
@@ -29,11 +30,14 @@ struct SettingsConfig
     #endif
 
     int     record_fps = 60;
+    FrameOverrunPolicy frame_overrun_policy = FrameOverrunPolicy::SKIP;
     int     record_frame_count = 0;
     int     record_quality = 100;
     bool    record_lossless = true;
     int     record_near_lossless = 100;
 
+    int     pipeline_depth = 1; // 1 = lockstep worker/GUI handoff, 2-3 = pipelined (scenes must opt in)
+
     bool    show_fps = false;
     bool    fill_viewport = false;
 
@@ -8,9 +8,14 @@
 #include <condition_variable>
 #include <future>
 #include <atomic>
+#include <latch>
+#include <exception>
+#include <chrono>
 #include <memory>
 
 #include <vector>
+#include <deque>
+#include <algorithm>
 
 #include <type_traits>
 #include <span>
@@ -132,37 +137,418 @@ namespace Thread
         return { start, start + size };   // [start, end)
     }
 
-    //template<typename T, typename Callback>
-    //void forEachBatch(std::vector<T>& items, Callback&& callback, int thread_count = Thread::threadCount())
-    //{
-    //    int item_count = (int)items.size();
-    //    std::vector<std::pair<int, int>> ranges = Thread::splitRanges<int>(item_count, thread_count);
+    // ======== Cancellation ========
     //
-    //    std::vector<std::future<void>> futures(thread_count);
+    // A generation counter that long-running work can poll. cancel() trips every observer that
+    // took a snapshot before it, so no reset is needed before the next piece of work starts.
+    // e.g. CameraInfo trips its changeToken() whenever the view changes.
+
+    class CancellationToken
+    {
+        std::atomic<uint64_t> generation{ 0 };
+
+    public:
+
+        CancellationToken() = default;
+        CancellationToken(const CancellationToken&) = delete;
+        CancellationToken& operator=(const CancellationToken&) = delete;
+
+        void cancel() { generation.fetch_add(1, std::memory_order_release); }
+
+        [[nodiscard]] uint64_t snapshot() const { return generation.load(std::memory_order_acquire); }
+        [[nodiscard]] bool cancelledSince(uint64_t snap) const { return snapshot() != snap; }
+    };
+
+    // ======== Work-stealing scheduler ========
+    //
+    // Runs an index range [begin, end) on the pool with one persistent task per worker.
+    // Each worker owns a deque of ranges, seeded with an even split. The owner lazily
+    // halves its newest range until it is no larger than 'grain', runs that chunk and
+    // pushes the other halves back. Idle workers steal the oldest (largest) range from
+    // the front of a victim's deque, so expensive regions are redistributed at runtime.
+    //
+    // Unclaimed ranges stay queued when a run is stopped early, so the same scheduler
+    // can be resumed on a later call (e.g. once per frame with a time budget).
+
+    struct WorkStealingStats
+    {
+        std::vector<uint32_t> tasks_run;    // chunks executed, per worker
+        std::vector<uint32_t> tasks_stolen; // successful steals, per worker
+
+        [[nodiscard]] uint32_t totalRun() const {
+            uint32_t n = 0; for (uint32_t v : tasks_run) n += v; return n;
+        }
+        [[nodiscard]] uint32_t totalStolen() const {
+            uint32_t n = 0; for (uint32_t v : tasks_stolen) n += v; return n;
+        }
+    };
+
+    [[nodiscard]] inline int defaultGrain(int count, int worker_count)
+    {
+        // ~16 chunks per worker before stealing starts to matter
+        return std::max(1, count / (std::max(1, worker_count) * 16));
+    }
+
+    class WorkStealingScheduler
+    {
+        struct Range { int begin, end; };
+
+        struct alignas(64) Worker
+        {
+            std::mutex mutex;
+            std::deque<Range> ranges; // owner pops back, thieves pop front
+            uint32_t run = 0;
+            uint32_t stolen = 0;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<int> unclaimed{ 0 };
+        int grain = 1;
+
+        // Idle workers park on 'epoch', bumped whenever ranges become stealable or the last index
+        // is claimed (only woken if someone is actually parked)
+        std::atomic<uint32_t> epoch{ 0 };
+        std::atomic<int> parked{ 0 };
+
+        void wakeParked()
+        {
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+            if (parked.load(std::memory_order_seq_cst) > 0)
+                epoch.notify_all();
+        }
+
+        bool popLocal(int wi, Range& out)
+        {
+            Worker& w = *workers[wi];
+            std::lock_guard<std::mutex> lock(w.mutex);
+            if (w.ranges.empty())
+                return false;
+
+            Range r = w.ranges.back();
+            w.ranges.pop_back();
+
+            // lazy binary splitting: keep the front half, queue the back half
+            const bool split = r.end - r.begin > grain;
+            while (r.end - r.begin > grain)
+            {
+                const int mid = r.begin + (r.end - r.begin) / 2;
+                w.ranges.push_back({ mid, r.end });
+                r.end = mid;
+            }
+
+            const int n = r.end - r.begin;
+            const bool last = unclaimed.fetch_sub(n, std::memory_order_acq_rel) == n;
+            ++w.run;
+            out = r;
+
+            if (split || last)
+                wakeParked();
+            return true;
+        }
+
+        bool steal(int wi, Range& out)
+        {
+            const int W = static_cast<int>(workers.size());
+            for (int i = 1; i < W; ++i)
+            {
+                Worker& victim = *workers[(wi + i) % W];
+                Range r;
+                {
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    if (victim.ranges.empty())
+                        continue;
+
+                    r = victim.ranges.front();
+                    if (r.end - r.begin > grain)
+                    {
+                        // leave the front half for the victim, take the back half
+                        const int mid = r.begin + (r.end - r.begin) / 2;
+                        victim.ranges.front().end = mid;
+                        r.begin = mid;
+                    }
+                    else
+                    {
+                        victim.ranges.pop_front();
+                    }
+                }
+
+                {
+                    Worker& self = *workers[wi];
+                    std::lock_guard<std::mutex> lock(self.mutex);
+                    self.ranges.push_back(r);
+                    ++self.stolen;
+                }
+                wakeParked();
+                out = r;
+                return true;
+            }
+            return false;
+        }
+
+        template<typename Fn, typename StopFn>
+        void workerLoop(int wi, Fn& fn, StopFn& should_stop)
+        {
+            Range r;
+            while (unclaimed.load(std::memory_order_acquire) > 0)
+            {
+                if (should_stop())
+                    break;
+
+                const uint32_t seen = epoch.load(std::memory_order_seq_cst);
+
+                if (popLocal(wi, r))
+                {
+                    fn(r.begin, r.end, wi);
+                    continue;
+                }
+
+                // stolen ranges are queued locally, claimed on the next popLocal()
+                if (steal(wi, r))
+                    continue;
+
+                // remaining work is in flight between deques, sleep until it lands or runs out
+                parked.fetch_add(1, std::memory_order_seq_cst);
+                if (unclaimed.load(std::memory_order_acquire) > 0)
+                    epoch.wait(seen, std::memory_order_seq_cst);
+                parked.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+    public:
+
+        WorkStealingScheduler() = default;
+        WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+        WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+        [[nodiscard]] int workerCount() const { return static_cast<int>(workers.size()); }
+        [[nodiscard]] int pending() const { return unclaimed.load(std::memory_order_acquire); }
+        [[nodiscard]] bool finished() const { return pending() == 0; }
+
+        // Queue [begin, end) split evenly across 'worker_count' deques (clears stats)
+        void reset(int begin, int end, int worker_count, int chunk_grain = 0)
+        {
+            worker_count = std::max(1, worker_count);
+            if (workerCount() != worker_count)
+            {
+                workers.clear();
+                for (int i = 0; i < worker_count; ++i)
+                    workers.push_back(std::make_unique<Worker>());
+            }
+
+            const int count = std::max(0, end - begin);
+            grain = (chunk_grain > 0) ? chunk_grain : defaultGrain(count, worker_count);
+
+            auto ranges = splitRanges<int>(count, worker_count);
+            for (int i = 0; i < worker_count; ++i)
+            {
+                Worker& w = *workers[i];
+                w.ranges.clear();
+                w.run = 0;
+                w.stolen = 0;
+                if (ranges[i].second > ranges[i].first)
+                    w.ranges.push_back({ begin + ranges[i].first, begin + ranges[i].second });
+            }
+
+            unclaimed.store(count, std::memory_order_release);
+        }
+
+        // Change worker count without losing queued ranges (clears stats)
+        void resize(int worker_count)
+        {
+            worker_count = std::max(1, worker_count);
+            if (workerCount() == worker_count)
+                return;
+
+            std::vector<Range> queued;
+            for (auto& w : workers)
+                queued.insert(queued.end(), w->ranges.begin(), w->ranges.end());
+
+            workers.clear();
+            for (int i = 0; i < worker_count; ++i)
+                workers.push_back(std::make_unique<Worker>());
+
+            for (size_t i = 0; i < queued.size(); ++i)
+                workers[i % worker_count]->ranges.push_back(queued[i]);
+        }
+
+        // fn(int i0, int i1, int worker_index) is invoked once per claimed chunk.
+        // Returns true once every index has been claimed and run.
+        template<typename Fn, typename StopFn>
+        bool run(Fn&& fn, StopFn&& should_stop)
+        {
+            const int W = workerCount();
+            if (W == 0 || finished())
+                return true;
+
+            std::vector<std::future<void>> futs;
+            futs.reserve(W);
+            for (int wi = 0; wi < W; ++wi)
+            {
+                futs.emplace_back(Thread::pool().submit_task([this, wi, &fn, &should_stop] {
+                    workerLoop(wi, fn, should_stop);
+                }));
+            }
+            for (auto& f : futs) if (f.valid()) f.get();
+
+            return finished();
+        }
+
+        template<typename Fn>
+        bool run(Fn&& fn)
+        {
+            return run(std::forward<Fn>(fn), [] { return false; });
+        }
+
+        [[nodiscard]] WorkStealingStats stats() const
+        {
+            WorkStealingStats s;
+            for (auto& w : workers)
+            {
+                s.tasks_run.push_back(w->run);
+                s.tasks_stolen.push_back(w->stolen);
+            }
+            return s;
+        }
+    };
+
+    // One-shot work-stealing loop over [begin, end), fn(int i0, int i1, int worker_index)
+    template<typename Fn>
+    void forEachRange(int begin, int end, Fn&& fn,
+        int thread_count = Thread::threadCount(),
+        int grain = 0,
+        WorkStealingStats* stats = nullptr)
+    {
+        WorkStealingScheduler scheduler;
+        scheduler.reset(begin, end, thread_count, grain);
+        scheduler.run(std::forward<Fn>(fn));
+        if (stats) *stats = scheduler.stats();
+    }
+
+    // As above, but collects one result per executed chunk (ordered by chunk start)
+    template<typename E, typename Fn>
+    [[nodiscard]] std::vector<E> forEachRangeCollect(int begin, int end, Fn&& fn,
+        int thread_count = Thread::threadCount(),
+        int grain = 0,
+        WorkStealingStats* stats = nullptr)
+    {
+        const int W = std::max(1, thread_count);
+        std::vector<std::vector<std::pair<int, E>>> per_worker(W);
+
+        forEachRange(begin, end, [&](int i0, int i1, int wi) {
+            per_worker[wi].emplace_back(i0, fn(i0, i1, wi));
+        }, W, grain, stats);
+
+        std::vector<std::pair<int, E>> chunks;
+        for (auto& v : per_worker)
+            for (auto& c : v) chunks.push_back(std::move(c));
+
+        std::sort(chunks.begin(), chunks.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::vector<E> out;
+        out.reserve(chunks.size());
+        for (auto& c : chunks) out.push_back(std::move(c.second));
+        return out;
+    }
+
+    // ======== Shared-cursor loop ========
     //
-    //    for (int ti = 0; ti < thread_count; ti++)
-    //    {
-    //        const std::pair<int, int>& range = ranges[ti];
-    //        futures[ti] = Thread::pool().submit_task([&]()
-    //        {
-    //            int i0 = range.first;
-    //            int i1 = range.second;
-    //            callback(i0, i1);
-    //        });
-    //    }
+    // One persistent task per worker claims indices in order from a shared atomic cursor
+    // until 'end' is reached or should_stop() is raised. The caller sleeps on a latch until
+    // every worker has returned. Claimed indices always run to completion, so the returned
+    // value (first index never claimed) is an exact resume point for the next call.
+    // If fn throws, the remaining workers stop claiming and the first exception is rethrown
+    // once every worker has returned.
+    // fn(int index, int worker_index)
+
+    template<typename Fn, typename StopFn>
+    int forEachClaimed(int begin, int end, Fn&& fn, StopFn&& should_stop,
+        int thread_count = Thread::threadCount())
+    {
+        if (begin >= end)
+            return end;
+
+        thread_count = std::max(1, thread_count);
+
+        std::atomic<int> cursor{ begin };
+        std::latch done(thread_count);
+
+        std::atomic<bool> failed{ false };
+        std::exception_ptr error;
+
+        for (int wi = 0; wi < thread_count; ++wi)
+        {
+            Thread::pool().detach_task([&, wi]
+            {
+                try
+                {
+                    while (!failed.load(std::memory_order_relaxed) && !should_stop())
+                    {
+                        const int i = cursor.fetch_add(1, std::memory_order_relaxed);
+                        if (i >= end)
+                            break;
+
+                        fn(i, wi);
+                    }
+                }
+                catch (...)
+                {
+                    // first failure wins, the caller is woken either way
+                    if (!failed.exchange(true, std::memory_order_acq_rel))
+                        error = std::current_exception();
+                }
+                done.count_down();
+            });
+        }
+
+        done.wait();
+        if (error)
+            std::rethrow_exception(error);
+
+        return std::min(cursor.load(std::memory_order_relaxed), end);
+    }
+
+    // ======== forEachBatch ========
     //
-    //    for (int ti = 0; ti < thread_count; ti++)
-    //    {
-    //        if (futures[ti].valid())
-    //            futures[ti].get();
-    //    }
-    //}
+    // Void callbacks are invoked on work-stealing chunks of 'items', so a batch is not necessarily
+    // one contiguous slice per thread. Value-returning callbacks keep the one-slice-per-thread
+    // contract: each thread's contiguous range is passed to a single call and the results are
+    // returned in range order (one per thread), so the callback can reduce its whole slice.
+    // For one result per work-stealing chunk, use forEachBatchChunks().
+
+    // One contiguous range per thread, fn(i0, i1, thread_index) -> E, results in range order
+    template<typename E, typename Fn>
+    [[nodiscard]] std::vector<E> forEachThreadRangeCollect(int count, Fn&& fn,
+        int thread_count = Thread::threadCount(),
+        WorkStealingStats* stats = nullptr)
+    {
+        auto ranges = Thread::splitRanges<int>(count, std::max(1, thread_count));
+
+        std::vector<E> out(ranges.size());
+        std::vector<std::future<void>> futs;
+        futs.reserve(ranges.size());
+        for (size_t ti = 0; ti < ranges.size(); ++ti)
+        {
+            auto [i0, i1] = ranges[ti];
+            futs.emplace_back(Thread::pool().submit_task([&fn, &out, i0, i1, ti] {
+                out[ti] = fn(i0, i1, static_cast<int>(ti));
+            }));
+        }
+        for (auto& f : futs) if (f.valid()) f.get();
+
+        if (stats)
+        {
+            stats->tasks_run.assign(ranges.size(), 1);
+            stats->tasks_stolen.assign(ranges.size(), 0);
+        }
+        return out;
+    }
 
     template<typename T, typename Callback>
         requires (std::invocable<Callback&, int, int> && !std::invocable<Callback&, std::span<T>>)
     auto forEachBatch(std::vector<T>& items,
         Callback&& callback,
-        int thread_count = Thread::threadCount())
+        int thread_count = Thread::threadCount(),
+        WorkStealingStats* stats = nullptr)
     {
         using CB = std::decay_t<Callback>;
         static_assert(std::is_invocable_v<CB&, int, int>);
@@ -170,34 +556,18 @@ namespace Thread
         using E = std::remove_cvref_t<R>;
 
         const int N = static_cast<int>(items.size());
-        auto ranges = Thread::splitRanges<int>(N, thread_count);
-
         CB cb = std::forward<Callback>(callback);
 
         if constexpr (std::is_void_v<R>) {
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, i0, i1] {
-                    cb(i0, i1);
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
+            forEachRange(0, N, [&cb](int i0, int i1, int) {
+                cb(i0, i1);
+            }, thread_count, 0, stats);
             return; // void
         }
         else {
-            std::vector<E> out(ranges.size());
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, i0, i1, &out, ti] {
-                    out[ti] = cb(i0, i1);
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
-            return out; // std::vector<E>
+            return forEachThreadRangeCollect<E>(N, [&cb](int i0, int i1, int) {
+                return cb(i0, i1);
+            }, thread_count, stats); // std::vector<E>, one per thread
         }
     }
 
@@ -206,41 +576,26 @@ namespace Thread
         requires std::invocable<Callback&, std::span<T>>
     auto forEachBatch(std::vector<T>& items,
         Callback&& callback,
-        int thread_count = Thread::threadCount())
+        int thread_count = Thread::threadCount(),
+        WorkStealingStats* stats = nullptr)
     {
         using CB = std::decay_t<Callback>;
         using R = std::invoke_result_t<CB&, std::span<T>>;
         using E = std::remove_cvref_t<R>;
 
         const int N = static_cast<int>(items.size());
-        auto ranges = Thread::splitRanges<int>(N, thread_count);
-
         CB cb = std::forward<Callback>(callback);
 
         if constexpr (std::is_void_v<R>) {
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, &items, i0, i1] {
-                    cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
+            forEachRange(0, N, [&cb, &items](int i0, int i1, int) {
+                cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
+            }, thread_count, 0, stats);
             return;
         }
         else {
-            std::vector<E> out(ranges.size());
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, &items, i0, i1, &out, ti] {
-                    out[ti] = cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
-            return out;
+            return forEachThreadRangeCollect<E>(N, [&cb, &items](int i0, int i1, int) {
+                return cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
+            }, thread_count, stats);
         }
     }
 
@@ -249,41 +604,27 @@ namespace Thread
         requires std::invocable<Callback&, std::span<T>, int>
     auto forEachBatch(std::vector<T>& items,
         Callback&& callback,
-        int thread_count = Thread::threadCount())
+        int thread_count = Thread::threadCount(),
+        WorkStealingStats* stats = nullptr)
     {
         using CB = std::decay_t<Callback>;
         using R = std::invoke_result_t<CB&, std::span<T>, int>;
         using E = std::remove_cvref_t<R>;
 
         const int N = static_cast<int>(items.size());
-        auto ranges = Thread::splitRanges<int>(N, thread_count);
-
         CB cb = std::forward<Callback>(callback);
 
+        // thread_index is stable for the whole call (safe for per-thread scratch)
         if constexpr (std::is_void_v<R>) {
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, &items, i0, i1, ti] {
-                    cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)), (int)ti);
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
+            forEachRange(0, N, [&cb, &items](int i0, int i1, int wi) {
+                cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)), wi);
+            }, thread_count, 0, stats);
             return;
         }
         else {
-            std::vector<E> out(ranges.size());
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, &items, i0, i1, &out, ti] {
-                    out[ti] = cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)), ti);
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
-            return out;
+            return forEachThreadRangeCollect<E>(N, [&cb, &items](int i0, int i1, int ti) {
+                return cb(std::span<T>(items.data() + i0, static_cast<size_t>(i1 - i0)), ti);
+            }, thread_count, stats);
         }
     }
 
@@ -292,48 +633,86 @@ namespace Thread
         requires std::invocable<Callback&, std::span<const T>>
     auto forEachBatch(const std::vector<T>& items,
         Callback&& callback,
-        int thread_count = Thread::threadCount())
+        int thread_count = Thread::threadCount(),
+        WorkStealingStats* stats = nullptr)
     {
         using CB = std::decay_t<Callback>;
         using R = std::invoke_result_t<CB&, std::span<const T>>;
         using E = std::remove_cvref_t<R>;
 
         const int N = static_cast<int>(items.size());
-        auto ranges = Thread::splitRanges<int>(N, thread_count);
-
         CB cb = std::forward<Callback>(callback);
 
         if constexpr (std::is_void_v<R>) {
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, &items, i0, i1] {
-                    cb(std::span<const T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
+            forEachRange(0, N, [&cb, &items](int i0, int i1, int) {
+                cb(std::span<const T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
+            }, thread_count, 0, stats);
             return;
         }
         else {
-            std::vector<E> out(ranges.size());
-            std::vector<std::future<void>> futs;
-            futs.reserve(ranges.size());
-            for (size_t ti = 0; ti < ranges.size(); ++ti) {
-                auto [i0, i1] = ranges[ti];
-                futs.emplace_back(Thread::pool().submit_task([&cb, &items, i0, i1, &out, ti] {
-                    out[ti] = cb(std::span<const T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
-                }));
-            }
-            for (auto& f : futs) if (f.valid()) f.get();
-            return out;
+            return forEachThreadRangeCollect<E>(N, [&cb, &items](int i0, int i1, int) {
+                return cb(std::span<const T>(items.data() + i0, static_cast<size_t>(i1 - i0)));
+            }, thread_count, stats);
         }
     }
+
+    // ======== forEachBatchChunks ========
+    //
+    // Work-stealing over 'items' with one result per executed chunk, ordered by chunk position.
+    // The callback takes (int i0, int i1), span, or (span, worker_index); results are usually
+    // combined afterwards by the caller.
+
+    template<typename Items, typename Callback>
+    [[nodiscard]] auto forEachBatchChunks(Items& items,
+        Callback&& callback,
+        int thread_count = Thread::threadCount(),
+        int grain = 0,
+        WorkStealingStats* stats = nullptr)
+    {
+        using T = std::remove_reference_t<decltype(*items.data())>;
+        using Span = std::span<T>;
+
+        auto call = [&callback, &items](int i0, int i1, int wi) -> decltype(auto)
+        {
+            if constexpr (std::is_invocable_v<Callback&, Span, int>)
+                return callback(Span(items.data() + i0, static_cast<size_t>(i1 - i0)), wi);
+            else if constexpr (std::is_invocable_v<Callback&, Span>)
+                return callback(Span(items.data() + i0, static_cast<size_t>(i1 - i0)));
+            else
+                return callback(i0, i1);
+        };
+
+        using E = std::remove_cvref_t<decltype(call(0, 0, 0))>;
+        static_assert(!std::is_void_v<E>, "forEachBatchChunks: callback must return a value (use forEachBatch)");
+
+        return forEachRangeCollect<E>(0, static_cast<int>(items.size()), call, thread_count, grain, stats);
+    }
 }
 
 // todo: Move to new thread_sync.h
+// Frame handoff counters, updated under SharedSync::state_mutex
+struct FrameHandoffStats
+{
+    int    depth = 1;                  // effective pipeline depth of the last published frame
+    double latency_ms = 0;             // publish -> GUI draw (smoothed)
+    double publish_interval_ms = 0;    // worker throughput (smoothed)
+    double consume_interval_ms = 0;    // GUI throughput (smoothed)
+    uint64_t frames_published = 0;
+    uint64_t frames_consumed = 0;
+
+    [[nodiscard]] double workerFPS() const { return publish_interval_ms > 0 ? 1000.0 / publish_interval_ms : 0.0; }
+    [[nodiscard]] double drawFPS() const   { return consume_interval_ms > 0 ? 1000.0 / consume_interval_ms : 0.0; }
+};
+
 struct SharedSync
 {
+    using steady_clock = std::chrono::steady_clock;
+
+    // Frames the worker may run ahead of the GUI. A depth of 1 is strict lockstep (the GUI draws
+    // frame N before the worker starts N+1). Deeper pipelines publish a per-frame draw snapshot
+    // into slot (frame % max_pipeline_depth), and the GUI draws every published frame in order.
+    static constexpr int max_pipeline_depth = 3;
+
     std::atomic<bool> quitting{ false };
     std::atomic<bool> updating_live_buffer{ false };
 
@@ -345,24 +724,101 @@ struct SharedSync
     std::condition_variable cv_updating_live_buffer;
 
     bool project_thread_started = false;
-    bool frame_ready_to_draw = false;
-    bool frame_consumed = false;
+    bool frame_ready_to_draw = false; // published frames waiting to be drawn
+    bool frame_consumed = false;      // every published frame has been drawn
+
+    // guarded by state_mutex
+    uint64_t frames_published = 0;
+    uint64_t frames_consumed = 0;
+    steady_clock::time_point published_at[max_pipeline_depth]{};
+    steady_clock::time_point last_published{};
+    steady_clock::time_point last_consumed{};
+    FrameHandoffStats stats;
+
+    // worker frame intervals measured by its FramePacer, drained by the GUI for display
+    static constexpr size_t max_paced_intervals = 256;
+    std::vector<double> paced_intervals_ms;
 
     std::atomic<bool> immediate_update{ false };
 
-    void flag_ready_to_draw()
+    // slot the next published frame should snapshot its draw state into (state_mutex held)
+    [[nodiscard]] int publish_slot() const
     {
-        std::lock_guard<std::mutex> lock(state_mutex);
+        return static_cast<int>(frames_published % max_pipeline_depth);
+    }
+
+    // state_mutex held
+    void publish_frame_locked(int depth)
+    {
+        const auto now = steady_clock::now();
+        if (frames_published > 0)
+            smooth(stats.publish_interval_ms, now - last_published);
+
+        published_at[publish_slot()] = now;
+        last_published = now;
+        ++frames_published;
+
         frame_ready_to_draw = true;
         frame_consumed = false;
+
+        stats.depth = depth;
+        stats.frames_published = frames_published;
+    }
+
+    // state_mutex held (oldest intervals dropped if the GUI stops draining them)
+    void push_paced_interval_locked(double ms)
+    {
+        if (paced_intervals_ms.size() >= max_paced_intervals)
+            paced_intervals_ms.erase(paced_intervals_ms.begin());
+        paced_intervals_ms.push_back(ms);
+    }
+
+    // state_mutex held, returns the draw slot of the oldest undrawn frame
+    int consume_frame_locked()
+    {
+        const int slot = static_cast<int>(frames_consumed % max_pipeline_depth);
+        const auto now = steady_clock::now();
+
+        if (frames_consumed < frames_published)
+        {
+            smooth(stats.latency_ms, now - published_at[slot]);
+            if (frames_consumed > 0)
+                smooth(stats.consume_interval_ms, now - last_consumed);
+            last_consumed = now;
+            ++frames_consumed;
+        }
+
+        frame_ready_to_draw = frames_consumed < frames_published;
+        frame_consumed = !frame_ready_to_draw;
+
+        stats.frames_consumed = frames_consumed;
+        return slot;
     }
 
+    void flag_ready_to_draw()
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        publish_frame_locked(1);
+    }
+
+    // Lockstep: wait until every published frame has been drawn
     void wait_until_gui_consumes_frame()
     {
         std::unique_lock<std::mutex> lock(state_mutex);
         cv.wait(lock, [this] { return frame_consumed || quitting.load(); });
     }
 
+    // Pipelined: wait until publishing one more frame keeps (depth-1) or fewer frames queued,
+    // and returns with state_mutex held so the snapshot + publish happen atomically
+    [[nodiscard]] std::unique_lock<std::mutex> wait_for_free_frame_slot(int depth)
+    {
+        const uint64_t max_queued = static_cast<uint64_t>(std::max(std::clamp(depth, 1, max_pipeline_depth) - 1, 1));
+
+        std::unique_lock<std::mutex> lock(state_mutex);
+        cv.wait(lock, [&] { return frames_published - frames_consumed < max_queued || quitting.load(); });
+        return lock;
+    }
+
     void wait_until_live_buffer_updated()
     {
         std::unique_lock<std::mutex> live_lock(live_buffer_mutex);
@@ -386,6 +842,14 @@ struct SharedSync
     {
         return immediate_update.load(std::memory_order_acquire);
     }
+
+private:
+
+    static void smooth(double& avg_ms, steady_clock::duration dt)
+    {
+        const double ms = std::chrono::duration<double, std::milli>(dt).count();
+        avg_ms = (avg_ms == 0) ? ms : avg_ms + (ms - avg_ms) * 0.05;
+    }
 };
 
 BL_END_NS
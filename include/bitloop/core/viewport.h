@@ -31,7 +31,13 @@ protected:
     SceneBase* scene = nullptr; // mounted scene
 
     static inline float focus_flash_frames = 20.0f;
-    float focused_dt = 0;
+    float focused_dt = 0; // focus flash countdown, GUI thread only
+
+    // offscreen surface the mounted scene draws into, composited into the project canvas
+    GLSurface surface;
+    f64 surface_scale = 0;        // canvas scale the surface was last drawn at
+    bool redrawn = false;         // redrawn on the last project draw (otherwise the old surface was reused)
+    double dt_viewportDraw = 0;   // time taken by the last redraw (ms)
 
 public:
     
@@ -50,6 +56,9 @@ public:
     [[nodiscard]] int viewportGridX() const { return viewport_grid_x; }
     [[nodiscard]] int viewportGridY() const { return viewport_grid_y; }
 
+    [[nodiscard]] double viewport_draw_dt() const { return dt_viewportDraw; } // last redraw only (not composite)
+    [[nodiscard]] bool   redrawnLastFrame() const { return redrawn; }
+
     //[[nodiscard]] double posX() const { return x; }
     //[[nodiscard]] double posY() const { return y; }
 
@@ -3,10 +3,12 @@
 #include <imgui.h>
 #include <bitloop/platform/platform.h>
 #include <bitloop/core/threads.h>
+#include <bitloop/core/precision_tier.h>
+#include <bitloop/nanovgx/nano_bitmap.h>
 
 BL_BEGIN_NS;
 
-void threadsDebugInfo()
+inline void threadsDebugInfo()
 {
     ImGui::Begin("Threads Info", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
     ImGui::Text("BSL Threads: %d", (int)Thread::pool().get_thread_count());
@@ -77,4 +79,35 @@ inline void dpiDebugInfo()
     #endif
 }
 
+inline void imageUploadDebugInfo()
+{
+    const ImageUploadStats& stats = imageUploadStats();
+
+    ImGui::Text("---- Image Uploads (last frame) ----");
+    ImGui::Text("Bytes:                 %.2f MB", double(stats.last_frame_bytes) / (1024.0 * 1024.0));
+    ImGui::Text("Sub-rects:            %d", stats.last_frame_rects);
+    ImGui::Text("Mipmap rebuilds:   %d", stats.last_frame_mipmaps);
+    ImGui::Text("Total:                  %.1f MB", double(stats.total_bytes) / (1024.0 * 1024.0));
+}
+
+inline void precisionTierDebugInfo()
+{
+    const PrecisionTierReport& report = precisionTierReport();
+    const int tier = report.tier.load(std::memory_order_relaxed);
+
+    ImGui::Text("---- Precision Tier ----");
+    if (tier < 0)
+    {
+        ImGui::Text("No PrecisionTierSelector in use");
+        return;
+    }
+
+    const FloatingPointType type = FloatingPointType(tier);
+    ImGui::Text("Tier:                    %s", floatingPointTypeName(type));
+    ImGui::Text("Required bits:       %d / %d", report.required_bits.load(std::memory_order_relaxed), mantissaBits(type));
+    if (report.exhausted.load(std::memory_order_relaxed))
+        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.3f, 1.0f), "Precision exhausted");
+    ImGui::Text("Tier switches:        %llu", (unsigned long long)report.switches.load(std::memory_order_relaxed));
+}
+
 BL_END_NS;
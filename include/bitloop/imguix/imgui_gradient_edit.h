@@ -191,6 +191,10 @@ public:
         c = m_cachedColors[(int)(position * CACHE_SIZE_M1)];
     }
 
+    // out[i] = colour at position[i] for a whole batch (clamped to [0, 1], NaN -> first colour), uses
+    // the active CPU kernel variant
+    void mapRGBA(const float* positions, uint32_t* out, size_t n) const;
+
     size_t hash() const
     {
         return _hash;
@@ -13,22 +13,80 @@
 
 BL_BEGIN_NS
 
+enum struct ImageMipmaps
+{
+    NONE,       // no mip chain (linear filtering), cheapest when drawn near 1:1
+    ON_UPLOAD,  // regenerate the whole chain after every upload (default)
+    DEFERRED    // regenerate once the image stops changing (a progressive render finished). Opt-in:
+                // while uploads continue, minified draws sample a stale chain
+};
+
+// Texture upload counters for all Images, shown in the debug UI. Updated on the GUI thread.
+struct ImageUploadStats
+{
+    uint64_t frame_bytes = 0;       // bytes uploaded since endFrame()
+    int      frame_rects = 0;       // glTexSubImage2D calls since endFrame()
+    int      frame_mipmaps = 0;     // mip chain rebuilds since endFrame()
+
+    uint64_t last_frame_bytes = 0;
+    int      last_frame_rects = 0;
+    int      last_frame_mipmaps = 0;
+    uint64_t total_bytes = 0;
+
+    void endFrame()
+    {
+        last_frame_bytes = frame_bytes;
+        last_frame_rects = frame_rects;
+        last_frame_mipmaps = frame_mipmaps;
+        frame_bytes = 0;
+        frame_rects = 0;
+        frame_mipmaps = 0;
+    }
+};
+
+[[nodiscard]] inline ImageUploadStats& imageUploadStats()
+{
+    static ImageUploadStats stats;
+    return stats;
+}
+
 class Image : public virtual RasterGrid
 {
     friend class SimplePainter;
     friend class Painter;
 
+public:
+
+    // Dirty regions are tracked on a grid of (1 << dirty_cell_shift) px square cells
+    static constexpr int dirty_cell_shift = 5;
+
 protected:
 
     // mutable: silently refresh nanovg data when necessary
     mutable int nano_img = 0;
     mutable bool pending_resize = false;
+    mutable bool mipmaps_stale = false;
 
     // non-mutable
     std::vector<uint8_t> pixels;
 
     uint32_t* colors;
 
+    ImageMipmaps mipmap_mode = ImageMipmaps::ON_UPLOAD;
+
+    // one flag per cell, set by writers (any thread), claimed by refreshData (GUI thread)
+    mutable std::vector<uint8_t> dirty_cells;
+    mutable std::vector<uint8_t> upload_cells; // cells claimed for the current upload
+    int dirty_cols = 0;
+    int dirty_rows = 0;
+
+    FORCE_INLINE void markCell(int cx, int cy) const
+    {
+        std::atomic_ref<uint8_t> flag(dirty_cells[size_t(cy) * dirty_cols + cx]);
+        if (!flag.load(std::memory_order_relaxed)) // avoid contending on shared cache lines
+            flag.store(1, std::memory_order_relaxed);
+    }
+
 public:
 
     Image() : RasterGrid(0, 0), colors(nullptr) {}
@@ -36,6 +94,15 @@ public:
     [[nodiscard]] int imageId() const { return nano_img; }
     [[nodiscard]] const uint8_t* data() const { return pixels.data(); }
 
+    // Takes effect the next time the texture is (re)created
+    void setMipmaps(ImageMipmaps mode)
+    {
+        if (mode == mipmap_mode) return;
+        mipmap_mode = mode;
+        pending_resize = true;
+    }
+    [[nodiscard]] ImageMipmaps mipmaps() const { return mipmap_mode; }
+
     void create(int w, int h) 
     {
         //raster_w = w; raster_h = h;
@@ -43,7 +110,30 @@ public:
         pixels.assign(size_t(w) * h * 4, 0);
         colors = reinterpret_cast<uint32_t*>(&pixels.front());
         pending_resize = true;
+
+        const int cell = 1 << dirty_cell_shift;
+        dirty_cols = (w + cell - 1) >> dirty_cell_shift;
+        dirty_rows = (h + cell - 1) >> dirty_cell_shift;
+        dirty_cells.assign(size_t(dirty_cols) * dirty_rows, 0);
     }
+
+    void markDirty(int x0, int y0, int x1, int y1) override
+    {
+        x0 = std::max(x0, 0); y0 = std::max(y0, 0);
+        x1 = std::min(x1, raster_w); y1 = std::min(y1, raster_h);
+        if (x0 >= x1 || y0 >= y1) return;
+
+        const int cx1 = (x1 - 1) >> dirty_cell_shift;
+        const int cy1 = (y1 - 1) >> dirty_cell_shift;
+        for (int cy = y0 >> dirty_cell_shift; cy <= cy1; ++cy)
+            for (int cx = x0 >> dirty_cell_shift; cx <= cx1; ++cx)
+                markCell(cx, cy);
+    }
+    void markAllDirty()
+    {
+        markDirty(0, 0, raster_w, raster_h);
+    }
+
     void clear(Color c)
     {
         if (pixels.size() == 0)
@@ -54,6 +144,7 @@ public:
         //uint32_t count = raster_w * raster_h;
         for (uint32_t i=0; i< count; i++)
             *pixel++ = u32;
+        markAllDirty();
     }
     void clear(int r, int g, int b, int a)
     {
@@ -64,6 +155,7 @@ public:
     {
         size_t i = (size_t(y) * raster_w + x);
         colors[i] = rgba;
+        markCell(x >> dirty_cell_shift, y >> dirty_cell_shift);
     }
     void setPixel(int x, int y, int r, int g, int b, int a=255)
     {
@@ -72,6 +164,7 @@ public:
         pixels[i++] = g;
         pixels[i++] = b;
         pixels[i++] = a;
+        markCell(x >> dirty_cell_shift, y >> dirty_cell_shift);
     }
     void setPixelSafe(int x, int y, uint32_t rgba)
     {
@@ -85,6 +178,7 @@ public:
         pixels[i + 1] = (rgba >> 8) & 0xFF;
         pixels[i + 2] = (rgba >> 16) & 0xFF;
         pixels[i + 3] = (rgba >> 24) & 0xFF;
+        markCell(x >> dirty_cell_shift, y >> dirty_cell_shift);
     }
     void setPixelSafe(int x, int y, int r, int g, int b, int a = 255)
     {
@@ -98,6 +192,7 @@ public:
         pixels[i + 1] = g;
         pixels[i + 2] = b;
         pixels[i + 3] = a;
+        markCell(x >> dirty_cell_shift, y >> dirty_cell_shift);
     }
 
     [[nodiscard]] Color getPixel(int x, int y) const
@@ -124,6 +219,7 @@ public:
             pixels[i + 2] << 16 | 
             pixels[i + 3] << 24;
     }
+    // writes through the pointer aren't tracked, report them with markDirty()
     [[nodiscard]] uint32_t* getU32PtrSafe(int x, int y)
     {
         if ((unsigned)x >= (unsigned)raster_w ||
@@ -136,22 +232,118 @@ public:
 
 protected:
 
+    // Upload the changed cells. Each row of cells is merged into horizontal runs, one
+    // glTexSubImage2D per run, or a single full upload once most of the image changed.
     void refreshData(NVGcontext* vg) const
     {
         if (raster_w <= 0 || raster_h <= 0)
             return;
 
+        ImageUploadStats& stats = imageUploadStats();
+
         if (pending_resize)
         {
             if (nano_img) nvgDeleteImage(vg, nano_img);
             //nano_img = nvgCreateImageRGBA(vg, raster_w, raster_h, NVG_IMAGE_NEAREST, pixels.data());
-            nano_img = nvgCreateImageRGBA(vg, raster_w, raster_h, NVG_IMAGE_GENERATE_MIPMAPS, pixels.data());
+            const int flags = (mipmap_mode == ImageMipmaps::NONE) ? 0 : NVG_IMAGE_GENERATE_MIPMAPS;
+            nano_img = nvgCreateImageRGBA(vg, raster_w, raster_h, flags, pixels.data());
             pending_resize = false;
+            mipmaps_stale = false;
+            std::fill(dirty_cells.begin(), dirty_cells.end(), uint8_t{ 0 });
+
+            stats.frame_bytes += pixels.size();
+            stats.frame_rects++;
+            stats.total_bytes += pixels.size();
+            if (flags & NVG_IMAGE_GENERATE_MIPMAPS)
+                stats.frame_mipmaps++; // nanovg builds the chain on creation
+            return;
+        }
+
+        const int cell = 1 << dirty_cell_shift;
+
+        // claim the dirty flags (cells marked from here on are uploaded next time)
+        upload_cells.resize(dirty_cells.size());
+        size_t dirty_count = 0;
+        for (size_t i = 0; i < dirty_cells.size(); ++i)
+        {
+            const uint8_t claimed = std::atomic_ref<uint8_t>(dirty_cells[i]).exchange(0, std::memory_order_relaxed);
+            upload_cells[i] = claimed;
+            dirty_count += claimed;
+        }
+
+        if (dirty_count == 0)
+        {
+            // deferred: rebuild the chain once uploads have settled
+            if (mipmaps_stale && mipmap_mode == ImageMipmaps::DEFERRED)
+            {
+                glBindTexture(GL_TEXTURE_2D, nvglImageHandle(vg, nano_img));
+                glGenerateMipmap(GL_TEXTURE_2D);
+                glBindTexture(GL_TEXTURE_2D, 0);
+                mipmaps_stale = false;
+                stats.frame_mipmaps++;
+            }
+            return;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, nvglImageHandle(vg, nano_img));
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        auto upload = [&](int x0, int y0, int x1, int y1)
+        {
+            x1 = std::min(x1, raster_w);
+            y1 = std::min(y1, raster_h);
+            glPixelStorei(GL_UNPACK_SKIP_PIXELS, x0);
+            glPixelStorei(GL_UNPACK_SKIP_ROWS, y0);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x0, y0, x1 - x0, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+            const uint64_t bytes = uint64_t(x1 - x0) * (y1 - y0) * 4;
+            stats.frame_bytes += bytes;
+            stats.total_bytes += bytes;
+            stats.frame_rects++;
+        };
+
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, raster_w);
+
+        if (dirty_count * 2 >= dirty_cells.size())
+        {
+            upload(0, 0, raster_w, raster_h);
         }
         else
         {
-            nvgUpdateImage(vg, nano_img, pixels.data());
+            for (int cy = 0; cy < dirty_rows; ++cy)
+            {
+                const uint8_t* row = upload_cells.data() + size_t(cy) * dirty_cols;
+                for (int cx = 0; cx < dirty_cols; ++cx)
+                {
+                    if (!row[cx]) continue;
+
+                    int run_end = cx;
+                    while (run_end < dirty_cols && row[run_end])
+                        run_end++;
+
+                    upload(cx * cell, cy * cell, run_end * cell, (cy + 1) * cell);
+                    cx = run_end;
+                }
+            }
         }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+
+        if (mipmap_mode == ImageMipmaps::ON_UPLOAD)
+        {
+            glGenerateMipmap(GL_TEXTURE_2D);
+            stats.frame_mipmaps++;
+        }
+        else if (mipmap_mode == ImageMipmaps::DEFERRED)
+        {
+            mipmaps_stale = true;
+        }
+
+        // nanovg tracks the bound texture, leave it as its own updates do
+        glBindTexture(GL_TEXTURE_2D, 0);
     }
 
     /*void draw(NVGcontext* vg, double x, double y, double w, double h)
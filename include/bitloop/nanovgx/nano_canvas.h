@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include <bitloop/platform/platform.h>
 
@@ -9,6 +10,7 @@
 
 #include <bitloop/nanovgx/nano_bitmap.h>
 #include <bitloop/nanovgx/nano_shader_surface.h>
+#include <bitloop/nanovgx/nano_path_cache.h>
 
 #include <atomic>
 
@@ -728,6 +730,118 @@ private:
         ~ScopedResetTransform() { painter->SimplePainter::restore(); }
     };
 
+    // ======== Batch internals ========
+
+    // primitives per merged path, bounds nanovg's per-path scratch memory
+    static constexpr size_t batch_chunk = 4096;
+    std::vector<DVec2> batch_stage;
+
+    // one packed world->stage pass into batch_stage
+    template<typename T>
+    const DVec2* _batchToStage(std::span<const Vec2<T>> pts)
+    {
+        batch_stage.resize(pts.size());
+        if (transform_coordinates)
+            m.toStage<T>(pts.data(), batch_stage.data(), pts.size());
+        else
+            for (size_t i = 0; i < pts.size(); i++) batch_stage[i] = static_cast<DVec2>(pts[i]);
+        return batch_stage.data();
+    }
+
+    // build(i) each primitive into the open path, draw(color or nullptr) per run of equal colours
+    template<class Build, class Draw>
+    void _batchRuns(size_t n, std::span<const Color> colors, Build&& build, Draw&& draw)
+    {
+        const bool per_item = n > 1 && colors.size() >= n;
+
+        size_t i = 0;
+        while (i < n)
+        {
+            const Color* c = colors.empty() ? nullptr : &colors[per_item ? i : 0];
+            const size_t end = std::min(n, i + batch_chunk);
+
+            SimplePainter::beginPath();
+            build(i++);
+            while (i < end && (!per_item || colors[i].rgba == c->rgba))
+                build(i++);
+            draw(c);
+        }
+    }
+
+    void _batchFill(const Color* c)
+    {
+        if (c) SimplePainter::setFillStyle(*c);
+        SimplePainter::fill();
+    }
+
+    void _batchStroke(const Color* c)
+    {
+        if (c) SimplePainter::setStrokeStyle(*c);
+        SimplePainter::stroke();
+    }
+
+    template<typename T>
+    void _drawCircles(std::span<const Vec2<T>> centers, std::span<const T> radii, std::span<const Color> colors)
+    {
+        if (centers.empty() || radii.empty()) return;
+        const DVec2* p = _batchToStage(centers);
+        const bool per_item = radii.size() >= centers.size();
+        const f64 r0 = SIZE((f64)radii[0]);
+
+        _batchRuns(centers.size(), colors,
+            [&](size_t i) { SimplePainter::circle(p[i], per_item ? SIZE((f64)radii[i]) : r0); },
+            [&](const Color* c) { _batchFill(c); });
+    }
+
+    template<typename T>
+    void _drawPoints(std::span<const Vec2<T>> points, f64 size, std::span<const Color> colors)
+    {
+        if (points.empty()) return;
+        const DVec2* p = _batchToStage(points);
+        const f64 s = size * paint_ctx->global_scale;
+        const f64 h = s * 0.5;
+
+        _batchRuns(points.size(), colors,
+            [&](size_t i) { nvgRect(vg, (f32)(p[i].x - h), (f32)(p[i].y - h), (f32)s, (f32)s); },
+            [&](const Color* c) { _batchFill(c); });
+    }
+
+    template<typename T>
+    void _drawLines(std::span<const Vec2<T>> endpoints, std::span<const Color> colors)
+    {
+        if (endpoints.size() < 2) return;
+        const DVec2* p = _batchToStage(endpoints);
+
+        _batchRuns(endpoints.size() / 2, colors,
+            [&](size_t i) { SimplePainter::moveTo(p[2 * i]); SimplePainter::lineTo(p[2 * i + 1]); },
+            [&](const Color* c) { _batchStroke(c); });
+    }
+
+    template<typename T>
+    void _drawRects(std::span<const Vec2<T>> origins, std::span<const Vec2<T>> sizes, std::span<const Color> colors)
+    {
+        if (origins.empty() || sizes.empty()) return;
+        const DVec2* p = _batchToStage(origins);
+        const bool per_item = sizes.size() >= origins.size();
+
+        // stage axes of one world unit (rects follow the camera's rotation)
+        const DVec2 ex = transform_coordinates ? m.toStageOffset<f64>(DVec2{ 1, 0 }) : DVec2{ 1, 0 };
+        const DVec2 ey = transform_coordinates ? m.toStageOffset<f64>(DVec2{ 0, 1 }) : DVec2{ 0, 1 };
+
+        _batchRuns(origins.size(), colors,
+            [&](size_t i) {
+                const DVec2 size = static_cast<DVec2>(sizes[per_item ? i : 0]);
+                const DVec2 w{ ex.x * size.x, ex.y * size.x };
+                const DVec2 h{ ey.x * size.y, ey.y * size.y };
+                SimplePainter::moveTo(p[i]);
+                SimplePainter::lineTo(p[i] + w);
+                SimplePainter::lineTo(p[i] + w + h);
+                SimplePainter::lineTo(p[i] + h);
+                SimplePainter::closePath();
+            },
+            [&](const Color* c) { _batchFill(c); });
+    }
+
     // ======== Position/Size wrappers (applies only enabled camera transforms) ========
 
     // IF (transform_coordinates)    Input = World (f64/f128),   Output = Stage (f64)
@@ -841,6 +955,76 @@ public:
         stroke();
     }
 
+    // Replay retained paths (recorded like this painter's path calls). The world->stage transform is
+    // applied once through nanovg instead of per point, and curves are only flattened again when the
+    // zoom leaves the cache's band. Line cap/join and alpha come from the current state.
+    void drawPathCache(PathCache& cache)
+    {
+        if (cache.empty())
+            return;
+
+        // stage units per world unit, as nanovg's average scale (which it applies to stroke widths)
+        auto axes = [&](DVec2 o, DVec2& p0, DVec2& ex, DVec2& ey) {
+            p0 = PT(o);
+            ex = PT(o + DVec2{ 1, 0 }) - p0;
+            ey = PT(o + DVec2{ 0, 1 }) - p0;
+            return 0.5 * (std::sqrt(ex.x * ex.x + ey.x * ey.x) + std::sqrt(ex.y * ex.y + ey.y * ey.y));
+        };
+
+        DVec2 p0, ex, ey;
+        f64 unit_scale = axes(cache.origin(), p0, ex, ey);
+        if (!(unit_scale > 0))
+            return;
+
+        // re-flattening may move the origin
+        if (cache.prepare(unit_scale * paint_ctx->global_scale))
+            unit_scale = axes(cache.origin(), p0, ex, ey);
+
+        struct NanoSink
+        {
+            NVGcontext* vg;
+            f64 width_scale;
+
+            void beginPath()                   { nvgBeginPath(vg); }
+            void moveTo(f32 x, f32 y)          { nvgMoveTo(vg, x, y); }
+            void lineTo(f32 x, f32 y)          { nvgLineTo(vg, x, y); }
+            void closePath()                   { nvgClosePath(vg); }
+            void fill(const Color& c)          { nvgFillColor(vg, toNVG(c)); nvgFill(vg); }
+            void stroke(const Color& c, f64 w) { nvgStrokeColor(vg, toNVG(c)); nvgStrokeWidth(vg, (f32)(w * width_scale)); nvgStroke(vg); }
+        };
+
+        // widths as setLineWidth(), undoing the scale nanovg adds for the cache transform
+        NanoSink sink{ vg, (scale_lines ? _avgAdjustedZoom() : lineScale()) / unit_scale };
+
+        SimplePainter::save();
+        nvgTransform(vg, (f32)ex.x, (f32)ex.y, (f32)ey.x, (f32)ey.y, (f32)p0.x, (f32)p0.y);
+        cache.replay(sink);
+        SimplePainter::restore();
+    }
+
+    // ======== Batched primitives ========
+    //
+    // All positions go through one packed world->stage pass, then each run of equal colours becomes one
+    // merged path with a single fill/stroke. colors: empty = current style, 1 = all, N = per primitive.
+    // Overlaps within a run are filled as a union, so translucent primitives don't stack.
+
+    void drawCircles(std::span<const DVec2> centers, std::span<const f64> radii, std::span<const Color> colors = {})   { _drawCircles(centers, radii, colors); }
+    void drawCircles(std::span<const DDVec2> centers, std::span<const f128> radii, std::span<const Color> colors = {}) { _drawCircles(centers, radii, colors); }
+    void drawCircles(std::span<const DVec2> centers, f64 radius, std::span<const Color> colors = {})                  { _drawCircles(centers, std::span<const f64>(&radius, 1), colors); }
+    void drawCircles(std::span<const DDVec2> centers, f128 radius, std::span<const Color> colors = {})                { _drawCircles(centers, std::span<const f128>(&radius, 1), colors); }
+
+    // squares of 'size' pixels, regardless of zoom
+    void drawPoints(std::span<const DVec2> points, f64 size, std::span<const Color> colors = {})                      { _drawPoints(points, size, colors); }
+    void drawPoints(std::span<const DDVec2> points, f64 size, std::span<const Color> colors = {})                     { _drawPoints(points, size, colors); }
+
+    // segments between endpoint pairs (0-1, 2-3, ...), one colour per segment
+    void drawLines(std::span<const DVec2> endpoints, std::span<const Color> colors = {})                              { _drawLines(endpoints, colors); }
+    void drawLines(std::span<const DDVec2> endpoints, std::span<const Color> colors = {})                             { _drawLines(endpoints, colors); }
+
+    // sizes: 1 = all, N = per rect
+    void drawRects(std::span<const DVec2> origins, std::span<const DVec2> sizes, std::span<const Color> colors = {})  { _drawRects(origins, sizes, colors); }
+    void drawRects(std::span<const DDVec2> origins, std::span<const DDVec2> sizes, std::span<const Color> colors = {}) { _drawRects(origins, sizes, colors); }
+
     // Linear (Fill)
     void setFillLinearGradient(f64 x0, f64 y0, f64 x1, f64 y1, const f32(&inner)[3], const f32(&outer)[3], f32 a = 1.0f)        { SimplePainter::setFillLinearGradient(PT(x0, y0), PT(x1, y1), inner, outer, a); }
     void setFillLinearGradient(f64 x0, f64 y0, f64 x1, f64 y1, const f32(&inner)[4], const f32(&outer)[4])                      { SimplePainter::setFillLinearGradient(PT(x0, y0), PT(x1, y1), inner, outer); }
@@ -1091,25 +1275,49 @@ public:
 
 private:
 
-    [[nodiscard]] std::string formatNumberScientific(f64 v, int decimals, f64 fixed_min = 0.001, f64 fixed_max = 100000);
-    [[nodiscard]] std::string formatNumberScientific(f128 v, int decimals, f64 fixed_min = 0.001, f64 fixed_max = 100000);
+    // Writes v into buf (rounded to 'decimals', trailing zeros trimmed) and returns a view of it.
+    // Scientific outside [fixed_min, fixed_max). Allocation-free, called per axis tick per frame.
+    [[nodiscard]] std::string_view formatNumberScientific(char* buf, size_t buf_size, f64 v, int decimals, f64 fixed_min = 0.001, f64 fixed_max = 100000);
+    [[nodiscard]] std::string_view formatNumberScientific(char* buf, size_t buf_size, f128 v, int decimals, f64 fixed_min = 0.001, f64 fixed_max = 100000);
 
     const f64 exponent_font_scale = 0.85;
     const f64 exponent_spacing_x = 0.06;
     const f64 exponent_spacing_y = -0.3;
 
+    // "1.5e+05" -> mantissa "1.5e", exponent "5" (written to exp_buf). False if txt has no exponent.
+    [[nodiscard]] static bool splitScientific(std::string_view txt, std::string_view& mantissa, char(&exp_buf)[8], std::string_view& exponent)
+    {
+        const size_t ePos = txt.find('e');
+        if (ePos == std::string_view::npos)
+            return false;
+
+        mantissa = txt.substr(0, ePos + 1);
+
+        std::string_view digits = txt.substr(ePos + 1);
+        size_t n = 0;
+        if (!digits.empty() && (digits[0] == '+' || digits[0] == '-'))
+        {
+            if (digits[0] == '-') exp_buf[n++] = '-';
+            digits.remove_prefix(1);
+        }
+        while (digits.size() > 1 && digits[0] == '0')
+            digits.remove_prefix(1);
+        for (size_t i = 0; i < digits.size() && n < sizeof(exp_buf); i++)
+            exp_buf[n++] = digits[i];
+
+        exponent = std::string_view(exp_buf, n);
+        return true;
+    }
+
 public:
 
-    // convert value to string first with ctx->prepareNumberScientific(n) or bl::to_string()
-    template<typename PosT=f64, typename ValT> void fillNumberScientific(std::string& txt, Vec2<PosT> pos, f64 fontSize = 12.0)
+    // convert value to string first with bl::to_chars_shortest() or bl::to_string()
+    template<typename PosT=f64, typename ValT> void fillNumberScientific(std::string_view txt, Vec2<PosT> pos, f64 fontSize = 12.0)
     {
-        size_t ePos = txt.find("e");
-        if (ePos != std::string::npos)
+        std::string_view mantissa_txt, exponent_txt;
+        char exp_buf[8];
+        if (splitScientific(txt, mantissa_txt, exp_buf, exponent_txt))
         {
-            const int exponent = std::stoi(txt.substr(ePos + 1));
-            std::string mantissa_txt = txt.substr(0, ePos) + "e";
-            std::string exponent_txt = std::to_string(exponent);
-
             f64 mantissaWidth = boundingBox<PosT>(mantissa_txt).x2 + exponent_spacing_x;
 
             /// todo: Take whatever alignment you're given and adjust right bound
@@ -1117,7 +1325,7 @@ public:
             setFontSize(fontSize);
 
             pos = pos.floored();
-            fillTextSharp(mantissa_txt.c_str(), pos);
+            fillTextSharp(mantissa_txt, pos);
 
             pos.x += PosT{ mantissaWidth } / PosT{ 2 } + PosT{ fontSize * exponent_spacing_x };
             pos.y -= PosT{ fontSize * (exponent_font_scale + exponent_spacing_y) };
@@ -1125,7 +1333,7 @@ public:
             setTextAlign(TextAlign::ALIGN_LEFT);
             setFontSize(fontSize * exponent_font_scale);
 
-            fillTextSharp(exponent_txt.c_str(), pos);
+            fillTextSharp(exponent_txt, pos);
 
             setFontSize(fontSize);
             setTextAlign(TextAlign::ALIGN_CENTER);
@@ -1133,19 +1341,16 @@ public:
         else
         {
             setFontSize(fontSize);
-            fillTextSharp(txt.c_str(), pos);
+            fillTextSharp(txt, pos);
         }
     }
     
-	template<typename PosT=f64, typename ValT> [[nodiscard]] Rect<PosT> boundingBoxScientific(std::string& txt, f64 fontSize = 12.0)
+	template<typename PosT=f64, typename ValT> [[nodiscard]] Rect<PosT> boundingBoxScientific(std::string_view txt, f64 fontSize = 12.0)
     {
-        size_t ePos = txt.find("e");
-        if (ePos != std::string::npos)
+        std::string_view mantissa_txt, exponent_txt;
+        char exp_buf[8];
+        if (splitScientific(txt, mantissa_txt, exp_buf, exponent_txt))
         {
-            const int  exponent = std::stoi(txt.substr(ePos + 1));
-            std::string mantissa_txt = txt.substr(0, ePos) + "e";
-            std::string exponent_txt = std::to_string(exponent);
-
             Rect<PosT> mantissaRect = boundingBox<PosT>(mantissa_txt);
             Rect<PosT> exponentRect = boundingBox<PosT>(exponent_txt);
             Rect<PosT> ret = mantissaRect;
@@ -1266,7 +1471,8 @@ public:
     using SimplePainter::closePath;
 };
 
-// todo: currently unused, but lots of places could do with using this instead (e.g. preprocessor, shader surfaces, Canvas, etc)
+// Offscreen RGBA8 render target (e.g. per-viewport surfaces composited by the project)
+// todo: lots of other places could do with using this instead (e.g. preprocessor, shader surfaces, Canvas, etc)
 struct GLSurface
 {
     GLuint fbo = 0;
@@ -1276,8 +1482,35 @@ struct GLSurface
     int height = 0;
     bool has_depth_stencil = false;
 
+    // nanovg image wrapping 'tex' (created on first use, the texture stays owned by the surface)
+    NVGcontext* nvg_ctx = nullptr;
+    int nvg_image = 0;
+
+    int nvgImageId(NVGcontext* vg)
+    {
+        if (!vg || !tex)
+            return 0;
+
+        if (nvg_image && nvg_ctx == vg)
+            return nvg_image;
+
+        if (nvg_image && nvg_ctx)
+            nvgDeleteImage(nvg_ctx, nvg_image);
+
+        // rendered bottom-up by nanovg, premultiplied
+        nvg_ctx = vg;
+        nvg_image = nvglCreateImageFromHandle(vg, tex, width, height,
+            NVG_IMAGE_FLIPY | NVG_IMAGE_PREMULTIPLIED | NVG_IMAGE_NODELETE);
+
+        return nvg_image;
+    }
+
     void destroy()
     {
+        if (nvg_image && nvg_ctx) nvgDeleteImage(nvg_ctx, nvg_image);
+        nvg_image = 0;
+        nvg_ctx = nullptr;
+
         if (fbo) glDeleteFramebuffers(1, &fbo);
         if (tex) glDeleteTextures(1, &tex);
         if (rbo) glDeleteRenderbuffers(1, &rbo);
@@ -1321,6 +1554,72 @@ struct GLSurface
     }
 };
 
+// Asynchronous RGBA8 readback through a ring of pixel-pack buffers. queue() issues glReadPixels into
+// the next free buffer and returns immediately; the copy runs on the GPU while the next frame
+// renders and take() maps the oldest one once its fence has signalled. Reads complete in the order
+// they were queued.
+//
+// WebGL can't map buffers for reading, so on Emscripten queue() reads synchronously into CPU memory
+// and take() hands that out instead (same call pattern, no overlap).
+class PixelReadbackRing
+{
+public:
+    static constexpr int ring_size = 3;
+
+    PixelReadbackRing() = default;
+    PixelReadbackRing(const PixelReadbackRing&) = delete;
+    PixelReadbackRing& operator=(const PixelReadbackRing&) = delete;
+
+    ~PixelReadbackRing() { destroy(); }
+
+    // Read [0, w) x [0, h) of fbo's color attachment 0. False if every buffer is still in flight.
+    bool queue(GLuint fbo, int w, int h);
+
+    // Hand the oldest queued read to fn(const uint8_t* rgba, int w, int h) (rows bottom-up, as
+    // glReadPixels returns them). Without 'wait', returns false if the GPU hasn't finished it yet
+    // (the read stays queued). Every queued read is delivered exactly once.
+    template<typename Fn>
+    bool take(bool wait, Fn&& fn)
+    {
+        const uint8_t* data = nullptr;
+        if (!mapOldest(wait, data))
+            return false;
+
+        const Slot& s = slots[head];
+        fn(data, s.w, s.h);
+
+        unmapOldest();
+        return true;
+    }
+
+    [[nodiscard]] int  pending() const { return count; }
+    [[nodiscard]] bool full() const { return count == ring_size; }
+
+    // drop queued reads (e.g. capture ended), keeps the buffers
+    void discard();
+
+    // explicit teardown while a GL context is current
+    void destroy();
+
+private:
+    struct Slot
+    {
+        GLuint pbo = 0;
+        GLsync fence = nullptr;
+        size_t capacity = 0;
+        std::vector<uint8_t> cpu; // synchronous fallback, or copy when the buffer can't be mapped
+        int w = 0, h = 0;
+        bool mapped = false;
+    };
+
+    Slot slots[ring_size];
+    int head = 0;  // oldest queued read
+    int count = 0;
+    bool map_failure_reported = false; // a driver that can't map won't start to, report it once
+
+    bool mapOldest(bool wait, const uint8_t*& data);
+    void unmapOldest();
+};
 
 class NanoCanvas : public SimplePainter
 {
@@ -1349,6 +1648,29 @@ public:
     void begin(f32 r, f32 g, f32 b, f32 a = 1.0);
     void end();
 
+    // Redirect drawing (same nanovg context) into 'surface' until endSurface(). What's been drawn to the
+    // canvas so far is flushed first, and the canvas frame resumes without clearing. Both reset the
+    // nanovg state, like begin().
+    void beginSurface(GLSurface& surface, f32 r, f32 g, f32 b, f32 a = 1.0);
+    void endSurface();
+
+    // composite 'surface' 1:1 with its top-left at (x, y)
+    void drawSurface(GLSurface& surface, f32 x, f32 y)
+    {
+        const int img = surface.nvgImageId(context.vg);
+        if (!img)
+            return;
+
+        const f32 w = (f32)surface.width;
+        const f32 h = (f32)surface.height;
+
+        NVGpaint paint = nvgImagePattern(context.vg, x, y, w, h, 0.0f, img, 1.0f);
+        nvgBeginPath(context.vg);
+        nvgRect(context.vg, x, y, w, h);
+        nvgFillPaint(context.vg, paint);
+        nvgFill(context.vg);
+    }
+
     void setDirty(bool b=true) { dirty.store(b, std::memory_order_relaxed); }
     bool isDirty() const { return dirty.load(std::memory_order_acquire); }
 
@@ -1359,7 +1681,11 @@ public:
     [[nodiscard]] IVec2 fboSize() const { return {fbo_w, fbo_h}; }
     [[nodiscard]] int fboExists() const { return has_fbo; }
 
+    // synchronous: stalls until the GPU has finished rendering, prefer readPixelsAsync for per-frame reads
     bool readPixels(std::vector<uint8_t>& out_rgba);
+
+    // queue a read of the canvas into 'ring', collect it later with ring.take()
+    bool readPixelsAsync(PixelReadbackRing& ring) { return fbo && ring.queue(fbo, fbo_w, fbo_h); }
 };
 
 BL_END_NS
@@ -0,0 +1,374 @@
+#pragma once
+
+#include <bitloop/core/types.h>
+#include <bitloop/util/color.h>
+
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+BL_BEGIN_NS
+
+// ======== PathCache ========
+//
+// Retained vector art. Path commands are recorded once (same calls as Painter, world coordinates) and
+// replayed each frame with Painter::drawPathCache(). Curves are flattened into polylines that stay in
+// world space (relative to origin(), as floats), and are only flattened again once the zoom leaves the
+// band they were flattened for. A replay is then one transform plus the cached points.
+//
+// Fill/stroke colours and line widths are recorded with the geometry, anything else (line cap/join,
+// composite, alpha) comes from the painter's state at replay.
+
+class PathCache
+{
+public:
+
+    enum struct Op : uint8_t { MOVE_TO, LINE_TO, BEZIER_TO, QUAD_TO, CLOSE };
+
+    // zoom may change by this fraction either way before curves are flattened again
+    f64 zoom_tolerance = 0.25;
+
+    // max distance of the flattened polylines from the true curves (framebuffer pixels, as nanovg)
+    f64 tess_tol = 0.25;
+
+private:
+
+    struct Path
+    {
+        uint32_t op_first, op_count;   // ops
+        uint32_t pt_first, pt_count;   // pts
+        uint32_t sub_first, sub_count; // subpaths (flattened)
+    };
+
+    struct SubPath
+    {
+        uint32_t first, count;         // flat_pts
+        bool closed;
+    };
+
+    struct DrawCmd
+    {
+        uint32_t path;
+        bool stroke;
+        Color color;
+        f64 line_width;
+    };
+
+    // ────── recorded ──────
+    std::vector<Op> ops;
+    std::vector<DVec2> pts;
+    std::vector<Path> paths;
+    std::vector<DrawCmd> cmds;
+
+    uint32_t path_op_first = 0;
+    uint32_t path_pt_first = 0;
+    int current_path = -1;           // committed by the last fill()/stroke(), until the path changes
+
+    Color fill_color = Color(255, 255, 255);
+    Color stroke_color = Color(255, 255, 255);
+    f64 line_width = 1;
+
+    // ────── flattened ──────
+    std::vector<SubPath> subpaths;
+    std::vector<FVec2> flat_pts;
+    DVec2 local_origin{ 0, 0 };
+    f64 flat_scale = 0;              // pixels per world unit the curves were flattened for (0 = stale)
+    int flatten_count = 0;
+
+    void pushOp(Op op)
+    {
+        reopenPath();
+        ops.push_back(op);
+        flat_scale = 0;
+    }
+
+    // extending a path after fill()/stroke() (as nanovg allows) continues on a copy, the drawn one stays
+    void reopenPath()
+    {
+        if (current_path < 0)
+            return;
+
+        const Path p = paths[current_path];
+        path_op_first = (uint32_t)ops.size();
+        path_pt_first = (uint32_t)pts.size();
+        for (uint32_t i = 0; i < p.op_count; i++) ops.push_back(ops[p.op_first + i]);
+        for (uint32_t i = 0; i < p.pt_count; i++) pts.push_back(pts[p.pt_first + i]);
+        current_path = -1;
+    }
+
+    uint32_t commitPath()
+    {
+        if (current_path >= 0)
+            return (uint32_t)current_path;
+
+        Path p{};
+        p.op_first = path_op_first;
+        p.op_count = (uint32_t)ops.size() - path_op_first;
+        p.pt_first = path_pt_first;
+        p.pt_count = (uint32_t)pts.size() - path_pt_first;
+
+        // fill + stroke of the same outline usually rebuild it, share the geometry
+        if (!paths.empty())
+        {
+            const Path& prev = paths.back();
+            if (prev.op_count == p.op_count && prev.pt_count == p.pt_count &&
+                std::equal(ops.begin() + prev.op_first, ops.begin() + prev.op_first + prev.op_count, ops.begin() + p.op_first) &&
+                std::memcmp(&pts[prev.pt_first], &pts[p.pt_first], p.pt_count * sizeof(DVec2)) == 0)
+            {
+                ops.resize(p.op_first);
+                pts.resize(p.pt_first);
+                current_path = (int)paths.size() - 1;
+                return (uint32_t)current_path;
+            }
+        }
+
+        paths.push_back(p);
+        current_path = (int)paths.size() - 1;
+        return (uint32_t)current_path;
+    }
+
+    // Wang's formula: segments needed to keep a uniform subdivision within 'tol' of the curve
+    static int cubicSegments(DVec2 p0, DVec2 p1, DVec2 p2, DVec2 p3, f64 tol)
+    {
+        const DVec2 d1 = p0 - p1 * 2.0 + p2;
+        const DVec2 d2 = p1 - p2 * 2.0 + p3;
+        const f64 l = std::sqrt(std::max(d1.x * d1.x + d1.y * d1.y, d2.x * d2.x + d2.y * d2.y));
+        return std::clamp((int)std::ceil(std::sqrt(0.75 * l / tol)), 1, 1024);
+    }
+
+    static int quadSegments(DVec2 p0, DVec2 p1, DVec2 p2, f64 tol)
+    {
+        const DVec2 d = p0 - p1 * 2.0 + p2;
+        const f64 l = std::sqrt(d.x * d.x + d.y * d.y);
+        return std::clamp((int)std::ceil(std::sqrt(0.25 * l / tol)), 1, 1024);
+    }
+
+    void flatten(f64 pixels_per_unit)
+    {
+        subpaths.clear();
+        flat_pts.clear();
+
+        // local origin = bounds centre, keeps the float offsets small
+        DVec2 lo = pts[0], hi = pts[0];
+        for (const DVec2& p : pts)
+        {
+            lo = { std::min(lo.x, p.x), std::min(lo.y, p.y) };
+            hi = { std::max(hi.x, p.x), std::max(hi.y, p.y) };
+        }
+        local_origin = (lo + hi) * 0.5;
+
+        const f64 tol = tess_tol / pixels_per_unit;
+
+        auto emit = [&](DVec2 p) {
+            flat_pts.push_back(FVec2{ (f32)(p.x - local_origin.x), (f32)(p.y - local_origin.y) });
+            subpaths.back().count++;
+        };
+
+        for (Path& path : paths)
+        {
+            path.sub_first = (uint32_t)subpaths.size();
+
+            const DVec2* p = &pts[path.pt_first];
+            DVec2 cur{ 0, 0 }, start{ 0, 0 };
+            bool open = false;
+
+            auto beginSub = [&](DVec2 at) {
+                subpaths.push_back(SubPath{ (uint32_t)flat_pts.size(), 0, false });
+                emit(at);
+                start = at;
+                open = true;
+            };
+
+            for (uint32_t i = 0; i < path.op_count; i++)
+            {
+                const Op op = ops[path.op_first + i];
+                if (op == Op::MOVE_TO)
+                {
+                    cur = *p++;
+                    beginSub(cur);
+                    continue;
+                }
+
+                if (op == Op::CLOSE)
+                {
+                    if (open)
+                        subpaths.back().closed = true;
+                    open = false;
+                    cur = start;
+                    continue;
+                }
+
+                // drawing without a moveTo starts at the current point
+                if (!open)
+                    beginSub(cur);
+
+                if (op == Op::LINE_TO)
+                {
+                    cur = *p++;
+                    emit(cur);
+                }
+                else if (op == Op::BEZIER_TO)
+                {
+                    const DVec2 p0 = cur, p1 = p[0], p2 = p[1], p3 = p[2];
+                    p += 3;
+
+                    const int n = cubicSegments(p0, p1, p2, p3, tol);
+                    for (int s = 1; s < n; s++)
+                    {
+                        const f64 t = (f64)s / n, u = 1.0 - t;
+                        emit(p0 * (u * u * u) + p1 * (3.0 * u * u * t) + p2 * (3.0 * u * t * t) + p3 * (t * t * t));
+                    }
+                    emit(p3);
+                    cur = p3;
+                }
+                else // QUAD_TO
+                {
+                    const DVec2 p0 = cur, p1 = p[0], p2 = p[1];
+                    p += 2;
+
+                    const int n = quadSegments(p0, p1, p2, tol);
+                    for (int s = 1; s < n; s++)
+                    {
+                        const f64 t = (f64)s / n, u = 1.0 - t;
+                        emit(p0 * (u * u) + p1 * (2.0 * u * t) + p2 * (t * t));
+                    }
+                    emit(p2);
+                    cur = p2;
+                }
+            }
+
+            path.sub_count = (uint32_t)subpaths.size() - path.sub_first;
+        }
+
+        flatten_count++;
+    }
+
+public:
+
+    // ======== Recording ========
+
+    void clear()
+    {
+        ops.clear();
+        pts.clear();
+        paths.clear();
+        cmds.clear();
+        subpaths.clear();
+        flat_pts.clear();
+
+        path_op_first = 0;
+        path_pt_first = 0;
+        current_path = -1;
+        flat_scale = 0;
+    }
+
+    void beginPath()
+    {
+        current_path = -1;
+        path_op_first = (uint32_t)ops.size();
+        path_pt_first = (uint32_t)pts.size();
+    }
+
+    void moveTo(f64 x, f64 y)                                  { pushOp(Op::MOVE_TO); pts.push_back({ x, y }); }
+    void lineTo(f64 x, f64 y)                                  { pushOp(Op::LINE_TO); pts.push_back({ x, y }); }
+    void moveTo(DVec2 p)                                       { moveTo(p.x, p.y); }
+    void lineTo(DVec2 p)                                       { lineTo(p.x, p.y); }
+    void closePath()                                           { pushOp(Op::CLOSE); }
+
+    void bezierTo(f64 x1, f64 y1, f64 x2, f64 y2, f64 x3, f64 y3)
+    {
+        pushOp(Op::BEZIER_TO);
+        pts.push_back({ x1, y1 });
+        pts.push_back({ x2, y2 });
+        pts.push_back({ x3, y3 });
+    }
+
+    void quadraticTo(f64 cx, f64 cy, f64 x, f64 y)
+    {
+        pushOp(Op::QUAD_TO);
+        pts.push_back({ cx, cy });
+        pts.push_back({ x, y });
+    }
+
+    void setFillStyle(const Color& c)                          { fill_color = c; }
+    void setFillStyle(int r, int g, int b, int a = 255)        { fill_color = Color((uint8_t)r, (uint8_t)g, (uint8_t)b, (uint8_t)a); }
+    void setStrokeStyle(const Color& c)                        { stroke_color = c; }
+    void setStrokeStyle(int r, int g, int b, int a = 255)      { stroke_color = Color((uint8_t)r, (uint8_t)g, (uint8_t)b, (uint8_t)a); }
+
+    // same units as Painter::setLineWidth() (world units when the painter scales lines)
+    void setLineWidth(f64 w)                                   { line_width = w; }
+
+    void fill()
+    {
+        if (ops.size() == path_op_first && current_path < 0) return;
+        cmds.push_back(DrawCmd{ commitPath(), false, fill_color, line_width });
+    }
+
+    void stroke()
+    {
+        if (ops.size() == path_op_first && current_path < 0) return;
+        cmds.push_back(DrawCmd{ commitPath(), true, stroke_color, line_width });
+    }
+
+    // ======== Replay ========
+
+    [[nodiscard]] bool empty() const { return cmds.empty() || pts.empty(); }
+
+    // reference point of the flattened geometry, valid after prepare()
+    [[nodiscard]] DVec2 origin() const { return local_origin; }
+
+    // stats
+    [[nodiscard]] size_t pathCount() const { return paths.size(); }
+    [[nodiscard]] size_t commandCount() const { return cmds.size(); }
+    [[nodiscard]] size_t flatPointCount() const { return flat_pts.size(); }
+    [[nodiscard]] int    flattenCount() const { return flatten_count; }
+
+    // Make the flattened geometry fit for drawing at 'pixels_per_unit' (framebuffer pixels per world
+    // unit). Re-flattens slightly finer than needed, so small zoom changes reuse it. True if it did.
+    bool prepare(f64 pixels_per_unit)
+    {
+        if (empty() || !(pixels_per_unit > 0))
+            return false;
+
+        const f64 band = 1.0 + zoom_tolerance;
+        if (flat_scale > 0 && pixels_per_unit <= flat_scale && pixels_per_unit * band * band >= flat_scale)
+            return false;
+
+        flat_scale = pixels_per_unit * band;
+        flatten(flat_scale);
+        return true;
+    }
+
+    // Feed the flattened paths to 'sink' (points relative to origin()):
+    //   beginPath(), moveTo(f32, f32), lineTo(f32, f32), closePath(), fill(Color), stroke(Color, f64 line_width)
+    template<class Sink>
+    void replay(Sink& sink) const
+    {
+        for (const DrawCmd& cmd : cmds)
+        {
+            const Path& path = paths[cmd.path];
+
+            sink.beginPath();
+            for (uint32_t s = 0; s < path.sub_count; s++)
+            {
+                const SubPath& sub = subpaths[path.sub_first + s];
+                const FVec2* p = &flat_pts[sub.first];
+
+                sink.moveTo(p[0].x, p[0].y);
+                for (uint32_t i = 1; i < sub.count; i++)
+                    sink.lineTo(p[i].x, p[i].y);
+
+                if (sub.closed)
+                    sink.closePath();
+            }
+
+            if (cmd.stroke)
+                sink.stroke(cmd.color, cmd.line_width);
+            else
+                sink.fill(cmd.color);
+        }
+    }
+};
+
+BL_END_NS
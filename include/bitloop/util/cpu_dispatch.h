@@ -0,0 +1,77 @@
+#pragma once
+#include <string_view>
+
+#ifndef BL_BEGIN_NS
+#define BL_BEGIN_NS namespace bl {
+#define BL_END_NS   }
+#endif
+
+/// ======== Runtime CPU dispatch ========
+//
+// simd.h picks its backend at compile time for the baseline the binary is built for. Hot kernels
+// can additionally be compiled once per ISA level (see BL_TARGET_*) and selected at startup:
+//
+//   SCALAR   - plain C++, no packed lanes (reference variant)
+//   BASELINE - the compile-time simd.h backend (SSE2 on x86-64, NEON, WASM SIMD)
+//   AVX2     - x86 AVX2 codegen
+//   AVX512   - x86 AVX-512F codegen
+//
+// The active level defaults to the best level the CPU supports. It can be lowered for testing with
+// the BL_CPU_LEVEL environment variable or --cpu-level=<name> (scalar, baseline/sse2, avx2, avx512),
+// but never raised above what the CPU reports.
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64) || defined(__i386__) || defined(_M_IX86)
+#define BL_CPU_X86 1
+#endif
+
+// Per-function ISA targets. Floating-point contraction is disabled so wider variants can't fuse
+// a*b+c where the baseline doesn't, keeping every variant bit-identical.
+#if defined(BL_CPU_X86) && defined(__clang__)
+#define BL_TARGET_AVX2   __attribute__((target("avx2")))
+#define BL_TARGET_AVX512 __attribute__((target("avx512f")))
+#define BL_CPU_MULTIVERSION 1
+#elif defined(BL_CPU_X86) && defined(__GNUC__)
+#define BL_TARGET_AVX2   __attribute__((target("avx2"), optimize("fp-contract=off")))
+#define BL_TARGET_AVX512 __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#define BL_CPU_MULTIVERSION 1
+#else
+// MSVC can't retarget individual functions, variants share the baseline codegen (dispatch still
+// reports and honours the detected level)
+#define BL_TARGET_AVX2
+#define BL_TARGET_AVX512
+#endif
+
+BL_BEGIN_NS;
+
+enum struct CpuLevel
+{
+    SCALAR,
+    BASELINE,
+    AVX2,
+    AVX512,
+    COUNT
+};
+
+[[nodiscard]] const char* cpuLevelName(CpuLevel level);
+
+// accepts the names from cpuLevelName() (case-insensitive) plus "sse2" for BASELINE
+[[nodiscard]] bool parseCpuLevel(std::string_view name, CpuLevel& out);
+
+// highest level supported by this CPU/OS (CPUID + XGETBV on x86, BASELINE elsewhere)
+[[nodiscard]] CpuLevel detectCpuLevel();
+
+[[nodiscard]] inline bool cpuLevelSupported(CpuLevel level)
+{
+    return static_cast<int>(level) <= static_cast<int>(detectCpuLevel());
+}
+
+// level used by dispatched kernels (detected level, or BL_CPU_LEVEL if set)
+[[nodiscard]] CpuLevel cpuLevel();
+
+// force a level (clamped to the detected level), returns the level actually applied
+CpuLevel setCpuLevel(CpuLevel level);
+
+// parse "--cpu-level=<name>" from the command line, if present
+void applyCpuLevelArgs(int argc, char* argv[]);
+
+BL_END_NS;
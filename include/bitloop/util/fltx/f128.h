@@ -293,7 +293,11 @@ FORCE_INLINE constexpr f128 quick_two_sum(double a, double b)
 }
 BL_POP_PRECISE
 
+#ifdef FMA_AVAILABLE
+FORCE_INLINE           f128 recip(f128 b)
+#else
 FORCE_INLINE constexpr f128 recip(f128 b)
+#endif
 {
     constexpr f128 one = f128(1.0);
     f128 y = f128(1.0 / b.hi);
@@ -517,24 +521,6 @@ FORCE_INLINE double log_as_double(f128 a)
 {
     return std::log(a.hi) + std::log1p(a.lo / a.hi);
 }
-FORCE_INLINE f128 log(const f128& a)
-{
-    double log_hi = std::log(a.hi); // first guess
-    f128 exp_log_hi(std::exp(log_hi)); // exp(guess)
-    f128 r = (a - exp_log_hi) / exp_log_hi; // (a - e^g) / e^g ≈ error
-    return f128(log_hi) + r; // refined log
-}
-FORCE_INLINE f128 log2(const f128& a)
-{
-    constexpr f128 LOG2_RECIPROCAL(1.442695040888963407359924681001892137); // 1/log(2)
-    return log(a) * LOG2_RECIPROCAL;
-}
-FORCE_INLINE f128 log10(const f128& x)
-{
-    // 1 / ln(10) to full-double accuracy
-    static constexpr double INV_LN10 = 0.434294481903251827651128918916605082;
-    return log(x) * f128(INV_LN10);   // log(x) already returns float128
-}
 FORCE_INLINE f128 clamp(const f128& v, const f128& lo, const f128& hi)
 {
     if (v < lo) return lo;
@@ -625,239 +611,203 @@ FORCE_INLINE f128 remainder(const f128& x, const f128& y)
 }
 
 /*------------ transcendentals -------------------------------------------*/
+//
+// Table-driven: each function splits its argument against a short table of f128 values (generated
+// at 400 bits, hi = RN(v), lo = RN(v - hi)) so the polynomial left over only covers a tiny interval.
+// Only the leading coefficients need f128, the tail is evaluated in double. Argument reductions
+// subtract the exact two_prod pieces of n*C one double at a time, so the reduced argument keeps
+// its relative accuracy instead of inheriting the 2^-106 error of |x|.
 
 // high-precision constants
+static constexpr f128 F128_PI = renorm(3.141592653589793, 1.2246467991473532e-16);
 static constexpr f128 F128_PIO2 = renorm(1.5707963267948966, 6.1232339957367660e-17);
 static constexpr f128 F128_INV_PIO2 = renorm(0.6366197723675814, -3.9357353350364970e-17);
 static constexpr f128 F128_LN2 = renorm(0.6931471805599453, 2.3190468138462996e-17);
 static constexpr f128 F128_INV_LN2 = renorm(1.4426950408889634, 2.0355273740931033e-17);
+static constexpr f128 F128_INV_LN10 = renorm(0.4342944819032518, 1.098319650216765e-17);
 static constexpr double F128_PIO4_HI = 0.7853981633974483;
 
+// pi/2 and ln2/64 as three non-overlapping doubles (~159 bits)
+static constexpr double F128_PIO2_1 = 1.5707963267948966;
+static constexpr double F128_PIO2_2 = 6.123233995736766e-17;
+static constexpr double F128_PIO2_3 = -1.4973849048591698e-33;
+static constexpr double F128_LN2_64_1 = 0.010830424696249145;
+static constexpr double F128_LN2_64_2 = 3.623510646634843e-19;
+static constexpr double F128_LN2_64_3 = 8.918294435025331e-36;
+
+// 2^(j/64), j = 0..63
+// log(1 + j/64), j = -19..27 (covers [sqrt(1/2), sqrt(2)])
+// sin(j/32), cos(j/32), j = 0..25 (covers [0, pi/4])
+// atan(j/64), j = 0..64
+inline constexpr f128 F128_EXP2_64[64] = {
+    { 1.0, 0.0 }, { 1.0108892860517005, -1.5234778603368577e-17 },
+    { 1.0218971486541166, 5.109225028973444e-17 }, { 1.0330248790212284, 7.600838874027088e-18 },
+    { 1.0442737824274138, 8.551889705537965e-17 }, { 1.0556451783605572, 1.759325738772092e-18 },
+    { 1.0671404006768237, -7.899853966841582e-17 }, { 1.0787607977571199, -6.656660436056593e-17 },
+    { 1.0905077326652577, -3.046782079812471e-17 }, { 1.102382583307841, 5.2660368715706944e-17 },
+    { 1.1143867425958924, 1.0410278456845571e-16 }, { 1.1265216186082418, 5.165856758795457e-17 },
+    { 1.1387886347566916, 8.912812676025408e-17 }, { 1.1511892299529827, 3.250710218863827e-17 },
+    { 1.1637248587775775, 3.8292048369240935e-17 }, { 1.1763969916502812, 5.554203254218079e-17 },
+    { 1.189207115002721, 3.982015231465646e-17 }, { 1.202156731452703, 6.644981499252301e-17 },
+    { 1.215247359980469, -7.712630692681488e-17 }, { 1.22848053610687, -1.89878163130253e-17 },
+    { 1.241857812073484, 4.658027591836937e-17 }, { 1.255380757024691, -6.7113898212968784e-18 },
+    { 1.2690509571917332, 2.667932131342186e-18 }, { 1.2828700160787783, 1.713594918243561e-17 },
+    { 1.2968395546510096, 2.5382502794888315e-17 }, { 1.3109612115247644, -7.181536135519454e-17 },
+    { 1.3252366431597413, -2.8587312100388614e-17 }, { 1.339667524053303, 8.927282594831732e-17 },
+    { 1.3542555469368927, 7.70094837980299e-17 }, { 1.3690024229745905, 9.593797919118849e-17 },
+    { 1.383909881963832, -6.770511658794786e-17 }, { 1.3989796725383112, -9.614213209051323e-17 },
+    { 1.4142135623730951, -9.667293313452913e-17 }, { 1.42961333839197, -1.2031642489053655e-17 },
+    { 1.4451808069770467, -3.0237581349939873e-17 }, { 1.460917794180647, -5.600377186075216e-17 },
+    { 1.4768261459394993, -3.483994556892796e-17 }, { 1.4929077282912648, 1.4192920154284036e-17 },
+    { 1.5091644275934228, -1.016455327754295e-16 }, { 1.5255981507445384, -1.1024941712342561e-16 },
+    { 1.5422108254079407, 7.949834809697621e-17 }, { 1.559004400237837, 3.7812070533575275e-17 },
+    { 1.5759808451078865, -1.0136916471278304e-17 }, { 1.593142151342267, -1.0094406542311964e-16 },
+    { 1.6104903319492543, 2.4707192569797888e-17 }, { 1.6280274218573478, -6.712955084707084e-17 },
+    { 1.645755478153965, -1.0125679913674773e-16 }, { 1.6636765803267364, 5.8909926967131e-17 },
+    { 1.681792830507429, 8.199010020581497e-17 }, { 1.7001063537185235, -8.0237193703977e-18 },
+    { 1.718619298122478, -1.851380418263111e-17 }, { 1.7373338352737062, 3.164389299292957e-17 },
+    { 1.7562521603732995, 2.960140695448873e-17 }, { 1.7753764925265212, 6.429731796556572e-17 },
+    { 1.7947090750031072, 1.8227458427912087e-17 }, { 1.8142521755003989, -9.969531538920349e-17 },
+    { 1.8340080864093424, 3.283107224245627e-17 }, { 1.8539791250833855, 9.761887490727594e-17 },
+    { 1.8741676341103, -6.122763413004143e-17 }, { 1.8945759815869656, 3.4034035352165297e-17 },
+    { 1.9152065613971474, -1.0619946056195963e-16 }, { 1.9360617934922943, 1.0332385960676326e-16 },
+    { 1.9571441241754002, 8.960767791036668e-17 }, { 1.978456026387951, 4.0388753109278167e-17 },
+};
+inline constexpr f128 F128_LOG_TABLE[47] = {
+    { -0.3522205935893521, -5.7233316949182485e-18 }, { -0.33024168687057687, 1.0828321637483858e-17 },
+    { -0.3087354816496133, 1.6199186085148102e-17 }, { -0.2876820724517809, -2.607160616442564e-17 },
+    { -0.26706278524904525, 7.32891532732017e-18 }, { -0.24686007793152578, -1.361743371748368e-17 },
+    { -0.22705745063534608, -9.551415762738488e-18 }, { -0.2076393647782445, -1.2053243216686129e-17 },
+    { -0.18859116980755003, 7.432164219196925e-18 }, { -0.16989903679539747, 4.868008764439071e-19 },
+    { -0.15154989812720093, -5.1669593684615594e-18 }, { -0.13353139262452263, 3.664457663660085e-18 },
+    { -0.1158318155251217, -4.338484369808096e-18 }, { -0.09844007281325252, 4.439009633675136e-18 },
+    { -0.0813456394539524, -5.07707635593117e-18 }, { -0.06453852113757118, 6.470486661692933e-18 },
+    { -0.048009219186360606, -1.4390903347292205e-18 }, { -0.0317486983145803, -3.0382263084680858e-18 },
+    { -0.015748356968139168, -1.0021578630528974e-18 }, { 0.0, 0.0 },
+    { 0.015504186535965254, -3.278321022892429e-19 }, { 0.030771658666753687, 1.0431732029005968e-18 },
+    { 0.0458095360312942, 1.902959866474257e-18 }, { 0.06062462181643484, 2.6424025938726934e-18 },
+    { 0.07522342123758753, -5.930604196293241e-18 }, { 0.08961215868968714, -5.4268129336647135e-18 },
+    { 0.10379679368164356, 5.47772415726659e-18 }, { 0.11778303565638346, -1.1971685747593677e-18 },
+    { 0.13157635778871926, 1.1123000879729588e-17 }, { 0.1451820098444979, 8.242418783022475e-18 },
+    { 0.15860503017663857, 1.1257003872182592e-17 }, { 0.17185025692665923, -6.0224538210113705e-18 },
+    { 0.184922338494012, 3.0236614153574064e-18 }, { 0.19782574332991987, 1.2821194372980142e-17 },
+    { 0.21056476910734964, -4.249405314729895e-18 }, { 0.22314355131420976, -9.091270597324799e-18 },
+    { 0.2355660713127669, -2.3943371495187355e-18 }, { 0.24783616390458127, -1.2432209578702523e-17 },
+    { 0.25995752443692605, 2.069806938978935e-17 }, { 0.27193371548364176, 7.83319637697442e-19 },
+    { 0.2837681731306446, -2.032665581126656e-17 }, { 0.2954642128938359, -2.16461086040599e-17 },
+    { 0.3070250352949119, -1.2319916200101964e-17 }, { 0.3184537311185346, 2.7114779367326236e-17 },
+    { 0.329753286372468, 2.122020616196946e-18 }, { 0.3409265869705932, 1.7467136443544747e-17 },
+    { 0.3519764231571782, -1.2953893030191963e-17 },
+};
+inline constexpr f128 F128_SIN_TABLE[26] = {
+    { 0.0, 0.0 }, { 0.03124491398532608, -1.562781562225433e-18 },
+    { 0.0624593178423802, -2.040259504585711e-18 }, { 0.09361273123551289, 1.4628632005878733e-18 },
+    { 0.12467473338522769, -2.925947496057858e-18 }, { 0.15561499277355603, 8.886053372342288e-18 },
+    { 0.18640329676226988, 2.3493796901281573e-18 }, { 0.21700958109501015, 1.1170071073364376e-17 },
+    { 0.24740395925452294, -7.53102495590706e-18 }, { 0.2775567516463363, 1.7674070262791822e-17 },
+    { 0.30743851458038085, 1.1004366442765296e-19 }, { 0.33702006902225307, 1.0312279860787216e-17 },
+    { 0.36627252908604757, -9.938814562106524e-18 }, { 0.39516733024093426, -1.9613487871414228e-17 },
+    { 0.42367625720393803, -2.331800700068871e-17 }, { 0.4517714714916838, -8.234073942098903e-18 },
+    { 0.479425538604203, -5.103969860556013e-18 }, { 0.5066114548142574, -3.269413423618168e-17 },
+    { 0.5333026735360201, 5.129318115032044e-17 }, { 0.5594731312473669, 1.575565514488728e-17 },
+    { 0.5850972729404622, -5.4883972461161805e-17 }, { 0.6101500770757914, -1.479826990758988e-17 },
+    { 0.6346070800152693, -3.4568582392624965e-17 }, { 0.6584443999105676, -3.7736386700306717e-17 },
+    { 0.6816387600233341, 4.410467313197903e-17 }, { 0.7041675114545337, -3.94095700584825e-17 },
+};
+inline constexpr f128 F128_COS_TABLE[26] = {
+    { 1.0, 0.0 }, { 0.9995117584851364, -3.418806487972947e-17 },
+    { 0.9980475107000991, 3.3232291674141346e-17 }, { 0.9956086864580017, 3.312922430932991e-17 },
+    { 0.992197667229329, 4.754870575189364e-17 }, { 0.9878177838164719, 4.91917302237681e-17 },
+    { 0.9824733131012553, -3.919920375420088e-17 }, { 0.9761694738686353, -7.850690609285027e-18 },
+    { 0.9689124217106447, 5.071436662403936e-17 }, { 0.9607092430155619, -2.807827063516729e-17 },
+    { 0.9515679480481722, -3.8614834675674123e-17 }, { 0.9414974631278811, -4.8523830236797095e-18 },
+    { 0.9305076219123143, 4.488760003328074e-18 }, { 0.9186091557949183, -4.0564150104514996e-17 },
+    { 0.9058136834259364, 4.2864666490805214e-17 }, { 0.8921336993669944, 2.3160655211380166e-17 },
+    { 0.8775825618903728, -4.2623149864279997e-17 }, { 0.8621744799348805, 4.4132427578105805e-18 },
+    { 0.8459244992310679, 1.549506647350329e-17 }, { 0.8288484876093257, 1.1163935406617444e-17 },
+    { 0.8109631195052179, -3.091333486122179e-17 }, { 0.7922858596771786, -2.9049779312834576e-17 },
+    { 0.7728349461524715, 4.231014921891023e-17 }, { 0.7526293724180665, -1.2970993013150526e-17 },
+    { 0.7316888688738209, -1.0475824306512768e-17 }, { 0.7100338835660797, 1.505272211891291e-17 },
+};
+inline constexpr f128 F128_ATAN_TABLE[65] = {
+    { 0.0, 0.0 }, { 0.015623728620476831, -4.913600136566304e-19 },
+    { 0.031239833430268277, -1.188442711587748e-18 }, { 0.046840712915969654, -1.655677442254952e-19 },
+    { 0.06241880999595735, -1.5490756308295046e-18 }, { 0.0779666338315423, 5.804551873143357e-18 },
+    { 0.09347678115858947, -6.2844725995420954e-18 }, { 0.10894195698986579, 6.8267122072409585e-18 },
+    { 0.12435499454676144, -3.1253241424539383e-18 }, { 0.13970887428916365, -2.9579864247315813e-18 },
+    { 0.15499674192394097, 9.585415594114324e-18 }, { 0.1702119252854744, -3.541164079802125e-18 },
+    { 0.18534794999569476, 4.180692268843079e-18 }, { 0.2003985538258785, 3.1399542871844493e-18 },
+    { 0.21535769969773805, 4.738160130078733e-19 }, { 0.23021958727684372, 1.2313404529142703e-17 },
+    { 0.24497866312686414, 1.0698755618734451e-17 }, { 0.2596296294082575, 1.9238754924615304e-17 },
+    { 0.2741674511196588, 8.261353575163773e-18 }, { 0.2885873618940774, -1.428369957377257e-17 },
+    { 0.3028848683749714, -1.1010827903001369e-17 }, { 0.31705575320914703, -1.893928924292642e-17 },
+    { 0.3310960767041321, -7.952610375793799e-18 }, { 0.34500217720710513, -2.2938804755578304e-17 },
+    { 0.35877067027057225, -2.4623815582638635e-17 }, { 0.3723984466767542, 1.9612311504845653e-17 },
+    { 0.38588266939807375, 2.378822732491941e-17 }, { 0.39922076957525254, 2.246598105617042e-17 },
+    { 0.4124104415973873, -1.587652227770689e-17 }, { 0.42544963737004227, 2.3315530741892885e-17 },
+    { 0.43833655985795783, -2.494277030626541e-17 }, { 0.4510696559885235, -2.2703795229420475e-17 },
+    { 0.4636476090008061, 2.2698777452961687e-17 }, { 0.4760693303227612, 1.4654487332256713e-17 },
+    { 0.48833395105640554, -1.1373236189329585e-17 }, { 0.5004408131472942, -4.7181675085518756e-17 },
+    { 0.5123894603107377, -2.5462781472855804e-17 }, { 0.5241796287829132, 5.520094119641666e-18 },
+    { 0.5358112379604637, -4.0637956834825575e-18 }, { 0.5472843809874369, 4.923709671396255e-17 },
+    { 0.5585993153435624, -5.4556305485916264e-18 }, { 0.5697564534829784, 1.2255062085054184e-17 },
+    { 0.5807563535676704, -1.441464378193067e-17 }, { 0.5915997103351114, 4.920495453686772e-17 },
+    { 0.6022873461349642, 2.950430737228402e-17 }, { 0.6128202021652414, -3.1552061848586226e-17 },
+    { 0.6231993299340659, 2.672403885140095e-17 }, { 0.6334258829691446, -2.7290767436015276e-17 },
+    { 0.6435011087932844, 1.5834785051444286e-17 }, { 0.6534263411807619, 3.5800634857340095e-17 },
+    { 0.6632029927060933, -3.076054864429649e-17 }, { 0.6728325475937632, -1.899315009714705e-17 },
+    { 0.6823165548747481, 6.943223671560008e-18 }, { 0.6916566218531999, -8.117151192285796e-18 },
+    { 0.7008544078844502, -1.987626234335816e-17 }, { 0.7099116184635249, -4.597166450584887e-17 },
+    { 0.7188299996216245, -2.1478388444456983e-17 }, { 0.7276113326265107, 2.569325697391839e-18 },
+    { 0.7362574289814281, 3.473937648299457e-17 }, { 0.7447701257160751, 3.708315849135547e-17 },
+    { 0.7531512809621944, -2.4256934659182068e-17 }, { 0.7614027698055784, 9.850030332752822e-18 },
+    { 0.7695264804056583, -3.704991905602721e-17 }, { 0.7775243103733478, -2.6676490951944502e-17 },
+    { 0.7853981633974483, 3.061616997868383e-17 },
+};
+
 FORCE_INLINE f128 f128_ldexp(const f128& x, int e)
 {
     // Scale by a power of two (preserves the double exponent range behavior)
     return f128(std::ldexp(x.hi, e), std::ldexp(x.lo, e));
 }
-FORCE_INLINE bool f128_rem_pio2(const f128& x, long long& n_out, f128& r_out)
+FORCE_INLINE f128 f128_two_prod(double a, double b)
 {
-    // Reduce x = n*(pi/2) + r with r in roughly [-pi/4, pi/4].
-    // Returns false if n cannot be represented robustly
-
-    double ax = std::fabs(x.hi);
-    if (!std::isfinite(ax)) return false;
-
-    // If x exceeds 2^52, a double cannot represent every integer and remainder accuracy collapses
-    if (ax > 7.0e15) return false;
-
-    f128 t = x * F128_INV_PIO2;
-    double qd = std::nearbyint((double)t);
-
-    // Guard cast to int64
-    if (!std::isfinite(qd) ||
-        qd < (double)std::numeric_limits<long long>::min() ||
-        qd >(double)std::numeric_limits<long long>::max())
-        return false;
-
-    long long n = (long long)qd;
-    n_out = n;
-    r_out = x - f128((double)n) * F128_PIO2;
-    return true;
+    double p, e;
+    #ifdef FMA_AVAILABLE
+    two_prod_precise_fma(a, b, p, e);
+    #else
+    two_prod_precise_dekker(a, b, p, e);
+    #endif
+    return { p, e };
 }
-FORCE_INLINE void f128_sincos_kernel_pio4(const f128& x, f128& s_out, f128& c_out)
+FORCE_INLINE f128 f128_reduce(const f128& x, double n, double c1, double c2, double c3)
 {
-    // Taylor kernels on |x| <= pi/4. Degrees chosen to push truncation error below ~1e-34.
-    f128 t = x * x;
-
-    // sin(x) = x + x^3 * P(t)
-    f128 ps = f128(1.13099628864477159e-31);      //  1/29!
-    ps = ps * t + f128(-9.18368986379554601e-29); // -1/27!
-    ps = ps * t + f128(6.44695028438447359e-26);  //  1/25!
-    ps = ps * t + f128(-3.86817017063068413e-23); // -1/23!
-    ps = ps * t + f128(1.95729410633912626e-20);  //  1/21!
-    ps = ps * t + f128(-8.22063524662432950e-18); // -1/19!
-    ps = ps * t + f128(2.81145725434552060e-15);  //  1/17!
-    ps = ps * t + f128(-7.64716373181981641e-13); // -1/15!
-    ps = ps * t + f128(1.60590438368216133e-10);  //  1/13!
-    ps = ps * t + f128(-2.50521083854417202e-08); // -1/11!
-    ps = ps * t + f128(2.75573192239858925e-06);  //  1/9!
-    ps = ps * t + f128(-1.98412698412698413e-04); // -1/7!
-    ps = ps * t + f128(8.33333333333333322e-03);  //  1/5!
-    ps = ps * t + f128(-1.66666666666666657e-01); // -1/3!
-    s_out = x + x * t * ps;
-
-    // cos(x) = 1 + x^2 * Q(t)
-    f128 pc = f128(3.27988923706983776e-30);       //  1/28!
-    pc = pc * t + f128(-2.47959626322479759e-27);  // -1/26!
-    pc = pc * t + f128(1.61173757109611839e-24);   //  1/24!
-    pc = pc * t + f128(-8.89679139245057408e-22);  // -1/22!
-    pc = pc * t + f128(4.11031762331216484e-19);   //  1/20!
-    pc = pc * t + f128(-1.56192069685862253e-16);  // -1/18!
-    pc = pc * t + f128(4.77947733238738525e-14);   //  1/16!
-    pc = pc * t + f128(-1.14707455977297245e-11);  // -1/14!
-    pc = pc * t + f128(2.08767569878681002e-09);   //  1/12!
-    pc = pc * t + f128(-2.75573192239858883e-07);  // -1/10!
-    pc = pc * t + f128(2.48015873015873016e-05);   //  1/8!
-    pc = pc * t + f128(-1.38888888888888894e-03);  // -1/6!
-    pc = pc * t + f128(4.16666666666666644e-02);   //  1/4!
-    pc = pc * t + f128(-5.00000000000000000e-01);  // -1/2!
-    c_out = f128(1.0) + t * pc;
-}
-FORCE_INLINE bool f128_sincos(const f128& x, f128& s_out, f128& c_out)
-{
-    // Full sin/cos with quadrant handling; uses kernels above
-    double ax = std::fabs(x.hi);
-    if (!std::isfinite(ax))
-    {
-        s_out = f128(std::numeric_limits<double>::quiet_NaN());
-        c_out = s_out;
-        return false;
-    }
+    // x - n*(c1 + c2 + c3). x.hi - n*c1 cancels (near-)exactly, the remaining terms are small and
+    // each is added on its own, so nothing of size |x| ever rounds into the result.
+    const f128 p1 = f128_two_prod(n, c1);
+    const f128 p2 = f128_two_prod(n, c2);
 
-    // Fast path: already small enough.
-    if (ax <= F128_PIO4_HI)
-    {
-        f128_sincos_kernel_pio4(x, s_out, c_out);
-        return true;
-    }
-
-    long long n = 0;
-    f128 r;
-    if (!f128_rem_pio2(x, n, r))
-        return false;
-
-    f128 sr, cr;
-    f128_sincos_kernel_pio4(r, sr, cr);
-
-    switch ((int)(n & 3))
-    {
-    case 0: s_out = sr;  c_out = cr;  break;
-    case 1: s_out = cr;  c_out = -sr; break;
-    case 2: s_out = -sr; c_out = -cr; break;
-    default: s_out = -cr; c_out = sr; break;
-    }
-    return true;
+    double s, e;
+    two_sum_precise(x.hi, -p1.hi, s, e);
+    f128 r{ s, e };
+    r = r + x.lo;
+    r = r - p1.lo;
+    r = r - p2.hi;
+    r = r - p2.lo;
+    r = r - n * c3;
+    return r;
 }
-FORCE_INLINE f128 f128_exp_kernel_ln2_half(const f128& r)
-{
-    // exp(r) kernel for |r| <= ln2/2 via truncated Taylor series (degree 22)
-    f128 p =    f128(8.89679139245057408e-22); // 1/22!
-    p = p * r + f128(1.95729410633912626e-20); // 1/21!
-    p = p * r + f128(4.11031762331216484e-19); // 1/20!
-    p = p * r + f128(8.22063524662432950e-18); // 1/19!
-    p = p * r + f128(1.56192069685862253e-16); // 1/18!
-    p = p * r + f128(2.81145725434552060e-15); // 1/17!
-    p = p * r + f128(4.77947733238738525e-14); // 1/16!
-    p = p * r + f128(7.64716373181981641e-13); // 1/15!
-    p = p * r + f128(1.14707455977297245e-11); // 1/14!
-    p = p * r + f128(1.60590438368216133e-10); // 1/13!
-    p = p * r + f128(2.08767569878681002e-09); // 1/12!
-    p = p * r + f128(2.50521083854417202e-08); // 1/11!
-    p = p * r + f128(2.75573192239858883e-07); // 1/10!
-    p = p * r + f128(2.75573192239858925e-06); // 1/9!
-    p = p * r + f128(2.48015873015873016e-05); // 1/8!
-    p = p * r + f128(1.98412698412698413e-04); // 1/7!
-    p = p * r + f128(1.38888888888888894e-03); // 1/6!
-    p = p * r + f128(8.33333333333333322e-03); // 1/5!
-    p = p * r + f128(4.16666666666666644e-02); // 1/4!
-    p = p * r + f128(1.66666666666666657e-01); // 1/3!
-    p = p * r + f128(5.00000000000000000e-01); // 1/2!
-    p = p * r + f128(1.0);                     // 1/1!
-    return (p * r) + f128(1.0);                //+1/0!
-}
-FORCE_INLINE f128 f128_sin_kernel_pio4(const f128& x)
+FORCE_INLINE f128 f128_div_long(const f128& n, const f128& d)
 {
-    // sin kernel for |x| <= pi/4.
-    f128 t = x * x;
-
-    // sin(x) = x + x*t*P(t)
-    f128 ps = f128(-9.18368986379554615e-29);
-    ps = ps * t + f128(6.4469502843844734e-26);
-    ps = ps * t + f128(-3.86817017063068404e-23);
-    ps = ps * t + f128(1.95729410633912612e-20);
-    ps = ps * t + f128(-8.22063524662432972e-18);
-    ps = ps * t + f128(2.81145725434552076e-15);
-    ps = ps * t + f128(-7.64716373181981648e-13);
-    ps = ps * t + f128(1.60590438368216146e-10);
-    ps = ps * t + f128(-2.50521083854417188e-8);
-    ps = ps * t + f128(2.75573192239858907e-6);
-    ps = ps * t + f128(-1.98412698412698413e-4);
-    ps = ps * t + f128(8.33333333333333333e-3);
-    ps = ps * t + f128(-1.66666666666666667e-1);
-
-    return x + x * t * ps;
-}
-FORCE_INLINE f128 f128_cos_kernel_pio4(const f128& x)
-{
-    // cos kernel for |x| <= pi/4
-    f128 t = x * x;
-
-    // cos(x) = 1 + t*Q(t)
-    f128 pc = f128(3.27988923706983791e-30);
-    pc = pc * t + f128(-2.47959626322479746e-27);
-    pc = pc * t + f128(1.61173757109611835e-24);
-    pc = pc * t + f128(-8.89679139245057329e-22);
-    pc = pc * t + f128(4.11031762331216486e-19);
-    pc = pc * t + f128(-1.56192069685862265e-16);
-    pc = pc * t + f128(4.7794773323873853e-14);
-    pc = pc * t + f128(-1.14707455977297247e-11);
-    pc = pc * t + f128(2.0876756987868099e-9);
-    pc = pc * t + f128(-2.75573192239858907e-7);
-    pc = pc * t + f128(2.48015873015873016e-5);
-    pc = pc * t + f128(-1.38888888888888889e-3);
-    pc = pc * t + f128(4.16666666666666667e-2);
-    pc = pc * t + f128(-5.0e-1);
-
-    return f128(1.0) + t * pc;
-}
-
-FORCE_INLINE f128 sin(f128 a)
-{
-    double ax = std::fabs(a.hi);
-    if (!std::isfinite(ax))
-        return f128(std::sin((double)a));
-
-    // Small fast path: no range reduction
-    if (ax <= F128_PIO4_HI)
-        return f128_sin_kernel_pio4(a);
-
-    long long n = 0;
-    f128 r;
-    if (!f128_rem_pio2(a, n, r))
-        return f128(std::sin((double)a));
-
-    // sin(x) uses sin(r) or cos(r) depending on quadrant.
-    switch ((int)(n & 3))
-    {
-    case 0:  return  f128_sin_kernel_pio4(r);
-    case 1:  return  f128_cos_kernel_pio4(r);
-    case 2:  return -f128_sin_kernel_pio4(r);
-    default: return -f128_cos_kernel_pio4(r);
-    }
+    // n / d as three quotient digits (cheaper than a * recip(b) where only ~2^-106 is needed)
+    const double q1 = n.hi / d.hi;
+    f128 r = n - d * q1;
+    const double q2 = r.hi / d.hi;
+    r = r - d * q2;
+    const double q3 = r.hi / d.hi;
+    return quick_two_sum(q1, q2) + q3;
 }
-FORCE_INLINE f128 cos(f128 a)
-{
-    double ax = std::fabs(a.hi);
-    if (!std::isfinite(ax))
-        return f128(std::cos((double)a));
 
-    // Small fast path: no range reduction.
-    if (ax <= F128_PIO4_HI)
-        return f128_cos_kernel_pio4(a);
-
-    long long n = 0;
-    f128 r;
-    if (!f128_rem_pio2(a, n, r))
-        return f128(std::cos((double)a));
-
-    // cos(x) uses cos(r) or sin(r) depending on quadrant.
-    switch ((int)(n & 3))
-    {
-    case 0:  return  f128_cos_kernel_pio4(r);
-    case 1:  return -f128_sin_kernel_pio4(r);
-    case 2:  return -f128_cos_kernel_pio4(r);
-    default: return  f128_sin_kernel_pio4(r);
-    }
-}
 FORCE_INLINE f128 sqrt(f128 a)
 {
     // Match std semantics for negative / zero quickly.
@@ -884,58 +834,217 @@ FORCE_INLINE f128 exp(const f128& a)
     if (a.hi > 709.782712893384) return f128(std::numeric_limits<double>::max());
     if (a.hi < -745.133219101941) return f128(0.0);
 
-    f128 t = a * F128_INV_LN2;
-    double kd = std::nearbyint((double)t);
+    // a = (64m + j) * ln2/64 + s, |s| <= ln2/128
+    const double kd = std::nearbyint(a.hi * 92.33248261689366);
+    const f128 s = f128_reduce(a, kd, F128_LN2_64_1, F128_LN2_64_2, F128_LN2_64_3);
+    const int k = (int)kd;
+    const int j = k & 63;
+    const int m = (k - j) / 64;
+
+    // exp(s), terms past s^6 in double (s^7/7! < 2^-69)
+    const double sd = s.hi;
+    const double tail = ((((1.0 / 39916800.0) * sd + 1.0 / 3628800.0) * sd + 1.0 / 362880.0) * sd + 1.0 / 40320.0) * sd + 1.0 / 5040.0;
+    f128 p = f128(tail) * s + renorm(0.001388888888888889, -5.300543954373577e-20); // 1/6!
+    p = p * s + renorm(0.008333333333333333, 1.1564823173178714e-19);               // 1/5!
+    p = p * s + renorm(0.041666666666666664, 2.3129646346357427e-18);               // 1/4!
+    p = p * s + renorm(0.16666666666666666, 9.25185853854297e-18);                  // 1/3!
+    p = p * s + 0.5;
+    p = p * s + 1.0;
+    p = p * s + 1.0;
+
+    return f128_ldexp(F128_EXP2_64[j] * p, m);
+}
+FORCE_INLINE f128 log(const f128& a)
+{
+    if (a.hi <= 0.0)
+    {
+        if (a.hi == 0.0) return f128(-std::numeric_limits<double>::infinity());
+        return f128(std::numeric_limits<double>::quiet_NaN());
+    }
+    if (!std::isfinite(a.hi)) return a;
+
+    // a = 2^e * m, m in [sqrt(1/2), sqrt(2)) so log(m) never cancels against e*ln2
+    int e = std::ilogb(a.hi);
+    f128 m = f128_ldexp(a, -e);
+    if (m.hi > 1.4142135623730951) { m = f128_ldexp(m, -1); ++e; }
+
+    // log(m) = log(c) + 2 atanh(u), c = 1 + j/64, u = (m - c) / (m + c), |u| < 1/180
+    const int j = (int)std::nearbyint((m.hi - 1.0) * 64.0);
+    const double c = 1.0 + j * (1.0 / 64.0);
+    const f128 u = f128_div_long(m - c, m + c);
+    const f128 v = u * u;
+
+    // 2 atanh(u) = 2u (1 + v/3 + v^2/5 + ...), terms past v^3 in double
+    const double vd = v.hi;
+    const double tail = (((vd * (1.0 / 17.0) + 1.0 / 15.0) * vd + 1.0 / 13.0) * vd + 1.0 / 11.0) * vd + 1.0 / 9.0;
+    f128 p = f128(tail) * v + renorm(0.14285714285714285, 7.93016446160826e-18); // 1/7
+    p = p * v + renorm(0.2, -1.1102230246251566e-17);                            // 1/5
+    p = p * v + renorm(0.3333333333333333, 1.850371707708594e-17);               // 1/3
+    p = p * v + 1.0;
+
+    const f128 log_m = F128_LOG_TABLE[j + 19] + f128{ 2.0 * u.hi, 2.0 * u.lo } * p;
+    return (e == 0) ? log_m : F128_LN2 * (double)e + log_m;
+}
+FORCE_INLINE f128 log2(const f128& a)
+{
+    return log(a) * F128_INV_LN2;
+}
+FORCE_INLINE f128 log10(const f128& a)
+{
+    return log(a) * F128_INV_LN10;
+}
+FORCE_INLINE void sincos(const f128& x, f128& s_out, f128& c_out)
+{
+    const double ax = std::fabs(x.hi);
 
-    // Keep k within exact-in-double integer range (prevents remainder blowups).
-    if (!std::isfinite(kd) || std::fabs(kd) > 9.0e15)
-        return f128(std::exp((double)a));
+    // Past 2^52 the quadrant itself is lost, fall back to double.
+    if (!std::isfinite(ax) || ax > 7.0e15)
+    {
+        s_out = f128(std::sin(x.hi));
+        c_out = f128(std::cos(x.hi));
+        return;
+    }
 
-    int k = (int)kd;
-    f128 r = a - f128((double)k) * F128_LN2;
+    // x = n*(pi/2) + r, |r| <= pi/4
+    f128 r = x;
+    long long n = 0;
+    if (ax > F128_PIO4_HI)
+    {
+        const double nd = std::nearbyint(x.hi * 0.6366197723675814);
+        r = f128_reduce(x, nd, F128_PIO2_1, F128_PIO2_2, F128_PIO2_3);
+        n = (long long)nd;
+    }
 
-    // if reduction misbehaved, fall back rather than returning nonsense.
-    if (std::fabs(r.hi) > 0.40)
-        return f128(std::exp((double)a));
+    // r = t + d, t = +-j/32, |d| <= 1/64
+    const int j = (int)std::nearbyint(std::fabs(r.hi) * 32.0);
+    const double t = std::copysign(j * (1.0 / 32.0), r.hi);
+    const f128 d = r - t;
+    const f128 v = d * d;
+    const double vd = v.hi;
+
+    // sin(d) = d + d*v*P(v), terms past d^7 in double
+    const double ts = ((-7.647163731819816e-13 * vd + 1.6059043836821613e-10) * vd - 2.505210838544172e-08) * vd + 2.7557319223985893e-06;
+    f128 ps = f128(ts) * v + renorm(-0.0001984126984126984, -1.7209558293420705e-22); // -1/7!
+    ps = ps * v + renorm(0.008333333333333333, 1.1564823173178714e-19);              //  1/5!
+    ps = ps * v + renorm(-0.16666666666666666, -9.25185853854297e-18);               // -1/3!
+    const f128 sin_d = d + d * v * ps;
+
+    // cos(d) = 1 + v*Q(v), terms past d^6 in double
+    const double tc = ((-1.1470745597729725e-11 * vd + 2.08767569878681e-09) * vd - 2.755731922398589e-07) * vd + 2.48015873015873e-05;
+    f128 pc = f128(tc) * v + renorm(-0.001388888888888889, 5.300543954373577e-20); // -1/6!
+    pc = pc * v + renorm(0.041666666666666664, 2.3129646346357427e-18);           //  1/4!
+    pc = pc * v - 0.5;
+    const f128 cos_d = f128(1.0) + v * pc;
+
+    // sin(t + d), cos(t + d)
+    const f128 sin_t = (r.hi < 0.0) ? -F128_SIN_TABLE[j] : F128_SIN_TABLE[j];
+    const f128 cos_t = F128_COS_TABLE[j];
+    const f128 sr = sin_t * cos_d + cos_t * sin_d;
+    const f128 cr = cos_t * cos_d - sin_t * sin_d;
 
-    f128 er = f128_exp_kernel_ln2_half(r);
-    return f128_ldexp(er, k);
+    switch ((int)(n & 3))
+    {
+    case 0:  s_out = sr;  c_out = cr;  break;
+    case 1:  s_out = cr;  c_out = -sr; break;
+    case 2:  s_out = -sr; c_out = -cr; break;
+    default: s_out = -cr; c_out = sr;  break;
+    }
+}
+FORCE_INLINE f128 sin(const f128& a)
+{
+    f128 s, c;
+    sincos(a, s, c);
+    return s;
+}
+FORCE_INLINE f128 cos(const f128& a)
+{
+    f128 s, c;
+    sincos(a, s, c);
+    return c;
 }
 FORCE_INLINE f128 atan2(const f128& y, const f128& x)
 {
-    static constexpr double DD_PI2 = 1.570796326794896619231321691639751442;
-
     // Special cases first (match IEEE / std::atan2 as closely as possible).
     if (x.hi == 0.0 && x.lo == 0.0)
     {
         if (y.hi == 0.0 && y.lo == 0.0)
             return f128(std::numeric_limits<double>::quiet_NaN());
-        return (y.hi > 0.0 || (y.hi == 0.0 && y.lo > 0.0)) ? f128(DD_PI2) : f128(-DD_PI2);
+        return (y.hi > 0.0 || (y.hi == 0.0 && y.lo > 0.0)) ? F128_PIO2 : -F128_PIO2;
     }
+    if (!std::isfinite(x.hi) || !std::isfinite(y.hi))
+        return f128(std::atan2(y.hi, x.hi));
+
+    // fold into 0 <= ay <= ax
+    f128 ax = abs(x), ay = abs(y);
+    const bool swap = ay > ax;
+    if (swap) std::swap(ax, ay);
+
+    // atan(ay/ax) = atan(c) + atan(w), c = j/64, w = (ay - c*ax) / (ax + c*ay), |w| <= 1/128
+    const int j = (int)std::nearbyint(ay.hi / ax.hi * 64.0);
+    const double c = j * (1.0 / 64.0);
+    const f128 w = (j == 0)
+        ? f128_div_long(ay, ax)
+        : f128_div_long(f128_reduce(ay, c, ax.hi, ax.lo, 0.0), ax + ay * c);
+    const f128 v = w * w;
+    const double vd = v.hi;
+
+    // atan(w) = w + w*v*P(v), terms past w^7 in double
+    const double tail = ((((1.0 / 17.0) * vd - 1.0 / 15.0) * vd + 1.0 / 13.0) * vd - 1.0 / 11.0) * vd + 1.0 / 9.0;
+    f128 p = f128(tail) * v - renorm(0.14285714285714285, 7.93016446160826e-18); // -1/7
+    p = p * v + renorm(0.2, -1.1102230246251566e-17);                            //  1/5
+    p = p * v - renorm(0.3333333333333333, 1.850371707708594e-17);               // -1/3
+
+    f128 r = F128_ATAN_TABLE[j] + (w + w * v * p);
+    if (swap)       r = F128_PIO2 - r;
+    if (x.hi < 0.0) r = F128_PI - r;
+    return (y.hi < 0.0) ? -r : r;
+}
+FORCE_INLINE f128 tan(const f128& a)
+{
+    f128 s, c;
+    sincos(a, s, c);
+    return s / c;
+}
+FORCE_INLINE f128 atan(const f128& x) { return atan2(x, f128{ 1 }); }
+FORCE_INLINE f128 pow(const f128& x, const f128& y)
+{
+    if (y.hi == 0.0) return f128(1.0);
 
-    // Seed from libm (correct quadrant), then refine with Newton on f(v)=x*sin v - y*cos v.
-    f128 v(std::atan2(y.hi, x.hi));
+    const bool y_int = (std::floor(y.hi) == y.hi) && (std::floor(y.lo) == y.lo);
+    bool negate = false;
+    f128 b = x;
+    if (x.hi <= 0.0)
+    {
+        if (x.hi == 0.0) return (y.hi > 0.0) ? f128(0.0) : f128(std::numeric_limits<double>::infinity());
+        if (!y_int) return f128(std::numeric_limits<double>::quiet_NaN());
 
-    for (int i = 0; i < 2; ++i)
+        // negative base, integer exponent: sign from parity
+        negate = (std::fmod(y.hi, 2.0) != 0.0) != (std::fmod(y.lo, 2.0) != 0.0);
+        b = -x;
+    }
+
+    f128 r;
+    if (y_int && std::fabs(y.hi) <= 64.0)
     {
-        f128 sv, cv;
-        if (!f128_sincos(v, sv, cv))
+        // small integer powers by squaring (fewer roundings than exp/log)
+        long long e = (long long)std::fabs(y.hi);
+        r = f128(1.0);
+        while (e)
         {
-            double vd = (double)v;
-            sv = f128(std::sin(vd));
-            cv = f128(std::cos(vd));
+            if (e & 1) r = r * b;
+            e >>= 1;
+            if (e) b = b * b;
         }
-
-        f128 f = x * sv - y * cv;
-        f128 fp = x * cv + y * sv;
-
-        v = v - f / fp;
+        if (y.hi < 0.0) r = f128(1.0) / r;
     }
-    return v;
+    else
+    {
+        // relative error grows with |y*log(x)|, the absolute error of the exponent
+        r = exp(y * log(b));
+    }
+
+    return negate ? -r : r;
 }
-FORCE_INLINE f128 tan(const f128& a) { return sin(a) / cos(a); }
-FORCE_INLINE f128 pow(const f128& x, const f128& y) { return exp(y * log(x)); }
-FORCE_INLINE f128 atan(const f128& x) { return atan2(x, f128{ 1 }); }
 
 
 /*------------ precise DP rounding -------------------------------------------*/
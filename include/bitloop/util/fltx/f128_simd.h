@@ -0,0 +1,479 @@
+#pragma once
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include "f128.h"
+
+#ifndef BL_BEGIN_NS
+#define BL_BEGIN_NS namespace bl {
+#define BL_END_NS   }
+#endif
+#include "../simd.h"
+
+/// ======== Packed double-double (SoA) ========
+//
+// f128x2 / f128x4 hold 2 or 4 f128 values as separate hi[] / lo[] registers and run the exact
+// same operation sequence as the scalar f128 operators (FMA or Dekker path, matching FMA_AVAILABLE),
+// so every lane is bit-for-bit identical to the scalar result.
+//
+//   simd2::f128x2  - native 2-lane (SSE2 / NEON / WASM / scalar)
+//   simd2::f128x4  - native 4-lane on AVX, otherwise a pair of 2-lane halves
+//   simd2::f128xN  - widest native width for the active tag
+
+BL_BEGIN_NS;
+
+namespace simd2 {
+
+    // Per-ISA packed double lanes. fma() must be a true fused multiply-add, since it reproduces
+    // std::fma in the scalar FMA path.
+    template<int N, class TAG = tag_t> struct dvec;
+
+    // ---- scalar (any lane count) ----
+    template<int N> struct dvec<N, scalar_tag>
+    {
+        static constexpr int lanes = N;
+        struct V { double v[N]; };
+        struct M { bool v[N]; };
+
+        #define BL_DVEC_LANES(expr) V r; for (int i = 0; i < N; i++) r.v[i] = (expr); return r
+        #define BL_DMASK_LANES(expr) M r; for (int i = 0; i < N; i++) r.v[i] = (expr); return r
+
+        static inline V set1(double x)                 { BL_DVEC_LANES(x); }
+        static inline V load(const double* p)          { BL_DVEC_LANES(p[i]); }
+        static inline void store(double* p, V a)       { for (int i = 0; i < N; i++) p[i] = a.v[i]; }
+
+        static inline V add(V a, V b)                  { BL_DVEC_LANES(a.v[i] + b.v[i]); }
+        static inline V sub(V a, V b)                  { BL_DVEC_LANES(a.v[i] - b.v[i]); }
+        static inline V mul(V a, V b)                  { BL_DVEC_LANES(a.v[i] * b.v[i]); }
+        static inline V div(V a, V b)                  { BL_DVEC_LANES(a.v[i] / b.v[i]); }
+        static inline V sqrt(V a)                      { BL_DVEC_LANES(std::sqrt(a.v[i])); }
+        static inline V neg(V a)                       { BL_DVEC_LANES(-a.v[i]); }
+        static inline V fma(V a, V b, V c)             { BL_DVEC_LANES(std::fma(a.v[i], b.v[i], c.v[i])); }
+
+        static inline M lt(V a, V b)                   { BL_DMASK_LANES(a.v[i] <  b.v[i]); }
+        static inline M le(V a, V b)                   { BL_DMASK_LANES(a.v[i] <= b.v[i]); }
+        static inline M eq(V a, V b)                   { BL_DMASK_LANES(a.v[i] == b.v[i]); }
+        static inline M mand(M a, M b)                 { BL_DMASK_LANES(a.v[i] && b.v[i]); }
+        static inline M mor(M a, M b)                  { BL_DMASK_LANES(a.v[i] || b.v[i]); }
+        static inline M mnot(M a)                      { BL_DMASK_LANES(!a.v[i]); }
+        static inline V blend(M m, V a, V b)           { BL_DVEC_LANES(m.v[i] ? a.v[i] : b.v[i]); }
+        static inline int bits(M m)                    { int r = 0; for (int i = 0; i < N; i++) r |= int(m.v[i]) << i; return r; }
+
+        #undef BL_DVEC_LANES
+        #undef BL_DMASK_LANES
+    };
+
+    // ---- SSE2+ ----
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX) || defined(BL_SIMD_SSE2)
+    template<> struct dvec<2, sse_tag>
+    {
+        static constexpr int lanes = 2;
+        using V = __m128d;
+        using M = __m128d;
+
+        static inline V set1(double x)                 { return _mm_set1_pd(x); }
+        static inline V load(const double* p)          { return _mm_loadu_pd(p); }
+        static inline void store(double* p, V a)       { _mm_storeu_pd(p, a); }
+
+        static inline V add(V a, V b)                  { return _mm_add_pd(a, b); }
+        static inline V sub(V a, V b)                  { return _mm_sub_pd(a, b); }
+        static inline V mul(V a, V b)                  { return _mm_mul_pd(a, b); }
+        static inline V div(V a, V b)                  { return _mm_div_pd(a, b); }
+        static inline V sqrt(V a)                      { return _mm_sqrt_pd(a); }
+        static inline V neg(V a)                       { return _mm_xor_pd(a, _mm_set1_pd(-0.0)); }
+        static inline V fma(V a, V b, V c)
+        {
+            #if defined(__FMA__) || defined(__AVX2__)
+            return _mm_fmadd_pd(a, b, c);
+            #else
+            alignas(16) double x[2], y[2], z[2];
+            _mm_store_pd(x, a); _mm_store_pd(y, b); _mm_store_pd(z, c);
+            return _mm_set_pd(std::fma(x[1], y[1], z[1]), std::fma(x[0], y[0], z[0]));
+            #endif
+        }
+
+        static inline M lt(V a, V b)                   { return _mm_cmplt_pd(a, b); }
+        static inline M le(V a, V b)                   { return _mm_cmple_pd(a, b); }
+        static inline M eq(V a, V b)                   { return _mm_cmpeq_pd(a, b); }
+        static inline M mand(M a, M b)                 { return _mm_and_pd(a, b); }
+        static inline M mor(M a, M b)                  { return _mm_or_pd(a, b); }
+        static inline M mnot(M a)                      { return _mm_xor_pd(a, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+        static inline V blend(M m, V a, V b)           { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+        static inline int bits(M m)                    { return _mm_movemask_pd(m); }
+    };
+    #endif
+
+    // ---- AVX / AVX2 ----
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX)
+    template<> struct dvec<4, sse_tag>
+    {
+        static constexpr int lanes = 4;
+        using V = __m256d;
+        using M = __m256d;
+
+        static inline V set1(double x)                 { return _mm256_set1_pd(x); }
+        static inline V load(const double* p)          { return _mm256_loadu_pd(p); }
+        static inline void store(double* p, V a)       { _mm256_storeu_pd(p, a); }
+
+        static inline V add(V a, V b)                  { return _mm256_add_pd(a, b); }
+        static inline V sub(V a, V b)                  { return _mm256_sub_pd(a, b); }
+        static inline V mul(V a, V b)                  { return _mm256_mul_pd(a, b); }
+        static inline V div(V a, V b)                  { return _mm256_div_pd(a, b); }
+        static inline V sqrt(V a)                      { return _mm256_sqrt_pd(a); }
+        static inline V neg(V a)                       { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+        static inline V fma(V a, V b, V c)
+        {
+            #if defined(__FMA__) || defined(__AVX2__)
+            return _mm256_fmadd_pd(a, b, c);
+            #else
+            alignas(32) double x[4], y[4], z[4];
+            _mm256_store_pd(x, a); _mm256_store_pd(y, b); _mm256_store_pd(z, c);
+            return _mm256_set_pd(std::fma(x[3], y[3], z[3]), std::fma(x[2], y[2], z[2]),
+                                 std::fma(x[1], y[1], z[1]), std::fma(x[0], y[0], z[0]));
+            #endif
+        }
+
+        static inline M lt(V a, V b)                   { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        static inline M le(V a, V b)                   { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+        static inline M eq(V a, V b)                   { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+        static inline M mand(M a, M b)                 { return _mm256_and_pd(a, b); }
+        static inline M mor(M a, M b)                  { return _mm256_or_pd(a, b); }
+        static inline M mnot(M a)                      { return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+        static inline V blend(M m, V a, V b)           { return _mm256_blendv_pd(b, a, m); }
+        static inline int bits(M m)                    { return _mm256_movemask_pd(m); }
+    };
+    #endif
+
+    // ---- NEON (AArch64) ----
+    #if defined(BL_SIMD_NEON) && defined(__aarch64__)
+    template<> struct dvec<2, neon_tag>
+    {
+        static constexpr int lanes = 2;
+        using V = float64x2_t;
+        using M = uint64x2_t;
+
+        static inline V set1(double x)                 { return vdupq_n_f64(x); }
+        static inline V load(const double* p)          { return vld1q_f64(p); }
+        static inline void store(double* p, V a)       { vst1q_f64(p, a); }
+
+        static inline V add(V a, V b)                  { return vaddq_f64(a, b); }
+        static inline V sub(V a, V b)                  { return vsubq_f64(a, b); }
+        static inline V mul(V a, V b)                  { return vmulq_f64(a, b); }
+        static inline V div(V a, V b)                  { return vdivq_f64(a, b); }
+        static inline V sqrt(V a)                      { return vsqrtq_f64(a); }
+        static inline V neg(V a)                       { return vnegq_f64(a); }
+        static inline V fma(V a, V b, V c)             { return vfmaq_f64(c, a, b); }
+
+        static inline M lt(V a, V b)                   { return vcltq_f64(a, b); }
+        static inline M le(V a, V b)                   { return vcleq_f64(a, b); }
+        static inline M eq(V a, V b)                   { return vceqq_f64(a, b); }
+        static inline M mand(M a, M b)                 { return vandq_u64(a, b); }
+        static inline M mor(M a, M b)                  { return vorrq_u64(a, b); }
+        static inline M mnot(M a)                      { return veorq_u64(a, vdupq_n_u64(~0ull)); }
+        static inline V blend(M m, V a, V b)           { return vbslq_f64(m, a, b); }
+        static inline int bits(M m)                    { return int(vgetq_lane_u64(m, 0) & 1) | int((vgetq_lane_u64(m, 1) & 1) << 1); }
+    };
+    #endif
+
+    // ---- WASM ----
+    #if defined(BL_SIMD_WASM)
+    template<> struct dvec<2, wasm_tag>
+    {
+        static constexpr int lanes = 2;
+        using V = v128_t;
+        using M = v128_t;
+
+        static inline V set1(double x)                 { return wasm_f64x2_splat(x); }
+        static inline V load(const double* p)          { return wasm_v128_load(p); }
+        static inline void store(double* p, V a)       { wasm_v128_store(p, a); }
+
+        static inline V add(V a, V b)                  { return wasm_f64x2_add(a, b); }
+        static inline V sub(V a, V b)                  { return wasm_f64x2_sub(a, b); }
+        static inline V mul(V a, V b)                  { return wasm_f64x2_mul(a, b); }
+        static inline V div(V a, V b)                  { return wasm_f64x2_div(a, b); }
+        static inline V sqrt(V a)                      { return wasm_f64x2_sqrt(a); }
+        static inline V neg(V a)                       { return wasm_f64x2_neg(a); }
+        static inline V fma(V a, V b, V c)
+        {
+            return wasm_f64x2_make(
+                std::fma(wasm_f64x2_extract_lane(a, 0), wasm_f64x2_extract_lane(b, 0), wasm_f64x2_extract_lane(c, 0)),
+                std::fma(wasm_f64x2_extract_lane(a, 1), wasm_f64x2_extract_lane(b, 1), wasm_f64x2_extract_lane(c, 1)));
+        }
+
+        static inline M lt(V a, V b)                   { return wasm_f64x2_lt(a, b); }
+        static inline M le(V a, V b)                   { return wasm_f64x2_le(a, b); }
+        static inline M eq(V a, V b)                   { return wasm_f64x2_eq(a, b); }
+        static inline M mand(M a, M b)                 { return wasm_v128_and(a, b); }
+        static inline M mor(M a, M b)                  { return wasm_v128_or(a, b); }
+        static inline M mnot(M a)                      { return wasm_v128_not(a); }
+        static inline V blend(M m, V a, V b)           { return wasm_v128_bitselect(a, b, m); }
+        static inline int bits(M m)                    { return (int)wasm_i64x2_bitmask(m); }
+    };
+    #endif
+
+    // Two native halves acting as one wider vector (f128x4 without AVX)
+    template<class H> struct dvec_pair
+    {
+        static constexpr int lanes = H::lanes * 2;
+        struct V { typename H::V a, b; };
+        struct M { typename H::M a, b; };
+
+        static inline V set1(double x)                 { return { H::set1(x), H::set1(x) }; }
+        static inline V load(const double* p)          { return { H::load(p), H::load(p + H::lanes) }; }
+        static inline void store(double* p, V v)       { H::store(p, v.a); H::store(p + H::lanes, v.b); }
+
+        static inline V add(V x, V y)                  { return { H::add(x.a, y.a), H::add(x.b, y.b) }; }
+        static inline V sub(V x, V y)                  { return { H::sub(x.a, y.a), H::sub(x.b, y.b) }; }
+        static inline V mul(V x, V y)                  { return { H::mul(x.a, y.a), H::mul(x.b, y.b) }; }
+        static inline V div(V x, V y)                  { return { H::div(x.a, y.a), H::div(x.b, y.b) }; }
+        static inline V sqrt(V x)                      { return { H::sqrt(x.a), H::sqrt(x.b) }; }
+        static inline V neg(V x)                       { return { H::neg(x.a), H::neg(x.b) }; }
+        static inline V fma(V x, V y, V z)             { return { H::fma(x.a, y.a, z.a), H::fma(x.b, y.b, z.b) }; }
+
+        static inline M lt(V x, V y)                   { return { H::lt(x.a, y.a), H::lt(x.b, y.b) }; }
+        static inline M le(V x, V y)                   { return { H::le(x.a, y.a), H::le(x.b, y.b) }; }
+        static inline M eq(V x, V y)                   { return { H::eq(x.a, y.a), H::eq(x.b, y.b) }; }
+        static inline M mand(M x, M y)                 { return { H::mand(x.a, y.a), H::mand(x.b, y.b) }; }
+        static inline M mor(M x, M y)                  { return { H::mor(x.a, y.a), H::mor(x.b, y.b) }; }
+        static inline M mnot(M x)                      { return { H::mnot(x.a), H::mnot(x.b) }; }
+        static inline V blend(M m, V x, V y)           { return { H::blend(m.a, x.a, y.a), H::blend(m.b, x.b, y.b) }; }
+        static inline int bits(M m)                    { return H::bits(m.a) | (H::bits(m.b) << H::lanes); }
+    };
+
+    #if defined(BL_SIMD_SCALAR) || (defined(BL_SIMD_NEON) && !defined(__aarch64__))
+    using dvec2 = dvec<2, scalar_tag>;
+    #else
+    using dvec2 = dvec<2, tag_t>;
+    #endif
+
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX)
+    using dvec4 = dvec<4, sse_tag>;
+    #else
+    using dvec4 = dvec_pair<dvec2>;
+    #endif
+
+    // ======== packed f128 ========
+
+    // Error-free transforms and dd add/mul, same operation order as the scalar f128 operators
+    BL_PUSH_PRECISE
+    template<class D>
+    FORCE_INLINE void dd_two_sum(typename D::V a, typename D::V b, typename D::V& s, typename D::V& e)
+    {
+        s = D::add(a, b);
+        typename D::V bv = D::sub(s, a);
+        e = D::add(D::sub(a, D::sub(s, bv)), D::sub(b, bv));
+    }
+
+    template<class D>
+    FORCE_INLINE void dd_quick_two_sum(typename D::V a, typename D::V b, typename D::V& s, typename D::V& e)
+    {
+        s = D::add(a, b);
+        e = D::sub(b, D::sub(s, a));
+    }
+
+    template<class D>
+    FORCE_INLINE void dd_two_prod_dekker(typename D::V a, typename D::V b, typename D::V& p, typename D::V& err)
+    {
+        using V = typename D::V;
+        const V split = D::set1(134217729.0);
+
+        V a_c = D::mul(a, split);
+        V a_hi = D::sub(a_c, D::sub(a_c, a));
+        V a_lo = D::sub(a, a_hi);
+
+        V b_c = D::mul(b, split);
+        V b_hi = D::sub(b_c, D::sub(b_c, b));
+        V b_lo = D::sub(b, b_hi);
+
+        p = D::mul(a, b);
+        err = D::add(D::add(D::add(D::sub(D::mul(a_hi, b_hi), p), D::mul(a_hi, b_lo)), D::mul(a_lo, b_hi)), D::mul(a_lo, b_lo));
+    }
+
+    template<class D>
+    FORCE_INLINE void dd_add(typename D::V a_hi, typename D::V a_lo, typename D::V b_hi, typename D::V b_lo,
+                             typename D::V& r_hi, typename D::V& r_lo)
+    {
+        typename D::V s, e;
+        dd_two_sum<D>(a_hi, b_hi, s, e);
+        e = D::add(e, D::add(a_lo, b_lo));
+        dd_two_sum<D>(s, e, r_hi, r_lo); // renorm
+    }
+
+    template<class D>
+    FORCE_INLINE void dd_mul(typename D::V a_hi, typename D::V a_lo, typename D::V b_hi, typename D::V b_lo,
+                             typename D::V& r_hi, typename D::V& r_lo)
+    {
+        using V = typename D::V;
+        #ifdef FMA_AVAILABLE
+        V p = D::mul(a_hi, b_hi);
+        V e = D::fma(a_hi, b_hi, D::neg(p));
+        e = D::fma(a_hi, b_lo, e);
+        e = D::fma(a_lo, b_hi, e);
+        e = D::fma(a_lo, b_lo, e);
+        dd_two_sum<D>(p, e, r_hi, r_lo); // renorm
+        #else
+        V p, e;
+        dd_two_prod_dekker<D>(a_hi, b_hi, p, e);
+        e = D::add(e, D::add(D::mul(a_hi, b_lo), D::mul(a_lo, b_hi)));
+        e = D::add(e, D::mul(a_lo, b_lo));
+        dd_quick_two_sum<D>(p, e, r_hi, r_lo);
+        #endif
+    }
+    BL_POP_PRECISE
+
+    template<class D>
+    struct f128v
+    {
+        using dvec = D;
+        using V = typename D::V;
+        static constexpr int lanes = D::lanes;
+
+        V hi, lo;
+
+        struct mask
+        {
+            typename D::M m;
+
+            [[nodiscard]] int  bits() const { return D::bits(m); }
+            [[nodiscard]] bool any()  const { return bits() != 0; }
+            [[nodiscard]] bool all()  const { return bits() == (1 << lanes) - 1; }
+            [[nodiscard]] bool operator[](int i) const { return (bits() >> i) & 1; }
+
+            friend mask operator&(mask a, mask b) { return { D::mand(a.m, b.m) }; }
+            friend mask operator|(mask a, mask b) { return { D::mor(a.m, b.m) }; }
+            friend mask operator!(mask a)         { return { D::mnot(a.m) }; }
+        };
+
+        // ---- construction / lanes ----
+
+        static inline f128v broadcast(f128 x) { return { D::set1(x.hi), D::set1(x.lo) }; }
+        static inline f128v broadcast(double x) { return { D::set1(x), D::set1(0.0) }; }
+
+        // SoA
+        static inline f128v load(const double* hi_p, const double* lo_p) { return { D::load(hi_p), D::load(lo_p) }; }
+        inline void store(double* hi_p, double* lo_p) const { D::store(hi_p, hi); D::store(lo_p, lo); }
+
+        // AoS (f128 arrays)
+        static inline f128v load(const f128* p)
+        {
+            double h[lanes], l[lanes];
+            for (int i = 0; i < lanes; i++) { h[i] = p[i].hi; l[i] = p[i].lo; }
+            return load(h, l);
+        }
+        inline void store(f128* p) const
+        {
+            double h[lanes], l[lanes];
+            store(h, l);
+            for (int i = 0; i < lanes; i++) p[i] = f128{ h[i], l[i] };
+        }
+
+        [[nodiscard]] inline f128 lane(int i) const
+        {
+            double h[lanes], l[lanes];
+            store(h, l);
+            return f128{ h[i], l[i] };
+        }
+
+        // ---- arithmetic ----
+
+        static FORCE_INLINE f128v add(const f128v& a, const f128v& b)
+        {
+            f128v r;
+            dd_add<D>(a.hi, a.lo, b.hi, b.lo, r.hi, r.lo);
+            return r;
+        }
+        static FORCE_INLINE f128v mul(const f128v& a, const f128v& b)
+        {
+            f128v r;
+            dd_mul<D>(a.hi, a.lo, b.hi, b.lo, r.hi, r.lo);
+            return r;
+        }
+        static FORCE_INLINE f128v neg(const f128v& a) { return { D::neg(a.hi), D::neg(a.lo) }; }
+        static FORCE_INLINE f128v sub(const f128v& a, const f128v& b) { return add(a, neg(b)); }
+
+        static FORCE_INLINE f128v recip(const f128v& b)
+        {
+            const f128v one = broadcast(1.0);
+            f128v y = { D::div(one.hi, b.hi), D::set1(0.0) };
+            f128v e = sub(one, mul(b, y));
+
+            y = add(y, mul(y, e));
+            e = sub(one, mul(b, y));
+            y = add(y, mul(y, e));
+            return y;
+        }
+
+        static FORCE_INLINE f128v div(const f128v& a, const f128v& b) { return mul(a, recip(b)); }
+
+        static FORCE_INLINE f128v sqrt(const f128v& a)
+        {
+            const V zero = D::set1(0.0);
+            f128v y = { D::sqrt(a.hi), zero };
+
+            y = add(y, div(sub(a, mul(y, y)), add(y, y)));
+            y = add(y, div(sub(a, mul(y, y)), add(y, y)));
+
+            // a <= 0: exact zero -> 0, otherwise NaN
+            const auto non_pos = D::le(a.hi, zero);
+            const auto is_zero = D::mand(D::eq(a.hi, zero), D::eq(a.lo, zero));
+            const V special = D::blend(is_zero, zero, D::set1(std::numeric_limits<double>::quiet_NaN()));
+            return { D::blend(non_pos, special, y.hi), D::blend(non_pos, zero, y.lo) };
+        }
+
+        static FORCE_INLINE f128v abs(const f128v& a)
+        {
+            return blend(mask{ D::lt(a.hi, D::set1(0.0)) }, neg(a), a);
+        }
+
+        // ---- comparisons / selection ----
+
+        static FORCE_INLINE mask cmplt(const f128v& a, const f128v& b)
+        {
+            return { D::mor(D::lt(a.hi, b.hi), D::mand(D::eq(a.hi, b.hi), D::lt(a.lo, b.lo))) };
+        }
+        static FORCE_INLINE mask cmpeq(const f128v& a, const f128v& b)
+        {
+            return { D::mand(D::eq(a.hi, b.hi), D::eq(a.lo, b.lo)) };
+        }
+        static FORCE_INLINE mask cmple(const f128v& a, const f128v& b) { return cmplt(a, b) | cmpeq(a, b); }
+        static FORCE_INLINE mask cmpgt(const f128v& a, const f128v& b) { return cmplt(b, a); }
+        static FORCE_INLINE mask cmpge(const f128v& a, const f128v& b) { return cmple(b, a); }
+
+        // lanes of a where m is set, otherwise b
+        static FORCE_INLINE f128v blend(mask m, const f128v& a, const f128v& b)
+        {
+            return { D::blend(m.m, a.hi, b.hi), D::blend(m.m, a.lo, b.lo) };
+        }
+
+        // operators, so kernels can be templated on f128 / f128v alike
+        friend FORCE_INLINE f128v operator+(const f128v& a, const f128v& b) { return add(a, b); }
+        friend FORCE_INLINE f128v operator-(const f128v& a, const f128v& b) { return sub(a, b); }
+        friend FORCE_INLINE f128v operator*(const f128v& a, const f128v& b) { return mul(a, b); }
+        friend FORCE_INLINE f128v operator/(const f128v& a, const f128v& b) { return div(a, b); }
+        friend FORCE_INLINE f128v operator-(const f128v& a) { return neg(a); }
+
+        FORCE_INLINE f128v& operator+=(const f128v& b) { return *this = add(*this, b); }
+        FORCE_INLINE f128v& operator-=(const f128v& b) { return *this = sub(*this, b); }
+        FORCE_INLINE f128v& operator*=(const f128v& b) { return *this = mul(*this, b); }
+        FORCE_INLINE f128v& operator/=(const f128v& b) { return *this = div(*this, b); }
+
+        friend FORCE_INLINE mask operator< (const f128v& a, const f128v& b) { return cmplt(a, b); }
+        friend FORCE_INLINE mask operator<=(const f128v& a, const f128v& b) { return cmple(a, b); }
+        friend FORCE_INLINE mask operator> (const f128v& a, const f128v& b) { return cmpgt(a, b); }
+        friend FORCE_INLINE mask operator>=(const f128v& a, const f128v& b) { return cmpge(a, b); }
+        friend FORCE_INLINE mask operator==(const f128v& a, const f128v& b) { return cmpeq(a, b); }
+        friend FORCE_INLINE mask operator!=(const f128v& a, const f128v& b) { return !cmpeq(a, b); }
+    };
+
+    using f128x2 = f128v<dvec2>;
+    using f128x4 = f128v<dvec4>;
+
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX)
+    using f128xN = f128x4;
+    #else
+    using f128xN = f128x2;
+    #endif
+
+} // namespace simd2
+
+BL_END_NS
@@ -40,23 +40,29 @@
     #endif
 #endif
 
+// defined only under fast-math, matching f128.h (other headers test it with #ifdef)
 #ifndef BL_FAST_MATH
     #if defined(__FAST_MATH__)
-        #define BL_FAST_MATH 1
-    #else
-        #define BL_FAST_MATH 0
+        #define BL_FAST_MATH
     #endif
 #endif
 
-// For now, disabling std::fma seems to offer a large performance boost on web
+// For now, disabling std::fma seems to offer a large performance boost on web.
+// Same test as f128.h: GCC without -mfma would call the software std::fma, which is far slower
+// than the Dekker split, and the macro is shared by both headers.
 #ifndef FMA_AVAILABLE
     #ifndef __EMSCRIPTEN__
-        #if defined(__FMA__) || defined(__FMA4__) || defined(_MSC_VER) || defined(__clang__) || defined(__GNUC__)
+        #if defined(__FMA__) || defined(__FMA4__) || defined(_MSC_VER) || defined(__clang__)
             #define FMA_AVAILABLE
         #endif
     #endif
 #endif
 
+// Addition: the default is accurate (QD "ieee" add, ~2^-212 relative even under cancellation).
+// Define BL_F256_SLOPPY_ADD for the branch-free add, ~2x faster but only accurate relative to the
+// operands, so sums that cancel lose bits. The packed f256 lanes always use the sloppy add.
+//#define BL_F256_SLOPPY_ADD
+
 namespace bl
 {
     struct f256;
@@ -132,30 +138,54 @@ namespace bl
             quick_two_sum(a0, a1, s, e); a0 = s; a1 = e;
         }
 
-        FORCE_INLINE void acc4(double& a0, double& a1, double& a2, double& a3, double x)
+        FORCE_INLINE void renorm5(double& a0, double& a1, double& a2, double& a3, double a4)
         {
-            // Add x into (a0,a1,a2,a3) with error propagation; leaves a0..a3 roughly normalized.
+            // Bottom-up then top-down quick_two_sum passes. Branch-free (unlike QD's renorm, which
+            // skips zero limbs) so the packed lanes in f256_simd.h can run the identical sequence.
             double s, e;
 
-            two_sum(a0, x,  s, e); a0 = s;
-            two_sum(a1, e,  s, e); a1 = s;
-            two_sum(a2, e,  s, e); a2 = s;
-            two_sum(a3, e,  s, e); a3 = s;
+            quick_two_sum(a3, a4, s, e); a3 = s; a4 = e;
+            quick_two_sum(a2, a3, s, e); a2 = s; a3 = e;
+            quick_two_sum(a1, a2, s, e); a1 = s; a2 = e;
+            quick_two_sum(a0, a1, s, e); a0 = s; a1 = e;
 
-            // Fold remaining tail into the smallest limb (fast, lossy).
-            a3 += e;
+            quick_two_sum(a0, a1, s, e); a0 = s; a1 = e;
+            quick_two_sum(a1, a2, s, e); a1 = s; a2 = e;
+            quick_two_sum(a2, a3, s, e); a2 = s; a3 = e;
+            a3 += a4;
         }
 
-        FORCE_INLINE void acc4_prod(double& a0, double& a1, double& a2, double& a3,
-                                    double u, double v,
-                                    bool keep_err)
+        FORCE_INLINE void three_sum(double& a, double& b, double& c)
         {
-            double p, e;
-            two_prod(u, v, p, e);
+            // a + b + c -> (a, b, c) exactly, a the rounded sum
+            double t1, t2, t3;
+            two_sum(a, b, t1, t2);
+            two_sum(c, t1, a, t3);
+            two_sum(t2, t3, b, c);
+        }
 
-            acc4(a0, a1, a2, a3, p);
-            if (keep_err)
-                acc4(a0, a1, a2, a3, e);
+        FORCE_INLINE void three_sum2(double& a, double& b, double c)
+        {
+            // as three_sum, with the two error terms folded into b
+            double t1, t2, t3;
+            two_sum(a, b, t1, t2);
+            two_sum(c, t1, a, t3);
+            b = t2 + t3;
+        }
+
+        FORCE_INLINE double quick_three_accum(double& a, double& b, double c)
+        {
+            // Accumulate c into (a, b). Returns a finished limb once both a and b are non-zero.
+            double s;
+            two_sum(b, c, s, b);
+            two_sum(a, s, s, a);
+
+            if (a != 0.0 && b != 0.0)
+                return s;
+
+            if (b == 0.0) { b = a; a = s; }
+            else          { a = s; }
+            return 0.0;
         }
 
 
@@ -164,24 +194,38 @@ namespace bl
         template<int N>
         FORCE_INLINE int compress(const double (&in)[N], double* out)
         {
-            // Two-pass "compress" (make nonoverlapping, remove zeros).
-            double q = in[N - 1];
-            double temp[N];
-            int k = N - 1;
+            // Shewchuk's two-pass compress: nonoverlapping, zero-free, increasing magnitude.
+            double g[N];
+            int bottom = N - 1;
+            double Q = in[N - 1];
 
+            // top-down: peel off the large part whenever the running sum leaves an error
             for (int i = N - 2; i >= 0; --i)
             {
                 double s, e;
-                two_sum(q, in[i], s, e);
-                q = s;
+                two_sum(Q, in[i], s, e);
                 if (e != 0.0)
-                    temp[k--] = e;
+                {
+                    g[bottom--] = s;
+                    Q = e;
+                }
+                else
+                    Q = s;
             }
-            temp[k] = q;
+            g[bottom] = Q;
 
+            // bottom-up: emit errors, carrying the sum
             int m = 0;
-            for (int i = k; i < N; ++i)
-                out[m++] = temp[i];
+            for (int i = bottom + 1; i < N; ++i)
+            {
+                double s, e;
+                two_sum(g[i], Q, s, e);
+                Q = s;
+                if (e != 0.0)
+                    out[m++] = e;
+            }
+            if (Q != 0.0 || m == 0)
+                out[m++] = Q;
 
             return m;
         }
@@ -313,10 +357,312 @@ namespace bl
         static constexpr f256_const kPi     = { 3.141592653589793116e+00, 1.224646799147353207e-16, -2.994769809718339666e-33, 1.112454220863365282e-49 };
         static constexpr f256_const kPi_2   = { 1.570796326794896558e+00, 6.123233995736766036e-17, -1.497384904859169833e-33, 5.562271104316826410e-50 };
         static constexpr f256_const kTwoPi  = { 6.283185307179586232e+00, 2.449293598294706414e-16, -5.989539619436679332e-33, 2.224908441726730563e-49 };
-        static constexpr f256_const kInvPi2 = { 6.366197723675813824e-01, -3.935735335036497176e-17, 2.152264262748829105e-33, -1.281085968010345041e-49 }; // 2/pi
+        static constexpr f256_const kInvPi2 = { 6.366197723675813824e-01, -3.935735335036497176e-17, -2.144287256578600800e-33, 1.610712785318822400e-49 }; // 2/pi
         static constexpr f256_const kLn2    = { 6.931471805599453094e-01, 2.319046813846299558e-17, 5.707708438416212066e-34, -3.582432210601811423e-50 };
-        static constexpr f256_const kLog10e = { 4.342944819032518166e-01, 1.010305011872601710e-17, -2.366755089061475057e-34, 1.558385330010468241e-50 };
-        static constexpr f256_const kLn10   = { 2.302585092994045901e+00, -2.170756223382249351e-16, -9.984262454465776570e-33, 2.448889984137502700e-49 };
+        static constexpr f256_const kLog10e = { 4.342944819032518166e-01, 1.098319650216765000e-17, 3.717181233110959000e-34, 7.734484346504299000e-51 };
+        static constexpr f256_const kLn10   = { 2.302585092994045901e+00, -2.170756223382249351e-16, -9.984262454465776570e-33, -4.023357454450206000e-49 };
+        static constexpr f256_const kLog2e  = { 1.442695040888963387e+00, 2.035527374093103300e-17, -1.061465995611725800e-33, -1.383671678018140200e-50 };
+        static constexpr f256_const kLn2_64 = { 1.083042469624914500e-02, 3.623510646634843000e-19, 8.918294435025331000e-36, -5.597550329065330000e-52 }; // ln2/64
+
+        // Tables for the transcendentals (mpmath at 400 bits, each limb the nearest double to what is left)
+        // 2^(j/64), j = 0..63
+        inline constexpr f256_const kExp2Table[64] = {
+            { 1.0, 0.0, 0.0, 0.0 },
+            { 1.0108892860517005, -1.5234778603368577e-17, -1.2052777336398203e-33, -9.723005129423798e-51 },
+            { 1.0218971486541166, 5.109225028973444e-17, 7.884226564969274e-34, -5.463190044781899e-51 },
+            { 1.0330248790212284, 7.600838874027088e-18, 4.175476603364996e-34, -1.9782355652557978e-50 },
+            { 1.0442737824274138, 8.551889705537965e-17, -4.330791080574723e-33, -1.3179407697148623e-49 },
+            { 1.0556451783605572, 1.759325738772092e-18, -1.3039672497797838e-34, 5.115569572637819e-51 },
+            { 1.0671404006768237, -7.899853966841582e-17, 2.487739243230479e-33, -4.571415615114676e-50 },
+            { 1.0787607977571199, -6.656660436056593e-17, -3.658125801319237e-33, 3.285602599364627e-49 },
+            { 1.0905077326652577, -3.046782079812471e-17, 2.0170548784884862e-33, -1.086602979548965e-49 },
+            { 1.102382583307841, 5.2660368715706944e-17, 6.458053975367214e-34, -1.3665475361588967e-50 },
+            { 1.1143867425958924, 1.0410278456845571e-16, 1.4757016734400031e-33, 5.993819722872146e-50 },
+            { 1.1265216186082418, 5.165856758795457e-17, -5.659166861707162e-34, 1.0693766597811698e-50 },
+            { 1.1387886347566916, 8.912812676025408e-17, -2.0074146328324945e-33, 1.2284922793851977e-49 },
+            { 1.1511892299529827, 3.250710218863827e-17, 8.890919316379272e-34, 5.8793193140222115e-50 },
+            { 1.1637248587775775, 3.8292048369240935e-17, 7.197098319876763e-34, 1.067898862439403e-50 },
+            { 1.1763969916502812, 5.554203254218079e-17, -1.4884292934336851e-33, 2.573699252118647e-52 },
+            { 1.189207115002721, 3.982015231465646e-17, 1.1419596568854534e-33, -5.891554891188599e-50 },
+            { 1.202156731452703, 6.644981499252301e-17, -3.8568525533690765e-33, 1.546163307654647e-49 },
+            { 1.215247359980469, -7.712630692681488e-17, 4.717206142884998e-33, -1.5341519914966926e-49 },
+            { 1.22848053610687, -1.89878163130253e-17, 6.1846945365210385e-34, 3.987300556123862e-50 },
+            { 1.241857812073484, 4.658027591836937e-17, -2.31439910378786e-33, -1.64627996692954e-49 },
+            { 1.255380757024691, -6.7113898212968784e-18, -5.768462643250284e-35, 9.000130126814666e-52 },
+            { 1.2690509571917332, 2.667932131342186e-18, -5.01723570938719e-35, 9.30400836733112e-52 },
+            { 1.2828700160787783, 1.713594918243561e-17, 7.251314912828195e-34, -2.27090822184965e-50 },
+            { 1.2968395546510096, 2.5382502794888315e-17, 1.686782464618325e-34, -6.744873588403686e-51 },
+            { 1.3109612115247644, -7.181536135519454e-17, -2.1262926674396956e-34, -1.696370184215208e-50 },
+            { 1.3252366431597413, -2.8587312100388614e-17, 7.620214063972604e-34, 9.50271103593005e-52 },
+            { 1.339667524053303, 8.927282594831732e-17, -7.6965798353189925e-34, -6.715551635393119e-51 },
+            { 1.3542555469368927, 7.70094837980299e-17, -2.2407483643739503e-33, -8.442194805074831e-50 },
+            { 1.3690024229745905, 9.593797919118849e-17, -4.886749587849472e-33, -6.327205612322654e-50 },
+            { 1.383909881963832, -6.770511658794786e-17, 5.259541347855243e-34, 1.966510348081778e-50 },
+            { 1.3989796725383112, -9.614213209051323e-17, 3.974651900775057e-33, -8.795555780679706e-50 },
+            { 1.4142135623730951, -9.667293313452913e-17, 4.1386753086994136e-33, 4.935546991468351e-50 },
+            { 1.42961333839197, -1.2031642489053655e-17, 3.9649253224338936e-35, -6.846630701732113e-52 },
+            { 1.4451808069770467, -3.0237581349939873e-17, -1.773011958202501e-33, 2.7068832966994386e-50 },
+            { 1.460917794180647, -5.600377186075216e-17, -4.809488048900044e-33, -1.8888265176118375e-49 },
+            { 1.4768261459394993, -3.483994556892796e-17, -1.2115770452309058e-34, 8.678046550627857e-52 },
+            { 1.4929077282912648, 1.4192920154284036e-17, 2.773263293447805e-34, 1.5906750159505835e-50 },
+            { 1.5091644275934228, -1.016455327754295e-16, 2.0419170696740344e-34, -1.8043598360040658e-51 },
+            { 1.5255981507445384, -1.1024941712342561e-16, -2.993828826371378e-33, 1.429050788929334e-49 },
+            { 1.5422108254079407, 7.949834809697621e-17, -9.159956374100367e-34, -4.1989501134935914e-50 },
+            { 1.559004400237837, 3.7812070533575275e-17, 5.942302210453856e-35, -2.910039562139426e-51 },
+            { 1.5759808451078865, -1.0136916471278304e-17, 5.439138515562207e-34, -3.976237623535635e-51 },
+            { 1.593142151342267, -1.0094406542311964e-16, 4.608483990349626e-33, 2.7821844003784898e-49 },
+            { 1.6104903319492543, 2.4707192569797888e-17, 1.069684778889359e-33, 6.527982715839633e-50 },
+            { 1.6280274218573478, -6.712955084707084e-17, 1.861242888133996e-33, -1.5749549606581507e-49 },
+            { 1.645755478153965, -1.0125679913674773e-16, -6.738384988036643e-34, 1.0518655701327504e-50 },
+            { 1.6636765803267364, 5.8909926967131e-17, 2.3778529927676503e-33, 1.2570039537642209e-49 },
+            { 1.681792830507429, 8.199010020581497e-17, 5.103515194728093e-33, 1.818637501100874e-49 },
+            { 1.7001063537185235, -8.0237193703977e-18, 4.508946750518465e-34, -3.6836302853975074e-50 },
+            { 1.718619298122478, -1.851380418263111e-17, 6.41562962530571e-34, 3.0427277557554027e-50 },
+            { 1.7373338352737062, 3.164389299292957e-17, 2.4681208652463518e-33, -1.1330128081177621e-49 },
+            { 1.7562521603732995, 2.960140695448873e-17, 1.2334822744893002e-33, -6.930134289894348e-50 },
+            { 1.7753764925265212, 6.429731796556572e-17, -3.059030381961223e-33, -1.2301153917731118e-49 },
+            { 1.7947090750031072, 1.8227458427912087e-17, 1.4217643387469497e-33, -4.856990681928593e-50 },
+            { 1.8142521755003989, -9.969531538920349e-17, -5.862249143774918e-33, -2.993662735887339e-50 },
+            { 1.8340080864093424, 3.283107224245627e-17, -6.4250893479530425e-34, 1.9878125518164447e-50 },
+            { 1.8539791250833855, 9.761887490727594e-17, 4.614815772055665e-33, -5.189144069374574e-50 },
+            { 1.8741676341103, -6.122763413004143e-17, 5.285885594025074e-33, -1.835318258986482e-49 },
+            { 1.8945759815869656, 3.4034035352165297e-17, 1.7247509954934323e-33, -8.157275676170662e-50 },
+            { 1.9152065613971474, -1.0619946056195963e-16, -3.0577697567913255e-33, -1.3115258716865948e-49 },
+            { 1.9360617934922943, 1.0332385960676326e-16, 6.053013676820623e-33, -7.367689096425991e-50 },
+            { 1.9571441241754002, 8.960767791036668e-17, -9.632676613618276e-34, 5.005339690344238e-50 },
+            { 1.978456026387951, 4.0388753109278167e-17, 3.5812037166778622e-34, -1.2569729167775466e-50 },
+        };
+
+        // log(1 + j/64), j = -19..27 (index j + 19)
+        inline constexpr f256_const kLogTable[47] = {
+            { -0.3522205935893521, -5.7233316949182485e-18, -3.1050610089331767e-34, 1.8834836959679689e-50 },
+            { -0.33024168687057687, 1.0828321637483858e-17, 5.649767125549595e-34, -3.4760233464530775e-50 },
+            { -0.3087354816496133, 1.6199186085148102e-17, 5.276104140241738e-34, -3.611442219397414e-50 },
+            { -0.2876820724517809, -2.607160616442564e-17, 1.0708025760192953e-33, 4.993821963963515e-50 },
+            { -0.26706278524904525, 7.32891532732017e-18, -3.908722279171073e-34, 3.6460582889181746e-50 },
+            { -0.24686007793152578, -1.361743371748368e-17, 6.879824723337168e-34, -4.0730411810212865e-50 },
+            { -0.22705745063534608, -9.551415762738488e-18, -1.866213056968216e-34, 1.0469512654963744e-51 },
+            { -0.2076393647782445, -1.2053243216686129e-17, -6.934295861642487e-34, 3.2559373575873293e-50 },
+            { -0.18859116980755003, 7.432164219196925e-18, 6.242317029478891e-34, 6.212189436890463e-51 },
+            { -0.16989903679539747, 4.868008764439071e-19, 2.7615180344397363e-35, 1.7342189890151321e-51 },
+            { -0.15154989812720093, -5.1669593684615594e-18, 2.634928587132709e-34, -1.5104580964955077e-50 },
+            { -0.13353139262452263, 3.664457663660085e-18, -1.9543611395855363e-34, 1.8230291444590873e-50 },
+            { -0.1158318155251217, -4.338484369808096e-18, 1.9660163152197876e-34, 1.7021165762667984e-51 },
+            { -0.09844007281325252, 4.439009633675136e-18, -1.9905588892517317e-34, -3.998527560380302e-51 },
+            { -0.0813456394539524, -5.07707635593117e-18, 1.148776436715296e-34, -6.259227098443845e-51 },
+            { -0.06453852113757118, 6.470486661692933e-18, 1.5943527859717567e-34, -9.7212649992179e-51 },
+            { -0.048009219186360606, -1.4390903347292205e-18, 4.4196182572963884e-35, 1.829087260951731e-51 },
+            { -0.0317486983145803, -3.0382263084680858e-18, -5.938726465918063e-35, 4.3535584178100165e-51 },
+            { -0.015748356968139168, -1.0021578630528974e-18, 1.3230954218251688e-35, -5.732973950149986e-52 },
+            { 0.0, 0.0, 0.0, 0.0 },
+            { 0.015504186535965254, -3.278321022892429e-19, -1.590467946689878e-35, -3.72463962057805e-52 },
+            { 0.030771658666753687, 1.0431732029005968e-18, -7.246134058454665e-35, 5.213507005671104e-51 },
+            { 0.0458095360312942, 1.902959866474257e-18, 1.672907500109968e-35, -1.0278704698650216e-51 },
+            { 0.06062462181643484, 2.6424025938726934e-18, -1.0186591508377544e-34, -6.12703301266365e-51 },
+            { 0.07522342123758753, -5.930604196293241e-18, -1.0456580084880699e-34, 7.357817498238294e-52 },
+            { 0.08961215868968714, -5.4268129336647135e-18, -3.3643143362577896e-34, -2.0047075513524616e-50 },
+            { 0.10379679368164356, 5.47772415726659e-18, 1.501653557345777e-34, 9.61373583871789e-51 },
+            { 0.11778303565638346, -1.1971685747593677e-18, 1.6074073738081715e-35, -9.423586896050125e-53 },
+            { 0.13157635778871926, 1.1123000879729588e-17, -5.5650165501318216e-34, 9.417929961174368e-51 },
+            { 0.1451820098444979, 8.242418783022475e-18, -6.131085144129312e-34, -4.9072052815955786e-51 },
+            { 0.15860503017663857, 1.1257003872182592e-17, -7.51932018824944e-34, -2.6616514276595826e-50 },
+            { 0.17185025692665923, -6.0224538210113705e-18, -1.0382896674242226e-34, -5.471867701893226e-51 },
+            { 0.184922338494012, 3.0236614153574064e-18, 9.450930508669466e-36, 2.33225911548778e-52 },
+            { 0.19782574332991987, 1.2821194372980142e-17, -5.9260012181312075e-34, -3.885519961345993e-50 },
+            { 0.21056476910734964, -4.249405314729895e-18, -7.868931695567006e-35, 2.8046285058952956e-51 },
+            { 0.22314355131420976, -9.091270597324799e-18, 6.29376658087669e-34, -3.827736695811549e-50 },
+            { 0.2355660713127669, -2.3943371495187355e-18, 3.214814747616343e-35, -1.884717379210025e-52 },
+            { 0.24783616390458127, -1.2432209578702523e-17, -4.663825225185012e-34, -3.6954043871063135e-50 },
+            { 0.25995752443692605, 2.069806938978935e-17, 1.7044043846287857e-34, 3.872042845782776e-51 },
+            { 0.27193371548364176, 7.83319637697442e-19, 1.6898476119360374e-36, -6.30831316599607e-53 },
+            { 0.2837681731306446, -2.032665581126656e-17, -6.28047223628448e-34, 1.9741953071433556e-50 },
+            { 0.2954642128938359, -2.16461086040599e-17, -5.871962579719758e-34, 1.8556092956712051e-50 },
+            { 0.3070250352949119, -1.2319916200101964e-17, 6.7214555318084905e-34, -3.264886538823839e-50 },
+            { 0.3184537311185346, 2.7114779367326236e-17, -5.654849332876713e-34, 3.011269924861743e-50 },
+            { 0.329753286372468, 2.122020616196946e-18, 2.6830404874781335e-35, -6.559609912547075e-52 },
+            { 0.3409265869705932, 1.7467136443544747e-17, 2.6026474294830354e-34, -1.6989485146338426e-50 },
+            { 0.3519764231571782, -1.2953893030191963e-17, 4.522771214737133e-34, -2.779889244702908e-50 },
+        };
+
+        // sin(j/32), j = 0..25
+        inline constexpr f256_const kSinTable[26] = {
+            { 0.0, 0.0, 0.0, 0.0 },
+            { 0.03124491398532608, -1.562781562225433e-18, 5.291457368560251e-35, -5.167338189299152e-51 },
+            { 0.0624593178423802, -2.040259504585711e-18, -1.3632507567037225e-34, 4.802087497124352e-51 },
+            { 0.09361273123551289, 1.4628632005878733e-18, 1.2060268575284523e-35, -1.1279940160469962e-51 },
+            { 0.12467473338522769, -2.925947496057858e-18, -5.7530164955545246e-36, -2.600123539409558e-52 },
+            { 0.15561499277355603, 8.886053372342288e-18, -3.1914019939033326e-35, -1.5631114176555974e-51 },
+            { 0.18640329676226988, 2.3493796901281573e-18, -1.1860601847613397e-34, 2.5705480649909167e-52 },
+            { 0.21700958109501015, 1.1170071073364376e-17, 3.480977318426213e-35, 1.497262202411977e-51 },
+            { 0.24740395925452294, -7.53102495590706e-18, -5.610697290224163e-34, 3.6058389855516872e-50 },
+            { 0.2775567516463363, 1.7674070262791822e-17, 1.5393854695550987e-33, 3.93854518461879e-50 },
+            { 0.30743851458038085, 1.1004366442765296e-19, 1.0651517242320465e-35, -2.1773063674608434e-52 },
+            { 0.33702006902225307, 1.0312279860787216e-17, -1.6658832144392663e-34, -9.020488068865936e-51 },
+            { 0.36627252908604757, -9.938814562106524e-18, -4.048628322309408e-34, -3.597355567462248e-50 },
+            { 0.39516733024093426, -1.9613487871414228e-17, 7.779475780687775e-34, -4.1047046848479403e-50 },
+            { 0.42367625720393803, -2.331800700068871e-17, -7.08175283506348e-34, 2.2798137778882482e-50 },
+            { 0.4517714714916838, -8.234073942098903e-18, -6.008697091132813e-35, -8.659801236749948e-52 },
+            { 0.479425538604203, -5.103969860556013e-18, 3.7134329111577535e-34, -1.3517949849042625e-50 },
+            { 0.5066114548142574, -3.269413423618168e-17, -2.1496193088083867e-33, -1.4277257797483846e-49 },
+            { 0.5333026735360201, 5.129318115032044e-17, 4.472109569648538e-34, 2.963415992918044e-50 },
+            { 0.5594731312473669, 1.575565514488728e-17, 7.702430551343702e-34, -3.848224342117297e-50 },
+            { 0.5850972729404622, -5.4883972461161805e-17, 1.9081134867594303e-33, -4.615670196883289e-50 },
+            { 0.6101500770757914, -1.479826990758988e-17, -1.2384702400587094e-33, 3.927370894220598e-50 },
+            { 0.6346070800152693, -3.4568582392624965e-17, -2.3067856740952832e-33, -1.4134728249942881e-49 },
+            { 0.6584443999105676, -3.7736386700306717e-17, 4.360411916883789e-34, 1.9272843086991577e-50 },
+            { 0.6816387600233341, 4.410467313197903e-17, 1.2378037481286456e-34, -9.645460929979052e-51 },
+            { 0.7041675114545337, -3.94095700584825e-17, 1.9935005043325582e-33, 1.3548832115018496e-49 },
+        };
+
+        // cos(j/32), j = 0..25
+        inline constexpr f256_const kCosTable[26] = {
+            { 1.0, 0.0, 0.0, 0.0 },
+            { 0.9995117584851364, -3.418806487972947e-17, -2.2270643952717984e-33, -1.4326306891845382e-49 },
+            { 0.9980475107000991, 3.3232291674141346e-17, 4.015282074516496e-34, -1.5606866692627113e-50 },
+            { 0.9956086864580017, 3.312922430932991e-17, 2.1492731765931547e-33, 1.5337053923013155e-49 },
+            { 0.992197667229329, 4.754870575189364e-17, -2.7828964973071316e-33, -2.0719021754926382e-50 },
+            { 0.9878177838164719, 4.91917302237681e-17, 1.1066886001966504e-33, -4.391094354582105e-50 },
+            { 0.9824733131012553, -3.919920375420088e-17, -2.0908543032787933e-34, -1.6561730998660056e-50 },
+            { 0.9761694738686353, -7.850690609285027e-18, -2.2136579186367175e-34, 2.986386595932719e-51 },
+            { 0.9689124217106447, 5.071436662403936e-17, -2.124059285887094e-33, 8.24828667866264e-50 },
+            { 0.9607092430155619, -2.807827063516729e-17, 4.756123705144931e-34, 2.5910222453752118e-51 },
+            { 0.9515679480481722, -3.8614834675674123e-17, 2.2211878623313023e-33, 8.302401366995269e-50 },
+            { 0.9414974631278811, -4.8523830236797095e-18, -3.8197889521141553e-34, 1.4177979070842405e-50 },
+            { 0.9305076219123143, 4.488760003328074e-18, -6.88423883641885e-35, 4.573132521987879e-51 },
+            { 0.9186091557949183, -4.0564150104514996e-17, -1.7998726188900467e-33, 9.865127780855769e-50 },
+            { 0.9058136834259364, 4.2864666490805214e-17, -6.138740140767649e-34, 1.1586290827521554e-50 },
+            { 0.8921336993669944, 2.3160655211380166e-17, -1.3592281548313217e-33, -8.506951065998588e-50 },
+            { 0.8775825618903728, -4.2623149864279997e-17, -9.919134682117543e-34, 2.660491718637009e-50 },
+            { 0.8621744799348805, 4.4132427578105805e-18, 1.5543731260697022e-34, 6.726093362964081e-51 },
+            { 0.8459244992310679, 1.549506647350329e-17, -1.0394559746987808e-33, 7.789045261319326e-50 },
+            { 0.8288484876093257, 1.1163935406617444e-17, -4.671742352867593e-34, 2.9707092950532873e-50 },
+            { 0.8109631195052179, -3.091333486122179e-17, -2.974143284514536e-33, 3.94268431050879e-51 },
+            { 0.7922858596771786, -2.9049779312834576e-17, 1.2766064196745506e-33, 2.045816296732364e-50 },
+            { 0.7728349461524715, 4.231014921891023e-17, -3.45688465943326e-34, -1.8142066607874187e-50 },
+            { 0.7526293724180665, -1.2970993013150526e-17, -6.369447846697662e-34, 8.926425417290039e-51 },
+            { 0.7316888688738209, -1.0475824306512768e-17, 3.0371505541297855e-34, -4.027218001613109e-51 },
+            { 0.7100338835660797, 1.505272211891291e-17, -1.1002237918893489e-33, -6.598488535709837e-50 },
+        };
+
+        // atan(j/64), j = 0..64
+        inline constexpr f256_const kAtanTable[65] = {
+            { 0.0, 0.0, 0.0, 0.0 },
+            { 0.015623728620476831, -4.913600136566304e-19, -2.5951603280842253e-35, 5.818866190809724e-52 },
+            { 0.031239833430268277, -1.188442711587748e-18, 7.452813278706378e-35, -5.2739038969539625e-51 },
+            { 0.046840712915969654, -1.655677442254952e-19, -6.828315053131563e-36, 8.29543117270358e-53 },
+            { 0.06241880999595735, -1.5490756308295046e-18, -2.3447954298848344e-35, -1.0305422006694132e-51 },
+            { 0.0779666338315423, 5.804551873143357e-18, 1.6381333317202502e-34, 1.0560269317815995e-50 },
+            { 0.09347678115858947, -6.2844725995420954e-18, -1.8747133162889916e-34, 8.953419321550866e-52 },
+            { 0.10894195698986579, 6.8267122072409585e-18, 1.4086483868681786e-34, 5.891146464241144e-51 },
+            { 0.12435499454676144, -3.1253241424539383e-18, -1.7914844536654056e-34, 9.890858390188382e-51 },
+            { 0.13970887428916365, -2.9579864247315813e-18, 3.3026898867359913e-35, -1.6691977450374217e-52 },
+            { 0.15499674192394097, 9.585415594114324e-18, 4.7870145828560443e-35, 1.9136358754899326e-51 },
+            { 0.1702119252854744, -3.541164079802125e-18, -1.005134533594166e-34, -3.3234517853584356e-51 },
+            { 0.18534794999569476, 4.180692268843079e-18, -1.7067621314286706e-34, 2.365210468236154e-51 },
+            { 0.2003985538258785, 3.1399542871844493e-18, -5.205480450891338e-35, -2.8333880451547976e-51 },
+            { 0.21535769969773805, 4.738160130078733e-19, -3.9306676388089466e-35, 1.5323284119937207e-51 },
+            { 0.23021958727684372, 1.2313404529142703e-17, -1.2170503382766786e-34, 2.129696480794389e-51 },
+            { 0.24497866312686414, 1.0698755618734451e-17, 1.0079104836654304e-34, 5.814081148887967e-51 },
+            { 0.2596296294082575, 1.9238754924615304e-17, 1.1388698851280622e-33, 7.348548484617827e-50 },
+            { 0.2741674511196588, 8.261353575163773e-18, -7.547422201687864e-34, 2.19763713838902e-51 },
+            { 0.2885873618940774, -1.428369957377257e-17, 1.220549102657346e-34, 1.1181552468004756e-51 },
+            { 0.3028848683749714, -1.1010827903001369e-17, -4.863137182713637e-34, 1.4947311025858167e-50 },
+            { 0.31705575320914703, -1.893928924292642e-17, -6.884116528884384e-34, -1.5548372192773952e-50 },
+            { 0.3310960767041321, -7.952610375793799e-18, -5.865230015160608e-34, 4.1369611130115004e-50 },
+            { 0.34500217720710513, -2.2938804755578304e-17, 9.688934357944709e-34, 3.1642127922474206e-50 },
+            { 0.35877067027057225, -2.4623815582638635e-17, -1.6682139707747893e-34, -2.2325146941511067e-51 },
+            { 0.3723984466767542, 1.9612311504845653e-17, 1.023710809792954e-34, -2.1822402732975645e-51 },
+            { 0.38588266939807375, 2.378822732491941e-17, 9.783371593040699e-34, 1.767904742235535e-50 },
+            { 0.39922076957525254, 2.246598105617042e-17, -6.049511638691005e-34, 1.086638721384012e-50 },
+            { 0.4124104415973873, -1.587652227770689e-17, -1.5000714146959223e-34, 1.8461561662572777e-51 },
+            { 0.42544963737004227, 2.3315530741892885e-17, 5.974763500240032e-34, -3.809900983904245e-52 },
+            { 0.43833655985795783, -2.494277030626541e-17, 1.224776527206502e-33, -4.377320773055343e-50 },
+            { 0.4510696559885235, -2.2703795229420475e-17, 1.325123604708083e-33, 8.14489258855414e-50 },
+            { 0.4636476090008061, 2.2698777452961687e-17, -5.247356382839165e-34, -3.4595227018992464e-50 },
+            { 0.4760693303227612, 1.4654487332256713e-17, 1.3436285170545872e-33, 4.8838397935849314e-52 },
+            { 0.48833395105640554, -1.1373236189329585e-17, -6.81313494883312e-34, 1.5427563511942742e-50 },
+            { 0.5004408131472942, -4.7181675085518756e-17, -2.403208831201166e-33, -4.306824126562228e-50 },
+            { 0.5123894603107377, -2.5462781472855804e-17, 9.793306210593216e-34, -2.3241840233763395e-50 },
+            { 0.5241796287829132, 5.520094119641666e-18, 1.2299659625260253e-34, -9.801555225930602e-51 },
+            { 0.5358112379604637, -4.0637956834825575e-18, -1.3618230917759633e-34, 4.9901652832236204e-51 },
+            { 0.5472843809874369, 4.923709671396255e-17, 6.705305481743567e-35, -2.486874017144687e-51 },
+            { 0.5585993153435624, -5.4556305485916264e-18, 4.1587722120912616e-35, -2.2215658802237217e-51 },
+            { 0.5697564534829784, 1.2255062085054184e-17, -3.835877575362002e-34, -1.0135583471211626e-50 },
+            { 0.5807563535676704, -1.441464378193067e-17, -1.117210545177785e-33, -1.4487527789109627e-50 },
+            { 0.5915997103351114, 4.920495453686772e-17, 2.8337483393613194e-33, -1.6988403610930852e-49 },
+            { 0.6022873461349642, 2.950430737228402e-17, 3.0722627931262134e-33, 6.223172109267152e-50 },
+            { 0.6128202021652414, -3.1552061848586226e-17, 2.492507501607541e-33, 1.3479163388018371e-49 },
+            { 0.6231993299340659, 2.672403885140095e-17, 1.3495604230401107e-33, 2.1399599953149055e-50 },
+            { 0.6334258829691446, -2.7290767436015276e-17, -9.743266701846296e-34, 4.2319042016948576e-50 },
+            { 0.6435011087932844, 1.5834785051444286e-17, -4.479136282913368e-34, 3.9284694358202935e-50 },
+            { 0.6534263411807619, 3.5800634857340095e-17, -2.1425232076574977e-33, -1.0563462040817303e-49 },
+            { 0.6632029927060933, -3.076054864429649e-17, -1.3090599700155425e-33, -7.442243883511959e-50 },
+            { 0.6728325475937632, -1.899315009714705e-17, -1.0480117102020388e-33, -5.276595493310956e-50 },
+            { 0.6823165548747481, 6.943223671560008e-18, 3.904816305754126e-34, 1.0523935536077366e-50 },
+            { 0.6916566218531999, -8.117151192285796e-18, -2.5901712799582253e-34, -5.409404860262038e-51 },
+            { 0.7008544078844502, -1.987626234335816e-17, 5.726828986341762e-34, 2.0087129980175048e-50 },
+            { 0.7099116184635249, -4.597166450584887e-17, -1.3422574510441738e-33, -3.331436979440012e-50 },
+            { 0.7188299996216245, -2.1478388444456983e-17, 8.217094605489785e-34, 5.553925224119375e-50 },
+            { 0.7276113326265107, 2.569325697391839e-18, 1.711700132230753e-34, -9.807399588213873e-51 },
+            { 0.7362574289814281, 3.473937648299457e-17, 3.0232306403447673e-33, -9.7173058455352e-50 },
+            { 0.7447701257160751, 3.708315849135547e-17, 1.575717865689441e-33, -3.9450839572500447e-50 },
+            { 0.7531512809621944, -2.4256934659182068e-17, 5.733733310288812e-34, 3.996842632016255e-50 },
+            { 0.7614027698055784, 9.850030332752822e-18, 7.176948781952207e-34, 3.8208691965441863e-50 },
+            { 0.7695264804056583, -3.704991905602721e-17, -3.8358348645819896e-34, 6.004629449455789e-52 },
+            { 0.7775243103733478, -2.6676490951944502e-17, 5.28290838880653e-34, 4.171432067183558e-50 },
+            { 0.7853981633974483, 3.061616997868383e-17, -7.486924524295849e-34, 2.781135552158413e-50 },
+        };
+
+        // 1/n!, n = 0..25
+        inline constexpr f256_const kInvFact[26] = {
+            { 1.0, 0.0, 0.0, 0.0 },
+            { 1.0, 0.0, 0.0, 0.0 },
+            { 0.5, 0.0, 0.0, 0.0 },
+            { 0.16666666666666666, 9.25185853854297e-18, 5.135813185032629e-34, 2.850949024098342e-50 },
+            { 0.041666666666666664, 2.3129646346357427e-18, 1.2839532962581572e-34, 7.127372560245855e-51 },
+            { 0.008333333333333333, 1.1564823173178714e-19, 1.6049416203226965e-36, 2.2273039250768297e-53 },
+            { 0.001388888888888889, -5.300543954373577e-20, -1.7386867553495878e-36, -1.6333562117230084e-52 },
+            { 0.0001984126984126984, 1.7209558293420705e-22, 1.4926912391394127e-40, 1.2947032674600247e-58 },
+            { 2.48015873015873e-05, 2.1511947866775882e-23, 1.865864048924266e-41, 1.6183790843250309e-59 },
+            { 2.7557319223985893e-06, -1.858393274046472e-22, 8.491754604881993e-39, -5.726616407894296e-55 },
+            { 2.755731922398589e-07, 2.3767714622250297e-23, -3.263188903340883e-40, 1.6143511186040442e-56 },
+            { 2.505210838544172e-08, -1.448814070935912e-24, 2.0426735146714455e-41, -8.496326720071632e-58 },
+            { 2.08767569878681e-09, -1.20734505911326e-25, 1.702227928892871e-42, 1.416095321503967e-58 },
+            { 1.6059043836821613e-10, 1.2585294588752098e-26, -5.31334602762985e-43, 3.5402147259760553e-59 },
+            { 1.1470745597729725e-11, 2.0655512752830745e-28, 6.889079232466646e-45, 5.729200026551091e-61 },
+            { 7.647163731819816e-13, 7.03872877733453e-30, -7.827539277162583e-48, 1.9213864944379024e-64 },
+            { 4.779477332387385e-14, 4.399205485834081e-31, -4.892212048226615e-49, 1.200866559023689e-65 },
+            { 2.8114572543455206e-15, 1.6508842730861433e-31, -2.877771793074479e-50, 4.2711068925629355e-67 },
+            { 1.5619206968586225e-16, 1.1910679660273754e-32, -4.577506059629983e-49, 2.874941423408996e-67 },
+            { 8.22063524662433e-18, 2.2141894119604265e-34, -1.508914023774199e-50, 1.4007295151478155e-67 },
+            { 4.110317623312165e-19, 1.4412973378659527e-36, -5.285627548789812e-53, -4.147647256357657e-70 },
+            { 1.9572941063391263e-20, -1.3643503830087908e-36, 1.3392348251125064e-53, -6.821089424149331e-70 },
+            { 8.896791392450574e-22, -7.911402614872376e-38, -3.1877976790570933e-54, 1.2705781017520566e-70 },
+            { 3.868170170630684e-23, -8.843177655482344e-40, 3.8718157106173247e-56, -1.9565257531522557e-72 },
+            { 1.6117375710961184e-24, -3.6846573564509766e-41, 1.613256546090552e-57, -8.1521906381344e-74 },
+            { 6.446950284384474e-26, -1.9330404233703465e-42, -1.5213023807039144e-58, 6.643772737212958e-75 },
+        };
+
+        // 1/(2k+1), k = 0..15
+        inline constexpr f256_const kInvOdd[16] = {
+            { 1.0, 0.0, 0.0, 0.0 },
+            { 0.3333333333333333, 1.850371707708594e-17, 1.0271626370065257e-33, 5.701898048196684e-50 },
+            { 0.2, -1.1102230246251566e-17, 6.162975822039155e-34, -3.4211388289180106e-50 },
+            { 0.14285714285714285, 7.93016446160826e-18, 4.4021255871708246e-34, 2.443670592084293e-50 },
+            { 0.1111111111111111, 6.1679056923619804e-18, 3.423875456688419e-34, 1.900632682732228e-50 },
+            { 0.09090909090909091, -2.523234146875356e-18, 7.003381615953585e-35, -1.9438288800670514e-51 },
+            { 0.07692307692307693, -4.270088556250602e-18, 2.370375316168906e-34, -1.3158226265069272e-50 },
+            { 0.06666666666666667, 9.251858538542971e-19, 1.2839532962581572e-35, 1.7818431400614637e-52 },
+            { 0.058823529411764705, 8.163404592832033e-19, 1.1328999672866093e-35, 1.5722145353483504e-52 },
+            { 0.05263157894736842, 2.921639538487254e-18, 1.6218357426418827e-34, 9.00299691820529e-51 },
+            { 0.047619047619047616, 2.64338815386942e-18, 1.4673751957236082e-34, 8.145568640280977e-51 },
+            { 0.043478260869565216, 1.206764157201257e-18, 3.349443381543019e-35, 9.296572904668506e-52 },
+            { 0.04, -8.326672684688674e-19, -3.0814879110195774e-35, 6.414635304221269e-52 },
+            { 0.037037037037037035, 2.05596856412066e-18, 1.1412918188961397e-34, 6.335442275774093e-51 },
+            { 0.034482758620689655, 4.785444071660157e-19, 6.64113773926633e-36, 9.216430034800675e-53 },
+            { 0.03225806451612903, 8.953411488912552e-19, 2.48507089598353e-35, 6.897457316366956e-52 },
+        };
+
 
         FORCE_INLINE void const_to_limbs(const f256_const& c, double& x0, double& x1, double& x2, double& x3)
         {
@@ -349,6 +695,12 @@ namespace bl
             return r;
         }
 
+        // table / constant entries are already normalized
+        static constexpr f256 from_const(const f256_detail::f256_const& c)
+        {
+            return f256(c.x0, c.x1, c.x2, c.x3);
+        }
+
         FORCE_INLINE void renorm()
         {
             // Convert to increasing expansion, compress, then take 4 largest.
@@ -385,22 +737,72 @@ namespace bl
         // Expansion view (increasing magnitude)
         FORCE_INLINE void to_expansion(double (&e)[4]) const { e[0] = x3; e[1] = x2; e[2] = x1; e[3] = x0; }
 
-        // Addition
-        friend FORCE_INLINE f256 operator+(const f256& a, const f256& b)
+        // Addition (QD algorithms, Hida/Li/Bailey)
+        static FORCE_INLINE f256 add_sloppy(const f256& a, const f256& b)
         {
-            double ea[4], eb[4];
-            a.to_expansion(ea);
-            b.to_expansion(eb);
+            // limb-wise two_sum, then fold the errors down; branch-free
+            double s0, s1, s2, s3, t0, t1, t2, t3;
+            f256_detail::two_sum(a.x0, b.x0, s0, t0);
+            f256_detail::two_sum(a.x1, b.x1, s1, t1);
+            f256_detail::two_sum(a.x2, b.x2, s2, t2);
+            f256_detail::two_sum(a.x3, b.x3, s3, t3);
+
+            f256_detail::two_sum(s1, t0, s1, t0);
+            f256_detail::three_sum(s2, t0, t1);
+            f256_detail::three_sum2(s3, t0, t2);
+            t0 = t0 + t1 + t3;
+
+            f256_detail::renorm5(s0, s1, s2, s3, t0);
+            return f256(s0, s1, s2, s3);
+        }
 
-            double s8[8];
-            f256_detail::fast_expansion_sum_zeroelim(ea, 4, eb, 4, s8);
+        static FORCE_INLINE f256 add_accurate(const f256& a, const f256& b)
+        {
+            // merge the limbs by decreasing magnitude, emitting a limb whenever the running sum has one
+            const double ea[4] = { a.x0, a.x1, a.x2, a.x3 };
+            const double eb[4] = { b.x0, b.x1, b.x2, b.x3 };
+            double x[4] = { 0.0, 0.0, 0.0, 0.0 };
+            int i = 0, j = 0, k = 0;
 
-            double c8[8];
-            const int clen = f256_detail::compress(s8, c8);
+            auto next = [&]() -> double
+            {
+                if (i >= 4) return eb[j++];
+                if (j >= 4) return ea[i++];
+                return (f256_detail::absd(ea[i]) > f256_detail::absd(eb[j])) ? ea[i++] : eb[j++];
+            };
 
-            f256 r;
-            f256_detail::pack4(c8, clen, r.x0, r.x1, r.x2, r.x3);
-            return r;
+            double u = next();
+            double v = next();
+            f256_detail::quick_two_sum(u, v, u, v);
+
+            while (k < 4)
+            {
+                if (i >= 4 && j >= 4)
+                {
+                    x[k] = u;
+                    if (k < 3) x[++k] = v;
+                    break;
+                }
+
+                const double t = f256_detail::quick_three_accum(u, v, next());
+                if (t != 0.0) x[k++] = t;
+            }
+
+            // whatever is left is below the fourth limb
+            for (; i < 4; ++i) x[3] += ea[i];
+            for (; j < 4; ++j) x[3] += eb[j];
+
+            f256_detail::renorm4(x[0], x[1], x[2], x[3]);
+            return f256(x[0], x[1], x[2], x[3]);
+        }
+
+        friend FORCE_INLINE f256 operator+(const f256& a, const f256& b)
+        {
+            #ifdef BL_F256_SLOPPY_ADD
+            return add_sloppy(a, b);
+            #else
+            return add_accurate(a, b);
+            #endif
         }
 
         friend FORCE_INLINE f256 operator-(const f256& a, const f256& b)
@@ -413,48 +815,95 @@ namespace bl
         friend FORCE_INLINE f256 operator+(double a, const f256& b) { return f256(a) + b; }
         friend FORCE_INLINE f256 operator-(double a, const f256& b) { return f256(a) - b; }
 
-        // Multiplication (fixed-schedule quad-double; truncated, performance-first)
+        // Multiplication (QD sloppy product: all terms down to order 3, errors of the order-3
+        // products dropped; ~2^-211 relative). Branch-free, see f256_simd.h.
         friend FORCE_INLINE f256 operator*(const f256& a, const f256& b)
         {
-            // Keep the dominant terms (i+j <= 3). This is intentionally lossy but fast.
-            double r0 = 0.0, r1 = 0.0, r2 = 0.0, r3 = 0.0;
+            double p0, p1, p2, p3, p4, p5, q0, q1, q2, q3, q4, q5;
+            f256_detail::two_prod(a.x0, b.x0, p0, q0);
+
+            f256_detail::two_prod(a.x0, b.x1, p1, q1);
+            f256_detail::two_prod(a.x1, b.x0, p2, q2);
 
-            // Order is chosen to roughly match magnitude so renorm stays cheap.
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x0, b.x0, true);
+            f256_detail::two_prod(a.x0, b.x2, p3, q3);
+            f256_detail::two_prod(a.x1, b.x1, p4, q4);
+            f256_detail::two_prod(a.x2, b.x0, p5, q5);
 
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x0, b.x1, true);
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x1, b.x0, true);
+            // order 1
+            f256_detail::three_sum(p1, p2, q0);
 
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x0, b.x2, true);
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x1, b.x1, true);
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x2, b.x0, true);
+            // order 2
+            f256_detail::three_sum(p2, q1, q2);
+            f256_detail::three_sum(p3, p4, p5);
 
-            // Smallest-order group: skip product error for speed
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x0, b.x3, false);
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x1, b.x2, false);
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x2, b.x1, false);
-            f256_detail::acc4_prod(r0, r1, r2, r3, a.x3, b.x0, false);
+            double s0, s1, s2, t0, t1;
+            f256_detail::two_sum(p2, p3, s0, t0);
+            f256_detail::two_sum(q1, p4, s1, t1);
+            s2 = q2 + p5;
+            f256_detail::two_sum(s1, t0, s1, t0);
+            s2 += (t0 + t1);
 
-            f256_detail::renorm4(r0, r1, r2, r3);
+            // order 3
+            s1 += a.x0 * b.x3 + a.x1 * b.x2 + a.x2 * b.x1 + a.x3 * b.x0 + q0 + q3 + q4 + q5;
 
-            return f256(r0, r1, r2, r3);
+            f256_detail::renorm5(p0, p1, s0, s1, s2);
+            return f256(p0, p1, s0, s1);
         }
 
         friend FORCE_INLINE f256 operator*(const f256& a, double b)
         {
-            // Scale limbs then renorm. Keep error for the dominant limb only.
-            double p0, e0;
-            f256_detail::two_prod(a.x0, b, p0, e0);
-
-            const double p1 = a.x1 * b;
-            const double p2 = a.x2 * b;
+            double p0, p1, p2, q0, q1, q2, s1, s2;
+            f256_detail::two_prod(a.x0, b, p0, q0);
+            f256_detail::two_prod(a.x1, b, p1, q1);
+            f256_detail::two_prod(a.x2, b, p2, q2);
             const double p3 = a.x3 * b;
 
-            double r0 = p0, r1 = p1, r2 = p2, r3 = p3;
-            f256_detail::acc4(r0, r1, r2, r3, e0);
-            f256_detail::renorm4(r0, r1, r2, r3);
+            f256_detail::two_sum(q0, p1, s1, s2);
+            f256_detail::three_sum(s2, q1, p2);
+            f256_detail::three_sum2(q1, q2, p3);
+
+            f256_detail::renorm5(p0, s1, s2, q1, q2 + p2);
+            return f256(p0, s1, s2, q1);
+        }
+
+        // a*a, cheaper than a*a (the cross terms are doubled instead of computed twice)
+        friend FORCE_INLINE f256 sqr(const f256& a)
+        {
+            double p0, p1, p2, p3, p4, p5, q0, q1, q2, q3, s0, s1, t0, t1;
+            f256_detail::two_prod(a.x0, a.x0, p0, q0);
+            f256_detail::two_prod(2.0 * a.x0, a.x1, p1, q1);
+            f256_detail::two_prod(2.0 * a.x0, a.x2, p2, q2);
+            f256_detail::two_prod(a.x1, a.x1, p3, q3);
+
+            f256_detail::two_sum(q0, p1, p1, q0);
+
+            f256_detail::two_sum(q0, q1, q0, q1);
+            f256_detail::two_sum(p2, p3, p2, p3);
 
-            return f256(r0, r1, r2, r3);
+            f256_detail::two_sum(q0, p2, s0, t0);
+            f256_detail::two_sum(q1, p3, s1, t1);
+
+            f256_detail::two_sum(s1, t0, s1, t0);
+            t0 += t1;
+
+            f256_detail::quick_two_sum(s1, t0, s1, t0);
+            f256_detail::quick_two_sum(s0, s1, p2, t1);
+            f256_detail::quick_two_sum(t1, t0, p3, q0);
+
+            p4 = 2.0 * a.x0 * a.x3;
+            p5 = 2.0 * a.x1 * a.x2;
+
+            f256_detail::two_sum(p4, p5, p4, p5);
+            f256_detail::two_sum(q2, q3, q2, q3);
+
+            f256_detail::two_sum(p4, q2, t0, t1);
+            t1 = t1 + p5 + q3;
+
+            f256_detail::two_sum(p3, t0, p3, p4);
+            p4 = p4 + q0 + t1;
+
+            f256_detail::renorm5(p0, p1, p2, p3, p4);
+            return f256(p0, p1, p2, p3);
         }
 
         friend FORCE_INLINE f256 operator*(double a, const f256& b) { return b * a; }
@@ -491,15 +940,20 @@ namespace bl
 
             // q2
             const double q2 = r.x0 / b0;
+            r -= b * q2;
 
-            f256 q(q0, q1, q2, 0.0);
+            // q3
+            const double q3 = r.x0 / b0;
+
+            f256 q(q0, q1, q2, q3);
             f256_detail::renorm4(q.x0, q.x1, q.x2, q.x3);
             return q;
         }
 
         friend FORCE_INLINE f256 operator/(const f256& a, double b)
         {
-            return a * (1.0 / b);
+            // not a * (1.0 / b): the rounded reciprocal alone would cap the result at ~2^-53
+            return a / f256(b);
         }
 
         friend FORCE_INLINE f256 operator/(double a, const f256& b)
@@ -561,34 +1015,37 @@ namespace bl
             return y;
         }
 
+        // Transcendentals. Same scheme as f128: the argument is split against a short table (2^(j/64),
+        // log(1 + j/64), sin/cos(j/32), atan(j/64)) so the polynomial only covers a tiny interval.
+        // Horner runs in quad-double while a term can still reach ~2^-212 of the result, the rest of
+        // the series is summed in double.
+
         friend FORCE_INLINE f256 exp(const f256& x)
         {
-            // x = k*ln2 + r, exp(x)=2^k*exp(r)
-            double ln2_0, ln2_1, ln2_2, ln2_3;
-            f256_detail::const_to_limbs(f256_detail::kLn2, ln2_0, ln2_1, ln2_2, ln2_3);
-            const f256 ln2 = f256::from_limbs(ln2_0, ln2_1, ln2_2, ln2_3);
-
-            const double xd = x.to_double();
-            const double inv_ln2 = 1.0 / std::log(2.0);
-            const long long k = (std::isfinite(xd)) ? (long long)std::llround(xd * inv_ln2) : 0LL;
-
-            const f256 r = x - ln2 * (double)k;
-
-            // Taylor exp(r)
-            f256 term(1.0);
-            f256 sum(1.0);
-
-            const double eps = std::ldexp(1.0, -240);
-            for (int n = 1; n < 2000; ++n)
-            {
-                term = term * (r / (double)n);
-                sum += term;
-
-                if (std::fabs(term.to_double()) <= std::fabs(sum.to_double()) * eps)
-                    break;
-            }
-
-            return ldexp(sum, (int)k);
+            if (!std::isfinite(x.x0)) return f256(std::exp(x.x0));
+            if (x.x0 > 709.782712893384) return f256(std::numeric_limits<double>::infinity());
+            if (x.x0 < -745.133219101941) return f256(0.0);
+
+            // x = (64m + j) * ln2/64 + r, |r| <= ln2/128
+            const double kd = std::nearbyint(x.x0 * 92.33248261689366);
+            const f256 r = x - from_const(f256_detail::kLn2_64) * kd;
+            const int k = (int)kd;
+            const int j = k & 63;
+            const int m = (k - j) / 64;
+
+            // exp(r) - 1 = r (1 + r/2! + r^2/3! + ...), terms past r^16 in double (r^17/17! < 2^-175)
+            using f256_detail::kInvFact;
+            const double rd = r.x0;
+            double tail = kInvFact[21].x0;
+            for (int n = 20; n >= 17; --n) tail = tail * rd + kInvFact[n].x0;
+
+            f256 p = f256(tail) * r + from_const(kInvFact[16]);
+            for (int n = 15; n >= 1; --n) p = p * r + from_const(kInvFact[n]);
+            p = p * r;
+
+            // scale in two steps so 2^m alone can't overflow at the ends of the range
+            const f256 t = from_const(f256_detail::kExp2Table[j]);
+            return ldexp(ldexp(t + t * p, m / 2), m - m / 2);
         }
 
         friend FORCE_INLINE f256 log(const f256& a)
@@ -599,100 +1056,105 @@ namespace bl
                     return f256(-std::numeric_limits<double>::infinity());
                 return f256(std::numeric_limits<double>::quiet_NaN());
             }
-
-            // Newton solve exp(y)=a
-            f256 y(std::log(a.x0));
-            for (int i = 0; i < 8; ++i)
-            {
-                const f256 ey = exp(y);
-                y = y + (a - ey) / ey;
-            }
-            return y;
+            if (!std::isfinite(a.x0)) return a;
+
+            // a = 2^e * m, m in [sqrt(1/2), sqrt(2))
+            int e = std::ilogb(a.x0);
+            f256 m = ldexp(a, -e);
+            if (m.x0 > 1.4142135623730951) { m = ldexp(m, -1); ++e; }
+
+            // log(m) = log(c) + 2 atanh(u), c = 1 + j/64, u = (m - c) / (m + c), |u| < 1/180
+            const int j = (int)std::nearbyint((m.x0 - 1.0) * 64.0);
+            const double c = 1.0 + j * (1.0 / 64.0);
+            const f256 u = (m - c) / (m + c);
+            const f256 v = u * u;
+
+            // 2 atanh(u) = 2u (1 + v/3 + v^2/5 + ...), terms past v^10 in double
+            using f256_detail::kInvOdd;
+            const double vd = v.x0;
+            double tail = kInvOdd[14].x0;
+            for (int k = 13; k >= 11; --k) tail = tail * vd + kInvOdd[k].x0;
+
+            f256 p = f256(tail) * v + from_const(kInvOdd[10]);
+            for (int k = 9; k >= 0; --k) p = p * v + from_const(kInvOdd[k]);
+
+            const f256 log_m = from_const(f256_detail::kLogTable[j + 19]) + ldexp(u, 1) * p;
+            return (e == 0) ? log_m : from_const(f256_detail::kLn2) * (double)e + log_m;
         }
 
         friend FORCE_INLINE f256 log2(const f256& a)
         {
-            // log2(a) = log(a)/ln2
-            double ln2_0, ln2_1, ln2_2, ln2_3;
-            f256_detail::const_to_limbs(f256_detail::kLn2, ln2_0, ln2_1, ln2_2, ln2_3);
-            const f256 ln2 = f256::from_limbs(ln2_0, ln2_1, ln2_2, ln2_3);
-            return log(a) / ln2;
+            return log(a) * from_const(f256_detail::kLog2e);
         }
 
         friend FORCE_INLINE f256 log10(const f256& a)
         {
-            // log10(a) = log(a)/ln10
-            double ln10_0, ln10_1, ln10_2, ln10_3;
-            f256_detail::const_to_limbs(f256_detail::kLn10, ln10_0, ln10_1, ln10_2, ln10_3);
-            const f256 ln10 = f256::from_limbs(ln10_0, ln10_1, ln10_2, ln10_3);
-            return log(a) / ln10;
+            return log(a) * from_const(f256_detail::kLog10e);
         }
 
         friend FORCE_INLINE f256 exp2(const f256& x)
         {
-            // exp2(x) = exp(x*ln2)
-            double ln2_0, ln2_1, ln2_2, ln2_3;
-            f256_detail::const_to_limbs(f256_detail::kLn2, ln2_0, ln2_1, ln2_2, ln2_3);
-            const f256 ln2 = f256::from_limbs(ln2_0, ln2_1, ln2_2, ln2_3);
-            return exp(x * ln2);
+            return exp(x * from_const(f256_detail::kLn2));
         }
 
         friend FORCE_INLINE void sincos(const f256& x, f256& s, f256& c)
         {
-            // Reduce to r = x - k*(pi/2), k = nearest int(x*(2/pi))
-            double invpi2_0, invpi2_1, invpi2_2, invpi2_3;
-            f256_detail::const_to_limbs(f256_detail::kInvPi2, invpi2_0, invpi2_1, invpi2_2, invpi2_3);
-            const f256 invpi2 = f256::from_limbs(invpi2_0, invpi2_1, invpi2_2, invpi2_3);
-
-            double pi2_0, pi2_1, pi2_2, pi2_3;
-            f256_detail::const_to_limbs(f256_detail::kPi_2, pi2_0, pi2_1, pi2_2, pi2_3);
-            const f256 pi_2 = f256::from_limbs(pi2_0, pi2_1, pi2_2, pi2_3);
-
-            const double xd = x.to_double();
-            long long k = 0;
-            if (std::isfinite(xd))
+            const double ax = std::fabs(x.x0);
+            if (!std::isfinite(ax))
             {
-                const double kd = (double)std::llround(xd * invpi2.to_double());
-                k = (long long)kd;
+                s = c = f256(std::numeric_limits<double>::quiet_NaN());
+                return;
             }
 
-            const f256 r = x - pi_2 * (double)k;
-
-            // Compute sin/cos via Taylor on r (|r| ~ <= pi/4 after rounding).
-            f256 r2 = r * r;
+            // x = n*(pi/2) + r, |r| <= pi/4 (the reduction loses log2|x| of the ~212 bits)
+            f256 r = x;
+            long long n = 0;
+            if (ax > 0.7853981633974483)
+            {
+                const double nd = std::nearbyint(x.x0 * 0.6366197723675814);
+                r = x - from_const(f256_detail::kPi_2) * nd;
+                n = (long long)nd;
+            }
 
-            // sin(r)
-            f256 sin_t = r;
-            f256 sin_sum = r;
-            for (int n = 1; n < 200; ++n)
+            // r = t + d, t = +-j/32, |d| <= 1/64
+            const int j = (int)std::nearbyint(std::fabs(r.x0) * 32.0);
+            const double t = std::copysign(j * (1.0 / 32.0), r.x0);
+            const f256 d = r - t;
+
+            // in w = -d^2: sin(d) = d (1 + w/3! + w^2/5! + ...), cos(d) = 1 + w/2! + w^2/4! + ...,
+            // terms past w^8 in double
+            using f256_detail::kInvFact;
+            const f256 w = -(d * d);
+            const double wd = w.x0;
+            double ts = kInvFact[25].x0, tc = kInvFact[24].x0;
+            for (int k = 11; k >= 9; --k)
             {
-                const int k2 = 2 * n;
-                sin_t = sin_t * (-r2) / (double)(k2 * (k2 + 1));
-                sin_sum += sin_t;
-                if (std::fabs(sin_t.to_double()) <= std::fabs(sin_sum.to_double()) * std::ldexp(1.0, -240))
-                    break;
+                ts = ts * wd + kInvFact[2 * k + 1].x0;
+                tc = tc * wd + kInvFact[2 * k].x0;
             }
 
-            // cos(r)
-            f256 cos_t(1.0);
-            f256 cos_sum(1.0);
-            for (int n = 1; n < 200; ++n)
+            f256 ps = f256(ts) * w + from_const(kInvFact[17]);
+            f256 pc = f256(tc) * w + from_const(kInvFact[16]);
+            for (int k = 7; k >= 0; --k)
             {
-                const int k2 = 2 * n;
-                cos_t = cos_t * (-r2) / (double)((k2 - 1) * k2);
-                cos_sum += cos_t;
-                if (std::fabs(cos_t.to_double()) <= std::fabs(cos_sum.to_double()) * std::ldexp(1.0, -240))
-                    break;
+                ps = ps * w + from_const(kInvFact[2 * k + 1]);
+                pc = pc * w + from_const(kInvFact[2 * k]);
             }
+            const f256 sin_d = d * ps;
+            const f256 cos_d = pc;
 
-            // Rotate based on quadrant k mod 4
-            const int q = (int)(k & 3LL);
-            switch (q)
+            // sin(t + d), cos(t + d)
+            const f256 sin_t = (r.x0 < 0.0) ? -from_const(f256_detail::kSinTable[j]) : from_const(f256_detail::kSinTable[j]);
+            const f256 cos_t = from_const(f256_detail::kCosTable[j]);
+            const f256 sr = sin_t * cos_d + cos_t * sin_d;
+            const f256 cr = cos_t * cos_d - sin_t * sin_d;
+
+            switch ((int)(n & 3))
             {
-                case 0: s = sin_sum;           c = cos_sum;           break;
-                case 1: s = cos_sum;           c = -sin_sum;          break;
-                case 2: s = -sin_sum;          c = -cos_sum;          break;
-                default:s = -cos_sum;          c = sin_sum;           break;
+                case 0: s = sr;  c = cr;  break;
+                case 1: s = cr;  c = -sr; break;
+                case 2: s = -sr; c = -cr; break;
+                default:s = -cr; c = sr;  break;
             }
         }
 
@@ -700,56 +1162,47 @@ namespace bl
         friend FORCE_INLINE f256 cos(const f256& x) { f256 s, c; sincos(x, s, c); return c; }
         friend FORCE_INLINE f256 tan(const f256& x) { f256 s, c; sincos(x, s, c); return s / c; }
 
-        friend FORCE_INLINE f256 atan(const f256& x)
+        friend FORCE_INLINE f256 atan2(const f256& y, const f256& x)
         {
-            // atan(x) via series for |x|<=1, else pi/2 - atan(1/x)
-            const f256 ax = abs(x);
-            if (ax <= f256(1.0))
+            const bool x_zero = (x.x0 == 0.0 && x.x1 == 0.0 && x.x2 == 0.0 && x.x3 == 0.0);
+            if (x_zero)
             {
-                f256 t = x;
-                f256 sum = x;
-                f256 x2 = x * x;
-                for (int n = 1; n < 2000; ++n)
-                {
-                    t = t * (-x2);
-                    f256 term = t / (double)(2 * n + 1);
-                    sum += term;
-                    if (std::fabs(term.to_double()) <= std::fabs(sum.to_double()) * std::ldexp(1.0, -240))
-                        break;
-                }
-                return sum;
+                if (y.x0 > 0.0) return from_const(f256_detail::kPi_2);
+                if (y.x0 < 0.0) return -from_const(f256_detail::kPi_2);
+                return f256(0.0);
             }
-
-            double pi2_0, pi2_1, pi2_2, pi2_3;
-            f256_detail::const_to_limbs(f256_detail::kPi_2, pi2_0, pi2_1, pi2_2, pi2_3);
-            const f256 pi_2 = f256::from_limbs(pi2_0, pi2_1, pi2_2, pi2_3);
-
-            f256 r = pi_2 - atan(inv(x));
-            return (x.x0 < 0.0) ? -r : r;
+            if (!std::isfinite(x.x0) || !std::isfinite(y.x0))
+                return f256(std::atan2(y.x0, x.x0));
+
+            // fold into 0 <= ay <= ax
+            f256 ax = abs(x), ay = abs(y);
+            const bool swap = ay > ax;
+            if (swap) { const f256 tmp = ax; ax = ay; ay = tmp; }
+
+            // atan(ay/ax) = atan(c) + atan(w), c = j/64, w = (ay - c*ax) / (ax + c*ay), |w| <= 1/128
+            const int j = (int)std::nearbyint(ay.x0 / ax.x0 * 64.0);
+            const double c = j * (1.0 / 64.0);
+            const f256 w = (j == 0) ? ay / ax : (ay - ax * c) / (ax + ay * c);
+
+            // atan(w) = w (1 + u/3 + u^2/5 + ...), u = -w^2, terms past u^11 in double
+            using f256_detail::kInvOdd;
+            const f256 u = -(w * w);
+            const double ud = u.x0;
+            double tail = kInvOdd[15].x0;
+            for (int k = 14; k >= 12; --k) tail = tail * ud + kInvOdd[k].x0;
+
+            f256 p = f256(tail) * u + from_const(kInvOdd[11]);
+            for (int k = 10; k >= 0; --k) p = p * u + from_const(kInvOdd[k]);
+
+            f256 r = from_const(f256_detail::kAtanTable[j]) + w * p;
+            if (swap)       r = from_const(f256_detail::kPi_2) - r;
+            if (x.x0 < 0.0) r = from_const(f256_detail::kPi) - r;
+            return (y.x0 < 0.0) ? -r : r;
         }
 
-        friend FORCE_INLINE f256 atan2(const f256& y, const f256& x)
+        friend FORCE_INLINE f256 atan(const f256& x)
         {
-            if (x.x0 > 0.0) return atan(y / x);
-
-            double pi_0, pi_1, pi_2_, pi_3;
-            f256_detail::const_to_limbs(f256_detail::kPi, pi_0, pi_1, pi_2_, pi_3);
-            const f256 pi = f256::from_limbs(pi_0, pi_1, pi_2_, pi_3);
-
-            if (x.x0 < 0.0)
-            {
-                f256 a = atan(y / x);
-                return (y.x0 >= 0.0) ? (a + pi) : (a - pi);
-            }
-
-            // x == 0
-            double pi2_0, pi2_1, pi2_2, pi2_3;
-            f256_detail::const_to_limbs(f256_detail::kPi_2, pi2_0, pi2_1, pi2_2, pi2_3);
-            const f256 pi_2 = f256::from_limbs(pi2_0, pi2_1, pi2_2, pi2_3);
-
-            if (y.x0 > 0.0) return pi_2;
-            if (y.x0 < 0.0) return -pi_2;
-            return f256(0.0);
+            return atan2(x, f256(1.0));
         }
 
         friend FORCE_INLINE f256 asin(const f256& x)
@@ -768,32 +1221,50 @@ namespace bl
             return atan2(sqrt(t), x);
         }
 
-        friend FORCE_INLINE f256 pow(const f256& a, const f256& b)
+        friend FORCE_INLINE f256 pow(const f256& x, const f256& y)
         {
-            // Handle integer exponent for negative bases.
-            if (a.x0 < 0.0)
+            if (y.x0 == 0.0) return f256(1.0);
+
+            const bool y_int = std::floor(y.x0) == y.x0 && std::floor(y.x1) == y.x1 &&
+                               std::floor(y.x2) == y.x2 && std::floor(y.x3) == y.x3;
+            bool negate = false;
+            f256 b = x;
+            if (x.x0 <= 0.0)
             {
-                const double bd = b.to_double();
-                const double rd = std::round(bd);
-                if (std::fabs(bd - rd) <= std::ldexp(1.0, -40)) // loose integer test
+                if (x.x0 == 0.0) return (y.x0 > 0.0) ? f256(0.0) : f256(std::numeric_limits<double>::infinity());
+                if (!y_int) return f256(std::numeric_limits<double>::quiet_NaN());
+
+                // negative base, integer exponent: sign from parity (limbs are integers, so parities add)
+                int odd = 0;
+                odd += std::fmod(y.x0, 2.0) != 0.0;
+                odd += std::fmod(y.x1, 2.0) != 0.0;
+                odd += std::fmod(y.x2, 2.0) != 0.0;
+                odd += std::fmod(y.x3, 2.0) != 0.0;
+                negate = (odd & 1) != 0;
+                b = -x;
+            }
+
+            f256 r;
+            if (y_int && std::fabs(y.x0) <= 64.0)
+            {
+                // small integer powers by squaring (fewer roundings than exp/log)
+                long long e = (long long)std::fabs(y.x0);
+                r = f256(1.0);
+                while (e)
                 {
-                    const long long n = (long long)rd;
-                    f256 base = -a;
-                    f256 res(1.0);
-                    long long e = (n < 0) ? -n : n;
-                    while (e)
-                    {
-                        if (e & 1LL) res *= base;
-                        base *= base;
-                        e >>= 1LL;
-                    }
-                    if (n < 0) res = inv(res);
-                    return (n & 1LL) ? -res : res;
+                    if (e & 1) r = r * b;
+                    e >>= 1;
+                    if (e) b = b * b;
                 }
-                return f256(std::numeric_limits<double>::quiet_NaN());
+                if (y.x0 < 0.0) r = f256(1.0) / r;
+            }
+            else
+            {
+                // relative error grows with |y*log(x)|, the absolute error of the exponent
+                r = exp(y * log(b));
             }
 
-            return exp(b * log(a));
+            return negate ? -r : r;
         }
 
         friend FORCE_INLINE f256 sinh(const f256& x)
@@ -0,0 +1,373 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include "f256.h"
+#include "f128_simd.h"
+
+/// ======== Packed quad-double (SoA) ========
+//
+// f256x2 / f256x4 hold 2 or 4 f256 values as four limb registers (x0..x3) and run the same
+// branch-free sequences as the scalar f256 operators: mul, sqr, mul by double and the sloppy add
+// are bit-for-bit identical per lane (FMA or Dekker, matching FMA_AVAILABLE). The accurate scalar
+// add branches on limb magnitudes, so packed lanes always use the sloppy add; define
+// BL_F256_SLOPPY_ADD for scalar + to match as well.
+//
+//   simd2::f256x2  - 2 lanes on the native 2-wide dvec
+//   simd2::f256x4  - 4 lanes, native on AVX, otherwise a pair of 2-lane halves
+//   simd2::f256xN  - widest native width for the active tag
+//
+// f256_batch:: runs the packed ops over arrays of f256 (reference orbit buffers, per-reference
+// tables), with the leftover tail done by the matching scalar sequence.
+
+BL_BEGIN_NS;
+
+namespace simd2 {
+
+    // quad-double building blocks (see f256_detail for the scalar versions)
+    BL_PUSH_PRECISE
+    template<class D>
+    FORCE_INLINE void qd_two_prod(typename D::V a, typename D::V b, typename D::V& p, typename D::V& e)
+    {
+        #ifdef FMA_AVAILABLE
+        p = D::mul(a, b);
+        e = D::fma(a, b, D::neg(p));
+        #else
+        dd_two_prod_dekker<D>(a, b, p, e);
+        #endif
+    }
+
+    template<class D>
+    FORCE_INLINE void qd_three_sum(typename D::V& a, typename D::V& b, typename D::V& c)
+    {
+        typename D::V t1, t2, t3;
+        dd_two_sum<D>(a, b, t1, t2);
+        dd_two_sum<D>(c, t1, a, t3);
+        dd_two_sum<D>(t2, t3, b, c);
+    }
+
+    template<class D>
+    FORCE_INLINE void qd_three_sum2(typename D::V& a, typename D::V& b, typename D::V c)
+    {
+        typename D::V t1, t2, t3;
+        dd_two_sum<D>(a, b, t1, t2);
+        dd_two_sum<D>(c, t1, a, t3);
+        b = D::add(t2, t3);
+    }
+
+    template<class D>
+    FORCE_INLINE void qd_renorm5(typename D::V& a0, typename D::V& a1, typename D::V& a2, typename D::V& a3, typename D::V a4)
+    {
+        dd_quick_two_sum<D>(a3, a4, a3, a4);
+        dd_quick_two_sum<D>(a2, a3, a2, a3);
+        dd_quick_two_sum<D>(a1, a2, a1, a2);
+        dd_quick_two_sum<D>(a0, a1, a0, a1);
+
+        dd_quick_two_sum<D>(a0, a1, a0, a1);
+        dd_quick_two_sum<D>(a1, a2, a1, a2);
+        dd_quick_two_sum<D>(a2, a3, a2, a3);
+        a3 = D::add(a3, a4);
+    }
+    BL_POP_PRECISE
+
+    template<class D>
+    struct f256v
+    {
+        using dvec = D;
+        using V = typename D::V;
+        static constexpr int lanes = D::lanes;
+
+        V x0, x1, x2, x3;
+
+        using mask = typename f128v<D>::mask;
+
+        // ---- construction / lanes ----
+
+        static inline f256v broadcast(const f256& v) { return { D::set1(v.x0), D::set1(v.x1), D::set1(v.x2), D::set1(v.x3) }; }
+        static inline f256v broadcast(double v) { const V z = D::set1(0.0); return { D::set1(v), z, z, z }; }
+
+        // SoA
+        static inline f256v load(const double* p0, const double* p1, const double* p2, const double* p3)
+        {
+            return { D::load(p0), D::load(p1), D::load(p2), D::load(p3) };
+        }
+        inline void store(double* p0, double* p1, double* p2, double* p3) const
+        {
+            D::store(p0, x0); D::store(p1, x1); D::store(p2, x2); D::store(p3, x3);
+        }
+
+        // AoS (f256 arrays)
+        static inline f256v load(const f256* p)
+        {
+            double l0[lanes], l1[lanes], l2[lanes], l3[lanes];
+            for (int i = 0; i < lanes; i++) { l0[i] = p[i].x0; l1[i] = p[i].x1; l2[i] = p[i].x2; l3[i] = p[i].x3; }
+            return load(l0, l1, l2, l3);
+        }
+        inline void store(f256* p) const
+        {
+            double l0[lanes], l1[lanes], l2[lanes], l3[lanes];
+            store(l0, l1, l2, l3);
+            for (int i = 0; i < lanes; i++) p[i] = f256(l0[i], l1[i], l2[i], l3[i]);
+        }
+
+        [[nodiscard]] inline f256 lane(int i) const
+        {
+            double l0[lanes], l1[lanes], l2[lanes], l3[lanes];
+            store(l0, l1, l2, l3);
+            return f256(l0[i], l1[i], l2[i], l3[i]);
+        }
+
+        // ---- arithmetic (same sequences as f256::add_sloppy / operator* / sqr) ----
+
+        static FORCE_INLINE f256v add(const f256v& a, const f256v& b)
+        {
+            V s0, s1, s2, s3, t0, t1, t2, t3;
+            dd_two_sum<D>(a.x0, b.x0, s0, t0);
+            dd_two_sum<D>(a.x1, b.x1, s1, t1);
+            dd_two_sum<D>(a.x2, b.x2, s2, t2);
+            dd_two_sum<D>(a.x3, b.x3, s3, t3);
+
+            dd_two_sum<D>(s1, t0, s1, t0);
+            qd_three_sum<D>(s2, t0, t1);
+            qd_three_sum2<D>(s3, t0, t2);
+            t0 = D::add(D::add(t0, t1), t3);
+
+            qd_renorm5<D>(s0, s1, s2, s3, t0);
+            return { s0, s1, s2, s3 };
+        }
+
+        static FORCE_INLINE f256v neg(const f256v& a) { return { D::neg(a.x0), D::neg(a.x1), D::neg(a.x2), D::neg(a.x3) }; }
+        static FORCE_INLINE f256v sub(const f256v& a, const f256v& b) { return add(a, neg(b)); }
+
+        static FORCE_INLINE f256v mul(const f256v& a, const f256v& b)
+        {
+            V p0, p1, p2, p3, p4, p5, q0, q1, q2, q3, q4, q5;
+            qd_two_prod<D>(a.x0, b.x0, p0, q0);
+
+            qd_two_prod<D>(a.x0, b.x1, p1, q1);
+            qd_two_prod<D>(a.x1, b.x0, p2, q2);
+
+            qd_two_prod<D>(a.x0, b.x2, p3, q3);
+            qd_two_prod<D>(a.x1, b.x1, p4, q4);
+            qd_two_prod<D>(a.x2, b.x0, p5, q5);
+
+            qd_three_sum<D>(p1, p2, q0);
+
+            qd_three_sum<D>(p2, q1, q2);
+            qd_three_sum<D>(p3, p4, p5);
+
+            V s0, s1, s2, t0, t1;
+            dd_two_sum<D>(p2, p3, s0, t0);
+            dd_two_sum<D>(q1, p4, s1, t1);
+            s2 = D::add(q2, p5);
+            dd_two_sum<D>(s1, t0, s1, t0);
+            s2 = D::add(s2, D::add(t0, t1));
+
+            V o3 = D::mul(a.x0, b.x3);
+            o3 = D::add(o3, D::mul(a.x1, b.x2));
+            o3 = D::add(o3, D::mul(a.x2, b.x1));
+            o3 = D::add(o3, D::mul(a.x3, b.x0));
+            o3 = D::add(D::add(D::add(D::add(o3, q0), q3), q4), q5);
+            s1 = D::add(s1, o3);
+
+            qd_renorm5<D>(p0, p1, s0, s1, s2);
+            return { p0, p1, s0, s1 };
+        }
+
+        static FORCE_INLINE f256v mul(const f256v& a, double b_)
+        {
+            const V b = D::set1(b_);
+            V p0, p1, p2, q0, q1, q2, s1, s2;
+            qd_two_prod<D>(a.x0, b, p0, q0);
+            qd_two_prod<D>(a.x1, b, p1, q1);
+            qd_two_prod<D>(a.x2, b, p2, q2);
+            const V p3 = D::mul(a.x3, b);
+
+            dd_two_sum<D>(q0, p1, s1, s2);
+            qd_three_sum<D>(s2, q1, p2);
+            qd_three_sum2<D>(q1, q2, p3);
+
+            qd_renorm5<D>(p0, s1, s2, q1, D::add(q2, p2));
+            return { p0, s1, s2, q1 };
+        }
+
+        static FORCE_INLINE f256v sqr(const f256v& a)
+        {
+            const V two = D::set1(2.0);
+            V p0, p1, p2, p3, p4, p5, q0, q1, q2, q3, s0, s1, t0, t1;
+            qd_two_prod<D>(a.x0, a.x0, p0, q0);
+            qd_two_prod<D>(D::mul(two, a.x0), a.x1, p1, q1);
+            qd_two_prod<D>(D::mul(two, a.x0), a.x2, p2, q2);
+            qd_two_prod<D>(a.x1, a.x1, p3, q3);
+
+            dd_two_sum<D>(q0, p1, p1, q0);
+
+            dd_two_sum<D>(q0, q1, q0, q1);
+            dd_two_sum<D>(p2, p3, p2, p3);
+
+            dd_two_sum<D>(q0, p2, s0, t0);
+            dd_two_sum<D>(q1, p3, s1, t1);
+
+            dd_two_sum<D>(s1, t0, s1, t0);
+            t0 = D::add(t0, t1);
+
+            dd_quick_two_sum<D>(s1, t0, s1, t0);
+            dd_quick_two_sum<D>(s0, s1, p2, t1);
+            dd_quick_two_sum<D>(t1, t0, p3, q0);
+
+            p4 = D::mul(D::mul(two, a.x0), a.x3);
+            p5 = D::mul(D::mul(two, a.x1), a.x2);
+
+            dd_two_sum<D>(p4, p5, p4, p5);
+            dd_two_sum<D>(q2, q3, q2, q3);
+
+            dd_two_sum<D>(p4, q2, t0, t1);
+            t1 = D::add(D::add(t1, p5), q3);
+
+            dd_two_sum<D>(p3, t0, p3, p4);
+            p4 = D::add(D::add(p4, q0), t1);
+
+            qd_renorm5<D>(p0, p1, p2, p3, p4);
+            return { p0, p1, p2, p3 };
+        }
+
+        // ---- comparisons / selection (lexicographic on the limbs, as the scalar operators) ----
+
+        static FORCE_INLINE mask cmplt(const f256v& a, const f256v& b)
+        {
+            const auto lt3 = D::lt(a.x3, b.x3);
+            const auto lt2 = D::mor(D::lt(a.x2, b.x2), D::mand(D::eq(a.x2, b.x2), lt3));
+            const auto lt1 = D::mor(D::lt(a.x1, b.x1), D::mand(D::eq(a.x1, b.x1), lt2));
+            return { D::mor(D::lt(a.x0, b.x0), D::mand(D::eq(a.x0, b.x0), lt1)) };
+        }
+        static FORCE_INLINE mask cmpeq(const f256v& a, const f256v& b)
+        {
+            return { D::mand(D::mand(D::eq(a.x0, b.x0), D::eq(a.x1, b.x1)), D::mand(D::eq(a.x2, b.x2), D::eq(a.x3, b.x3))) };
+        }
+        static FORCE_INLINE mask cmple(const f256v& a, const f256v& b) { return cmplt(a, b) | cmpeq(a, b); }
+        static FORCE_INLINE mask cmpgt(const f256v& a, const f256v& b) { return cmplt(b, a); }
+        static FORCE_INLINE mask cmpge(const f256v& a, const f256v& b) { return cmple(b, a); }
+
+        // lanes of a where m is set, otherwise b
+        static FORCE_INLINE f256v blend(mask m, const f256v& a, const f256v& b)
+        {
+            return { D::blend(m.m, a.x0, b.x0), D::blend(m.m, a.x1, b.x1), D::blend(m.m, a.x2, b.x2), D::blend(m.m, a.x3, b.x3) };
+        }
+
+        static FORCE_INLINE f256v abs(const f256v& a)
+        {
+            return blend(mask{ D::lt(a.x0, D::set1(0.0)) }, neg(a), a);
+        }
+
+        // operators, so kernels can be templated on f256 / f256v alike
+        friend FORCE_INLINE f256v operator+(const f256v& a, const f256v& b) { return add(a, b); }
+        friend FORCE_INLINE f256v operator-(const f256v& a, const f256v& b) { return sub(a, b); }
+        friend FORCE_INLINE f256v operator*(const f256v& a, const f256v& b) { return mul(a, b); }
+        friend FORCE_INLINE f256v operator*(const f256v& a, double b) { return mul(a, b); }
+        friend FORCE_INLINE f256v operator-(const f256v& a) { return neg(a); }
+        friend FORCE_INLINE f256v sqr(const f256v& a) { return f256v::sqr(a); }
+
+        FORCE_INLINE f256v& operator+=(const f256v& b) { return *this = add(*this, b); }
+        FORCE_INLINE f256v& operator-=(const f256v& b) { return *this = sub(*this, b); }
+        FORCE_INLINE f256v& operator*=(const f256v& b) { return *this = mul(*this, b); }
+
+        friend FORCE_INLINE mask operator< (const f256v& a, const f256v& b) { return cmplt(a, b); }
+        friend FORCE_INLINE mask operator<=(const f256v& a, const f256v& b) { return cmple(a, b); }
+        friend FORCE_INLINE mask operator> (const f256v& a, const f256v& b) { return cmpgt(a, b); }
+        friend FORCE_INLINE mask operator>=(const f256v& a, const f256v& b) { return cmpge(a, b); }
+        friend FORCE_INLINE mask operator==(const f256v& a, const f256v& b) { return cmpeq(a, b); }
+        friend FORCE_INLINE mask operator!=(const f256v& a, const f256v& b) { return !cmpeq(a, b); }
+    };
+
+    using f256x2 = f256v<dvec2>;
+    using f256x4 = f256v<dvec4>;
+
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX)
+    using f256xN = f256x4;
+    #else
+    using f256xN = f256x2;
+    #endif
+
+} // namespace simd2
+
+/// ======== Batch ops over f256 arrays ========
+//
+// out may alias any input. Results match the scalar sloppy-add / mul / sqr sequences exactly.
+
+namespace f256_batch {
+
+    template<class V = simd2::f256xN, class Op, class ScalarOp>
+    FORCE_INLINE void apply2(const f256* a, const f256* b, f256* out, size_t n, Op op, ScalarOp scalar_op)
+    {
+        constexpr size_t L = V::lanes;
+        size_t i = 0;
+        for (; i + L <= n; i += L)
+            op(V::load(a + i), V::load(b + i)).store(out + i);
+        for (; i < n; ++i)
+            out[i] = scalar_op(a[i], b[i]);
+    }
+
+    inline void add(const f256* a, const f256* b, f256* out, size_t n)
+    {
+        apply2(a, b, out, n,
+            [](const auto& x, const auto& y) { return x + y; },
+            [](const f256& x, const f256& y) { return f256::add_sloppy(x, y); });
+    }
+
+    inline void sub(const f256* a, const f256* b, f256* out, size_t n)
+    {
+        apply2(a, b, out, n,
+            [](const auto& x, const auto& y) { return x - y; },
+            [](const f256& x, const f256& y) { return f256::add_sloppy(x, -y); });
+    }
+
+    inline void mul(const f256* a, const f256* b, f256* out, size_t n)
+    {
+        apply2(a, b, out, n,
+            [](const auto& x, const auto& y) { return x * y; },
+            [](const f256& x, const f256& y) { return x * y; });
+    }
+
+    // out = a * s
+    inline void scale(const f256* a, double s, f256* out, size_t n)
+    {
+        using V = simd2::f256xN;
+        size_t i = 0;
+        for (; i + V::lanes <= n; i += V::lanes)
+            (V::load(a + i) * s).store(out + i);
+        for (; i < n; ++i)
+            out[i] = a[i] * s;
+    }
+
+    // out = a * a
+    inline void sqr(const f256* a, f256* out, size_t n)
+    {
+        using V = simd2::f256xN;
+        size_t i = 0;
+        for (; i + V::lanes <= n; i += V::lanes)
+            V::sqr(V::load(a + i)).store(out + i);
+        for (; i < n; ++i)
+            out[i] = sqr(a[i]);
+    }
+
+    // out = a * b + c
+    inline void mul_add(const f256* a, const f256* b, const f256* c, f256* out, size_t n)
+    {
+        using V = simd2::f256xN;
+        size_t i = 0;
+        for (; i + V::lanes <= n; i += V::lanes)
+            (V::load(a + i) * V::load(b + i) + V::load(c + i)).store(out + i);
+        for (; i < n; ++i)
+            out[i] = f256::add_sloppy(a[i] * b[i], c[i]);
+    }
+
+    // leading limb of each value, e.g. an f256 reference orbit rounded for the f64 delta iteration
+    inline void to_double(const f256* a, double* out, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = a[i].x0;
+    }
+
+} // namespace f256_batch
+
+BL_END_NS
@@ -0,0 +1,215 @@
+#pragma once
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "f128.h"
+
+namespace bl {
+
+/// ======== floatexp ========
+//
+// A double mantissa with a separate 64-bit binary exponent: value = m * 2^e, with 1 <= |m| < 2
+// (or m == 0). Precision is that of a double, but the range is effectively unbounded, so values
+// that underflow/overflow f64, f128 and f256 (e.g. deep-zoom scales and per-pixel deltas past
+// 1e-308) stay representable. Every operation renormalises the mantissa with a couple of bit ops.
+
+struct floatexp;
+
+constexpr floatexp operator+(const floatexp& a, const floatexp& b);
+constexpr floatexp operator-(const floatexp& a, const floatexp& b);
+constexpr floatexp operator*(const floatexp& a, const floatexp& b);
+constexpr floatexp operator/(const floatexp& a, const floatexp& b);
+
+struct floatexp
+{
+    double  m; // mantissa, 1 <= |m| < 2 (or 0, inf, nan)
+    int64_t e; // binary exponent
+
+    // exponents reserved for zero and inf/nan, far enough apart that sums never overflow
+    static constexpr int64_t zero_exp    = -(int64_t(1) << 60);
+    static constexpr int64_t special_exp =  (int64_t(1) << 60);
+
+    floatexp() = default;
+
+    template<class T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+    constexpr floatexp(T v) noexcept { *this = normalized(static_cast<double>(v), 0); }
+
+    explicit constexpr floatexp(const f128& v) noexcept;
+
+    // build from an unnormalised mantissa/exponent pair
+    [[nodiscard]] static constexpr floatexp normalized(double m, int64_t e) noexcept
+    {
+        constexpr uint64_t exp_mask = uint64_t(0x7ff) << 52;
+
+        const uint64_t bits = std::bit_cast<uint64_t>(m);
+        const int64_t be = int64_t((bits >> 52) & 0x7ff);
+
+        // zero, subnormal, inf and nan all fall outside [1, 0x7fe] (single compare)
+        if (uint64_t(be - 1) >= 0x7fe) [[unlikely]]
+            return normalizedSlow(m, e);
+
+        return raw(std::bit_cast<double>((bits & ~exp_mask) | (uint64_t(1023) << 52)), e + (be - 1023));
+    }
+
+    [[nodiscard]] static constexpr floatexp normalizedSlow(double m, int64_t e) noexcept
+    {
+        if (m == 0.0) return raw(m, zero_exp);
+        if (m != m || m - m != 0.0) return raw(m, special_exp); // nan / inf
+
+        // subnormal, lift into the normal range first
+        return normalized(m * 0x1p54, e - 54);
+    }
+
+    [[nodiscard]] static constexpr floatexp raw(double m, int64_t e) noexcept
+    {
+        floatexp r;
+        r.m = m;
+        r.e = e;
+        return r;
+    }
+
+    /// ======== Conversions ========
+    explicit constexpr operator double() const;
+    explicit constexpr operator float() const { return static_cast<float>(static_cast<double>(*this)); }
+    explicit constexpr operator f128() const  { return f128{ static_cast<double>(*this), 0.0 }; }
+
+    constexpr floatexp operator+() const { return *this; }
+    constexpr floatexp operator-() const noexcept { return raw(-m, e); }
+
+    constexpr floatexp& operator+=(const floatexp& rhs) { *this = *this + rhs; return *this; }
+    constexpr floatexp& operator-=(const floatexp& rhs) { *this = *this - rhs; return *this; }
+    constexpr floatexp& operator*=(const floatexp& rhs) { *this = *this * rhs; return *this; }
+    constexpr floatexp& operator/=(const floatexp& rhs) { *this = *this / rhs; return *this; }
+};
+
+/// ======== Helpers ========
+
+// 2^k as a double for k in [-1022, 1023]
+FORCE_INLINE constexpr double fe_pow2(int64_t k)
+{
+    return std::bit_cast<double>(uint64_t(1023 + k) << 52);
+}
+
+// m * 2^e, saturating to 0/inf outside double's range
+FORCE_INLINE constexpr double fe_scale(double m, int64_t e)
+{
+    if (e > 1023)  return m * fe_pow2(1023) * 2.0; // inf
+    if (e < -1100) return m * 0.0;
+    if (e < -1022) return m * fe_pow2(e + 100) * fe_pow2(-100);
+    return m * fe_pow2(e);
+}
+
+constexpr floatexp::floatexp(const f128& v) noexcept
+{
+    *this = normalized(v.hi, 0);
+    if (e != zero_exp && e != special_exp)
+        *this = normalized(m + fe_scale(v.lo, -e), e); // fold in what fits of the trailing limb
+}
+
+constexpr floatexp::operator double() const
+{
+    if (e == special_exp) return m;
+    return fe_scale(m, e);
+}
+
+/// ======== Arithmetic ========
+
+FORCE_INLINE constexpr floatexp operator*(const floatexp& a, const floatexp& b)
+{
+    return floatexp::normalized(a.m * b.m, a.e + b.e);
+}
+
+FORCE_INLINE constexpr floatexp operator/(const floatexp& a, const floatexp& b)
+{
+    return floatexp::normalized(a.m / b.m, a.e - b.e);
+}
+
+FORCE_INLINE constexpr floatexp operator+(const floatexp& a, const floatexp& b)
+{
+    // align the smaller operand to the larger exponent, anything 64+ binades below vanishes
+    const floatexp& big   = (a.e >= b.e) ? a : b;
+    const floatexp& small = (a.e >= b.e) ? b : a;
+
+    const int64_t d = small.e - big.e;
+    if (d < -63) return big;
+
+    return floatexp::normalized(big.m + small.m * fe_pow2(d), big.e);
+}
+
+FORCE_INLINE constexpr floatexp operator-(const floatexp& a, const floatexp& b)
+{
+    return a + (-b);
+}
+
+/// ======== Comparison ========
+
+FORCE_INLINE constexpr int sign(const floatexp& a) { return (a.m > 0.0) - (a.m < 0.0); }
+
+FORCE_INLINE constexpr bool operator==(const floatexp& a, const floatexp& b) { return a.m == b.m && (a.e == b.e || a.m == 0.0); }
+FORCE_INLINE constexpr bool operator!=(const floatexp& a, const floatexp& b) { return !(a == b); }
+
+FORCE_INLINE constexpr bool operator<(const floatexp& a, const floatexp& b)
+{
+    const int sa = sign(a), sb = sign(b);
+    if (sa != sb) return sa < sb;
+    if (sa == 0)  return false;
+    if (a.e != b.e) return (a.e < b.e) == (sa > 0);
+    return a.m < b.m;
+}
+
+FORCE_INLINE constexpr bool operator> (const floatexp& a, const floatexp& b) { return b < a; }
+FORCE_INLINE constexpr bool operator<=(const floatexp& a, const floatexp& b) { return !(b < a); }
+FORCE_INLINE constexpr bool operator>=(const floatexp& a, const floatexp& b) { return !(a < b); }
+
+/// ======== Math ========
+
+FORCE_INLINE constexpr bool iszero(const floatexp& a)   { return a.m == 0.0; }
+FORCE_INLINE constexpr bool isfinite(const floatexp& a) { return a.e != floatexp::special_exp; }
+FORCE_INLINE constexpr floatexp abs(const floatexp& a)  { return floatexp::raw(a.m < 0.0 ? -a.m : a.m, a.e); }
+
+FORCE_INLINE constexpr floatexp ldexp(const floatexp& a, int64_t k)
+{
+    if (iszero(a) || !isfinite(a)) return a;
+    return floatexp::raw(a.m, a.e + k);
+}
+
+FORCE_INLINE floatexp sqrt(const floatexp& a)
+{
+    if (iszero(a) || !isfinite(a) || a.m < 0.0)
+        return floatexp::raw(std::sqrt(a.m), a.e);
+
+    // make the exponent even, mantissa lands in [1,4) and its root in [1,2)
+    const bool odd = (a.e & 1) != 0;
+    const double m = odd ? a.m * 2.0 : a.m;
+    const int64_t e = odd ? a.e - 1 : a.e;
+    return floatexp::normalized(std::sqrt(m), e / 2);
+}
+
+FORCE_INLINE double log2(const floatexp& a) { return double(a.e) + std::log2(a.m); }
+FORCE_INLINE double log10(const floatexp& a) { return double(a.e) * 0.30102999566398120 + std::log10(a.m); }
+
+/// ======== Printing ========
+
+// scientific notation with an unbounded decimal exponent, e.g. "1.2346e-4120"
+inline std::string to_string(const floatexp& x, int precision = 6)
+{
+    if (!isfinite(x) || iszero(x))
+        return std::to_string(x.m);
+
+    const double l10 = log10(abs(x));
+    double e10 = std::floor(l10);
+    double mant = std::pow(10.0, l10 - e10);
+
+    // rounding may push the mantissa to 10.0
+    if (mant >= 10.0 - 0.5 * std::pow(10.0, -precision)) { mant /= 10.0; e10 += 1.0; }
+
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%s%.*fe%lld", x.m < 0.0 ? "-" : "", precision, mant, (long long)e10);
+    return buf;
+}
+
+} // end bl
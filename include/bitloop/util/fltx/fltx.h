@@ -1,4 +1,5 @@
 #pragma once
 
 #include "f128.h"
+#include "floatexp.h"
 //#include "f256.h"
@@ -0,0 +1,491 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "f128.h"
+#include "f256.h"
+
+namespace bl {
+
+/// ======== Shortest round-trip printing ========
+//
+// Ryu/Grisu-style printing for f64/f128/f256: emits the fewest significant digits that still
+// identify the value to within half an ulp of its type, instead of a fixed precision. The value
+// is scaled to [1, 10) once against a quad-double power of ten (far more accurate than an f128
+// half-ulp) straight into a fixed-point integer, then digits are peeled off exactly one at a time
+// until the remainder fits inside the rounding interval. Short values like axis ticks cost a
+// handful of iterations and nothing is allocated.
+//
+// "ulp" for the multi-double types is relative to the leading limb (2^-105 for f128, as in
+// numeric_limits<f128>::epsilon()). f256 uses a few bits less than its nominal 212, since quad-double
+// products (and so the scaling itself) are only accurate to about 2^-200.
+
+struct fltx_decimal
+{
+    static constexpr int max_digits = 72;
+
+    char digits[max_digits]; // '0'..'9', no trailing zeros
+    int  count = 0;          // 0 for zero
+    int  exp10 = 0;          // value = d0.d1d2... * 10^exp10
+    bool neg = false;
+};
+
+namespace shortest_detail
+{
+    // 10^k for |k| <= 256. Built once from exact 10^r (r < 32) and 10^32 steps, negative powers by
+    // a single division each, so every entry is good to ~2^-210.
+    struct pow10_f256_table
+    {
+        static constexpr int range = 256;
+        f256 p[2 * range + 1];
+
+        [[nodiscard]] const f256& operator[](int k) const { return p[range + k]; }
+
+        pow10_f256_table()
+        {
+            f256 small[32];
+            small[0] = f256(1.0);
+            for (int r = 1; r < 32; ++r)
+                small[r] = small[r - 1] * 10.0;
+
+            const f256 step = small[31] * 10.0;
+            f256 big = f256(1.0);
+            for (int k = 0; k <= range; ++k)
+            {
+                if (k > 0 && k % 32 == 0) big = big * step;
+                p[range + k] = (k % 32) ? big * small[k % 32] : big;
+            }
+            for (int k = 1; k <= range; ++k)
+                p[range - k] = f256(1.0) / p[range + k];
+        }
+    };
+
+    inline const pow10_f256_table& pow10_table()
+    {
+        static const pow10_f256_table table;
+        return table;
+    }
+
+    // Non-negative fixed-point number: w[0] is the integer part, w[1..W] the fraction in base 2^64.
+    // Digits come out of the integer word one multiply-by-10 at a time, exactly.
+    template<int W>
+    struct fixed_point
+    {
+        uint64_t w[W + 1] = {};
+
+        // adds one (possibly negative) double, truncated below 2^(-64W)
+        FORCE_INLINE void add(double v)
+        {
+            if (v == 0.0) return;
+
+            const uint64_t bits = std::bit_cast<uint64_t>(v);
+            const bool neg = (bits >> 63) != 0;
+            const int be = int((bits >> 52) & 0x7ff);
+            uint64_t mant = bits & ((uint64_t(1) << 52) - 1);
+            int e; // |v| = mant * 2^e
+            if (be == 0) e = -1074;
+            else { mant |= uint64_t(1) << 52; e = be - 1075; }
+
+            // position of mant's lsb above the fixed-point lsb
+            int shift = e + 64 * W;
+            if (shift < 0)
+            {
+                if (shift <= -53) return;
+                mant >>= -shift;
+                shift = 0;
+            }
+
+            const int wi = shift >> 6, bi = shift & 63; // wi counts words up from w[W]
+            const uint64_t part[2] = { mant << bi, bi ? (mant >> (64 - bi)) : 0 };
+
+            uint64_t carry = 0;
+            for (int k = 0; wi + k <= W; ++k)
+            {
+                if (k >= 2 && !carry) break;
+                const uint64_t a = (k < 2) ? part[k] : 0;
+                uint64_t& x = w[W - (wi + k)];
+                if (!neg)
+                {
+                    const uint64_t s1 = x + a;
+                    const uint64_t s2 = s1 + carry;
+                    carry = uint64_t(s1 < a) + uint64_t(s2 < s1);
+                    x = s2;
+                }
+                else
+                {
+                    const uint64_t d1 = x - a;
+                    const uint64_t d2 = d1 - carry;
+                    carry = uint64_t(x < a) + uint64_t(d1 < carry);
+                    x = d2;
+                }
+            }
+        }
+
+        FORCE_INLINE void times10()
+        {
+            uint64_t carry = 0;
+            for (int k = W; k >= 0; --k)
+            {
+                // w*10 = w*8 + w*2, with the bits shifted out as the next word's carry
+                const uint64_t x = w[k];
+                const uint64_t a = x << 3, b = x << 1;
+                const uint64_t s1 = a + b;
+                const uint64_t s2 = s1 + carry;
+                carry = (x >> 61) + (x >> 63) + uint64_t(s1 < a) + uint64_t(s2 < s1);
+                w[k] = s2;
+            }
+        }
+
+        [[nodiscard]] FORCE_INLINE double fraction() const
+        {
+            double r = 0.0;
+            for (int k = W; k >= 1; --k) r = (r + (double)w[k]) * 0x1p-64;
+            return r;
+        }
+
+        [[nodiscard]] FORCE_INLINE bool operator<(const fixed_point& o) const
+        {
+            for (int k = 0; k <= W; ++k)
+                if (w[k] != o.w[k]) return w[k] < o.w[k];
+            return false;
+        }
+
+        // fraction + o > 1
+        [[nodiscard]] FORCE_INLINE bool sumExceedsOne(const fixed_point& o) const
+        {
+            uint64_t carry = 0;
+            bool frac_nonzero = false;
+            for (int k = W; k >= 1; --k)
+            {
+                const uint64_t s1 = w[k] + o.w[k];
+                const uint64_t s2 = s1 + carry;
+                carry = uint64_t(s1 < w[k]) + uint64_t(s2 < s1);
+                frac_nonzero |= (s2 != 0);
+            }
+            const uint64_t whole = o.w[0] + carry;
+            return whole > 1 || (whole == 1 && frac_nonzero);
+        }
+
+        // sign of (fraction - 1/2)
+        [[nodiscard]] FORCE_INLINE int compareHalf() const
+        {
+            constexpr uint64_t half = uint64_t(1) << 63;
+            if (w[1] != half) return (w[1] > half) ? 1 : -1;
+            for (int k = 2; k <= W; ++k)
+                if (w[k]) return 1;
+            return 0;
+        }
+    };
+
+    // out = x * 10^k, accumulating the partial products exactly down to the fixed-point lsb
+    template<int W>
+    FORCE_INLINE void scale_pow10(f256 x, int k, fixed_point<W>& out)
+    {
+        const pow10_f256_table& t = pow10_table();
+
+        // only subnormal-adjacent or huge inputs get here, keeps table entries in the normal range
+        while (k > t.range)  { x = x * t[t.range];  k -= t.range; }
+        while (k < -t.range) { x = x * t[-t.range]; k += t.range; }
+
+        const f256& p = t[k];
+        out = {};
+
+        if constexpr (W <= 2)
+        {
+            // f64/f128 inputs: order 0 and 1 split exactly, order 2 rounded (x2 is only set by the
+            // pre-steps above), so the sum is good to ~2^-155, then folded into three fixed-point adds
+            double p00, e00, p01, e01, p10, e10;
+            f256_detail::two_prod(x.x0, p.x0, p00, e00);
+            f256_detail::two_prod(x.x0, p.x1, p01, e01);
+            f256_detail::two_prod(x.x1, p.x0, p10, e10);
+
+            double mid, mid_err, mid2, mid2_err;
+            f256_detail::two_sum(p01, p10, mid, mid_err);
+            f256_detail::two_sum(mid, e00, mid2, mid2_err);
+            const double low = (mid_err + mid2_err) + (e01 + e10) + (x.x0 * p.x2 + x.x1 * p.x1 + x.x2 * p.x0);
+
+            out.add(p00);
+            out.add(mid2);
+            out.add(low);
+        }
+        else
+        {
+            // full quad-double: orders 0-2 split exactly, order 3 rounded (~2^-212)
+            const double a[4] = { x.x0, x.x1, x.x2, x.x3 };
+            const double b[4] = { p.x0, p.x1, p.x2, p.x3 };
+            for (int i = 0; i <= 3; ++i)
+            {
+                if (a[i] == 0.0) continue;
+                for (int j = 0; i + j <= 3; ++j)
+                {
+                    if (i + j <= 2)
+                    {
+                        double pr, er;
+                        f256_detail::two_prod(a[i], b[j], pr, er);
+                        out.add(pr);
+                        out.add(er);
+                    }
+                    else
+                        out.add(a[i] * b[j]);
+                }
+            }
+        }
+    }
+
+    FORCE_INLINE void round_up(fltx_decimal& d)
+    {
+        int i = d.count - 1;
+        while (i >= 0 && d.digits[i] == '9') --i;
+        if (i < 0)
+        {
+            // 9.99.. -> 1
+            d.digits[0] = '1';
+            d.count = 1;
+            d.exp10++;
+            return;
+        }
+        d.digits[i]++;
+        d.count = i + 1;
+    }
+
+    FORCE_INLINE void strip_zeros(fltx_decimal& d)
+    {
+        while (d.count > 0 && d.digits[d.count - 1] == '0') --d.count;
+    }
+
+    // ax > 0 and finite. 'bits' is the significand width defining the half-ulp interval, W the
+    // fixed-point fraction words (64W must comfortably exceed 'bits'). The interval is shrunk by
+    // 2^-margin_bits to absorb scaling/truncation error, so a string sitting (almost) exactly on
+    // the boundary is never accepted; at worst such values get one extra digit.
+    // max_sig/max_frac cap significant/fractional digits (rounded to nearest, ties to even).
+    template<int W>
+    FORCE_INLINE void generate(const f256& ax, int bits, int margin_bits, int max_sig, int max_frac, fltx_decimal& out)
+    {
+        const int e2 = std::ilogb(ax.x0);
+        int e10 = (int)std::floor(e2 * 0.30102999566398120);
+
+        // r = ax / 10^e10 in [1, 10)
+        fixed_point<W> r;
+        scale_pow10<W>(ax, -e10, r);
+        if (r.w[0] >= 10)     { ++e10; scale_pow10<W>(ax, -e10, r); }
+        else if (r.w[0] == 0) { --e10; r.times10(); }
+
+        // half-ulp in units of r. The gap below an exact power of two is half as wide, and
+        // below 2^-1022 the ulp stops shrinking (subnormal hi/lo)
+        constexpr int min_half_ulp_exp = -1075;
+        const double m = r.w[0] + r.fraction();
+        const double lead = std::ldexp(ax.x0, -e2); // [1, 2)
+        const int half_ulp_exp = std::max(e2 - bits, min_half_ulp_exp);
+        const double delta = std::ldexp(m / lead * (1.0 - std::ldexp(1.0, -margin_bits)), half_ulp_exp - e2);
+        const bool narrow_below = (lead == 1.0 && ax.x1 == 0.0 && e2 - bits > min_half_ulp_exp);
+
+        fixed_point<W> delta_hi, delta_lo;
+        delta_hi.add(delta);
+        if (narrow_below) delta_lo.add(delta * 0.5);
+        const fixed_point<W>& below_limit = narrow_below ? delta_lo : delta_hi;
+
+        int cap = INT_MAX;
+        if (max_sig > 0) cap = max_sig;
+        if (max_frac != INT_MAX && e10 + 1 + max_frac < cap) cap = e10 + 1 + max_frac;
+        if (cap > fltx_decimal::max_digits) cap = fltx_decimal::max_digits;
+
+        out.exp10 = e10;
+        out.count = 0;
+
+        if (cap <= 0)
+        {
+            // rounds to zero or to a single unit one place above the leading digit
+            if (cap == 0 && (r.w[0] > 5 || (r.w[0] == 5 && r.fraction() > 0.0)))
+            {
+                out.digits[0] = '1';
+                out.count = 1;
+                out.exp10 = e10 + 1;
+            }
+            return;
+        }
+
+        for (;;)
+        {
+            const int d = (int)r.w[0];
+            r.w[0] = 0;
+            out.digits[out.count++] = char('0' + d);
+
+            // remainder in [0, 1), weighted by the last digit emitted
+            const bool down_ok = r < below_limit;
+            const bool up_ok = r.sumExceedsOne(delta_hi);
+
+            if (down_ok || up_ok || out.count == cap)
+            {
+                bool up = up_ok;
+                if (down_ok == up_ok)
+                {
+                    // nearest, exact ties to even
+                    const int half = r.compareHalf();
+                    up = (half > 0) || (half == 0 && (d & 1) != 0);
+                }
+
+                if (up) round_up(out);
+                break;
+            }
+
+            r.times10();
+            delta_hi.times10();
+            if (narrow_below) delta_lo.times10();
+        }
+
+        strip_zeros(out);
+    }
+
+    FORCE_INLINE bool emit_special(double lead, char*& p, char* last)
+    {
+        const char* s = nullptr;
+        if (std::isnan(lead))      s = "nan";
+        else if (lead == INFINITY) s = "inf";
+        else if (lead == -INFINITY) s = "-inf";
+        else return false;
+
+        const size_t n = std::strlen(s);
+        if ((size_t)(last - p) < n) return true; // caller sees ok == false via p unchanged
+        std::memcpy(p, s, n);
+        p += n;
+        return true;
+    }
+}
+
+/// ======== Decimal digits ========
+
+// Shortest digits for x (see above). max_sig > 0 caps significant digits, max_frac caps
+// digits after the decimal point; both round to nearest.
+FORCE_INLINE void shortest_decimal(const f256& x, fltx_decimal& out, int max_sig = 0, int max_frac = INT_MAX)
+{
+    out.neg = (x.x0 < 0.0);
+    out.count = 0;
+    out.exp10 = 0;
+    if (x.x0 == 0.0 || !std::isfinite(x.x0)) return;
+    shortest_detail::generate<4>(out.neg ? -x : x, 200, 8, max_sig, max_frac, out);
+}
+
+FORCE_INLINE void shortest_decimal(const f128& x, fltx_decimal& out, int max_sig = 0, int max_frac = INT_MAX)
+{
+    out.neg = (x.hi < 0.0);
+    out.count = 0;
+    out.exp10 = 0;
+    if (x.hi == 0.0 || !std::isfinite(x.hi)) return;
+    const f256 ax = out.neg ? f256(-x.hi, -x.lo, 0.0, 0.0) : f256(x.hi, x.lo, 0.0, 0.0);
+    shortest_detail::generate<2>(ax, 106, 16, max_sig, max_frac, out);
+}
+
+FORCE_INLINE void shortest_decimal(double x, fltx_decimal& out, int max_sig = 0, int max_frac = INT_MAX)
+{
+    out.neg = std::signbit(x);
+    out.count = 0;
+    out.exp10 = 0;
+    if (x == 0.0 || !std::isfinite(x)) return;
+    shortest_detail::generate<2>(f256(std::fabs(x)), 53, 16, max_sig, max_frac, out);
+}
+
+/// ======== Layout ========
+
+// Writes d in fixed or scientific notation (neither: whichever is shorter, fixed on ties).
+// Zero is written as "0", never "-0".
+FORCE_INLINE f128_chars_result decimal_to_chars(char* first, char* last, const fltx_decimal& d,
+    bool fixed = false, bool scientific = false) noexcept
+{
+    if (d.count == 0)
+    {
+        if (first >= last) return { first, false };
+        *first = '0';
+        return { first + 1, true };
+    }
+
+    const int n = d.count, e = d.exp10;
+    const int sign = d.neg ? 1 : 0;
+
+    const int exp_digits = (e <= -100 || e >= 100) ? 3 : 2;
+    const int sci_len = sign + n + (n > 1 ? 1 : 0) + 2 + exp_digits;
+    const int fixed_len = sign + ((e >= 0)
+        ? ((n > e + 1) ? n + 1 : e + 1)
+        : 2 + (-e - 1) + n);
+
+    bool use_sci = scientific && !fixed;
+    if (!fixed && !scientific) use_sci = sci_len < fixed_len;
+
+    char* p = first;
+    if ((size_t)(last - first) < (size_t)(use_sci ? sci_len : fixed_len)) return { first, false };
+
+    if (d.neg) *p++ = '-';
+
+    if (use_sci)
+    {
+        *p++ = d.digits[0];
+        if (n > 1)
+        {
+            *p++ = '.';
+            std::memcpy(p, d.digits + 1, (size_t)(n - 1));
+            p += n - 1;
+        }
+        return append_exp10_to_chars(p, last, e);
+    }
+
+    if (e >= 0)
+    {
+        const int int_digits = e + 1;
+        if (n > int_digits)
+        {
+            std::memcpy(p, d.digits, (size_t)int_digits);
+            p += int_digits;
+            *p++ = '.';
+            std::memcpy(p, d.digits + int_digits, (size_t)(n - int_digits));
+            p += n - int_digits;
+        }
+        else
+        {
+            std::memcpy(p, d.digits, (size_t)n);
+            p += n;
+            std::memset(p, '0', (size_t)(int_digits - n));
+            p += int_digits - n;
+        }
+    }
+    else
+    {
+        *p++ = '0';
+        *p++ = '.';
+        std::memset(p, '0', (size_t)(-e - 1));
+        p += -e - 1;
+        std::memcpy(p, d.digits, (size_t)n);
+        p += n;
+    }
+    return { p, true };
+}
+
+/// ======== to_chars_shortest ========
+
+// Shortest round-trip text for x into [first, last), no allocation. With neither flag set the
+// shorter of fixed/scientific is used (like std::to_chars without a format).
+FORCE_INLINE f128_chars_result to_chars_shortest(char* first, char* last, const f128& x,
+    bool fixed = false, bool scientific = false) noexcept
+{
+    char* p = first;
+    if (shortest_detail::emit_special(x.hi, p, last)) return { p, p != first };
+
+    fltx_decimal d;
+    shortest_decimal(x, d);
+    return decimal_to_chars(first, last, d, fixed, scientific);
+}
+
+FORCE_INLINE f128_chars_result to_chars_shortest(char* first, char* last, const f256& x,
+    bool fixed = false, bool scientific = false) noexcept
+{
+    char* p = first;
+    if (shortest_detail::emit_special(x.x0, p, last)) return { p, p != first };
+
+    fltx_decimal d;
+    shortest_decimal(x, d);
+    return decimal_to_chars(first, last, d, fixed, scientific);
+}
+
+} // end bl
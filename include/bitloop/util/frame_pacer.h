@@ -0,0 +1,164 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+#include "timer.h"
+
+namespace bl {
+
+// What to do with deadlines that have already passed when a frame finishes late
+enum struct FrameOverrunPolicy
+{
+    SKIP,     // drop the missed slots, stay phase-locked to the original cadence
+    CATCH_UP  // keep every slot, run late frames back-to-back (up to max_catch_up frames behind)
+};
+
+// Paces a loop against absolute deadlines (t0 + n * period), so late frames don't push every
+// following frame back. The wait sleeps until shortly before the deadline and spins the rest,
+// with the spin margin tracking how much the OS oversleeps.
+class FramePacer
+{
+public:
+
+    using clock      = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+    using duration   = clock::duration;
+
+private:
+
+    duration period = std::chrono::nanoseconds(1000000000 / 60);
+    FrameOverrunPolicy policy = FrameOverrunPolicy::SKIP;
+    int max_catch_up = 3;
+
+    time_point deadline{};
+    time_point last_release{};
+    bool started = false;
+
+    // sleep slack, adapted to observed oversleep
+    duration spin_margin = std::chrono::microseconds(1000);
+    static constexpr duration min_spin_margin = std::chrono::microseconds(200);
+    static constexpr duration max_spin_margin = std::chrono::microseconds(4000);
+
+    uint64_t overruns = 0;
+    uint64_t skipped = 0;
+
+    FPSTimer fps_timer{ 30 };
+    double last_interval_ms = 0;
+
+public:
+
+    FramePacer() = default;
+    FramePacer(double fps, FrameOverrunPolicy overrun_policy = FrameOverrunPolicy::SKIP)
+    {
+        setTargetFPS(fps);
+        setOverrunPolicy(overrun_policy);
+    }
+
+    void setTargetFPS(double fps)
+    {
+        const auto new_period = std::chrono::duration_cast<duration>(
+            std::chrono::duration<double>(1.0 / std::max(fps, 1.0)));
+
+        if (new_period != period)
+        {
+            period = new_period;
+            started = false; // re-anchor on the next frame
+        }
+    }
+
+    void setOverrunPolicy(FrameOverrunPolicy p) { policy = p; }
+    void setMaxCatchUp(int frames)              { max_catch_up = std::max(frames, 0); }
+
+    // forget the cadence, e.g. after a pause or an unpaced (immediate) frame
+    void reset() { started = false; }
+
+    [[nodiscard]] duration           framePeriod() const    { return period; }
+    [[nodiscard]] FrameOverrunPolicy overrunPolicy() const  { return policy; }
+    [[nodiscard]] uint64_t           overrunCount() const   { return overruns; }
+    [[nodiscard]] uint64_t           skippedFrames() const  { return skipped; }
+    [[nodiscard]] const FPSTimer&    timer() const          { return fps_timer; }
+    [[nodiscard]] double             lastIntervalMs() const { return last_interval_ms; } // 0 before the second release
+
+    // Advance to the deadline of the frame that just finished at 'now'. Pure scheduling, no waiting.
+    time_point schedule(time_point now)
+    {
+        if (!started)
+        {
+            started = true;
+            deadline = now + period;
+            return deadline;
+        }
+
+        deadline += period;
+        if (now <= deadline)
+            return deadline;
+
+        // overrun (never a negative delay)
+        ++overruns;
+        const auto behind = (now - deadline) / period; // whole slots already missed
+
+        if (policy == FrameOverrunPolicy::SKIP)
+        {
+            skipped += static_cast<uint64_t>(behind) + 1;
+            deadline += period * (behind + 1);
+        }
+        else if (behind >= max_catch_up)
+        {
+            // too far behind to catch up, re-anchor on now
+            skipped += static_cast<uint64_t>(behind);
+            deadline = now;
+        }
+        return deadline;
+    }
+
+    // Block until the next frame's deadline and record the frame interval
+    void wait()
+    {
+        const time_point target = schedule(clock::now());
+        sleepUntil(target);
+        release();
+    }
+
+    // Record a frame released without waiting (keeps interval stats honest)
+    void release()
+    {
+        const time_point now = clock::now();
+        if (last_release != time_point{})
+        {
+            last_interval_ms = std::chrono::duration<double, std::milli>(now - last_release).count();
+            fps_timer.push(last_interval_ms);
+        }
+        last_release = now;
+    }
+
+private:
+
+    void sleepUntil(time_point target)
+    {
+        time_point now = clock::now();
+        if (now >= target)
+            return;
+
+        // coarse sleep, leaving spin_margin for the tail
+        if (target - now > spin_margin)
+        {
+            const time_point wake_target = target - spin_margin;
+            std::this_thread::sleep_until(wake_target);
+            now = clock::now();
+
+            // adapt the margin to how late the OS woke us (EMA, slightly padded)
+            const duration oversleep = std::max(now - wake_target, duration::zero());
+            const duration wanted = oversleep + oversleep / 2;
+            spin_margin += (wanted - spin_margin) / 8;
+            spin_margin = std::clamp(spin_margin, min_spin_margin, max_spin_margin);
+        }
+
+        // precise tail
+        while (clock::now() < target)
+            std::this_thread::yield();
+    }
+};
+
+}
@@ -31,10 +31,16 @@
 #define BL_SIMD_SCALAR 1
 #endif
 
+// AVX-512F on top of AVX2 (only used by the 512-bit types in simd_wide.h)
+#if defined(BL_SIMD_AVX2) && defined(__AVX512F__)
+#define BL_SIMD_AVX512 1
+#endif
+
 #if BL_SIMD_FORCE_SCALAR
 #undef BL_SIMD_SSE2
 #undef BL_SIMD_AVX
 #undef BL_SIMD_AVX2
+#undef BL_SIMD_AVX512
 #define BL_SIMD_SCALAR 1
 //BL_MESSAGE("SIMD: Forcing scalar mode")
 #endif
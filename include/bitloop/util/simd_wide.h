@@ -0,0 +1,813 @@
+#pragma once
+#include <cstdint>
+#include <cmath>
+#include <type_traits>
+
+#ifndef BL_BEGIN_NS
+#define BL_BEGIN_NS namespace bl {
+#define BL_END_NS   }
+#endif
+#ifndef FORCE_INLINE
+#if defined(_MSC_VER)
+#define FORCE_INLINE __forceinline
+#else
+#define FORCE_INLINE inline __attribute__((always_inline))
+#endif
+#endif
+
+#include "simd.h"
+
+/// ======== Wide SIMD vectors ========
+//
+// Fixed-width packed float/double vectors for writing portable vectorised kernels (escape-time,
+// particles, ...), on top of the backend simd.h selects at compile time:
+//
+//   simd::v4d  - 4 x double  (AVX: __m256d,  SSE2/NEON/WASM: 2 x 128-bit,  else scalar)
+//   simd::v8f  - 8 x float   (AVX: __m256,   SSE2/NEON/WASM: 2 x 128-bit,  else scalar)
+//   simd::v8d  - 8 x double  (AVX-512: __m512d, otherwise 2 x v4d)
+//
+// each with a matching mask type (m4d, m8f, m8d) from comparisons. Semantics are the same on every
+// backend:
+//   - min(a, b) = a < b ? a : b,  max(a, b) = a > b ? a : b  (x86 NaN behaviour)
+//   - fma() is fused where the ISA has it (FMA3, AVX-512, NEON), a*b + c otherwise
+//   - hsum/hmin/hmax reduce as a halving tree (lane i with lane i + N/2), so results don't
+//     depend on the backend
+//   - cmul() treats lanes as interleaved complex numbers (re0, im0, re1, im1, ...)
+//
+// Lane counts are fixed per type, so simd::native_lanes<T> gives the widest width that maps to
+// single registers on the active backend (for picking batch sizes).
+
+BL_BEGIN_NS;
+
+namespace simd {
+
+namespace detail {
+
+    // ---- scalar (any lane count) ----
+    template<class Type, int N> struct scalar_lanes
+    {
+        using T = Type;
+        static constexpr int lanes = N;
+        struct R { T v[N]; };
+        struct K { bool v[N]; };
+
+        #define BL_WIDE_LANES(expr)  R r; for (int i = 0; i < N; i++) r.v[i] = (expr); return r
+        #define BL_WIDE_KLANES(expr) K r; for (int i = 0; i < N; i++) r.v[i] = (expr); return r
+
+        static FORCE_INLINE R set1(T x)                           { BL_WIDE_LANES(x); }
+        static FORCE_INLINE R load(const T* p)                    { BL_WIDE_LANES(p[i]); }
+        static FORCE_INLINE void store(T* p, R a)                 { for (int i = 0; i < N; i++) p[i] = a.v[i]; }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { BL_WIDE_LANES(b[idx[i]]); }
+
+        static FORCE_INLINE R add(R a, R b)                       { BL_WIDE_LANES(a.v[i] + b.v[i]); }
+        static FORCE_INLINE R sub(R a, R b)                       { BL_WIDE_LANES(a.v[i] - b.v[i]); }
+        static FORCE_INLINE R mul(R a, R b)                       { BL_WIDE_LANES(a.v[i] * b.v[i]); }
+        static FORCE_INLINE R div(R a, R b)                       { BL_WIDE_LANES(a.v[i] / b.v[i]); }
+        static FORCE_INLINE R sqrt(R a)                           { BL_WIDE_LANES(std::sqrt(a.v[i])); }
+        static FORCE_INLINE R min(R a, R b)                       { BL_WIDE_LANES(a.v[i] < b.v[i] ? a.v[i] : b.v[i]); }
+        static FORCE_INLINE R max(R a, R b)                       { BL_WIDE_LANES(a.v[i] > b.v[i] ? a.v[i] : b.v[i]); }
+        static FORCE_INLINE R neg(R a)                            { BL_WIDE_LANES(-a.v[i]); }
+        static FORCE_INLINE R abs(R a)                            { BL_WIDE_LANES(std::fabs(a.v[i])); }
+        static FORCE_INLINE R fma(R a, R b, R c)                  { BL_WIDE_LANES(std::fma(a.v[i], b.v[i], c.v[i])); }
+
+        static FORCE_INLINE K lt(R a, R b)                        { BL_WIDE_KLANES(a.v[i] <  b.v[i]); }
+        static FORCE_INLINE K le(R a, R b)                        { BL_WIDE_KLANES(a.v[i] <= b.v[i]); }
+        static FORCE_INLINE K eq(R a, R b)                        { BL_WIDE_KLANES(a.v[i] == b.v[i]); }
+        static FORCE_INLINE K ne(R a, R b)                        { BL_WIDE_KLANES(a.v[i] != b.v[i]); }
+        static FORCE_INLINE K mand(K a, K b)                      { BL_WIDE_KLANES(a.v[i] && b.v[i]); }
+        static FORCE_INLINE K mor(K a, K b)                       { BL_WIDE_KLANES(a.v[i] || b.v[i]); }
+        static FORCE_INLINE K mnot(K a)                           { BL_WIDE_KLANES(!a.v[i]); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { BL_WIDE_LANES(m.v[i] ? a.v[i] : b.v[i]); }
+        static FORCE_INLINE int bits(K m)                         { int r = 0; for (int i = 0; i < N; i++) r |= int(m.v[i]) << i; return r; }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { BL_WIDE_LANES(a.v[i ^ 1]); }
+        static FORCE_INLINE R dup_even(R a)                       { BL_WIDE_LANES(a.v[i & ~1]); }
+        static FORCE_INLINE R dup_odd(R a)                        { BL_WIDE_LANES(a.v[i | 1]); }
+
+        static FORCE_INLINE T hsum(R a)
+        {
+            for (int w = N / 2; w >= 1; w /= 2)
+                for (int i = 0; i < w; i++) a.v[i] = a.v[i] + a.v[i + w];
+            return a.v[0];
+        }
+        static FORCE_INLINE T hmin(R a)
+        {
+            for (int w = N / 2; w >= 1; w /= 2)
+                for (int i = 0; i < w; i++) a.v[i] = a.v[i] < a.v[i + w] ? a.v[i] : a.v[i + w];
+            return a.v[0];
+        }
+        static FORCE_INLINE T hmax(R a)
+        {
+            for (int w = N / 2; w >= 1; w /= 2)
+                for (int i = 0; i < w; i++) a.v[i] = a.v[i] > a.v[i + w] ? a.v[i] : a.v[i + w];
+            return a.v[0];
+        }
+
+        #undef BL_WIDE_LANES
+        #undef BL_WIDE_KLANES
+    };
+
+    // ---- two halves acting as one wider vector ----
+    template<class H> struct lanes_pair
+    {
+        using T = typename H::T;
+        static constexpr int lanes = H::lanes * 2;
+        struct R { typename H::R a, b; };
+        struct K { typename H::K a, b; };
+
+        static FORCE_INLINE R set1(T x)                           { return { H::set1(x), H::set1(x) }; }
+        static FORCE_INLINE R load(const T* p)                    { return { H::load(p), H::load(p + H::lanes) }; }
+        static FORCE_INLINE void store(T* p, R x)                 { H::store(p, x.a); H::store(p + H::lanes, x.b); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { return { H::gather(b, idx), H::gather(b, idx + H::lanes) }; }
+
+        static FORCE_INLINE R add(R x, R y)                       { return { H::add(x.a, y.a), H::add(x.b, y.b) }; }
+        static FORCE_INLINE R sub(R x, R y)                       { return { H::sub(x.a, y.a), H::sub(x.b, y.b) }; }
+        static FORCE_INLINE R mul(R x, R y)                       { return { H::mul(x.a, y.a), H::mul(x.b, y.b) }; }
+        static FORCE_INLINE R div(R x, R y)                       { return { H::div(x.a, y.a), H::div(x.b, y.b) }; }
+        static FORCE_INLINE R sqrt(R x)                           { return { H::sqrt(x.a), H::sqrt(x.b) }; }
+        static FORCE_INLINE R min(R x, R y)                       { return { H::min(x.a, y.a), H::min(x.b, y.b) }; }
+        static FORCE_INLINE R max(R x, R y)                       { return { H::max(x.a, y.a), H::max(x.b, y.b) }; }
+        static FORCE_INLINE R neg(R x)                            { return { H::neg(x.a), H::neg(x.b) }; }
+        static FORCE_INLINE R abs(R x)                            { return { H::abs(x.a), H::abs(x.b) }; }
+        static FORCE_INLINE R fma(R x, R y, R z)                  { return { H::fma(x.a, y.a, z.a), H::fma(x.b, y.b, z.b) }; }
+
+        static FORCE_INLINE K lt(R x, R y)                        { return { H::lt(x.a, y.a), H::lt(x.b, y.b) }; }
+        static FORCE_INLINE K le(R x, R y)                        { return { H::le(x.a, y.a), H::le(x.b, y.b) }; }
+        static FORCE_INLINE K eq(R x, R y)                        { return { H::eq(x.a, y.a), H::eq(x.b, y.b) }; }
+        static FORCE_INLINE K ne(R x, R y)                        { return { H::ne(x.a, y.a), H::ne(x.b, y.b) }; }
+        static FORCE_INLINE K mand(K x, K y)                      { return { H::mand(x.a, y.a), H::mand(x.b, y.b) }; }
+        static FORCE_INLINE K mor(K x, K y)                       { return { H::mor(x.a, y.a), H::mor(x.b, y.b) }; }
+        static FORCE_INLINE K mnot(K x)                           { return { H::mnot(x.a), H::mnot(x.b) }; }
+        static FORCE_INLINE R blend(K m, R x, R y)                { return { H::blend(m.a, x.a, y.a), H::blend(m.b, x.b, y.b) }; }
+        static FORCE_INLINE int bits(K m)                         { return H::bits(m.a) | (H::bits(m.b) << H::lanes); }
+
+        static FORCE_INLINE R swap_pairs(R x)                     { return { H::swap_pairs(x.a), H::swap_pairs(x.b) }; }
+        static FORCE_INLINE R dup_even(R x)                       { return { H::dup_even(x.a), H::dup_even(x.b) }; }
+        static FORCE_INLINE R dup_odd(R x)                        { return { H::dup_odd(x.a), H::dup_odd(x.b) }; }
+
+        static FORCE_INLINE T hsum(R x)                           { return H::hsum(H::add(x.a, x.b)); }
+        static FORCE_INLINE T hmin(R x)                           { return H::hmin(H::min(x.a, x.b)); }
+        static FORCE_INLINE T hmax(R x)                           { return H::hmax(H::max(x.a, x.b)); }
+    };
+
+    #if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+    #define BL_WIDE_FMA 1
+    #endif
+
+    // ---- SSE2+ ----
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX) || defined(BL_SIMD_SSE2)
+    struct sse_d2
+    {
+        using T = double;
+        static constexpr int lanes = 2;
+        using R = __m128d;
+        using K = __m128d;
+
+        static FORCE_INLINE R set1(T x)                           { return _mm_set1_pd(x); }
+        static FORCE_INLINE R load(const T* p)                    { return _mm_loadu_pd(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { _mm_storeu_pd(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { return _mm_set_pd(b[idx[1]], b[idx[0]]); }
+
+        static FORCE_INLINE R add(R a, R b)                       { return _mm_add_pd(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return _mm_sub_pd(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return _mm_mul_pd(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return _mm_div_pd(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return _mm_sqrt_pd(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return _mm_min_pd(a, b); }
+        static FORCE_INLINE R max(R a, R b)                       { return _mm_max_pd(a, b); }
+        static FORCE_INLINE R neg(R a)                            { return _mm_xor_pd(a, _mm_set1_pd(-0.0)); }
+        static FORCE_INLINE R abs(R a)                            { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+        static FORCE_INLINE R fma(R a, R b, R c)
+        {
+            #ifdef BL_WIDE_FMA
+            return _mm_fmadd_pd(a, b, c);
+            #else
+            return _mm_add_pd(_mm_mul_pd(a, b), c);
+            #endif
+        }
+
+        static FORCE_INLINE K lt(R a, R b)                        { return _mm_cmplt_pd(a, b); }
+        static FORCE_INLINE K le(R a, R b)                        { return _mm_cmple_pd(a, b); }
+        static FORCE_INLINE K eq(R a, R b)                        { return _mm_cmpeq_pd(a, b); }
+        static FORCE_INLINE K ne(R a, R b)                        { return _mm_cmpneq_pd(a, b); }
+        static FORCE_INLINE K mand(K a, K b)                      { return _mm_and_pd(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return _mm_or_pd(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return _mm_xor_pd(a, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+        static FORCE_INLINE int bits(K m)                         { return _mm_movemask_pd(m); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return _mm_shuffle_pd(a, a, 1); }
+        static FORCE_INLINE R dup_even(R a)                       { return _mm_unpacklo_pd(a, a); }
+        static FORCE_INLINE R dup_odd(R a)                        { return _mm_unpackhi_pd(a, a); }
+
+        static FORCE_INLINE T hsum(R a)                           { return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a))); }
+        static FORCE_INLINE T hmin(R a)                           { return _mm_cvtsd_f64(_mm_min_sd(a, _mm_unpackhi_pd(a, a))); }
+        static FORCE_INLINE T hmax(R a)                           { return _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a))); }
+    };
+
+    struct sse_f4
+    {
+        using T = float;
+        static constexpr int lanes = 4;
+        using R = __m128;
+        using K = __m128;
+
+        static FORCE_INLINE R set1(T x)                           { return _mm_set1_ps(x); }
+        static FORCE_INLINE R load(const T* p)                    { return _mm_loadu_ps(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { _mm_storeu_ps(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { return _mm_set_ps(b[idx[3]], b[idx[2]], b[idx[1]], b[idx[0]]); }
+
+        static FORCE_INLINE R add(R a, R b)                       { return _mm_add_ps(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return _mm_sub_ps(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return _mm_mul_ps(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return _mm_div_ps(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return _mm_sqrt_ps(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return _mm_min_ps(a, b); }
+        static FORCE_INLINE R max(R a, R b)                       { return _mm_max_ps(a, b); }
+        static FORCE_INLINE R neg(R a)                            { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+        static FORCE_INLINE R abs(R a)                            { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+        static FORCE_INLINE R fma(R a, R b, R c)
+        {
+            #ifdef BL_WIDE_FMA
+            return _mm_fmadd_ps(a, b, c);
+            #else
+            return _mm_add_ps(_mm_mul_ps(a, b), c);
+            #endif
+        }
+
+        static FORCE_INLINE K lt(R a, R b)                        { return _mm_cmplt_ps(a, b); }
+        static FORCE_INLINE K le(R a, R b)                        { return _mm_cmple_ps(a, b); }
+        static FORCE_INLINE K eq(R a, R b)                        { return _mm_cmpeq_ps(a, b); }
+        static FORCE_INLINE K ne(R a, R b)                        { return _mm_cmpneq_ps(a, b); }
+        static FORCE_INLINE K mand(K a, K b)                      { return _mm_and_ps(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return _mm_or_ps(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+        static FORCE_INLINE int bits(K m)                         { return _mm_movemask_ps(m); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+        static FORCE_INLINE R dup_even(R a)                       { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0)); }
+        static FORCE_INLINE R dup_odd(R a)                        { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1)); }
+
+        // (a0 op a2, a1 op a3), then lane 0 op lane 1
+        static FORCE_INLINE T hsum(R a)
+        {
+            const R t = _mm_add_ps(a, _mm_movehl_ps(a, a));
+            return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 1)));
+        }
+        static FORCE_INLINE T hmin(R a)
+        {
+            const R t = _mm_min_ps(a, _mm_movehl_ps(a, a));
+            return _mm_cvtss_f32(_mm_min_ss(t, _mm_shuffle_ps(t, t, 1)));
+        }
+        static FORCE_INLINE T hmax(R a)
+        {
+            const R t = _mm_max_ps(a, _mm_movehl_ps(a, a));
+            return _mm_cvtss_f32(_mm_max_ss(t, _mm_shuffle_ps(t, t, 1)));
+        }
+    };
+    #endif
+
+    // ---- AVX / AVX2 ----
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX)
+    struct avx_d4
+    {
+        using T = double;
+        static constexpr int lanes = 4;
+        using R = __m256d;
+        using K = __m256d;
+
+        static FORCE_INLINE R set1(T x)                           { return _mm256_set1_pd(x); }
+        static FORCE_INLINE R load(const T* p)                    { return _mm256_loadu_pd(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { _mm256_storeu_pd(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx)
+        {
+            #if defined(BL_SIMD_AVX2)
+            return _mm256_i32gather_pd(b, _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx)), 8);
+            #else
+            return _mm256_set_pd(b[idx[3]], b[idx[2]], b[idx[1]], b[idx[0]]);
+            #endif
+        }
+
+        static FORCE_INLINE R add(R a, R b)                       { return _mm256_add_pd(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return _mm256_sub_pd(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return _mm256_mul_pd(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return _mm256_div_pd(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return _mm256_sqrt_pd(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return _mm256_min_pd(a, b); }
+        static FORCE_INLINE R max(R a, R b)                       { return _mm256_max_pd(a, b); }
+        static FORCE_INLINE R neg(R a)                            { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+        static FORCE_INLINE R abs(R a)                            { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+        static FORCE_INLINE R fma(R a, R b, R c)
+        {
+            #ifdef BL_WIDE_FMA
+            return _mm256_fmadd_pd(a, b, c);
+            #else
+            return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+            #endif
+        }
+
+        static FORCE_INLINE K lt(R a, R b)                        { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        static FORCE_INLINE K le(R a, R b)                        { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+        static FORCE_INLINE K eq(R a, R b)                        { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+        static FORCE_INLINE K ne(R a, R b)                        { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+        static FORCE_INLINE K mand(K a, K b)                      { return _mm256_and_pd(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return _mm256_or_pd(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return _mm256_blendv_pd(b, a, m); }
+        static FORCE_INLINE int bits(K m)                         { return _mm256_movemask_pd(m); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return _mm256_permute_pd(a, 0x5); }
+        static FORCE_INLINE R dup_even(R a)                       { return _mm256_movedup_pd(a); }
+        static FORCE_INLINE R dup_odd(R a)                        { return _mm256_permute_pd(a, 0xf); }
+
+        static FORCE_INLINE T hsum(R a)                           { return sse_d2::hsum(_mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1))); }
+        static FORCE_INLINE T hmin(R a)                           { return sse_d2::hmin(_mm_min_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1))); }
+        static FORCE_INLINE T hmax(R a)                           { return sse_d2::hmax(_mm_max_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1))); }
+    };
+
+    struct avx_f8
+    {
+        using T = float;
+        static constexpr int lanes = 8;
+        using R = __m256;
+        using K = __m256;
+
+        static FORCE_INLINE R set1(T x)                           { return _mm256_set1_ps(x); }
+        static FORCE_INLINE R load(const T* p)                    { return _mm256_loadu_ps(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { _mm256_storeu_ps(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx)
+        {
+            #if defined(BL_SIMD_AVX2)
+            return _mm256_i32gather_ps(b, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx)), 4);
+            #else
+            return _mm256_set_ps(b[idx[7]], b[idx[6]], b[idx[5]], b[idx[4]], b[idx[3]], b[idx[2]], b[idx[1]], b[idx[0]]);
+            #endif
+        }
+
+        static FORCE_INLINE R add(R a, R b)                       { return _mm256_add_ps(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return _mm256_sub_ps(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return _mm256_mul_ps(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return _mm256_div_ps(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return _mm256_sqrt_ps(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return _mm256_min_ps(a, b); }
+        static FORCE_INLINE R max(R a, R b)                       { return _mm256_max_ps(a, b); }
+        static FORCE_INLINE R neg(R a)                            { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+        static FORCE_INLINE R abs(R a)                            { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+        static FORCE_INLINE R fma(R a, R b, R c)
+        {
+            #ifdef BL_WIDE_FMA
+            return _mm256_fmadd_ps(a, b, c);
+            #else
+            return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+            #endif
+        }
+
+        static FORCE_INLINE K lt(R a, R b)                        { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        static FORCE_INLINE K le(R a, R b)                        { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+        static FORCE_INLINE K eq(R a, R b)                        { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+        static FORCE_INLINE K ne(R a, R b)                        { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+        static FORCE_INLINE K mand(K a, K b)                      { return _mm256_and_ps(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return _mm256_or_ps(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return _mm256_blendv_ps(b, a, m); }
+        static FORCE_INLINE int bits(K m)                         { return _mm256_movemask_ps(m); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)); }
+        static FORCE_INLINE R dup_even(R a)                       { return _mm256_moveldup_ps(a); }
+        static FORCE_INLINE R dup_odd(R a)                        { return _mm256_movehdup_ps(a); }
+
+        static FORCE_INLINE T hsum(R a)                           { return sse_f4::hsum(_mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1))); }
+        static FORCE_INLINE T hmin(R a)                           { return sse_f4::hmin(_mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1))); }
+        static FORCE_INLINE T hmax(R a)                           { return sse_f4::hmax(_mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1))); }
+    };
+    #endif
+
+    // ---- AVX-512F ----
+    #if defined(BL_SIMD_AVX512)
+    struct avx512_d8
+    {
+        using T = double;
+        static constexpr int lanes = 8;
+        using R = __m512d;
+        using K = __mmask8;
+
+        static FORCE_INLINE R set1(T x)                           { return _mm512_set1_pd(x); }
+        static FORCE_INLINE R load(const T* p)                    { return _mm512_loadu_pd(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { _mm512_storeu_pd(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx)
+        {
+            return _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx)), b, 8);
+        }
+
+        static FORCE_INLINE R add(R a, R b)                       { return _mm512_add_pd(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return _mm512_sub_pd(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return _mm512_mul_pd(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return _mm512_div_pd(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return _mm512_sqrt_pd(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return _mm512_min_pd(a, b); }
+        static FORCE_INLINE R max(R a, R b)                       { return _mm512_max_pd(a, b); }
+        static FORCE_INLINE R abs(R a)                            { return _mm512_abs_pd(a); }
+        static FORCE_INLINE R neg(R a)
+        {
+            // _mm512_xor_pd needs AVX-512DQ, flip the sign bit as integers instead
+            return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(INT64_MIN)));
+        }
+        static FORCE_INLINE R fma(R a, R b, R c)                  { return _mm512_fmadd_pd(a, b, c); }
+
+        static FORCE_INLINE K lt(R a, R b)                        { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+        static FORCE_INLINE K le(R a, R b)                        { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+        static FORCE_INLINE K eq(R a, R b)                        { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+        static FORCE_INLINE K ne(R a, R b)                        { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+        static FORCE_INLINE K mand(K a, K b)                      { return K(a & b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return K(a | b); }
+        static FORCE_INLINE K mnot(K a)                           { return K(~a); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return _mm512_mask_blend_pd(m, b, a); }
+        static FORCE_INLINE int bits(K m)                         { return int(m); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return _mm512_permute_pd(a, 0x55); }
+        static FORCE_INLINE R dup_even(R a)                       { return _mm512_movedup_pd(a); }
+        static FORCE_INLINE R dup_odd(R a)                        { return _mm512_permute_pd(a, 0xff); }
+
+        static FORCE_INLINE T hsum(R a)                           { return avx_d4::hsum(_mm256_add_pd(_mm512_castpd512_pd256(a), _mm512_extractf64x4_pd(a, 1))); }
+        static FORCE_INLINE T hmin(R a)                           { return avx_d4::hmin(_mm256_min_pd(_mm512_castpd512_pd256(a), _mm512_extractf64x4_pd(a, 1))); }
+        static FORCE_INLINE T hmax(R a)                           { return avx_d4::hmax(_mm256_max_pd(_mm512_castpd512_pd256(a), _mm512_extractf64x4_pd(a, 1))); }
+    };
+    #endif
+
+    // ---- NEON (AArch64) ----
+    #if defined(BL_SIMD_NEON) && defined(__aarch64__)
+    struct neon_d2
+    {
+        using T = double;
+        static constexpr int lanes = 2;
+        using R = float64x2_t;
+        using K = uint64x2_t;
+
+        static FORCE_INLINE R set1(T x)                           { return vdupq_n_f64(x); }
+        static FORCE_INLINE R load(const T* p)                    { return vld1q_f64(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { vst1q_f64(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { const T t[2] = { b[idx[0]], b[idx[1]] }; return vld1q_f64(t); }
+
+        static FORCE_INLINE R add(R a, R b)                       { return vaddq_f64(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return vsubq_f64(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return vmulq_f64(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return vdivq_f64(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return vsqrtq_f64(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return vbslq_f64(vcltq_f64(a, b), a, b); } // not vminq (NaN rules differ)
+        static FORCE_INLINE R max(R a, R b)                       { return vbslq_f64(vcgtq_f64(a, b), a, b); }
+        static FORCE_INLINE R neg(R a)                            { return vnegq_f64(a); }
+        static FORCE_INLINE R abs(R a)                            { return vabsq_f64(a); }
+        static FORCE_INLINE R fma(R a, R b, R c)                  { return vfmaq_f64(c, a, b); }
+
+        static FORCE_INLINE K lt(R a, R b)                        { return vcltq_f64(a, b); }
+        static FORCE_INLINE K le(R a, R b)                        { return vcleq_f64(a, b); }
+        static FORCE_INLINE K eq(R a, R b)                        { return vceqq_f64(a, b); }
+        static FORCE_INLINE K ne(R a, R b)                        { return mnot(vceqq_f64(a, b)); }
+        static FORCE_INLINE K mand(K a, K b)                      { return vandq_u64(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return vorrq_u64(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return veorq_u64(a, vdupq_n_u64(~0ull)); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return vbslq_f64(m, a, b); }
+        static FORCE_INLINE int bits(K m)                         { return int(vgetq_lane_u64(m, 0) & 1) | int((vgetq_lane_u64(m, 1) & 1) << 1); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return vextq_f64(a, a, 1); }
+        static FORCE_INLINE R dup_even(R a)                       { return vdupq_laneq_f64(a, 0); }
+        static FORCE_INLINE R dup_odd(R a)                        { return vdupq_laneq_f64(a, 1); }
+
+        static FORCE_INLINE T hsum(R a)                           { return vgetq_lane_f64(a, 0) + vgetq_lane_f64(a, 1); }
+        static FORCE_INLINE T hmin(R a)                           { const T x = vgetq_lane_f64(a, 0), y = vgetq_lane_f64(a, 1); return x < y ? x : y; }
+        static FORCE_INLINE T hmax(R a)                           { const T x = vgetq_lane_f64(a, 0), y = vgetq_lane_f64(a, 1); return x > y ? x : y; }
+    };
+
+    struct neon_f4
+    {
+        using T = float;
+        static constexpr int lanes = 4;
+        using R = float32x4_t;
+        using K = uint32x4_t;
+
+        static FORCE_INLINE R set1(T x)                           { return vdupq_n_f32(x); }
+        static FORCE_INLINE R load(const T* p)                    { return vld1q_f32(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { vst1q_f32(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { const T t[4] = { b[idx[0]], b[idx[1]], b[idx[2]], b[idx[3]] }; return vld1q_f32(t); }
+
+        static FORCE_INLINE R add(R a, R b)                       { return vaddq_f32(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return vsubq_f32(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return vmulq_f32(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return vdivq_f32(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return vsqrtq_f32(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return vbslq_f32(vcltq_f32(a, b), a, b); }
+        static FORCE_INLINE R max(R a, R b)                       { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+        static FORCE_INLINE R neg(R a)                            { return vnegq_f32(a); }
+        static FORCE_INLINE R abs(R a)                            { return vabsq_f32(a); }
+        static FORCE_INLINE R fma(R a, R b, R c)                  { return vfmaq_f32(c, a, b); }
+
+        static FORCE_INLINE K lt(R a, R b)                        { return vcltq_f32(a, b); }
+        static FORCE_INLINE K le(R a, R b)                        { return vcleq_f32(a, b); }
+        static FORCE_INLINE K eq(R a, R b)                        { return vceqq_f32(a, b); }
+        static FORCE_INLINE K ne(R a, R b)                        { return vmvnq_u32(vceqq_f32(a, b)); }
+        static FORCE_INLINE K mand(K a, K b)                      { return vandq_u32(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return vorrq_u32(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return vmvnq_u32(a); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return vbslq_f32(m, a, b); }
+        static FORCE_INLINE int bits(K m)
+        {
+            const uint32x4_t weights = { 1, 2, 4, 8 };
+            return int(vaddvq_u32(vandq_u32(m, weights)));
+        }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return vrev64q_f32(a); }
+        static FORCE_INLINE R dup_even(R a)                       { return vtrn1q_f32(a, a); }
+        static FORCE_INLINE R dup_odd(R a)                        { return vtrn2q_f32(a, a); }
+
+        static FORCE_INLINE T hsum(R a)
+        {
+            const float32x2_t t = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+            return vget_lane_f32(t, 0) + vget_lane_f32(t, 1);
+        }
+        static FORCE_INLINE T hmin(R a)
+        {
+            const float32x2_t lo = vget_low_f32(a), hi = vget_high_f32(a);
+            const float32x2_t t = vbsl_f32(vclt_f32(lo, hi), lo, hi);
+            const T x = vget_lane_f32(t, 0), y = vget_lane_f32(t, 1);
+            return x < y ? x : y;
+        }
+        static FORCE_INLINE T hmax(R a)
+        {
+            const float32x2_t lo = vget_low_f32(a), hi = vget_high_f32(a);
+            const float32x2_t t = vbsl_f32(vcgt_f32(lo, hi), lo, hi);
+            const T x = vget_lane_f32(t, 0), y = vget_lane_f32(t, 1);
+            return x > y ? x : y;
+        }
+    };
+    #endif
+
+    // ---- WASM SIMD128 ----
+    #if defined(BL_SIMD_WASM)
+    struct wasm_d2
+    {
+        using T = double;
+        static constexpr int lanes = 2;
+        using R = v128_t;
+        using K = v128_t;
+
+        static FORCE_INLINE R set1(T x)                           { return wasm_f64x2_splat(x); }
+        static FORCE_INLINE R load(const T* p)                    { return wasm_v128_load(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { wasm_v128_store(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { return wasm_f64x2_make(b[idx[0]], b[idx[1]]); }
+
+        static FORCE_INLINE R add(R a, R b)                       { return wasm_f64x2_add(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return wasm_f64x2_sub(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return wasm_f64x2_mul(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return wasm_f64x2_div(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return wasm_f64x2_sqrt(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return wasm_v128_bitselect(a, b, wasm_f64x2_lt(a, b)); }
+        static FORCE_INLINE R max(R a, R b)                       { return wasm_v128_bitselect(a, b, wasm_f64x2_gt(a, b)); }
+        static FORCE_INLINE R neg(R a)                            { return wasm_f64x2_neg(a); }
+        static FORCE_INLINE R abs(R a)                            { return wasm_f64x2_abs(a); }
+        static FORCE_INLINE R fma(R a, R b, R c)                  { return wasm_f64x2_add(wasm_f64x2_mul(a, b), c); } // no native fma
+
+        static FORCE_INLINE K lt(R a, R b)                        { return wasm_f64x2_lt(a, b); }
+        static FORCE_INLINE K le(R a, R b)                        { return wasm_f64x2_le(a, b); }
+        static FORCE_INLINE K eq(R a, R b)                        { return wasm_f64x2_eq(a, b); }
+        static FORCE_INLINE K ne(R a, R b)                        { return wasm_f64x2_ne(a, b); }
+        static FORCE_INLINE K mand(K a, K b)                      { return wasm_v128_and(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return wasm_v128_or(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return wasm_v128_not(a); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return wasm_v128_bitselect(a, b, m); }
+        static FORCE_INLINE int bits(K m)                         { return int(wasm_i64x2_bitmask(m)); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return wasm_i64x2_shuffle(a, a, 1, 0); }
+        static FORCE_INLINE R dup_even(R a)                       { return wasm_i64x2_shuffle(a, a, 0, 0); }
+        static FORCE_INLINE R dup_odd(R a)                        { return wasm_i64x2_shuffle(a, a, 1, 1); }
+
+        static FORCE_INLINE T hsum(R a)                           { return wasm_f64x2_extract_lane(a, 0) + wasm_f64x2_extract_lane(a, 1); }
+        static FORCE_INLINE T hmin(R a)                           { const T x = wasm_f64x2_extract_lane(a, 0), y = wasm_f64x2_extract_lane(a, 1); return x < y ? x : y; }
+        static FORCE_INLINE T hmax(R a)                           { const T x = wasm_f64x2_extract_lane(a, 0), y = wasm_f64x2_extract_lane(a, 1); return x > y ? x : y; }
+    };
+
+    struct wasm_f4
+    {
+        using T = float;
+        static constexpr int lanes = 4;
+        using R = v128_t;
+        using K = v128_t;
+
+        static FORCE_INLINE R set1(T x)                           { return wasm_f32x4_splat(x); }
+        static FORCE_INLINE R load(const T* p)                    { return wasm_v128_load(p); }
+        static FORCE_INLINE void store(T* p, R a)                 { wasm_v128_store(p, a); }
+        static FORCE_INLINE R gather(const T* b, const int32_t* idx) { return wasm_f32x4_make(b[idx[0]], b[idx[1]], b[idx[2]], b[idx[3]]); }
+
+        static FORCE_INLINE R add(R a, R b)                       { return wasm_f32x4_add(a, b); }
+        static FORCE_INLINE R sub(R a, R b)                       { return wasm_f32x4_sub(a, b); }
+        static FORCE_INLINE R mul(R a, R b)                       { return wasm_f32x4_mul(a, b); }
+        static FORCE_INLINE R div(R a, R b)                       { return wasm_f32x4_div(a, b); }
+        static FORCE_INLINE R sqrt(R a)                           { return wasm_f32x4_sqrt(a); }
+        static FORCE_INLINE R min(R a, R b)                       { return wasm_v128_bitselect(a, b, wasm_f32x4_lt(a, b)); }
+        static FORCE_INLINE R max(R a, R b)                       { return wasm_v128_bitselect(a, b, wasm_f32x4_gt(a, b)); }
+        static FORCE_INLINE R neg(R a)                            { return wasm_f32x4_neg(a); }
+        static FORCE_INLINE R abs(R a)                            { return wasm_f32x4_abs(a); }
+        static FORCE_INLINE R fma(R a, R b, R c)                  { return wasm_f32x4_add(wasm_f32x4_mul(a, b), c); } // no native fma
+
+        static FORCE_INLINE K lt(R a, R b)                        { return wasm_f32x4_lt(a, b); }
+        static FORCE_INLINE K le(R a, R b)                        { return wasm_f32x4_le(a, b); }
+        static FORCE_INLINE K eq(R a, R b)                        { return wasm_f32x4_eq(a, b); }
+        static FORCE_INLINE K ne(R a, R b)                        { return wasm_f32x4_ne(a, b); }
+        static FORCE_INLINE K mand(K a, K b)                      { return wasm_v128_and(a, b); }
+        static FORCE_INLINE K mor(K a, K b)                       { return wasm_v128_or(a, b); }
+        static FORCE_INLINE K mnot(K a)                           { return wasm_v128_not(a); }
+        static FORCE_INLINE R blend(K m, R a, R b)                { return wasm_v128_bitselect(a, b, m); }
+        static FORCE_INLINE int bits(K m)                         { return int(wasm_i32x4_bitmask(m)); }
+
+        static FORCE_INLINE R swap_pairs(R a)                     { return wasm_i32x4_shuffle(a, a, 1, 0, 3, 2); }
+        static FORCE_INLINE R dup_even(R a)                       { return wasm_i32x4_shuffle(a, a, 0, 0, 2, 2); }
+        static FORCE_INLINE R dup_odd(R a)                        { return wasm_i32x4_shuffle(a, a, 1, 1, 3, 3); }
+
+        static FORCE_INLINE T hsum(R a)
+        {
+            const R t = wasm_f32x4_add(a, wasm_i32x4_shuffle(a, a, 2, 3, 0, 1));
+            return wasm_f32x4_extract_lane(t, 0) + wasm_f32x4_extract_lane(t, 1);
+        }
+        static FORCE_INLINE T hmin(R a)
+        {
+            const R t = min(a, wasm_i32x4_shuffle(a, a, 2, 3, 0, 1));
+            const T x = wasm_f32x4_extract_lane(t, 0), y = wasm_f32x4_extract_lane(t, 1);
+            return x < y ? x : y;
+        }
+        static FORCE_INLINE T hmax(R a)
+        {
+            const R t = max(a, wasm_i32x4_shuffle(a, a, 2, 3, 0, 1));
+            const T x = wasm_f32x4_extract_lane(t, 0), y = wasm_f32x4_extract_lane(t, 1);
+            return x > y ? x : y;
+        }
+    };
+    #endif
+
+    // ---- backend selection ----
+    #if defined(BL_SIMD_AVX2) || defined(BL_SIMD_AVX)
+    using backend_d4 = avx_d4;
+    using backend_f8 = avx_f8;
+    #if defined(BL_SIMD_AVX512)
+    inline constexpr int native_double_lanes = 8;
+    #else
+    inline constexpr int native_double_lanes = 4;
+    #endif
+    inline constexpr int native_float_lanes  = 8;
+    #elif defined(BL_SIMD_SSE2)
+    using backend_d4 = lanes_pair<sse_d2>;
+    using backend_f8 = lanes_pair<sse_f4>;
+    inline constexpr int native_double_lanes = 2;
+    inline constexpr int native_float_lanes  = 4;
+    #elif defined(BL_SIMD_NEON) && defined(__aarch64__)
+    using backend_d4 = lanes_pair<neon_d2>;
+    using backend_f8 = lanes_pair<neon_f4>;
+    inline constexpr int native_double_lanes = 2;
+    inline constexpr int native_float_lanes  = 4;
+    #elif defined(BL_SIMD_WASM)
+    using backend_d4 = lanes_pair<wasm_d2>;
+    using backend_f8 = lanes_pair<wasm_f4>;
+    inline constexpr int native_double_lanes = 2;
+    inline constexpr int native_float_lanes  = 4;
+    #else
+    using backend_d4 = scalar_lanes<double, 4>;
+    using backend_f8 = scalar_lanes<float, 8>;
+    inline constexpr int native_double_lanes = 1;
+    inline constexpr int native_float_lanes  = 1;
+    #endif
+
+    #if defined(BL_SIMD_AVX512)
+    using backend_d8 = avx512_d8;
+    #else
+    using backend_d8 = lanes_pair<backend_d4>;
+    #endif
+
+    #undef BL_WIDE_FMA
+}
+
+template<class B>
+struct basic_vec
+{
+    using backend = B;
+    using value_type = typename B::T;
+    static constexpr int lanes = B::lanes;
+
+    typename B::R v;
+
+    struct mask
+    {
+        typename B::K m;
+
+        [[nodiscard]] FORCE_INLINE int  bits() const { return B::bits(m); }
+        [[nodiscard]] FORCE_INLINE bool any()  const { return bits() != 0; }
+        [[nodiscard]] FORCE_INLINE bool none() const { return bits() == 0; }
+        [[nodiscard]] FORCE_INLINE bool all()  const { return bits() == (1 << lanes) - 1; }
+        [[nodiscard]] FORCE_INLINE bool operator[](int i) const { return (bits() >> i) & 1; }
+
+        // first n lanes set (e.g. a partial tail batch)
+        [[nodiscard]] static FORCE_INLINE mask firstN(int n)
+        {
+            alignas(64) value_type idx[lanes];
+            for (int i = 0; i < lanes; i++) idx[i] = value_type(i);
+            return { B::lt(B::load(idx), B::set1(value_type(n))) };
+        }
+
+        friend FORCE_INLINE mask operator&(mask a, mask b) { return { B::mand(a.m, b.m) }; }
+        friend FORCE_INLINE mask operator|(mask a, mask b) { return { B::mor(a.m, b.m) }; }
+        friend FORCE_INLINE mask operator!(mask a)         { return { B::mnot(a.m) }; }
+    };
+
+    // ---- construction / lanes ----
+
+    [[nodiscard]] static FORCE_INLINE basic_vec broadcast(value_type x) { return { B::set1(x) }; }
+    [[nodiscard]] static FORCE_INLINE basic_vec zero()                  { return { B::set1(value_type(0)) }; }
+    [[nodiscard]] static FORCE_INLINE basic_vec load(const value_type* p) { return { B::load(p) }; }
+
+    // lanes[i] = base[idx[i]]
+    [[nodiscard]] static FORCE_INLINE basic_vec gather(const value_type* base, const int32_t* idx) { return { B::gather(base, idx) }; }
+
+    // first n lanes from p (n <= lanes), the rest 'fill' - never reads past p[n - 1]
+    [[nodiscard]] static FORCE_INLINE basic_vec loadPartial(const value_type* p, int n, value_type fill = value_type(0))
+    {
+        alignas(64) value_type t[lanes];
+        for (int i = 0; i < lanes; i++) t[i] = (i < n) ? p[i] : fill;
+        return load(t);
+    }
+
+    FORCE_INLINE void store(value_type* p) const { B::store(p, v); }
+    FORCE_INLINE void storePartial(value_type* p, int n) const
+    {
+        alignas(64) value_type t[lanes];
+        B::store(t, v);
+        for (int i = 0; i < n; i++) p[i] = t[i];
+    }
+
+    [[nodiscard]] FORCE_INLINE value_type lane(int i) const
+    {
+        alignas(64) value_type t[lanes];
+        B::store(t, v);
+        return t[i];
+    }
+
+    // ---- arithmetic ----
+
+    [[nodiscard]] static FORCE_INLINE basic_vec sqrt(basic_vec a)                   { return { B::sqrt(a.v) }; }
+    [[nodiscard]] static FORCE_INLINE basic_vec abs(basic_vec a)                    { return { B::abs(a.v) }; }
+    [[nodiscard]] static FORCE_INLINE basic_vec min(basic_vec a, basic_vec b)       { return { B::min(a.v, b.v) }; }
+    [[nodiscard]] static FORCE_INLINE basic_vec max(basic_vec a, basic_vec b)       { return { B::max(a.v, b.v) }; }
+    [[nodiscard]] static FORCE_INLINE basic_vec fma(basic_vec a, basic_vec b, basic_vec c) { return { B::fma(a.v, b.v, c.v) }; }
+
+    // m ? a : b per lane
+    [[nodiscard]] static FORCE_INLINE basic_vec blend(mask m, basic_vec a, basic_vec b) { return { B::blend(m.m, a.v, b.v) }; }
+
+    // complex multiply of interleaved (re, im) pairs
+    [[nodiscard]] static FORCE_INLINE basic_vec cmul(basic_vec a, basic_vec b)
+    {
+        // re = ar*br - ai*bi, im = ar*bi + ai*br
+        alignas(64) value_type sign[lanes];
+        for (int i = 0; i < lanes; i++) sign[i] = (i & 1) ? value_type(1) : value_type(-1);
+
+        const typename B::R t = B::mul(B::dup_odd(a.v), B::swap_pairs(b.v)); // (ai*bi, ai*br)
+        return { B::add(B::mul(B::dup_even(a.v), b.v), B::mul(t, B::load(sign))) };
+    }
+
+    // ---- reductions ----
+
+    [[nodiscard]] FORCE_INLINE value_type hsum() const { return B::hsum(v); }
+    [[nodiscard]] FORCE_INLINE value_type hmin() const { return B::hmin(v); }
+    [[nodiscard]] FORCE_INLINE value_type hmax() const { return B::hmax(v); }
+
+    // ---- operators ----
+
+    friend FORCE_INLINE basic_vec operator+(basic_vec a, basic_vec b) { return { B::add(a.v, b.v) }; }
+    friend FORCE_INLINE basic_vec operator-(basic_vec a, basic_vec b) { return { B::sub(a.v, b.v) }; }
+    friend FORCE_INLINE basic_vec operator*(basic_vec a, basic_vec b) { return { B::mul(a.v, b.v) }; }
+    friend FORCE_INLINE basic_vec operator/(basic_vec a, basic_vec b) { return { B::div(a.v, b.v) }; }
+    friend FORCE_INLINE basic_vec operator-(basic_vec a)              { return { B::neg(a.v) }; }
+
+    FORCE_INLINE basic_vec& operator+=(basic_vec b) { v = B::add(v, b.v); return *this; }
+    FORCE_INLINE basic_vec& operator-=(basic_vec b) { v = B::sub(v, b.v); return *this; }
+    FORCE_INLINE basic_vec& operator*=(basic_vec b) { v = B::mul(v, b.v); return *this; }
+    FORCE_INLINE basic_vec& operator/=(basic_vec b) { v = B::div(v, b.v); return *this; }
+
+    friend FORCE_INLINE mask operator< (basic_vec a, basic_vec b) { return { B::lt(a.v, b.v) }; }
+    friend FORCE_INLINE mask operator<=(basic_vec a, basic_vec b) { return { B::le(a.v, b.v) }; }
+    friend FORCE_INLINE mask operator> (basic_vec a, basic_vec b) { return { B::lt(b.v, a.v) }; }
+    friend FORCE_INLINE mask operator>=(basic_vec a, basic_vec b) { return { B::le(b.v, a.v) }; }
+    friend FORCE_INLINE mask operator==(basic_vec a, basic_vec b) { return { B::eq(a.v, b.v) }; }
+    friend FORCE_INLINE mask operator!=(basic_vec a, basic_vec b) { return { B::ne(a.v, b.v) }; }
+};
+
+using v4d = basic_vec<detail::backend_d4>;
+using v8f = basic_vec<detail::backend_f8>;
+using v8d = basic_vec<detail::backend_d8>;
+
+using m4d = v4d::mask;
+using m8f = v8f::mask;
+using m8d = v8d::mask;
+
+// widest lane count held in a single register on the active backend (1 for scalar)
+template<class T> inline constexpr int native_lanes = std::is_same_v<T, float> ? detail::native_float_lanes : detail::native_double_lanes;
+
+} // end simd
+
+BL_END_NS;
@@ -1,21 +1,61 @@
 #pragma once
+#include <atomic>
+#include <algorithm>
 #include <cassert>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <thread>
 #include <type_traits>
 #include <utility>
-#include <vector>
+
+// Multi-producer / single-consumer queue of closures, run on the owner thread by pump()/drain().
+//
+// Posts are linked into an intrusive lock-free MPSC list (Vyukov). Nodes come from a fixed pool
+// with a tagged lock-free free-list, and closures up to inline_capacity bytes are stored in the
+// node itself, so a post normally neither allocates nor locks. Larger closures are boxed on the
+// heap, and if the pool is exhausted a heap node is used instead. Posts from one thread run in order.
+//
+// Tasks may pump the queue again (e.g. an invokeBlocking task that calls drain()).
 
 class ThreadQueue
 {
 public:
-    ThreadQueue()
+    static constexpr std::size_t inline_capacity = 64;
+
+    explicit ThreadQueue(std::size_t pool_size = 1024)
         : owner_thread_id_(std::this_thread::get_id())
-    {}
+    {
+        pool_size = std::max<std::size_t>(pool_size, 1);
+        pool_size_ = static_cast<uint32_t>(std::min<std::size_t>(pool_size, UINT32_MAX - 1));
+        pool_ = std::make_unique<Node[]>(pool_size_);
+
+        // free-list links are 1-based (0 = end of list)
+        for (uint32_t i = 0; i < pool_size_; ++i)
+            pool_[i].next_free.store(i + 1 < pool_size_ ? i + 2 : 0, std::memory_order_relaxed);
+        free_head_.store(1, std::memory_order_relaxed);
+
+        stub_.next.store(nullptr, std::memory_order_relaxed);
+        head_.store(&stub_, std::memory_order_relaxed);
+        tail_ = &stub_;
+    }
+
+    ~ThreadQueue()
+    {
+        // run nothing, but release anything still queued
+        while (Node* n = popNode())
+        {
+            n->ops->destroy(n->storage);
+            releaseNode(n);
+        }
+    }
+
+    ThreadQueue(const ThreadQueue&) = delete;
+    ThreadQueue& operator=(const ThreadQueue&) = delete;
 
     bool isOwnerThread() const noexcept
     {
@@ -26,33 +66,30 @@ public:
     void post(F&& fn)
     {
         using Fn = std::decay_t<F>;
-        Fn* heap_fn = new Fn(std::forward<F>(fn));
-
-        Task t;
-        t.object = heap_fn;
-        t.run = &runCallable<Fn>;
-        t.cleanup = &deleteCallable<Fn>;
 
-        std::lock_guard<std::mutex> lock(mutex_);
-        tasks_.push_back(t);
+        if constexpr (fitsInline<Fn>())
+        {
+            // constructed before a cell is claimed, so a throwing copy can't leave a hole in the ring
+            Fn local(std::forward<F>(fn));
+            push(local);
+        }
+        else
+        {
+            Boxed<Fn> boxed{ new Fn(std::forward<F>(fn)) };
+            push(boxed);
+        }
     }
 
     template <typename T>
     void retire(T* ptr) noexcept
     {
         if (!ptr) return;
-
-        Task t;
-        t.object = ptr;
-        t.run = &runDelete<T>;
-        t.cleanup = nullptr;
-
-        std::lock_guard<std::mutex> lock(mutex_);
-        tasks_.push_back(t);
+        Retired<T> task{ ptr };
+        push(task);
     }
 
     template <typename F>
-    decltype(auto) invokeBlocking(F&& fn)
+    std::invoke_result_t<std::decay_t<F>&> invokeBlocking(F&& fn)
     {
         if (isOwnerThread())
             return std::forward<F>(fn)();
@@ -60,18 +97,15 @@ public:
         using Fn = std::decay_t<F>;
         using R = std::invoke_result_t<Fn&>;
 
-        struct State
-        {
-            std::mutex m;
-            std::condition_variable cv;
-            bool done = false;
-            std::exception_ptr ep;
-            std::conditional_t<std::is_void_v<R>, char, R> result{};
-        };
+        // Result, exception and waiter live on this (blocked) thread's stack. Completion is signalled
+        // with the waiter's mutex held, so this thread can't return (and destroy them) until the owner
+        // thread has released it.
+        Waiter waiter;
 
-        auto state = std::make_shared<State>();
+        std::exception_ptr ep;
+        std::conditional_t<std::is_void_v<R>, char, R> result{};
 
-        post([state, fn2 = Fn(std::forward<F>(fn))]() mutable noexcept
+        post([&waiter, &ep, &result, fn2 = Fn(std::forward<F>(fn))]() mutable noexcept
         {
             try
             {
@@ -81,29 +115,29 @@ public:
                 }
                 else
                 {
-                    state->result = fn2();
+                    result = fn2();
                 }
             }
             catch (...)
             {
-                state->ep = std::current_exception();
+                ep = std::current_exception();
             }
 
-            {
-                std::lock_guard<std::mutex> lk(state->m);
-                state->done = true;
-            }
-            state->cv.notify_one();
+            std::lock_guard<std::mutex> lock(waiter.mutex);
+            waiter.done = true;
+            waiter.cv.notify_one();
         });
 
-        std::unique_lock<std::mutex> lk(state->m);
-        state->cv.wait(lk, [&] { return state->done; });
+        {
+            std::unique_lock<std::mutex> lock(waiter.mutex);
+            waiter.cv.wait(lock, [&] { return waiter.done; });
+        }
 
-        if (state->ep)
-            std::rethrow_exception(state->ep);
+        if (ep)
+            std::rethrow_exception(ep);
 
         if constexpr (!std::is_void_v<R>)
-            return std::move(state->result);
+            return std::move(result);
     }
 
     void pump() noexcept
@@ -123,53 +157,203 @@ public:
     }
 
 private:
-    struct Task
+
+    // Type-erased ops for a closure stored inline in a node
+    struct Ops
     {
-        void* object = nullptr;
-        void (*run)(void*) noexcept = nullptr;
-        void (*cleanup)(void*) noexcept = nullptr;
+        void (*run)(void*) noexcept;             // invoke, then destroy
+        void (*relocate)(void*, void*) noexcept; // move-construct into dst, destroy src
+        void (*destroy)(void*) noexcept;
     };
 
-    bool pumpOnce() noexcept
+    struct alignas(64) Node
+    {
+        std::atomic<Node*>    next{ nullptr };
+        std::atomic<uint32_t> next_free{ 0 }; // pool free-list link (1-based)
+        const Ops* ops = nullptr;
+        bool from_heap = false;
+        alignas(std::max_align_t) unsigned char storage[inline_capacity];
+    };
+
+    struct Waiter
+    {
+        std::mutex              mutex;
+        std::condition_variable cv;
+        bool                    done = false;
+    };
+
+    template <typename Fn>
+    struct Boxed
+    {
+        Fn* fn;
+        void operator()() noexcept { (*fn)(); delete fn; fn = nullptr; }
+        ~Boxed() { delete fn; }
+        Boxed(Fn* p) noexcept : fn(p) {}
+        Boxed(Boxed&& o) noexcept : fn(std::exchange(o.fn, nullptr)) {}
+    };
+
+    template <typename T>
+    struct Retired
+    {
+        T* ptr;
+        void operator()() noexcept { delete ptr; ptr = nullptr; }
+        ~Retired() { delete ptr; }
+        Retired(T* p) noexcept : ptr(p) {}
+        Retired(Retired&& o) noexcept : ptr(std::exchange(o.ptr, nullptr)) {}
+    };
+
+    template <typename Fn>
+    static constexpr bool fitsInline()
     {
-        std::vector<Task> local;
+        return sizeof(Fn) <= inline_capacity &&
+               alignof(Fn) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Fn>;
+    }
+
+    template <typename Fn>
+    static const Ops* opsFor() noexcept
+    {
+        static constexpr Ops ops{
+            [](void* p) noexcept { Fn* f = std::launder(static_cast<Fn*>(p)); (*f)(); f->~Fn(); },
+            [](void* dst, void* src) noexcept { Fn* f = std::launder(static_cast<Fn*>(src)); ::new (dst) Fn(std::move(*f)); f->~Fn(); },
+            [](void* p) noexcept { std::launder(static_cast<Fn*>(p))->~Fn(); }
+        };
+        return &ops;
+    }
+
+    // ======== Node pool (tagged Treiber stack: [tag:32 | index+1:32]) ========
+
+    Node* acquireNode()
+    {
+        uint64_t old_head = free_head_.load(std::memory_order_acquire);
+        while (uint32_t idx = static_cast<uint32_t>(old_head))
+        {
+            Node* n = &pool_[idx - 1];
+            const uint64_t next = n->next_free.load(std::memory_order_relaxed);
+            const uint64_t new_head = ((old_head >> 32) + 1) << 32 | next;
+            if (free_head_.compare_exchange_weak(old_head, new_head,
+                std::memory_order_acquire, std::memory_order_acquire))
+            {
+                n->from_heap = false;
+                return n;
+            }
+        }
+
+        // pool exhausted (owner thread is falling behind)
+        Node* n = new Node;
+        n->from_heap = true;
+        return n;
+    }
+
+    void releaseNode(Node* n) noexcept
+    {
+        if (n->from_heap)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (tasks_.empty())
-                return false;
-            local.swap(tasks_);
+            delete n;
+            return;
         }
 
-        for (const Task& t : local)
+        const uint32_t idx = static_cast<uint32_t>(n - pool_.get()) + 1;
+        uint64_t old_head = free_head_.load(std::memory_order_relaxed);
+        for (;;)
         {
-            t.run(t.object);
-            if (t.cleanup)
-                t.cleanup(t.object);
+            n->next_free.store(static_cast<uint32_t>(old_head), std::memory_order_relaxed);
+            const uint64_t new_head = ((old_head >> 32) + 1) << 32 | idx;
+            if (free_head_.compare_exchange_weak(old_head, new_head,
+                std::memory_order_release, std::memory_order_relaxed))
+                return;
         }
-        return true;
     }
 
-    template <typename T>
-    static void runDelete(void* p) noexcept
+    // ======== MPSC list ========
+
+    void pushNode(Node* n) noexcept
     {
-        delete static_cast<T*>(p);
+        n->next.store(nullptr, std::memory_order_relaxed);
+        Node* prev = head_.exchange(n, std::memory_order_acq_rel);
+        prev->next.store(n, std::memory_order_release);
     }
 
-    template <typename Fn>
-    static void runCallable(void* p) noexcept
+    // Owner thread only. Returns nullptr if empty (or a producer is mid-push).
+    Node* popNode() noexcept
     {
-        (*static_cast<Fn*>(p))();
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &stub_)
+        {
+            if (!next) return nullptr;
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            tail_ = next;
+            return tail;
+        }
+
+        if (tail != head_.load(std::memory_order_acquire))
+            return nullptr;
+
+        pushNode(&stub_);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            tail_ = next;
+            return tail;
+        }
+        return nullptr;
     }
 
+    // fn is moved from
     template <typename Fn>
-    static void deleteCallable(void* p) noexcept
+    void push(Fn& fn)
     {
-        delete static_cast<Fn*>(p);
+        Node* n = acquireNode();
+        ::new (static_cast<void*>(n->storage)) Fn(std::move(fn));
+        n->ops = opsFor<Fn>();
+        pushNode(n);
+        pushed_.fetch_add(1, std::memory_order_release);
+    }
+
+    bool pumpOnce() noexcept
+    {
+        // Only run what was queued when the batch started, tasks posted meanwhile wait for the next batch
+        const uint64_t end = pushed_.load(std::memory_order_acquire);
+
+        bool ran = false;
+        while (popped_ < end)
+        {
+            Node* n = popNode();
+            if (!n) break; // a producer is mid-push, pick it up next batch
+
+            // move the closure out and recycle the node first, so the task may pump re-entrantly
+            alignas(std::max_align_t) unsigned char local[inline_capacity];
+            const Ops* ops = n->ops;
+            ops->relocate(local, n->storage);
+            releaseNode(n);
+            ++popped_;
+
+            ops->run(local);
+            ran = true;
+        }
+        return ran;
     }
 
 private:
-    std::mutex mutex_;
-    std::vector<Task> tasks_;
+    std::unique_ptr<Node[]> pool_;
+    uint32_t pool_size_ = 0;
+    alignas(64) std::atomic<uint64_t> free_head_{ 0 };
+
+    alignas(64) std::atomic<Node*> head_{ nullptr };  // producers
+    alignas(64) std::atomic<uint64_t> pushed_{ 0 };
+    alignas(64) Node* tail_ = nullptr;                 // owner thread only
+    uint64_t popped_ = 0;                              // owner thread only
+    Node stub_;
+
     std::thread::id owner_thread_id_;
 };
 
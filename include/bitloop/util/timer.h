@@ -1,6 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <cmath>
+#include <vector>
+#include <algorithm>
 #include "math_util.h"
 
 namespace bl {
@@ -56,9 +59,66 @@ struct AverageTimer
     }
 };
 
+// Rolling window of recent intervals (ms) for percentile/jitter queries
+class IntervalHistogram
+{
+    std::vector<double> samples;  // ring buffer
+    std::size_t head = 0;
+    std::size_t count = 0;
+    mutable std::vector<double> sorted;
+    mutable bool sorted_valid = false;
+
+public:
+
+    IntervalHistogram(int window = 240)
+    {
+        setWindow(window);
+    }
+
+    void setWindow(int window)
+    {
+        samples.assign(static_cast<std::size_t>(std::max(window, 1)), 0.0);
+        clear();
+    }
+
+    void clear()
+    {
+        head = 0;
+        count = 0;
+        sorted_valid = false;
+    }
+
+    void push(double ms)
+    {
+        samples[head] = ms;
+        head = (head + 1) % samples.size();
+        count = std::min(count + 1, samples.size());
+        sorted_valid = false;
+    }
+
+    [[nodiscard]] std::size_t size() const { return count; }
+
+    // p in [0,1], nearest-rank
+    [[nodiscard]] double percentile(double p) const
+    {
+        if (count == 0) return 0.0;
+        if (!sorted_valid)
+        {
+            sorted.assign(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(count));
+            std::sort(sorted.begin(), sorted.end());
+            sorted_valid = true;
+        }
+
+        const double rank = std::ceil(std::clamp(p, 0.0, 1.0) * static_cast<double>(count));
+        const std::size_t idx = static_cast<std::size_t>(std::max(rank, 1.0)) - 1;
+        return sorted[std::min(idx, count - 1)];
+    }
+};
+
 struct FPSTimer
 {
     AverageTimer timer;
+    IntervalHistogram intervals;
 
     FPSTimer(int count = 1)
     {
@@ -72,13 +132,28 @@ struct FPSTimer
 
     void tick()
     {
-        timer.tick();
+        intervals.push(timer.tick());
+    }
+
+    // record an interval measured elsewhere (e.g. by a FramePacer)
+    void push(double interval_ms)
+    {
+        timer.avg.push(interval_ms);
+        intervals.push(interval_ms);
     }
 
     double getFPS() const
     {
         return 1000.0 / timer.average();
     }
+
+    // frame-interval percentiles (ms)
+    [[nodiscard]] double p50() const { return intervals.percentile(0.50); }
+    [[nodiscard]] double p95() const { return intervals.percentile(0.95); }
+    [[nodiscard]] double p99() const { return intervals.percentile(0.99); }
+
+    // worst-case deviation from the median interval (ms)
+    [[nodiscard]] double jitter() const { return p99() - p50(); }
 };
 
 }
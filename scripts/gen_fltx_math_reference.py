@@ -0,0 +1,131 @@
+"""
+Generates tests/unit/utility/fltx_math_reference.h, the reference values the f128/f256
+transcendental tests are checked against.
+
+Inputs are exact double-doubles (so the same case serves f128 and f256), results are
+evaluated with mpmath at 400 bits and stored as four non-overlapping doubles (~212 bits).
+
+    pip install mpmath
+    python scripts/gen_fltx_math_reference.py
+"""
+
+import argparse
+import random
+from pathlib import Path
+
+import mpmath as mp
+
+mp.mp.prec = 400
+
+CASES_PER_FUNCTION = 64
+DEFAULT_OUT = Path(__file__).resolve().parent.parent / "tests" / "unit" / "utility" / "fltx_math_reference.h"
+
+
+def limbs(v, n):
+    out = []
+    for _ in range(n):
+        d = float(v)
+        out.append(d)
+        v -= d
+    return out
+
+
+def double_double(v):
+    """Round to a double-double, returning the limbs and the exact value they represent."""
+    hi, lo = limbs(v, 2)
+    return (hi, lo), mp.mpf(hi) + mp.mpf(lo)
+
+
+def log_uniform(rng, lo_exp10, hi_exp10, signed=True):
+    v = mp.mpf(10) ** rng.uniform(lo_exp10, hi_exp10) * (1 + mp.mpf(rng.random()) * mp.mpf(2) ** -60)
+    if signed and rng.random() < 0.5:
+        v = -v
+    return v
+
+
+def make_cases(rng):
+    zero = ((0.0, 0.0), mp.mpf(0))
+    fns = {}
+
+    def add(name, fn, xs, ys=None):
+        rows = []
+        for i, x in enumerate(xs):
+            x = double_double(x)
+            y = double_double(ys[i]) if ys else zero
+            rows.append((x[0], y[0], limbs(fn(x[1], y[1]), 4)))
+        fns[name] = rows
+
+    n = CASES_PER_FUNCTION
+    fixed_exp = [mp.mpf(1), mp.mpf(-1), mp.mpf("0.5"), mp.mpf(2) ** -40, mp.log(2), mp.mpf(700), mp.mpf(-600)]
+    add("exp", lambda x, y: mp.exp(x),
+        fixed_exp + [rng.choice([log_uniform(rng, -20, 2), mp.mpf(rng.uniform(-600, 700))]) for _ in range(n - len(fixed_exp))])
+
+    fixed_log = [mp.mpf(2), mp.mpf("0.5"), 1 + mp.mpf(2) ** -50, 1 - mp.mpf(2) ** -40, mp.mpf(10), mp.mpf("1e-300"), mp.mpf("1e300")]
+    add("log", lambda x, y: mp.log(x),
+        fixed_log + [rng.choice([log_uniform(rng, -300, 300, False), 1 + log_uniform(rng, -12, -1)]) for _ in range(n - len(fixed_log))])
+
+    fixed_trig = [mp.mpf(1), mp.mpf(-1), mp.mpf("0.5"), mp.mpf(2) ** -30, mp.mpf(3), mp.mpf(100), mp.mpf("12345.678")]
+    trig = fixed_trig + [log_uniform(rng, -10, 5) for _ in range(n - len(fixed_trig))]
+    add("sin", lambda x, y: mp.sin(x), trig)
+    add("cos", lambda x, y: mp.cos(x), trig)
+
+    fixed_y = [mp.mpf(1), mp.mpf(1), mp.mpf(-1), mp.mpf(1), mp.mpf("1e-20")]
+    fixed_x = [mp.mpf(1), mp.mpf(-1), mp.mpf(-1), mp.mpf("1e-20"), mp.mpf(1)]
+    ys = fixed_y + [log_uniform(rng, -10, 10) for _ in range(n - len(fixed_y))]
+    xs = fixed_x + [log_uniform(rng, -10, 10) for _ in range(n - len(fixed_x))]
+    add("atan2", lambda y, x: mp.atan2(y, x), ys, xs)
+
+    fixed_b = [mp.mpf(2), mp.mpf(10), mp.mpf("0.5"), mp.mpf(-3), mp.mpf(-3), mp.mpf("1.5")]
+    fixed_e = [mp.mpf("0.5"), mp.mpf(-7), mp.mpf(100), mp.mpf(5), mp.mpf(-4), mp.mpf("2.75")]
+    bases = fixed_b + [log_uniform(rng, -2, 2, False) for _ in range(n - len(fixed_b))]
+    exps = fixed_e + [mp.mpf(rng.uniform(-40, 40)) for _ in range(n - len(fixed_e))]
+    add("pow", lambda b, e: mp.power(b, e), bases, exps)
+
+    return fns
+
+
+def fmt(d):
+    return "0.0" if d == 0.0 else float.hex(d)
+
+
+def write_header(fns, out):
+    lines = [
+        "// Generated by scripts/gen_fltx_math_reference.py (mpmath, 400 bits) - do not edit.",
+        "// x, y: exact double-double inputs. ref: the exact result as four non-overlapping doubles.",
+        "#pragma once",
+        "",
+        "namespace fltx_math_reference",
+        "{",
+        "    struct Case",
+        "    {",
+        "        double x[2];",
+        "        double y[2];",
+        "        double ref[4];",
+        "    };",
+    ]
+    for name, rows in fns.items():
+        lines.append("")
+        lines.append(f"    inline constexpr Case {name}_cases[] = {{")
+        for x, y, ref in rows:
+            lines.append("        {{ {} }}, {{ {} }}, {{ {} }} }},".format(
+                "{ " + ", ".join(fmt(v) for v in x),
+                ", ".join(fmt(v) for v in y),
+                ", ".join(fmt(v) for v in ref)))
+        lines.append("    };")
+    lines.append("}")
+    lines.append("")
+    out.write_text("\n".join(lines), encoding="utf-8")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the fltx transcendental reference table")
+    parser.add_argument("--out", type=Path, default=DEFAULT_OUT)
+    parser.add_argument("--seed", type=int, default=19)
+    args = parser.parse_args()
+
+    write_header(make_cases(random.Random(args.seed)), args.out)
+    print(f"wrote {args.out}")
+
+
+if __name__ == "__main__":
+    main()
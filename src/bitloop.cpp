@@ -82,6 +82,7 @@
 /// Project files
 #include <bitloop/core/project_worker.h>
 #include <bitloop/core/main_window.h>
+#include <bitloop/util/cpu_dispatch.h>
 
 using namespace bl;
 
@@ -232,8 +233,12 @@ void clipboard_paste_callback(std::string&& paste_data, void* callback_data)
 }
 #endif
 
-int bitloop_main(int, char* [])
+int bitloop_main(int argc, char* argv[])
 {
+    // ======== Kernel dispatch (--cpu-level=<name> / BL_CPU_LEVEL) ========
+    applyCpuLevelArgs(argc, argv);
+    blPrint() << "CPU kernels: " << cpuLevelName(cpuLevel()) << " (detected: " << cpuLevelName(detectCpuLevel()) << ")\n";
+
     // ======== SDL Window setup ========
     {
         SDL_Init(SDL_INIT_VIDEO);
@@ -909,6 +909,45 @@ bool CaptureManager::encodeFrame(const EncodeFrame& preprocessed_frame)
     return true;
 }
 
+bool CaptureManager::submitFrame(EncodeFrame& frame)
+{
+    if (encoder_busy.load(std::memory_order_acquire))
+        return false;
+
+    {
+        assert(!(isSnapshotting() && frame_count == 1));
+
+        std::lock_guard<std::mutex> lock(pending_mutex);
+
+        // caller gets the encoder's previous buffers back to reuse
+        pending_frame.swap(frame);
+        frame_count++;
+
+        encoder_busy.store(true, std::memory_order_release);
+    }
+
+    work_available_cond.notify_one();
+    return true;
+}
+
+void CaptureManager::endFrameReadback()
+{
+    {
+        std::lock_guard<std::mutex> lock(encoder_ready_mutex);
+        frames_in_readback.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    encoder_ready_cond.notify_all();
+}
+
+void CaptureManager::waitForFrameReadbackSlot(int max_in_flight)
+{
+    std::unique_lock<std::mutex> lock(encoder_ready_mutex);
+    encoder_ready_cond.wait(lock, [&]
+    {
+        return frames_in_readback.load(std::memory_order_acquire) < max_in_flight || !(isRecording() || isSnapshotting());
+    });
+}
+
 void CaptureManager::waitUntilReadyForNewFrame()
 {
     blPrint() << "waitUntilReadyForNewFrame()...";
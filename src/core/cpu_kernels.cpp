@@ -0,0 +1,199 @@
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi" // wide vector args only ever appear in always-inlined helpers
+#endif
+
+#include <bitloop/core/cpu_kernels.h>
+#include <bitloop/core/raster_grid.h>
+#include <bitloop/util/fltx/f128_simd.h>
+
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+// Each variant below is a thin wrapper, compiled with its own BL_TARGET_* attribute, around the same
+// FORCE_INLINE kernel body, so the body is re-optimised for that ISA (and never fuses a*b+c).
+
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#endif
+
+BL_BEGIN_NS;
+
+namespace {
+
+#if defined(BL_CPU_MULTIVERSION)
+
+typedef double  ext_v4d __attribute__((vector_size(32)));
+typedef int64_t ext_m4d __attribute__((vector_size(32)));
+typedef double  ext_v8d __attribute__((vector_size(64)));
+typedef int64_t ext_m8d __attribute__((vector_size(64)));
+
+template<int N> struct ext_types;
+template<> struct ext_types<4> { using V = ext_v4d; using M = ext_m4d; };
+template<> struct ext_types<8> { using V = ext_v8d; using M = ext_m8d; };
+
+// Packed doubles as GCC/Clang generic vectors. Unlike intrinsics these inline into any
+// target-attributed caller, which lowers them to that ISA's widest registers (ymm/zmm).
+template<int N>
+struct dvec_ext
+{
+    static constexpr int lanes = N;
+    using V = typename ext_types<N>::V;
+    using M = typename ext_types<N>::M;
+
+    static FORCE_INLINE V set1(double x)            { V r; for (int i = 0; i < N; i++) r[i] = x; return r; }
+    static FORCE_INLINE V load(const double* p)     { V r; std::memcpy(&r, p, sizeof(V)); return r; }
+    static FORCE_INLINE void store(double* p, V a)  { std::memcpy(p, &a, sizeof(V)); }
+
+    static FORCE_INLINE V add(V a, V b)             { return a + b; }
+    static FORCE_INLINE V sub(V a, V b)             { return a - b; }
+    static FORCE_INLINE V mul(V a, V b)             { return a * b; }
+    static FORCE_INLINE V div(V a, V b)             { return a / b; }
+    static FORCE_INLINE V neg(V a)                  { return -a; }
+    static FORCE_INLINE V sqrt(V a)                 { V r; for (int i = 0; i < N; i++) r[i] = std::sqrt(a[i]); return r; }
+    static FORCE_INLINE V fma(V a, V b, V c)        { V r; for (int i = 0; i < N; i++) r[i] = std::fma(a[i], b[i], c[i]); return r; }
+
+    static FORCE_INLINE M lt(V a, V b)              { return a < b; }
+    static FORCE_INLINE M le(V a, V b)              { return a <= b; }
+    static FORCE_INLINE M eq(V a, V b)              { return a == b; }
+    static FORCE_INLINE M mand(M a, M b)            { return a & b; }
+    static FORCE_INLINE M mor(M a, M b)             { return a | b; }
+    static FORCE_INLINE M mnot(M a)                 { return ~a; }
+    static FORCE_INLINE V blend(M m, V a, V b)      { return (V)((m & (M)a) | (~m & (M)b)); }
+    static FORCE_INLINE int bits(M m)               { int r = 0; for (int i = 0; i < N; i++) r |= int(m[i] != 0) << i; return r; }
+};
+
+using f128_avx2   = simd2::f128v<dvec_ext<4>>;
+using f128_avx512 = simd2::f128v<dvec_ext<8>>;
+
+#else
+
+using f128_avx2   = simd2::f128x4;
+using f128_avx512 = simd2::f128x4;
+
+#endif
+
+// packed f128 type per level (void: scalar loop only)
+template<CpuLevel L> struct LevelPack          { using type = simd2::f128x4; };
+template<> struct LevelPack<CpuLevel::SCALAR>  { using type = void; };
+template<> struct LevelPack<CpuLevel::AVX2>    { using type = f128_avx2; };
+template<> struct LevelPack<CpuLevel::AVX512>  { using type = f128_avx512; };
+
+struct AddOp { template<class T> FORCE_INLINE T operator()(const T& a, const T& b) const { return a + b; } };
+struct SubOp { template<class T> FORCE_INLINE T operator()(const T& a, const T& b) const { return a - b; } };
+struct MulOp { template<class T> FORCE_INLINE T operator()(const T& a, const T& b) const { return a * b; } };
+struct DivOp { template<class T> FORCE_INLINE T operator()(const T& a, const T& b) const { return a / b; } };
+struct SqrtOp
+{
+    FORCE_INLINE f128 operator()(const f128& a) const { return sqrt(a); }
+    template<class T> FORCE_INLINE T operator()(const T& a) const { return T::sqrt(a); }
+};
+
+/// ======== Kernel bodies ========
+
+template<class Pack, class Op>
+FORCE_INLINE void f128Binary(const f128* a, const f128* b, f128* out, size_t n, Op op)
+{
+    size_t i = 0;
+    if constexpr (!std::is_void_v<Pack>)
+    {
+        constexpr size_t L = Pack::lanes;
+        for (; i + L <= n; i += L)
+            op(Pack::load(a + i), Pack::load(b + i)).store(out + i);
+    }
+    for (; i < n; i++)
+        out[i] = op(a[i], b[i]);
+}
+
+template<class Pack, class Op>
+FORCE_INLINE void f128Unary(const f128* a, f128* out, size_t n, Op op)
+{
+    size_t i = 0;
+    if constexpr (!std::is_void_v<Pack>)
+    {
+        constexpr size_t L = Pack::lanes;
+        for (; i + L <= n; i += L)
+            op(Pack::load(a + i)).store(out + i);
+    }
+    for (; i < n; i++)
+        out[i] = op(a[i]);
+}
+
+template<typename WorldT>
+FORCE_INLINE void worldRow(const detail::WorldScan<WorldT>& scan, int row, int x0, int x1, WorldT* wx, WorldT* wy)
+{
+    scan.forEachRowPixel(row, x0, x1, [&](int x, WorldT px, WorldT py)
+    {
+        wx[x - x0] = px;
+        wy[x - x0] = py;
+    });
+}
+
+FORCE_INLINE void mapColors(const float* t, uint32_t* out, size_t n, const uint32_t* lut, int lut_size)
+{
+    const float scale = static_cast<float>(lut_size - 1);
+    for (size_t i = 0; i < n; i++)
+    {
+        float v = t[i] * scale + 0.5f;
+        v = v > 0.0f ? v : 0.0f; // also catches NaN
+        v = v < scale ? v : scale;
+        out[i] = lut[static_cast<int>(v)];
+    }
+}
+
+/// ======== Variants ========
+
+#define BL_CPU_KERNEL_VARIANT(SUFFIX, LEVEL, TARGET) \
+    using Pack_##SUFFIX = LevelPack<LEVEL>::type; \
+    TARGET void f128Add_##SUFFIX(const f128* a, const f128* b, f128* out, size_t n) { f128Binary<Pack_##SUFFIX>(a, b, out, n, AddOp{}); } \
+    TARGET void f128Sub_##SUFFIX(const f128* a, const f128* b, f128* out, size_t n) { f128Binary<Pack_##SUFFIX>(a, b, out, n, SubOp{}); } \
+    TARGET void f128Mul_##SUFFIX(const f128* a, const f128* b, f128* out, size_t n) { f128Binary<Pack_##SUFFIX>(a, b, out, n, MulOp{}); } \
+    TARGET void f128Div_##SUFFIX(const f128* a, const f128* b, f128* out, size_t n) { f128Binary<Pack_##SUFFIX>(a, b, out, n, DivOp{}); } \
+    TARGET void f128Sqrt_##SUFFIX(const f128* a, f128* out, size_t n) { f128Unary<Pack_##SUFFIX>(a, out, n, SqrtOp{}); } \
+    TARGET void worldRowF64_##SUFFIX(const detail::WorldScan<f64>& scan, int row, int x0, int x1, f64* wx, f64* wy) { worldRow(scan, row, x0, x1, wx, wy); } \
+    TARGET void worldRowF128_##SUFFIX(const detail::WorldScan<f128>& scan, int row, int x0, int x1, f128* wx, f128* wy) { worldRow(scan, row, x0, x1, wx, wy); } \
+    TARGET void mapColors_##SUFFIX(const float* t, uint32_t* out, size_t n, const uint32_t* lut, int lut_size) { mapColors(t, out, n, lut, lut_size); } \
+    constexpr CpuKernels kernels_##SUFFIX = { \
+        LEVEL, \
+        &f128Add_##SUFFIX, &f128Sub_##SUFFIX, &f128Mul_##SUFFIX, &f128Div_##SUFFIX, &f128Sqrt_##SUFFIX, \
+        &worldRowF64_##SUFFIX, &worldRowF128_##SUFFIX, \
+        &mapColors_##SUFFIX \
+    };
+
+BL_CPU_KERNEL_VARIANT(scalar,   CpuLevel::SCALAR,   )
+BL_CPU_KERNEL_VARIANT(baseline, CpuLevel::BASELINE, )
+#if defined(BL_CPU_X86)
+BL_CPU_KERNEL_VARIANT(avx2,     CpuLevel::AVX2,     BL_TARGET_AVX2)
+BL_CPU_KERNEL_VARIANT(avx512,   CpuLevel::AVX512,   BL_TARGET_AVX512)
+#endif
+
+#undef BL_CPU_KERNEL_VARIANT
+
+constexpr const CpuKernels* kernel_table[] = {
+    &kernels_scalar,
+    &kernels_baseline,
+    #if defined(BL_CPU_X86)
+    &kernels_avx2,
+    &kernels_avx512,
+    #endif
+};
+
+} // end anon
+
+const CpuKernels* cpuKernelsFor(CpuLevel level)
+{
+    const int i = static_cast<int>(level);
+    if (i < 0 || i >= static_cast<int>(std::size(kernel_table)) || !cpuLevelSupported(level))
+        return nullptr;
+    return kernel_table[i];
+}
+
+const CpuKernels& cpuKernels()
+{
+    // cpuLevel() is always a supported level, and the baseline table always exists
+    const CpuKernels* k = cpuKernelsFor(cpuLevel());
+    return k ? *k : kernels_baseline;
+}
+
+BL_END_NS;
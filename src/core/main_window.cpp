@@ -2,7 +2,7 @@
 #include <bitloop/core/main_window.h>
 #include <bitloop/core/project_worker.h>
 #include <bitloop/util/text_util.h>
-//#include <bitloop/imguix/imgui_debug_ui.h>
+#include <bitloop/imguix/imgui_debug_ui.h>
 
 #include <filesystem>
 
@@ -12,6 +12,7 @@
 #include <string_view>
 #include <system_error>
 #include <charconv>
+#include <cstring>
 #include <cctype>
 #endif
 
@@ -893,10 +894,68 @@ void MainWindow::endRecording()
         record.enabled = false;
         snapshot.enabled = false;
 
+        // frames still reading back belong to the recording
+        completeFrameReadbacks(true);
+
         capture_manager.finalizeCapture();
     }
 }
 
+void MainWindow::completeFrameReadbacks(bool wait, bool state_locked)
+{
+    while (frame_readback.pending() > 0)
+    {
+        if (!capture_manager.isCapturing())
+        {
+            // capture ended (or failed) with frames still in flight, nothing left to encode them
+            for (size_t i = 0; i < pending_capture_frames.size(); i++)
+                capture_manager.endFrameReadback();
+
+            frame_readback.discard();
+            pending_capture_frames.clear();
+            return;
+        }
+
+        // encoder takes one frame at a time, the rest stay on the GPU until it's free
+        if (capture_manager.isBusy())
+        {
+            if (!wait)
+                return;
+
+            capture_manager.waitUntilReadyForNewFrame();
+            continue;
+        }
+
+        // single copy, mapped buffer => encoder frame (rows already top-down, flipped by the preprocessor)
+        const bool read = frame_readback.take(wait, [&](const uint8_t* rgba, int w, int h)
+        {
+            preprocessed_frame.resize((size_t)w * (size_t)h * 4);
+            std::memcpy(preprocessed_frame.frameData(), rgba, preprocessed_frame.size());
+        });
+
+        // GPU hasn't finished the read yet, try again next frame
+        if (!read)
+            return;
+
+        PendingCaptureFrame frame = std::move(pending_capture_frames.front());
+        pending_capture_frames.pop_front();
+        preprocessed_frame.payload = std::move(frame.payload);
+
+        {
+            // snapshot callbacks are registered by the worker
+            std::unique_lock<std::mutex> lock(shared_sync.state_mutex, std::defer_lock);
+            if (!state_locked)
+                lock.lock();
+
+            project_worker()->onFrameReadBack(preprocessed_frame, frame.request_id, frame.preset);
+        }
+
+        // send to encoder (swaps buffers, no copy)
+        capture_manager.submitFrame(preprocessed_frame);
+        capture_manager.endFrameReadback();
+    }
+}
+
 void MainWindow::checkCaptureComplete()
 {
     static bool show_error_box = false;
@@ -1276,7 +1335,24 @@ void MainWindow::populateToolbar()
         ImVec2 p = ImGui::GetCursorPos();
         ImGui::SetCursorPos(ImVec2(p.x, p.y + y_off - pad_y));
 
-        ImGui::Text("FPS: %.1f", worker_fps_timer.getFPS());
+        if (handoff_stats.depth > 1)
+        {
+            ImGui::Text("FPS: %.1f  Sim: %.1f  Latency: %.1f ms  (pipelined x%d)",
+                worker_fps_timer.getFPS(), handoff_stats.workerFPS(), handoff_stats.latency_ms, handoff_stats.depth);
+        }
+        else
+        {
+            ImGui::Text("FPS: %.1f  Latency: %.1f ms", worker_fps_timer.getFPS(), handoff_stats.latency_ms);
+        }
+
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip(
+                "Sim frame interval, paced (ms)\np50: %.2f\np95: %.2f\np99: %.2f\n\n"
+                "Draw interval (ms)\np50: %.2f\np95: %.2f\np99: %.2f",
+                pacer_fps_timer.p50(), pacer_fps_timer.p95(), pacer_fps_timer.p99(),
+                worker_fps_timer.p50(), worker_fps_timer.p95(), worker_fps_timer.p99());
+        }
     }
 
     ImGui::EndChild();
@@ -1548,6 +1624,9 @@ void MainWindow::populateViewport(bool& projectDrawn)
         }
     }
 
+    // Encode any captured frames whose pixels have arrived since the last GUI frame
+    completeFrameReadbacks(false);
+
     // Always process viewport, even if not visible
     ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
     ImGui::Begin("Viewport");
@@ -1598,8 +1677,7 @@ void MainWindow::populateViewport(bool& projectDrawn)
         {
             if (!capturing_frame && active_ssaa == 1 && active_sharpen == 0)
             {
-                // no preprocessing/flipping needed, just copy canvas to preprocessed_frame
-                canvas.readPixels(preprocessed_frame);
+                // no preprocessing/flipping needed, the canvas texture is displayed directly
                 return false;
             }
 
@@ -1611,11 +1689,8 @@ void MainWindow::populateViewport(bool& projectDrawn)
             params.sharpen = active_sharpen;
             params.flip_y = true;
 
-            if (capturing_frame)
-                preprocessor.preprocessToFrame(canvas.texture(), params, preprocessed_frame);
-            else
-                preprocessor.preprocessToTexture(canvas.texture(), params);
-
+            // captured pixels are read back asynchronously from the output texture (see queueing below)
+            preprocessor.preprocessToTexture(canvas.texture(), params);
             return true;
         };
 
@@ -1642,12 +1717,18 @@ void MainWindow::populateViewport(bool& projectDrawn)
 
                 worker_fps_timer.tick();
 
+                // oldest undrawn frame (always the latest one in lockstep)
+                const bool pipelined = shared_sync.stats.depth > 1;
+                const int frame_slot = shared_sync.consume_frame_locked();
+
+                // pipelined frames are drawn unconditionally, the dirty flag may belong to a newer frame
                 bool capturing_frame = capture_manager.isCapturing() && permit_frame_capture && new_frame_prepared;
-                if (canvas.isDirty() || capturing_frame)
+                if (canvas.isDirty() || capturing_frame || pipelined)
                 {
                     canvas.begin(0.05f, 0.05f, 0.1f, 1.0f);
-                    project_worker()->draw();
+                    project_worker()->draw(frame_slot);
                     canvas.end();
+                    imageUploadStats().endFrame();
 
                     preprocess_frame = true;
 
@@ -1666,22 +1747,36 @@ void MainWindow::populateViewport(bool& projectDrawn)
 
                     if (capturing_frame)
                     {
-                        // give project a chance to attach metadata to the frame before sending it to the encoder
-                        CapturePreset preset_info = *active_preset;
-                        preset_info.setVideo(capture_manager.isRecording()); // Tell user whether preset is being used a video or snapshot
-                        project_worker()->onEncodeFrame(preprocessed_frame, active_snapshot_preset_request_id, preset_info);
-
-                        // send to encoder
-                        capture_manager.encodeFrame(preprocessed_frame);
+                        // Start reading the frame back, it's encoded once the pixels arrive (completeFrameReadbacks).
+                        // The worker keeps at most ring_size frames in flight, if the ring is full anyway
+                        // drain it rather than lose the frame.
+                        const IVec2 res = preprocessor.outputResolution();
+                        if (frame_readback.full())
+                            completeFrameReadbacks(true, true);
+
+                        if (frame_readback.queue(preprocessor.outputFramebuffer(), res.x, res.y))
+                        {
+                            CapturePreset preset_info = *active_preset;
+                            preset_info.setVideo(capture_manager.isRecording()); // Tell user whether preset is being used a video or snapshot
+
+                            // metadata comes from the state this frame was drawn with, not the state once its pixels arrive
+                            EncodeFrame metadata;
+                            project_worker()->onEncodeFrame(metadata, active_snapshot_preset_request_id, preset_info);
+                            pending_capture_frames.push_back({ active_snapshot_preset_request_id, preset_info, std::move(metadata.payload) });
+
+                            // worker waits for a free readback slot before processing another captured frame
+                            capture_manager.beginFrameReadback();
+                        }
+                        else
+                        {
+                            blPrint() << "Frame capture failed: invalid output resolution " << res.x << "x" << res.y;
+                        }
                     }
 
                     // Force worker to tell us when it wants to encode a new frame
                     permit_frame_capture = false;
                 }
 
-                shared_sync.frame_ready_to_draw = false;
-                shared_sync.frame_consumed = true;
-
                 // update settings for the next frame (and flag that we can correctly capture the next frame)
                 updateActivePreset();
                 new_frame_prepared = true; // frame should be ready to capture after next worker draw call
@@ -1785,6 +1880,11 @@ void MainWindow::populateUI()
     {
         std::lock_guard<std::mutex> g(shared_sync.state_mutex);
         need_draw = shared_sync.frame_ready_to_draw;
+        handoff_stats = shared_sync.stats;
+
+        for (double interval_ms : shared_sync.paced_intervals_ms)
+            pacer_fps_timer.push(interval_ms);
+        shared_sync.paced_intervals_ms.clear();
     }
 
     // stall here (GUI-thread) until worker finishes copying data to live thread
@@ -1871,6 +1971,13 @@ void MainWindow::populateUI()
                     ImGui::EndTabItem();
                 }
 
+                if (ImGui::BeginTabItem("Render"))
+                {
+                    imageUploadDebugInfo();
+                    precisionTierDebugInfo();
+                    ImGui::EndTabItem();
+                }
+
                 if (ImGui::BeginTabItem("Project Log"))
                 {
                     project_log.draw();
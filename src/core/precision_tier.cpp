@@ -0,0 +1,22 @@
+#include <bitloop/core/precision_tier.h>
+#include <bitloop/imguix/imguix.h>
+
+BL_BEGIN_NS
+
+void PrecisionTierSelector::populateUI()
+{
+    if (exhausted)
+        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.3f, 1.0f), "Precision: %s (exhausted, needs %d bits)",
+            floatingPointTypeName(current), required_bits);
+    else
+        ImGui::Text("Precision: %s (%d / %d bits)",
+            floatingPointTypeName(current), required_bits, mantissaBits(current));
+
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Tier switches: %llu", (unsigned long long)switches);
+
+    ImGui::SliderInt("Guard bits", &guard_bits, 0, 24);
+    ImGui::SliderInt("Tier hysteresis (bits)", &hysteresis_bits, 0, 16);
+}
+
+BL_END_NS
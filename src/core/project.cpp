@@ -520,7 +520,12 @@ void ProjectBase::_projectProcess()
     frame_dt = frame_timer.tick();
 
     bool canvas_dirty = false;
-    bool viewport_rects_updated = updateViewportRects();
+    bool viewport_rects_updated;
+    {
+        // a pipelined GUI may still be drawing the previous frame with these rects
+        std::lock_guard<std::mutex> lock(main_window()->sharedSync().state_mutex);
+        viewport_rects_updated = updateViewportRects();
+    }
 
     // 'did_first_process' is only true for the FIRST frame we process (when unpaused) so that we
     // don't do any drawing until this sets:  done_single_process=true
@@ -580,7 +585,7 @@ void ProjectBase::_projectProcess()
             viewport->scene->viewportProcess(viewport, dt);
 
             // all viewports need redraw if surface changes size
-            if (viewport_rects_updated || viewport->focused_dt > 0)
+            if (viewport_rects_updated)
                 viewport->scene->needs_redraw = true;
 
             // if any scene needs a redraw (including from surface size change), mark the canvas
@@ -589,6 +594,10 @@ void ProjectBase::_projectProcess()
                 canvas_dirty = true;
         }
 
+        // The focus flash is only drawn over the composite, keep redrawing it until it fades out
+        if (focus_changed || focus_flash_active.load(std::memory_order_relaxed))
+            canvas_dirty = true;
+
         /// --- Post-Process each scene ---
 
         // Measure time taken to process whole project
@@ -605,56 +614,81 @@ void ProjectBase::_projectProcess()
     if (canvas_dirty)
         canvas->setDirty();
 }
-void ProjectBase::_projectDraw()
+void ProjectBase::_projectDraw(int frame_slot)
 {
     // note: called from main GUI thread
 
     if (!done_single_process) return;
     if (!started) return;
 
-    DVec2 surface_size = canvas->fboSize();
+    for (SceneBase* scene : viewports.all_scenes)
+        scene->draw_slot = frame_slot;
 
-    /// todo: No per-viewport redrawing for now. Would require:
-    /// - or give each viewport a separate Canvas (ideal)
-    ///   - let ImGui draw viewport splitters
-    ///   - blit each viewport (when dirty) to merged "project_image" so you can record all in one frame
-    ///   - optional [hard]: add Scene-specific logic to capture only that scene.
-    ///     - queue captures, see if FFmpeg can handle multiple recordings at once (multiple capture managers?)
-    /// 
-    /// - additional surfaces to target (switch same nanovg instance)
-    
-    // Draw background
-    canvas->setFillStyle(10, 10, 15);
-    canvas->fillRect(0, 0, surface_size.x, surface_size.y);
+    // focus as of the frame being drawn
+    const int focused_index = draw_focused_index[frame_slot];
+    bool flashing = false;
+
+    DVec2 surface_size = canvas->fboSize();
 
-    canvas->setFillStyle(255, 255, 255);
-    canvas->setStrokeStyle(255, 255, 255);
+    /// todo: optional [hard]: add Scene-specific logic to capture only that scene.
+    ///  - queue captures, see if FFmpeg can handle multiple recordings at once (multiple capture managers?)
 
-    canvas->setFontSize(16.0f);
+    // Pipelined frames are drawn in order, but needs_redraw may already belong to a newer frame
+    const bool redraw_all = main_window()->sharedSync().stats.depth > 1;
 
-    // Draw each viewport
+    // Redraw dirty viewports into their own surfaces, the rest keep the pixels from their last redraw
     for (Viewport* viewport : viewports)
     {
+        const int surface_w = (int)std::ceil(viewport->width());
+        const int surface_h = (int)std::ceil(viewport->height());
+
+        viewport->redrawn = false;
+        if (surface_w <= 0 || surface_h <= 0)
+        {
+            viewport->surface.destroy();
+            continue;
+        }
+
+        const bool resized = viewport->surface.resize(surface_w, surface_h, true);
+        const bool rescaled = viewport->surface_scale != canvas->getGlobalScale();
+
+        if (!(redraw_all || resized || rescaled || viewport->scene->needs_redraw))
+            continue;
+
+        viewport_timer.begin();
+
+        canvas->beginSurface(viewport->surface, 10 / 255.0f, 10 / 255.0f, 15 / 255.0f);
+
+        canvas->setFillStyle(255, 255, 255);
+        canvas->setStrokeStyle(255, 255, 255);
+        canvas->setFontSize(16.0f);
+
         // Reuse derived painter for the primary canvas context
         viewport->setTargetPainterContext(canvas->getPainterContext());
 
         viewport->resetTransform();
 
-        canvas->setClipRect(viewport->left(), viewport->top(), viewport->width(), viewport->height());
-        canvas->save();
-
-        // Starting viewport position
-        canvas->translate(std::floor(viewport->left()), std::floor(viewport->top()));
-
         // Set default world transform
         viewport->worldMode();
 
         // Draw Scene to Viewport
         viewport->draw();
 
-        // Restore initial canvas transform
-        canvas->restore();
-        canvas->resetClipping();
+        canvas->endSurface();
+
+        viewport->surface_scale = canvas->getGlobalScale();
+        viewport->redrawn = true;
+        viewport->dt_viewportDraw = viewport_timer.elapsed();
+    }
+
+    // Composite viewports into the project image (what gets displayed and captured)
+    canvas->setFillStyle(10, 10, 15);
+    canvas->fillRect(0, 0, surface_size.x, surface_size.y);
+
+    for (Viewport* viewport : viewports)
+    {
+        if (viewport->surface.fbo)
+            canvas->drawSurface(viewport->surface, (f32)std::floor(viewport->left()), (f32)std::floor(viewport->top()));
     }
 
     // Draw viewport splitters
@@ -682,8 +716,14 @@ void ProjectBase::_projectDraw()
 
         canvas->stroke();
 
-        if (ctx_focused == viewport)
+        if (viewport->viewportIndex() == focused_index)
         {
+            if (draw_focus_flash[frame_slot])
+            {
+                viewport->focused_dt = Viewport::focus_flash_frames;
+                draw_focus_flash[frame_slot] = false;
+            }
+
             int flash_lines_extra = 0;
             float focus_flash_brightness = viewport->focused_dt / Viewport::focus_flash_frames;
             flash_lines_extra = (int)(focus_flash_brightness * 155.0f);
@@ -691,6 +731,7 @@ void ProjectBase::_projectDraw()
             if (viewport->focused_dt > 0)
             {
                 viewport->focused_dt -= 1.0f;
+                flashing = viewport->focused_dt > 0;
 
                 int flash_fill_extra = (int)(focus_flash_brightness * 50.0f);
                 canvas->setFillStyle(255, 255, 255, flash_fill_extra);
@@ -703,9 +744,35 @@ void ProjectBase::_projectDraw()
         }
     }
 
+    focus_flash_active.store(flashing, std::memory_order_relaxed);
+
     for (Viewport* viewport : viewports)
         viewport->setOldSize();
 }
+bool ProjectBase::_supportsPipelinedDraw() const
+{
+    for (SceneBase* scene : viewports.all_scenes)
+    {
+        if (!scene->supportsPipelinedDraw())
+            return false;
+    }
+    return !viewports.all_scenes.empty();
+}
+
+void ProjectBase::_snapshotDrawState(int frame_slot)
+{
+    // note: called from worker thread with state_mutex held (GUI isn't drawing)
+    draw_focused_index[frame_slot] = ctx_focused ? ctx_focused->viewportIndex() : -1;
+    draw_focus_flash[frame_slot] = focus_changed;
+    focus_changed = false;
+
+    for (SceneBase* scene : viewports.all_scenes)
+    {
+        if (scene->supportsPipelinedDraw())
+            scene->snapshotDrawState(frame_slot);
+    }
+}
+
 void ProjectBase::_onEndFrame()
 {
     for (SceneBase* scene : viewports.all_scenes)
@@ -811,7 +878,7 @@ void ProjectBase::_onEvent(SDL_Event& e)
                     {
                         ctx_focused = ctx;
                         captured_focus_event = true;
-                        ctx->focused_dt = Viewport::focus_flash_frames;
+                        focus_changed = true; // flash starts with the frame that publishes it
                     }
                     captured = true;
                     break;
@@ -1037,6 +1104,12 @@ void ProjectBase::_onEncodeFrame(EncodeFrame& data, int request_id, const Captur
         scene->_onEncodeFrame(data, request_id, preset);
 }
 
+void ProjectBase::_onFrameReadBack(EncodeFrame& data, int request_id, const CapturePreset& preset)
+{
+    for (SceneBase* scene : viewports.all_scenes)
+        scene->_onFrameReadBack(data, request_id, preset);
+}
+
 
 void ProjectBase::logMessage(const char* fmt, ...)
 {
@@ -119,7 +119,6 @@ void ProjectWorker::worker_loop()
     //bool shadow_changed = false;
 
     bool immediate_update_requested = false;
-    auto last_frame_time = std::chrono::steady_clock::now();
 
     while (!shared_sync.quitting.load())
     {
@@ -135,13 +134,35 @@ void ProjectWorker::worker_loop()
 
             if (!commands.empty())
             {
+                // a pipelined GUI may still have frames of this project queued, drain them first
+                shared_sync.wait_until_gui_consumes_frame();
+
                 std::unique_lock<std::mutex> shadow_lock(shared_sync.shadow_buffer_mutex);
                 for (auto& e : commands) handleProjectCommands(e);
             }
         }
 
-        // Wait for GUI to consume the freshly-rendered previous frame
-        shared_sync.wait_until_gui_consumes_frame();
+        // Frames the GUI may lag behind. Captures stay in lockstep so every processed frame is encoded
+        // exactly once, in order, with the capture settings it was processed with.
+        const bool capturing = capture_manager->isRecording() || capture_manager->isSnapshotting() || main_window()->isSnapshotting();
+        const bool pipelined = !capturing &&
+            main_window()->getPipelineDepth() > 1 &&
+            current_project && current_project->_supportsPipelinedDraw();
+
+        const int pipeline_depth = pipelined ? main_window()->getPipelineDepth() : 1;
+
+        // Lockstep: wait for GUI to consume the freshly-rendered previous frame
+        if (!pipelined)
+            shared_sync.wait_until_gui_consumes_frame();
+
+        // Captured frames read back on the GUI thread while the worker moves on (their metadata was taken
+        // when they were captured). Recording keeps up to ring_size reads in flight, a snapshot encodes a
+        // single frame so it waits for it to reach the encoder.
+        if (capturing)
+        {
+            const int max_in_flight = capture_manager->isRecording() ? PixelReadbackRing::ring_size : 1;
+            capture_manager->waitForFrameReadbackSlot(max_in_flight);
+        }
 
         /// ────── Do heavy work (while GUI thread redraws cached frame) ──────
         if (current_project && current_project->started) 
@@ -211,34 +232,51 @@ void ProjectWorker::worker_loop()
                 capture_manager->waitUntilReadyForNewFrame();
         }
 
-        // delay to achieve target fps (minus time taken to draw the frame)
+        // wait for this frame's absolute deadline (late frames are handled by the overrun policy)
         if (!immediate_update_requested)
         {
-            auto dt = std::chrono::steady_clock::now() - last_frame_time;
-            uint64_t target_ns = 1000000000 / main_window()->getFPS();
-            uint64_t frame_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count());
-            uint64_t delay_ns = std::max((uint64_t)0, target_ns - frame_ns);
-            if (delay_ns > 0) SDL_DelayPrecise(delay_ns);
+            frame_pacer.setTargetFPS(main_window()->getFPS());
+            frame_pacer.setOverrunPolicy(main_window()->getSettingsConfig()->frame_overrun_policy);
+            frame_pacer.wait();
         }
         else
         {
+            // unpaced frame, re-anchor the cadence afterwards
+            frame_pacer.release();
+            frame_pacer.reset();
+
             shared_sync.setImmediateUpdate(true);
             immediate_update_requested = false;
         }
 
-        last_frame_time = std::chrono::steady_clock::now();
+        /// ────── Snapshot draw state & flag ready to draw ──────
+        {
+            // pipelined: blocks while (depth-1) frames are still queued for the GUI
+            auto state_lock = shared_sync.wait_for_free_frame_slot(pipeline_depth);
+
+            if (current_project && current_project->started)
+                current_project->_snapshotDrawState(shared_sync.publish_slot());
 
-        /// ────── Flag ready to draw ──────
-        shared_sync.flag_ready_to_draw();
+            if (const double interval_ms = frame_pacer.lastIntervalMs(); interval_ms > 0)
+                shared_sync.push_paced_interval_locked(interval_ms);
+
+            shared_sync.publish_frame_locked(pipeline_depth);
+        }
 
         /// ────── Wake GUI ──────
         shared_sync.cv.notify_one();
 
-        /// ────── Wait for GUI to draw the freshly prepared data ──────
-        shared_sync.wait_until_gui_consumes_frame();
+        /// ────── Lockstep: wait for GUI to draw the freshly prepared data ──────
+        if (!pipelined)
+            shared_sync.wait_until_gui_consumes_frame();
 
+        // Pipelined: the GUI may be drawing a published frame, which holds state_mutex for the whole
+        // draw. Clearing needs_redraw and the change trackers mustn't overlap it.
         if (current_project)
+        {
+            std::lock_guard<std::mutex> state_lock(shared_sync.state_mutex);
             current_project->_onEndFrame();
+        }
     }
 }
 
@@ -325,6 +363,12 @@ void ProjectWorker::onEncodeFrame(EncodeFrame& data, int request_id, const Captu
         current_project->_onEncodeFrame(data, request_id, preset);
 }
 
+void ProjectWorker::onFrameReadBack(EncodeFrame& data, int request_id, const CapturePreset& preset)
+{
+    if (current_project)
+        current_project->_onFrameReadBack(data, request_id, preset);
+}
+
 void ProjectWorker::_onEvent(SDL_Event& e)
 {
     BL_TAKE_OWNERSHIP("live");
@@ -333,12 +377,12 @@ void ProjectWorker::_onEvent(SDL_Event& e)
         current_project->_onEvent(e);
 }
 
-void ProjectWorker::draw()
+void ProjectWorker::draw(int frame_slot)
 {
     BL_TAKE_OWNERSHIP("live");
 
     if (current_project)
-        current_project->_projectDraw();
+        current_project->_projectDraw(frame_slot);
 }
 
 BL_END_NS
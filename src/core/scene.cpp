@@ -108,10 +108,13 @@ bool SceneBase::isCapturing() const
     return isSnapshotting() || isRecording();
 }
 
-void SceneBase::_onEncodeFrame(EncodeFrame& data, int request_id, const CapturePreset& preset)
+void SceneBase::_onEncodeFrame(EncodeFrame& data, int request_id [[maybe_unused]], const CapturePreset& preset)
 {
     onEncodeFrame(data, preset);
+}
 
+void SceneBase::_onFrameReadBack(EncodeFrame& data, int request_id, const CapturePreset& preset)
+{
     for (size_t i = 0; i < snapshot_callbacks.size(); i++)
     {
         const auto& [callback_id, batch_callbacks] = snapshot_callbacks[i];
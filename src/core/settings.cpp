@@ -389,6 +389,16 @@ void SettingsPanel::populateSettings()
             config.record_fps = std::clamp(config.record_fps, 1, 100);
             config.updateRecordBitrate();
         }
+        bool catch_up = config.frame_overrun_policy == FrameOverrunPolicy::CATCH_UP;
+        if (ImGui::Checkbox("Catch up late frames", &catch_up))
+            config.frame_overrun_policy = catch_up ? FrameOverrunPolicy::CATCH_UP : FrameOverrunPolicy::SKIP;
+
+        ImGui::Text("Frame pipeline depth:");
+        if (ImGui::SliderInt("##pipeline_depth", &config.pipeline_depth, 1, SharedSync::max_pipeline_depth,
+            config.pipeline_depth == 1 ? "lockstep" : "%d frames"))
+        {
+            config.pipeline_depth = std::clamp(config.pipeline_depth, 1, SharedSync::max_pipeline_depth);
+        }
         ImGui::Checkbox("Show FPS in toolbar", &config.show_fps);
         ImGui::Checkbox("Fill viewport", &config.fill_viewport);
         ImGui::EndLabelledBox();
@@ -15,6 +15,15 @@ Viewport::Viewport(Layout* layout, int viewport_index, int grid_x, int grid_y) :
 
 Viewport::~Viewport()
 {
+    // GL objects belong to the GUI thread
+    if (surface.fbo)
+    {
+        if (main_window()->threadQueue().isOwnerThread())
+            surface.destroy();
+        else
+            main_window()->threadQueue().post([s = surface]() mutable noexcept { s.destroy(); });
+    }
+
     if (scene)
     {
         // Unmount sim from viewport
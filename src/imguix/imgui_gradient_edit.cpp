@@ -7,6 +7,7 @@
 
 
 #include <bitloop/imguix/imgui_gradient_edit.h>
+#include <bitloop/core/cpu_kernels.h>
 #include <cstdint>
 #include <optional>
 
@@ -16,6 +17,11 @@ static const float GRADIENT_MARK_DELETE_DIFFY = 40;
 
 int ImGradient::uid_counter = 0;
 
+void ImGradient::mapRGBA(const float* positions, uint32_t* out, size_t n) const
+{
+    bl::cpuKernels().map_colors(positions, out, n, m_cachedColors, CACHE_SIZE);
+}
+
 void ImGradient::clear() noexcept
 {
     m_marks.clear();
@@ -1,5 +1,6 @@
 #include <bitloop/nanovgx/nano_canvas.h>
 #include <bitloop/core/project.h>
+#include <bitloop/util/fltx/shortest_chars.h>
 
 BL_BEGIN_NS
 
@@ -51,59 +52,31 @@ inline flt niceStepDivisible(flt ideal, flt& coarse, flt& fade)
     return step;
 }
 
-std::string Painter::formatNumberScientific(f64 v, int decimals, f64 fixed_min, f64 fixed_max) {
-    char buffer[32];
-    f64 abs_v = std::abs(v);
-
-    char fmt[8];
-
-    if ((abs_v != 0.0 && abs_v < fixed_min) || abs_v >= fixed_max) {
-        // Use scientific notation
-        std::snprintf(fmt, sizeof(fmt), "%%.%de", decimals);
-        std::snprintf(buffer, sizeof(buffer), fmt, v);
-    }
-    else {
-        // Use fixed-point
-        std::snprintf(fmt, sizeof(fmt), "%%.%df", decimals);
-        std::snprintf(buffer, sizeof(buffer), fmt, v);
-    }
-
-    std::string s(buffer);
-
-    // Trim trailing zeros (both fixed and scientific cases)
-    size_t dot_pos = s.find('.');
-    if (dot_pos != std::string::npos) {
-        size_t end = s.find_first_of("eE", dot_pos); // handle scientific part separately
-        size_t trim_end = (end == std::string::npos) ? s.size() : end;
+std::string_view Painter::formatNumberScientific(char* buf, size_t buf_size, f64 v, int decimals, f64 fixed_min, f64 fixed_max)
+{
+    const f64 abs_v = std::abs(v);
+    const bool scientific = (abs_v != 0.0 && abs_v < fixed_min) || abs_v >= fixed_max;
 
-        // Trim zeros in the fractional part
-        size_t last_nonzero = s.find_last_not_of('0', trim_end - 1);
-        if (last_nonzero != std::string::npos && s[last_nonzero] == '.') {
-            last_nonzero--; // also remove the decimal point
-        }
+    // rounded to 'decimals' places (fixed) or 'decimals' digits after the leading one (scientific),
+    // never more digits than needed to round-trip
+    fltx_decimal d;
+    if (scientific) shortest_decimal(v, d, decimals + 1);
+    else            shortest_decimal(v, d, 0, decimals);
 
-        s.erase(last_nonzero + 1, trim_end - last_nonzero - 1);
-    }
-
-    return s;
+    const auto r = decimal_to_chars(buf, buf + buf_size, d, !scientific, scientific);
+    return std::string_view(buf, r.ok ? size_t(r.ptr - buf) : 0);
 }
-std::string Painter::formatNumberScientific(f128 v, int decimals, f64 fixed_min, f64 fixed_max) {
-    f128 abs_v = abs(v);
+std::string_view Painter::formatNumberScientific(char* buf, size_t buf_size, f128 v, int decimals, f64 fixed_min, f64 fixed_max)
+{
+    const f128 abs_v = abs(v);
+    const bool scientific = (abs_v != 0 && abs_v < fixed_min) || abs_v >= fixed_max;
 
-    std::string s;
-    if ((abs_v != 0 && abs_v < fixed_min) || abs_v >= fixed_max)
-    {
-        // Use scientific notation (strip zeros)
-        s = to_string(abs_v, decimals, false, true, true);
-    }
-    else {
-        // Use fixed-point (keep trailing zeros for consistency)
-        s = to_string(abs_v, decimals, true, false, false);
-    }
-    if (v >= 0)
-        return s;
-    else
-        return '-' + s;
+    fltx_decimal d;
+    if (scientific) shortest_decimal(v, d, decimals + 1);
+    else            shortest_decimal(v, d, 0, decimals);
+
+    const auto r = decimal_to_chars(buf, buf + buf_size, d, !scientific, scientific);
+    return std::string_view(buf, r.ok ? size_t(r.ptr - buf) : 0);
 }
 
 void Painter::drawWorldAxis(f64 axis_opacity, f64 grid_opacity, f64 text_opacity)
@@ -219,6 +192,7 @@ void Painter::drawWorldAxis(f64 axis_opacity, f64 grid_opacity, f64 text_opacity
             // multiply epsilon by large number of potential steps to avoid rounding error
             const flt eps = 100.0 * std::numeric_limits<flt>::epsilon();
 
+            char txt_buf[64];
             for (flt w = math::roundUp(wStart, step); w < wEnd; w += step)
             {
                 if (abs(w) < eps) continue;
@@ -231,7 +205,7 @@ void Painter::drawWorldAxis(f64 axis_opacity, f64 grid_opacity, f64 text_opacity
                 setStrokeStyle(255, 255, 255, aTick);
                 strokeLineSharp(DVec2{stage_pos - perpDir * tick_length}, DVec2{stage_pos + perpDir * tick_length});
 
-                std::string txt = formatNumberScientific(w, decimals);
+                const std::string_view txt = formatNumberScientific(txt_buf, sizeof(txt_buf), w, decimals);
 
                 constexpr f64 spacing = 3;
                 DVec2 txt_size = DVec2{ boundingBoxScientific<f64, flt>(txt).size().x * 0.75, standard_txt_size.y };
@@ -388,6 +362,42 @@ void NanoCanvas::end()
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
+void NanoCanvas::beginSurface(GLSurface& surface, f32 r, f32 g, f32 b, f32 a)
+{
+    // flush the canvas commands so far while its framebuffer is still bound
+    nvgEndFrame(context.vg);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, surface.fbo);
+    glViewport(0, 0, surface.width, surface.height);
+    glClearColor(r, g, b, a);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+    nvgBeginFrame(context.vg,
+        static_cast<f32>(surface.width),
+        static_cast<f32>(surface.height),
+        static_cast<f32>(context.global_scale)
+    );
+
+    // nanovg state was reset, make the next setFont() apply again
+    context.active_font = {};
+}
+
+void NanoCanvas::endSurface()
+{
+    nvgEndFrame(context.vg);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glViewport(0, 0, fbo_w, fbo_h);
+
+    nvgBeginFrame(context.vg,
+        static_cast<f32>(fbo_w),
+        static_cast<f32>(fbo_h),
+        static_cast<f32>(context.global_scale)
+    );
+
+    context.active_font = {};
+}
+
 bool NanoCanvas::readPixels(std::vector<uint8_t>& out_rgba)
 {
     if (!fbo || fbo_w <= 0 || fbo_h <= 0) return false;
@@ -406,4 +416,138 @@ bool NanoCanvas::readPixels(std::vector<uint8_t>& out_rgba)
     return true;
 }
 
+// ======== PixelReadbackRing ========
+
+bool PixelReadbackRing::queue(GLuint fbo, int w, int h)
+{
+    if (w <= 0 || h <= 0 || count == ring_size)
+        return false;
+
+    Slot& s = slots[(head + count) % ring_size];
+    const size_t bytes = (size_t)w * h * 4;
+    s.w = w;
+    s.h = h;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    #ifdef __EMSCRIPTEN__
+    s.cpu.resize(bytes);
+    glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, s.cpu.data());
+    #else
+    if (!s.pbo)
+        glGenBuffers(1, &s.pbo);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, s.pbo);
+    if (s.capacity != bytes)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)bytes, nullptr, GL_STREAM_READ);
+        s.capacity = bytes;
+    }
+
+    // offset 0 into the bound pack buffer, returns without waiting for the GPU
+    glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    s.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush(); // make sure the read is submitted before the fence is polled
+    #endif
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    count++;
+    return true;
+}
+
+bool PixelReadbackRing::mapOldest(bool wait, const uint8_t*& data)
+{
+    data = nullptr;
+    if (count == 0)
+        return false;
+
+    Slot& s = slots[head];
+
+    #ifdef __EMSCRIPTEN__
+    (void)wait;
+    data = s.cpu.data();
+    #else
+    if (s.fence)
+    {
+        // a finished read maps without stalling, otherwise poll (or block) on the fence
+        const GLuint64 timeout_ns = wait ? 1000000000ull : 0;
+        GLenum r;
+        do {
+            r = glClientWaitSync(s.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout_ns);
+        } while (wait && r == GL_TIMEOUT_EXPIRED);
+
+        if (r == GL_TIMEOUT_EXPIRED)
+            return false;
+
+        glDeleteSync(s.fence);
+        s.fence = nullptr;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, s.pbo);
+    data = static_cast<const uint8_t*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)s.capacity, GL_MAP_READ_BIT));
+    s.mapped = (data != nullptr);
+
+    if (!s.mapped)
+    {
+        // the read has finished, copy it out instead of losing the frame
+        if (!map_failure_reported)
+        {
+            blPrint() << "PixelReadbackRing: glMapBufferRange failed, copying with glGetBufferSubData";
+            map_failure_reported = true;
+        }
+        s.cpu.resize(s.capacity);
+        glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)s.capacity, s.cpu.data());
+        data = s.cpu.data();
+    }
+    #endif
+
+    return true;
+}
+
+void PixelReadbackRing::unmapOldest()
+{
+    #ifndef __EMSCRIPTEN__
+    Slot& s = slots[head];
+    if (s.mapped)
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER); // still bound by mapOldest
+    s.mapped = false;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    #endif
+
+    head = (head + 1) % ring_size;
+    count--;
+}
+
+void PixelReadbackRing::discard()
+{
+    for (Slot& s : slots)
+    {
+        #ifndef __EMSCRIPTEN__
+        if (s.fence) glDeleteSync(s.fence);
+        #endif
+        s.fence = nullptr;
+    }
+    head = 0;
+    count = 0;
+}
+
+void PixelReadbackRing::destroy()
+{
+    discard();
+    for (Slot& s : slots)
+    {
+        #ifndef __EMSCRIPTEN__
+        if (s.pbo) glDeleteBuffers(1, &s.pbo);
+        #endif
+        s.pbo = 0;
+        s.capacity = 0;
+        s.cpu.clear();
+    }
+}
+
 BL_END_NS
@@ -0,0 +1,154 @@
+#include <bitloop/util/cpu_dispatch.h>
+
+#include <atomic>
+#include <cstdlib>
+
+#if defined(BL_CPU_X86) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+BL_BEGIN_NS;
+
+namespace {
+
+CpuLevel detectUncached()
+{
+    #if defined(BL_CPU_X86) && (defined(__GNUC__) || defined(__clang__))
+    // libgcc/compiler-rt also check XCR0, so AVX state must be enabled by the OS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return CpuLevel::AVX512;
+    if (__builtin_cpu_supports("avx2"))    return CpuLevel::AVX2;
+    return CpuLevel::BASELINE;
+
+    #elif defined(BL_CPU_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const int max_leaf = info[0];
+    if (max_leaf < 7) return CpuLevel::BASELINE;
+
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx     = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx) return CpuLevel::BASELINE;
+
+    const unsigned long long xcr0 = _xgetbv(0);
+    const bool ymm_state = (xcr0 & 0x06) == 0x06;
+    const bool zmm_state = (xcr0 & 0xe6) == 0xe6;
+
+    __cpuidex(info, 7, 0);
+    const bool avx2    = (info[1] & (1 << 5)) != 0;
+    const bool avx512f = (info[1] & (1 << 16)) != 0;
+
+    if (avx512f && zmm_state) return CpuLevel::AVX512;
+    if (avx2 && ymm_state)    return CpuLevel::AVX2;
+    return CpuLevel::BASELINE;
+
+    #else
+    return CpuLevel::BASELINE;
+    #endif
+}
+
+CpuLevel clampToDetected(CpuLevel level)
+{
+    const CpuLevel detected = detectCpuLevel();
+    return static_cast<int>(level) > static_cast<int>(detected) ? detected : level;
+}
+
+CpuLevel initialLevel()
+{
+    CpuLevel level = detectCpuLevel();
+    if (const char* env = std::getenv("BL_CPU_LEVEL"))
+    {
+        CpuLevel forced;
+        if (parseCpuLevel(env, forced))
+            level = clampToDetected(forced);
+    }
+    return level;
+}
+
+std::atomic<int>& activeLevel()
+{
+    static std::atomic<int> level{ static_cast<int>(initialLevel()) };
+    return level;
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        char ca = a[i], cb = b[i];
+        if (ca >= 'A' && ca <= 'Z') ca = char(ca - 'A' + 'a');
+        if (cb >= 'A' && cb <= 'Z') cb = char(cb - 'A' + 'a');
+        if (ca != cb) return false;
+    }
+    return true;
+}
+
+} // end anon
+
+const char* cpuLevelName(CpuLevel level)
+{
+    switch (level)
+    {
+    case CpuLevel::SCALAR:   return "scalar";
+    case CpuLevel::BASELINE: return "baseline";
+    case CpuLevel::AVX2:     return "avx2";
+    case CpuLevel::AVX512:   return "avx512";
+    default:                 return "?";
+    }
+}
+
+bool parseCpuLevel(std::string_view name, CpuLevel& out)
+{
+    for (int i = 0; i < static_cast<int>(CpuLevel::COUNT); i++)
+    {
+        if (equalsIgnoreCase(name, cpuLevelName(CpuLevel(i))))
+        {
+            out = CpuLevel(i);
+            return true;
+        }
+    }
+    if (equalsIgnoreCase(name, "sse2"))
+    {
+        out = CpuLevel::BASELINE;
+        return true;
+    }
+    return false;
+}
+
+CpuLevel detectCpuLevel()
+{
+    static const CpuLevel detected = detectUncached();
+    return detected;
+}
+
+CpuLevel cpuLevel()
+{
+    return CpuLevel(activeLevel().load(std::memory_order_relaxed));
+}
+
+CpuLevel setCpuLevel(CpuLevel level)
+{
+    const CpuLevel applied = clampToDetected(level);
+    activeLevel().store(static_cast<int>(applied), std::memory_order_relaxed);
+    return applied;
+}
+
+void applyCpuLevelArgs(int argc, char* argv[])
+{
+    constexpr std::string_view prefix = "--cpu-level=";
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg = argv[i] ? argv[i] : "";
+        if (!arg.starts_with(prefix))
+            continue;
+
+        CpuLevel level;
+        if (parseCpuLevel(arg.substr(prefix.size()), level))
+            setCpuLevel(level);
+    }
+}
+
+BL_END_NS;
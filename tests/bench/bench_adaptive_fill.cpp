@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/core/raster_grid.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int bench_w = 1920;
+    constexpr int bench_h = 1080;
+    constexpr int max_iter = 1024;
+
+    int escapeTime(f64 cx, f64 cy)
+    {
+        f64 x = 0, y = 0;
+        int i = 0;
+        for (; i < max_iter; ++i)
+        {
+            const f64 xx = x * x, yy = y * y;
+            if (xx + yy > 4.0) break;
+            y = 2.0 * x * y + cy;
+            x = xx - yy + cx;
+        }
+        return i;
+    }
+
+    struct MandelView
+    {
+        const char* name;
+        f64 x, y, w, h;
+    };
+
+    const MandelView views[] = {
+        { "full set",       -2.5,        -1.125,     4.0,    2.25     },
+        { "seahorse valley", -0.7530,     0.0920,    0.0120, 0.00675  },
+        { "deep spiral",    -0.74364392, 0.13182588, 2.4e-7, 1.35e-7  },
+    };
+
+    void renderFull(WorldRasterGridT<f64>& grid, std::vector<int>& out)
+    {
+        int row = 0;
+        grid.forEachWorldPixel<f64>(row, [&](int x, int y, f64 wx, f64 wy) {
+            out[y * bench_w + x] = escapeTime(wx, wy);
+        });
+    }
+
+    void renderAdaptive(WorldRasterGridT<f64>& grid, std::vector<int>& out, AdaptiveFillStats* stats)
+    {
+        TileBlockProgress progress;
+        grid.forEachWorldPixelAdaptive<f64>(progress,
+            [&](int x, int y, f64 wx, f64 wy) { return out[y * bench_w + x] = escapeTime(wx, wy); },
+            [](int a, int b) { return a == b; },
+            [&](int x0, int y0, int x1, int y1, int v) {
+                for (int y = y0; y < y1; ++y)
+                    std::fill(out.begin() + (y * bench_w + x0), out.begin() + (y * bench_w + x1), v);
+            },
+            Thread::threadCount(), 0, 64, stats);
+    }
+}
+
+TEST_CASE("forEachWorldPixelAdaptive vs full traversal (Mandelbrot)", "[bench]")
+{
+    std::vector<int> full(bench_w * bench_h), adaptive(bench_w * bench_h);
+
+    for (const MandelView& view : views)
+    {
+        WorldRasterGridT<f64> grid;
+        grid.setRasterSize(bench_w, bench_h);
+        grid.setWorldRect(view.x, view.y, view.w, view.h);
+
+        renderFull(grid, full);
+
+        AdaptiveFillStats stats;
+        renderAdaptive(grid, adaptive, &stats);
+
+        size_t mismatched = 0;
+        for (size_t i = 0; i < full.size(); ++i)
+            mismatched += (full[i] != adaptive[i]);
+
+        const double total = double(bench_w) * bench_h;
+        std::printf("%-16s callbacks: %llu / %.0f (%.1f%% saved), filled: %llu, mismatched pixels: %zu\n",
+            view.name,
+            (unsigned long long)stats.evaluated.load(), total,
+            100.0 * (1.0 - double(stats.evaluated.load()) / total),
+            (unsigned long long)stats.filled.load(), mismatched);
+
+        SECTION(view.name)
+        {
+            BENCHMARK("full")     { renderFull(grid, full); return full[0]; };
+            BENCHMARK("adaptive") { renderAdaptive(grid, adaptive, nullptr); return adaptive[0]; };
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/nanovgx/nano_canvas.h>
+
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace bl;
+
+// CPU cost of drawing particles: nanovg runs with no-op render callbacks, so path building, flattening
+// and fill/stroke expansion are measured but nothing reaches the GPU.
+
+namespace {
+    template<class R, class... A>
+    auto noop(R(*)(A...)) -> R(*)(A...)
+    {
+        return [](A...) -> R { if constexpr (!std::is_void_v<R>) return R(1); };
+    }
+
+    struct HeadlessNanoVG
+    {
+        NVGcontext* vg = nullptr;
+
+        HeadlessNanoVG()
+        {
+            NVGparams params{};
+            params.edgeAntiAlias = 1;
+            params.renderCreate = noop(params.renderCreate);
+            params.renderCreateTexture = noop(params.renderCreateTexture);
+            params.renderDeleteTexture = noop(params.renderDeleteTexture);
+            params.renderUpdateTexture = noop(params.renderUpdateTexture);
+            params.renderGetTextureSize = noop(params.renderGetTextureSize);
+            params.renderViewport = noop(params.renderViewport);
+            params.renderCancel = noop(params.renderCancel);
+            params.renderFlush = noop(params.renderFlush);
+            params.renderFill = noop(params.renderFill);
+            params.renderStroke = noop(params.renderStroke);
+            params.renderTriangles = noop(params.renderTriangles);
+            params.renderDelete = noop(params.renderDelete);
+            vg = nvgCreateInternal(&params);
+        }
+
+        ~HeadlessNanoVG() { nvgDeleteInternal(vg); }
+    };
+
+    // 1280x720 view of a 1000x1000 world
+    DDMat3 viewTransform()
+    {
+        DDMat3 view = dd_translate(f128{ 640 }, f128{ 360 });
+        view *= dd_scale(f128{ 0.7 }, f128{ 0.7 });
+        view *= dd_translate(f128{ -500 }, f128{ -500 });
+        return view;
+    }
+
+    template<class T>
+    std::vector<Vec2<T>> particles(size_t n)
+    {
+        std::mt19937_64 rng(1);
+        std::uniform_real_distribution<double> d(0.0, 1000.0);
+
+        std::vector<Vec2<T>> out(n);
+        for (auto& p : out) p = { T{ d(rng) }, T{ d(rng) } };
+        return out;
+    }
+
+    std::vector<Color> palette(size_t n)
+    {
+        std::vector<Color> out(n);
+        for (size_t i = 0; i < n; i++) out[i] = (i * 4 / n == 0) ? Color(255, 80, 80) : Color(80, 160, 255);
+        return out;
+    }
+
+    struct Frame
+    {
+        HeadlessNanoVG& nano;
+        PainterContext& ctx;
+        Painter painter{ nullptr };
+
+        Frame(HeadlessNanoVG& n, PainterContext& c) : nano(n), ctx(c)
+        {
+            nvgBeginFrame(nano.vg, 1280, 720, 1);
+            painter.setTargetPainterContext(&ctx);
+            painter.transform(viewTransform());
+            painter.setFillStyle(255, 255, 255);
+            painter.setStrokeStyle(255, 255, 255);
+        }
+
+        ~Frame() { nvgEndFrame(nano.vg); }
+    };
+}
+
+TEST_CASE("World->stage transform", "[bench][batch]")
+{
+    WorldStageTransform m;
+    m.transform(viewTransform());
+
+    for (size_t n : { 10'000, 100'000, 1'000'000 })
+    {
+        const auto p64 = particles<f64>(n);
+        const auto p128 = particles<f128>(n);
+        std::vector<DVec2> out(n);
+        const std::string count = std::to_string(n);
+
+        BENCHMARK("f64 per point, " + count)
+        {
+            for (size_t i = 0; i < n; i++) out[i] = m.toStage<f64>(p64[i]);
+            return out[n - 1];
+        };
+
+        BENCHMARK("f64 batch, " + count)
+        {
+            m.toStage<f64>(p64.data(), out.data(), n);
+            return out[n - 1];
+        };
+
+        BENCHMARK("f128 per point, " + count)
+        {
+            for (size_t i = 0; i < n; i++) out[i] = m.toStage<f128>(p128[i]);
+            return out[n - 1];
+        };
+
+        BENCHMARK("f128 batch, " + count)
+        {
+            m.toStage<f128>(p128.data(), out.data(), n);
+            return out[n - 1];
+        };
+    }
+}
+
+TEST_CASE("Drawing particles", "[bench][batch]")
+{
+    HeadlessNanoVG nano;
+    PainterContext ctx;
+    ctx.vg = nano.vg;
+
+    for (size_t n : { 10'000, 100'000, 1'000'000 })
+    {
+        const auto pts = particles<f64>(n);
+        const auto colors = palette(n);
+        const std::string count = std::to_string(n);
+
+        // one path + fill per primitive takes seconds per frame at 1M, only measured up to 100k
+        if (n <= 100'000)
+        {
+            BENCHMARK("circle() per particle, " + count)
+            {
+                Frame f(nano, ctx);
+                for (size_t i = 0; i < n; i++)
+                {
+                    f.painter.beginPath();
+                    f.painter.circle(pts[i], 2.0);
+                    f.painter.setFillStyle(colors[i]);
+                    f.painter.fill();
+                }
+                return n;
+            };
+        }
+
+        BENCHMARK("drawCircles, " + count)
+        {
+            Frame f(nano, ctx);
+            f.painter.drawCircles(pts, 2.0, colors);
+            return n;
+        };
+
+        BENCHMARK("drawPoints, " + count)
+        {
+            Frame f(nano, ctx);
+            f.painter.drawPoints(pts, 2.0, colors);
+            return n;
+        };
+
+        BENCHMARK("drawRects, " + count)
+        {
+            Frame f(nano, ctx);
+            f.painter.drawRects(pts, std::vector<DVec2>{ { 2, 2 } }, colors);
+            return n;
+        };
+
+        BENCHMARK("drawLines, " + count)
+        {
+            Frame f(nano, ctx);
+            f.painter.drawLines(pts, colors);
+            return n;
+        };
+    }
+}
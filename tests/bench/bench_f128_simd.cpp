@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/util/fltx/f128_simd.h>
+
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int point_count = 4096;
+    constexpr int max_iter = 256;
+
+    // a row of points across a 1e-20 wide window, well past f64 precision
+    std::vector<f128> rowPoints()
+    {
+        const f128 cx = f128{ -0.743643887037151, 1.3e-18 };
+        const f128 w  = f128{ 1e-20, 0.0 };
+
+        std::vector<f128> out(point_count);
+        for (int i = 0; i < point_count; i++)
+            out[i] = cx + w * f128{ (double)i / point_count - 0.5, 0.0 };
+        return out;
+    }
+
+    int escapeScalar(f128 cx, f128 cy)
+    {
+        f128 x{ 0.0, 0.0 }, y{ 0.0, 0.0 };
+        int i = 0;
+        for (; i < max_iter; ++i)
+        {
+            const f128 xx = x * x, yy = y * y;
+            if (xx + yy > 4.0) break;
+            y = (x + x) * y + cy;
+            x = xx - yy + cx;
+        }
+        return i;
+    }
+
+    // same recurrence, lanes that escaped keep their iteration count and stop updating
+    template<class V>
+    void escapePacked(const f128* cx_p, f128 cy_s, int* out)
+    {
+        constexpr int L = V::lanes;
+        const V cx = V::load(cx_p);
+        const V cy = V::broadcast(cy_s);
+        const V four = V::broadcast(4.0);
+
+        V x = V::broadcast(0.0), y = V::broadcast(0.0);
+        int iters[L] = {};
+        int active = (1 << L) - 1;
+
+        for (int i = 0; i < max_iter && active; ++i)
+        {
+            const V xx = x * x, yy = y * y;
+            const int escaped = (xx + yy > four).bits() & active;
+            for (int l = 0; l < L; l++)
+                if (escaped & (1 << l)) iters[l] = i;
+            active &= ~escaped;
+
+            y = (x + x) * y + cy;
+            x = xx - yy + cx;
+        }
+
+        for (int l = 0; l < L; l++)
+            out[l] = (active & (1 << l)) ? max_iter : iters[l];
+    }
+}
+
+TEST_CASE("Packed f128 escape-time kernel vs scalar f128", "[bench][f128]")
+{
+    const f128 cy = f128{ 0.131825904205330, -3.1e-19 };
+    const auto cx = rowPoints();
+
+    std::vector<int> ref(point_count), packed2(point_count), packed4(point_count);
+    for (int i = 0; i < point_count; i++) ref[i] = escapeScalar(cx[i], cy);
+    for (int i = 0; i < point_count; i += 2) escapePacked<simd2::f128x2>(&cx[i], cy, &packed2[i]);
+    for (int i = 0; i < point_count; i += 4) escapePacked<simd2::f128x4>(&cx[i], cy, &packed4[i]);
+
+    // lanes compute exactly the scalar sequence, so iteration counts match exactly
+    REQUIRE(ref == packed2);
+    REQUIRE(ref == packed4);
+
+    BENCHMARK("scalar f128")
+    {
+        int sum = 0;
+        for (int i = 0; i < point_count; i++) sum += escapeScalar(cx[i], cy);
+        return sum;
+    };
+
+    BENCHMARK("f128x2")
+    {
+        int out[2], sum = 0;
+        for (int i = 0; i < point_count; i += 2) { escapePacked<simd2::f128x2>(&cx[i], cy, out); sum += out[0] + out[1]; }
+        return sum;
+    };
+
+    BENCHMARK("f128x4")
+    {
+        int out[4], sum = 0;
+        for (int i = 0; i < point_count; i += 4) { escapePacked<simd2::f128x4>(&cx[i], cy, out); sum += out[0] + out[1] + out[2] + out[3]; }
+        return sum;
+    };
+}
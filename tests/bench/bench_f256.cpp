@@ -0,0 +1,168 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/util/fltx/f128.h>
+#include <bitloop/util/fltx/f256.h>
+#include <bitloop/util/fltx/f256_simd.h>
+
+#include <random>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int value_count = 1024;
+    constexpr int orbit_steps = 1000;
+
+    std::vector<f256> sampleValues(uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> dist(0.5, 2.0);
+
+        std::vector<f256> out;
+        for (int i = 0; i < value_count; i++)
+        {
+            const double v = dist(rng);
+            out.push_back(f256::from_limbs(v, v * 0x1p-55, v * 0x1p-110, v * 0x1p-165));
+        }
+        return out;
+    }
+
+    std::vector<f128> narrow(const std::vector<f256>& v)
+    {
+        std::vector<f128> out;
+        for (const f256& x : v) out.push_back(f128{ x.x0, x.x1 });
+        return out;
+    }
+
+    // one reference-orbit step, z = z^2 + c
+    template<class T>
+    T orbit(T zr, T zi, const T& cr, const T& ci)
+    {
+        for (int i = 0; i < orbit_steps; i++)
+        {
+            const T zr2 = zr * zr;
+            const T zi2 = zi * zi;
+            const T zri = zr * zi;
+            zr = zr2 - zi2 + cr;
+            zi = zri + zri + ci;
+        }
+        return zr + zi;
+    }
+}
+
+TEST_CASE("f256 vs f128 arithmetic throughput", "[bench][fltx]")
+{
+    const auto a256 = sampleValues(1);
+    const auto b256 = sampleValues(2);
+    const auto a128 = narrow(a256);
+    const auto b128 = narrow(b256);
+
+    BENCHMARK("f128 add")
+    {
+        f128 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc = acc + (a128[i] + b128[i]);
+        return acc;
+    };
+
+    BENCHMARK("f256 add (accurate)")
+    {
+        f256 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc = f256::add_accurate(acc, f256::add_accurate(a256[i], b256[i]));
+        return acc;
+    };
+
+    BENCHMARK("f256 add (sloppy)")
+    {
+        f256 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc = f256::add_sloppy(acc, f256::add_sloppy(a256[i], b256[i]));
+        return acc;
+    };
+
+    BENCHMARK("f128 mul")
+    {
+        f128 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc = acc + a128[i] * b128[i];
+        return acc;
+    };
+
+    BENCHMARK("f256 mul")
+    {
+        f256 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc += a256[i] * b256[i];
+        return acc;
+    };
+
+    BENCHMARK("f256 sqr")
+    {
+        f256 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc += sqr(a256[i]);
+        return acc;
+    };
+
+    BENCHMARK("f128 div")
+    {
+        f128 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc = acc + a128[i] / b128[i];
+        return acc;
+    };
+
+    BENCHMARK("f256 div")
+    {
+        f256 acc(0.0);
+        for (int i = 0; i < value_count; i++) acc += a256[i] / b256[i];
+        return acc;
+    };
+}
+
+TEST_CASE("f256 vs f128 reference orbit", "[bench][fltx]")
+{
+    const f256 cr(-0.743643887037158704752191506114774, 0.0, 0.0, 0.0);
+    const f256 ci(0.131825904205311970493132056385139, 0.0, 0.0, 0.0);
+
+    BENCHMARK("f128 orbit")
+    {
+        return orbit<f128>(f128(0.0), f128(0.0), f128{ cr.x0, cr.x1 }, f128{ ci.x0, ci.x1 });
+    };
+
+    BENCHMARK("f256 orbit")
+    {
+        return orbit<f256>(f256(0.0), f256(0.0), cr, ci);
+    };
+
+    BENCHMARK("f256xN orbit (one c per lane)")
+    {
+        using V = simd2::f256xN;
+        return orbit<V>(V::broadcast(0.0), V::broadcast(0.0), V::broadcast(cr), V::broadcast(ci)).lane(0);
+    };
+}
+
+TEST_CASE("f256 batch ops vs scalar loops", "[bench][fltx]")
+{
+    const auto a = sampleValues(3);
+    const auto b = sampleValues(4);
+    std::vector<f256> out(value_count);
+
+    BENCHMARK("scalar mul loop")
+    {
+        for (int i = 0; i < value_count; i++) out[i] = a[i] * b[i];
+        return out[value_count - 1];
+    };
+
+    BENCHMARK("f256_batch::mul")
+    {
+        f256_batch::mul(a.data(), b.data(), out.data(), value_count);
+        return out[value_count - 1];
+    };
+
+    BENCHMARK("scalar sloppy add loop")
+    {
+        for (int i = 0; i < value_count; i++) out[i] = f256::add_sloppy(a[i], b[i]);
+        return out[value_count - 1];
+    };
+
+    BENCHMARK("f256_batch::add")
+    {
+        f256_batch::add(a.data(), b.data(), out.data(), value_count);
+        return out[value_count - 1];
+    };
+}
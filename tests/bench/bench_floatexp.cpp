@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/core/perturbation.h>
+
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int point_count = 4096;
+    constexpr int max_iter = 256;
+
+    // the same escape-time recurrence in each candidate type, points in a window 'size' wide
+    template<typename T>
+    int escapeRow(double size)
+    {
+        int sum = 0;
+        for (int p = 0; p < point_count; ++p)
+        {
+            const Complex<T> c{ T(-0.75 + size * ((double)p / point_count - 0.5)), T(0.1) };
+            Complex<T> z{ T(0), T(0) };
+            int i = 0;
+            while (i < max_iter && !(z.mag2() > T(4.0)))
+            {
+                z = z * z + c;
+                ++i;
+            }
+            sum += i;
+        }
+        return sum;
+    }
+
+    template<typename DeltaT>
+    int perturbedRender(WorldRasterGrid128& grid, std::vector<int>& iters)
+    {
+        PerturbationEngine<f128, DeltaT> engine;
+        TileBlockProgress progress;
+        const int w = grid.rasterWidth();
+        while (!engine.render(grid, progress, MandelbrotFormula{}, 1000, [&](int x, int y, const PerturbationResult& r) {
+            iters[y * w + x] = r.iter;
+        }, 4.0, 64, 64, 1, 0));
+        return iters[0];
+    }
+}
+
+TEST_CASE("floatexp vs f64 vs f128 arithmetic cost", "[bench][floatexp]")
+{
+    BENCHMARK("f64")      { return escapeRow<f64>(0.1); };
+    BENCHMARK("floatexp") { return escapeRow<floatexp>(0.1); };
+    BENCHMARK("f128")     { return escapeRow<f128>(0.1); };
+}
+
+TEST_CASE("Perturbation delta type: f64 vs floatexp (vs direct f128)", "[bench][floatexp][perturbation]")
+{
+    // f64 deltas are the cheapest until they underflow (|dc|^2 < ~1e-308), then floatexp takes over.
+    // Direct f128 is only competitive at shallow depths with short orbits.
+    const int w = 128, h = 96;
+    WorldRasterGrid128 grid;
+    grid.setRasterSize(w, h);
+
+    const f128 size = f128{ 1e-24 };
+    grid.setWorldRect(f128{ 3.1e-31 } - size * 0.5, f128{ 1.0 } - size * 0.5, size, size);
+
+    std::vector<int> a(w * h), b(w * h);
+    perturbedRender<f64>(grid, a);
+    perturbedRender<floatexp>(grid, b);
+    REQUIRE(a == b);
+
+    BENCHMARK("perturbation, f64 deltas")      { return perturbedRender<f64>(grid, a); };
+    BENCHMARK("perturbation, floatexp deltas") { return perturbedRender<floatexp>(grid, b); };
+}
@@ -0,0 +1,202 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/util/fltx/f128.h>
+#include <bitloop/util/fltx/f256.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int value_count = 1000;
+
+    std::vector<f128> sampleValues(double lo, double hi, uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> dist(lo, hi);
+        std::uniform_real_distribution<double> low(-1.0, 1.0);
+
+        std::vector<f128> out;
+        for (int i = 0; i < value_count; i++)
+        {
+            const double v = dist(rng);
+            out.push_back(renorm(v, v * 0x1p-53 * low(rng)));
+        }
+        return out;
+    }
+
+    std::vector<f256> widen(const std::vector<f128>& v)
+    {
+        std::vector<f256> out;
+        for (const f128& x : v) out.push_back(f256(x.hi, x.lo, 0.0, 0.0));
+        return out;
+    }
+
+    // the f128 log / exp this replaced (double seed + one correction, and a degree-22 Taylor kernel)
+    namespace legacy
+    {
+        f128 log(const f128& a)
+        {
+            const double log_hi = std::log(a.hi);
+            const f128 exp_log_hi(std::exp(log_hi));
+            const f128 r = (a - exp_log_hi) / exp_log_hi;
+            return f128(log_hi) + r;
+        }
+
+        f128 exp(const f128& a)
+        {
+            static constexpr double inv_fact[] = {
+                8.89679139245057408e-22, 1.95729410633912626e-20, 4.11031762331216484e-19, 8.22063524662432950e-18,
+                1.56192069685862253e-16, 2.81145725434552060e-15, 4.77947733238738525e-14, 7.64716373181981641e-13,
+                1.14707455977297245e-11, 1.60590438368216133e-10, 2.08767569878681002e-09, 2.50521083854417202e-08,
+                2.75573192239858883e-07, 2.75573192239858925e-06, 2.48015873015873016e-05, 1.98412698412698413e-04,
+                1.38888888888888894e-03, 8.33333333333333322e-03, 4.16666666666666644e-02, 1.66666666666666657e-01,
+                5.00000000000000000e-01, 1.0
+            };
+
+            const double kd = std::nearbyint((a * F128_INV_LN2).hi);
+            const f128 r = a - f128(kd) * F128_LN2;
+
+            f128 p(inv_fact[0]);
+            for (int i = 1; i < 22; i++) p = p * r + f128(inv_fact[i]);
+            return f128_ldexp(p * r + f128(1.0), (int)kd);
+        }
+    }
+}
+
+TEST_CASE("f128 transcendentals: table-driven vs legacy vs double", "[bench][fltx]")
+{
+    const auto xs = sampleValues(0.1, 50.0, 19);
+    const auto angles = sampleValues(-10.0, 10.0, 20);
+
+    BENCHMARK("std::log (double)")
+    {
+        double acc = 0.0;
+        for (const f128& x : xs) acc += std::log(x.hi);
+        return acc;
+    };
+
+    BENCHMARK("legacy f128 log (double accurate)")
+    {
+        f128 acc(0.0);
+        for (const f128& x : xs) acc = acc + legacy::log(x);
+        return acc;
+    };
+
+    BENCHMARK("f128 log")
+    {
+        f128 acc(0.0);
+        for (const f128& x : xs) acc = acc + log(x);
+        return acc;
+    };
+
+    BENCHMARK("std::exp (double)")
+    {
+        double acc = 0.0;
+        for (const f128& x : angles) acc += std::exp(x.hi);
+        return acc;
+    };
+
+    BENCHMARK("legacy f128 exp")
+    {
+        f128 acc(0.0);
+        for (const f128& x : angles) acc = acc + legacy::exp(x);
+        return acc;
+    };
+
+    BENCHMARK("f128 exp")
+    {
+        f128 acc(0.0);
+        for (const f128& x : angles) acc = acc + exp(x);
+        return acc;
+    };
+
+    BENCHMARK("std::sin + std::cos (double)")
+    {
+        double acc = 0.0;
+        for (const f128& x : angles) acc += std::sin(x.hi) + std::cos(x.hi);
+        return acc;
+    };
+
+    BENCHMARK("f128 sincos")
+    {
+        f128 acc(0.0);
+        for (const f128& x : angles)
+        {
+            f128 s, c;
+            sincos(x, s, c);
+            acc = acc + s + c;
+        }
+        return acc;
+    };
+
+    BENCHMARK("f128 atan2")
+    {
+        f128 acc(0.0);
+        for (size_t i = 0; i < angles.size(); i++) acc = acc + atan2(angles[i], xs[i]);
+        return acc;
+    };
+
+    BENCHMARK("f128 pow")
+    {
+        f128 acc(0.0);
+        for (size_t i = 0; i < xs.size(); i++) acc = acc + pow(xs[i], angles[i]);
+        return acc;
+    };
+
+    // smooth colouring: log(log|z|) per escaped pixel
+    BENCHMARK("f128 log(log(|z|))")
+    {
+        f128 acc(0.0);
+        for (const f128& x : xs) acc = acc + log(log(x + 2.0));
+        return acc;
+    };
+}
+
+TEST_CASE("f256 transcendentals", "[bench][fltx]")
+{
+    const auto xs = widen(sampleValues(0.1, 50.0, 19));
+    const auto angles = widen(sampleValues(-10.0, 10.0, 20));
+
+    BENCHMARK("f256 log")
+    {
+        f256 acc(0.0);
+        for (const f256& x : xs) acc += log(x);
+        return acc;
+    };
+
+    BENCHMARK("f256 exp")
+    {
+        f256 acc(0.0);
+        for (const f256& x : angles) acc += exp(x);
+        return acc;
+    };
+
+    BENCHMARK("f256 sincos")
+    {
+        f256 acc(0.0);
+        for (const f256& x : angles)
+        {
+            f256 s, c;
+            sincos(x, s, c);
+            acc += s + c;
+        }
+        return acc;
+    };
+
+    BENCHMARK("f256 atan2")
+    {
+        f256 acc(0.0);
+        for (size_t i = 0; i < angles.size(); i++) acc += atan2(angles[i], xs[i]);
+        return acc;
+    };
+
+    BENCHMARK("f256 pow")
+    {
+        f256 acc(0.0);
+        for (size_t i = 0; i < xs.size(); i++) acc += pow(xs[i], angles[i]);
+        return acc;
+    };
+}
@@ -0,0 +1,169 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/nanovgx/nano_path_cache.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../../examples/Tiger/Tiger/draw_tiger.h"
+
+using namespace bl;
+
+// CPU side of a Tiger frame (no GL context): what Painter + nanovg do per point before tessellation
+// into triangles, immediate mode vs. replaying a PathCache.
+
+namespace {
+    constexpr f64 tess_tol = 0.25;
+
+    struct View
+    {
+        f64 zoom;
+        DVec2 offset;
+
+        DVec2 toStage(f64 x, f64 y) const { return { x * zoom + offset.x, y * zoom + offset.y }; }
+    };
+
+    // Painter stand-in: f64 world->stage per point, then nanovg's recursive bezier subdivision
+    struct ImmediateModel
+    {
+        View view;
+        std::vector<FVec2> pts;
+        DVec2 cur{ 0, 0 };
+        size_t drawn = 0;
+
+        void tesselate(f64 x1, f64 y1, f64 x2, f64 y2, f64 x3, f64 y3, f64 x4, f64 y4, int level)
+        {
+            if (level > 10) return;
+
+            const f64 x12 = (x1 + x2) * 0.5, y12 = (y1 + y2) * 0.5;
+            const f64 x23 = (x2 + x3) * 0.5, y23 = (y2 + y3) * 0.5;
+            const f64 x34 = (x3 + x4) * 0.5, y34 = (y3 + y4) * 0.5;
+            const f64 x123 = (x12 + x23) * 0.5, y123 = (y12 + y23) * 0.5;
+
+            const f64 dx = x4 - x1, dy = y4 - y1;
+            const f64 d2 = std::fabs((x2 - x4) * dy - (y2 - y4) * dx);
+            const f64 d3 = std::fabs((x3 - x4) * dy - (y3 - y4) * dx);
+
+            if ((d2 + d3) * (d2 + d3) < tess_tol * (dx * dx + dy * dy))
+            {
+                pts.push_back({ (f32)x4, (f32)y4 });
+                return;
+            }
+
+            const f64 x234 = (x23 + x34) * 0.5, y234 = (y23 + y34) * 0.5;
+            const f64 x1234 = (x123 + x234) * 0.5, y1234 = (y123 + y234) * 0.5;
+
+            tesselate(x1, y1, x12, y12, x123, y123, x1234, y1234, level + 1);
+            tesselate(x1234, y1234, x234, y234, x34, y34, x4, y4, level + 1);
+        }
+
+        void beginPath()                        { pts.clear(); }
+        void moveTo(f64 x, f64 y)               { cur = view.toStage(x, y); pts.push_back({ (f32)cur.x, (f32)cur.y }); }
+        void lineTo(f64 x, f64 y)               { moveTo(x, y); }
+        void closePath()                        {}
+        void setLineWidth(f64)                  {}
+        void setFillStyle(int, int, int, int)   {}
+        void setStrokeStyle(int, int, int, int) {}
+        void fill()                             { drawn += pts.size(); }
+        void stroke()                           { drawn += pts.size(); }
+
+        void bezierTo(f64 x1, f64 y1, f64 x2, f64 y2, f64 x3, f64 y3)
+        {
+            const DVec2 a = view.toStage(x1, y1), b = view.toStage(x2, y2), c = view.toStage(x3, y3);
+            tesselate(cur.x, cur.y, a.x, a.y, b.x, b.y, c.x, c.y, 0);
+            cur = c;
+        }
+    };
+
+    // nanovg's side of drawPathCache(): one float transform per cached point
+    struct ReplayModel
+    {
+        f32 t[6];
+        std::vector<FVec2> pts;
+        size_t drawn = 0;
+
+        void beginPath()          { pts.clear(); }
+        void moveTo(f32 x, f32 y) { pts.push_back({ x * t[0] + y * t[2] + t[4], x * t[1] + y * t[3] + t[5] }); }
+        void lineTo(f32 x, f32 y) { moveTo(x, y); }
+        void closePath()          {}
+        void fill(Color)          { drawn += pts.size(); }
+        void stroke(Color, f64)   { drawn += pts.size(); }
+    };
+
+    size_t drawImmediate(const View& view)
+    {
+        ImmediateModel model{ view };
+        draw_tiger(&model);
+        return model.drawn;
+    }
+
+    size_t drawCached(PathCache& cache, const View& view)
+    {
+        cache.prepare(view.zoom);
+        const DVec2 o = view.toStage(cache.origin().x, cache.origin().y);
+        ReplayModel model{ { (f32)view.zoom, 0, 0, (f32)view.zoom, (f32)o.x, (f32)o.y } };
+        cache.replay(model);
+        return model.drawn;
+    }
+
+    View viewFor(int i)
+    {
+        return { 0.5 + 0.4 * i, DVec2{ 100.0 * i, -50.0 * i } };
+    }
+}
+
+TEST_CASE("Tiger, 1 viewport", "[bench][path_cache]")
+{
+    PathCache cache;
+    draw_tiger(&cache);
+    const View view = viewFor(1);
+
+    BENCHMARK("immediate") { return drawImmediate(view); };
+    BENCHMARK("path cache") { return drawCached(cache, view); };
+}
+
+TEST_CASE("Tiger, 8 viewports", "[bench][path_cache]")
+{
+    std::vector<PathCache> caches(8);
+    for (PathCache& cache : caches)
+        draw_tiger(&cache);
+
+    BENCHMARK("immediate")
+    {
+        size_t n = 0;
+        for (int i = 0; i < 8; i++) n += drawImmediate(viewFor(i));
+        return n;
+    };
+
+    BENCHMARK("path cache")
+    {
+        size_t n = 0;
+        for (int i = 0; i < 8; i++) n += drawCached(caches[i], viewFor(i));
+        return n;
+    };
+}
+
+TEST_CASE("Tiger, continuous zoom", "[bench][path_cache]")
+{
+    PathCache cache;
+    draw_tiger(&cache);
+
+    // 2% zoom per frame, the cache re-flattens every ~20 frames
+    std::vector<View> frames;
+    for (int i = 0; i < 100; i++)
+        frames.push_back({ 0.5 * std::pow(1.02, i), DVec2{ 0, 0 } });
+
+    BENCHMARK("immediate x100")
+    {
+        size_t n = 0;
+        for (const View& v : frames) n += drawImmediate(v);
+        return n;
+    };
+
+    BENCHMARK("path cache x100")
+    {
+        size_t n = 0;
+        for (const View& v : frames) n += drawCached(cache, v);
+        return n;
+    };
+}
@@ -0,0 +1,53 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/core/perturbation.h>
+
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int w = 128, h = 96;
+    constexpr int max_iter = 1000;
+}
+
+TEST_CASE("Perturbation vs direct f128 escape-time render", "[bench][perturbation]")
+{
+    WorldRasterGrid128 grid;
+    grid.setRasterSize(w, h);
+
+    // 1e-24 wide window next to c = i
+    const f128 size = f128{ 1e-24 };
+    grid.setWorldRect(f128{ 3.1e-31 } - size * 0.5, f128{ 1.0 } - size * 0.5, size, size);
+
+    std::vector<int> iters(w * h);
+
+    BENCHMARK("direct f128")
+    {
+        TileBlockProgress progress;
+        while (!grid.forEachWorldTilePixel<f128>(64, 64, progress, [&](int x, int y, f128 cx, f128 cy)
+        {
+            const Complex<f128> c{ cx, cy };
+            Complex<f128> z{ f128{0}, f128{0} };
+            int i = 0;
+            while (i < max_iter)
+            {
+                z = z * z + c;
+                ++i;
+                if (z.mag2() > 4.0) break;
+            }
+            iters[y * w + x] = i;
+        }, 1, 0));
+        return iters[0];
+    };
+
+    BENCHMARK("perturbation (f128 reference, f64 deltas)")
+    {
+        PerturbationEngine<f128> engine; // includes the reference orbit
+        TileBlockProgress progress;
+        while (!engine.render(grid, progress, MandelbrotFormula{}, max_iter, [&](int x, int y, const PerturbationResult& r) {
+            iters[y * w + x] = r.iter;
+        }, 4.0, 64, 64, 1, 0));
+        return iters[0];
+    };
+}
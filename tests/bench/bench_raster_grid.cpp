@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/core/raster_grid.h>
+
+using namespace bl;
+
+namespace {
+    constexpr int bench_w = 3840;
+    constexpr int bench_h = 2160;
+
+    // Full 4K traversal on the calling thread, callback only accumulates so the stepping cost dominates
+    template<typename T>
+    double traverse(WorldRasterGridT<T>& grid, WorldStepMode mode)
+    {
+        grid.setWorldStepMode(mode);
+
+        double sum = 0;
+        int row = 0;
+        grid.template forEachWorldPixel<T>(row, [&](int, int, T wx, T wy) {
+            sum += static_cast<double>(wx) + static_cast<double>(wy);
+        }, 0);
+        return sum;
+    }
+}
+
+TEST_CASE("forEachWorldPixel 4K (f64)", "[bench]")
+{
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(bench_w, bench_h);
+    grid.setWorldRect(-0.75, 0.1, 1e-6, 5.625e-7);
+
+    BENCHMARK("per-pixel lerp") { return traverse(grid, WorldStepMode::PER_PIXEL); };
+    BENCHMARK("incremental")    { return traverse(grid, WorldStepMode::INCREMENTAL); };
+}
+
+TEST_CASE("forEachWorldPixel 4K (f128)", "[bench]")
+{
+    WorldRasterGridT<f128> grid;
+    grid.setRasterSize(bench_w, bench_h);
+
+    SECTION("shallow")
+    {
+        grid.setWorldRect(f128{ -0.75 }, f128{ 0.1 }, f128{ 1e-6 }, f128{ 5.625e-7 });
+        BENCHMARK("per-pixel lerp") { return traverse(grid, WorldStepMode::PER_PIXEL); };
+        BENCHMARK("incremental")    { return traverse(grid, WorldStepMode::INCREMENTAL); };
+    }
+
+    SECTION("deep")
+    {
+        grid.setWorldRect(f128{ -0.75, 1e-20 }, f128{ 0.1, -3e-21 }, f128{ 1e-24 }, f128{ 5.625e-25 });
+        BENCHMARK("per-pixel lerp") { return traverse(grid, WorldStepMode::PER_PIXEL); };
+        BENCHMARK("incremental")    { return traverse(grid, WorldStepMode::INCREMENTAL); };
+    }
+}
@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/util/fltx/shortest_chars.h>
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int value_count = 1000;
+
+    std::vector<f128> sampleValues()
+    {
+        std::mt19937_64 rng(18);
+        std::uniform_real_distribution<double> mant(1.0, 2.0);
+        std::uniform_real_distribution<double> low(-1.0, 1.0);
+        std::uniform_int_distribution<int> expo(-200, 200);
+
+        std::vector<f128> out;
+        for (int i = 0; i < value_count; i++)
+        {
+            const double hi = std::ldexp(mant(rng), expo(rng));
+            out.push_back(renorm(hi, hi * 0x1p-53 * low(rng)));
+        }
+        return out;
+    }
+
+    // axis tick values: multiples of a decimal step, as drawWorldAxis produces
+    std::vector<double> tickValues()
+    {
+        std::vector<double> out;
+        for (int i = 0; i < value_count; i++)
+            out.push_back(-3.0 + i * 0.0125);
+        return out;
+    }
+
+    // the label formatting Painter used before (snprintf + trimmed std::string)
+    std::string snprintfLabel(double v, int decimals)
+    {
+        char fmt[8], buffer[32];
+        std::snprintf(fmt, sizeof(fmt), "%%.%df", decimals);
+        std::snprintf(buffer, sizeof(buffer), fmt, v);
+
+        std::string s(buffer);
+        const size_t dot_pos = s.find('.');
+        if (dot_pos != std::string::npos)
+        {
+            size_t last_nonzero = s.find_last_not_of('0');
+            if (s[last_nonzero] == '.') last_nonzero--;
+            s.erase(last_nonzero + 1);
+        }
+        return s;
+    }
+}
+
+TEST_CASE("f128 printing: fixed-precision to_chars vs shortest round-trip", "[bench][fltx]")
+{
+    const auto values = sampleValues();
+    char buf[96];
+
+    BENCHMARK("to_chars, 32 significant digits")
+    {
+        size_t len = 0;
+        for (const f128& x : values)
+            len += size_t(to_chars(buf, buf + sizeof(buf), x, 32, false, true, true).ptr - buf);
+        return len;
+    };
+
+    BENCHMARK("to_string, 32 significant digits")
+    {
+        size_t len = 0;
+        for (const f128& x : values)
+            len += to_string(x, 32, false, true, true).size();
+        return len;
+    };
+
+    BENCHMARK("to_chars_shortest")
+    {
+        size_t len = 0;
+        for (const f128& x : values)
+            len += size_t(to_chars_shortest(buf, buf + sizeof(buf), x).ptr - buf);
+        return len;
+    };
+}
+
+TEST_CASE("Axis label formatting: allocating vs buffer", "[bench][fltx]")
+{
+    const auto ticks = tickValues();
+    char buf[64];
+
+    BENCHMARK("snprintf + std::string (old Painter path)")
+    {
+        size_t len = 0;
+        for (double v : ticks)
+            len += snprintfLabel(v, 4).size();
+        return len;
+    };
+
+    BENCHMARK("f128 to_string, 4 decimals")
+    {
+        size_t len = 0;
+        for (double v : ticks)
+            len += to_string(f128(v), 4, true, false, true).size();
+        return len;
+    };
+
+    BENCHMARK("f128 to_chars, 4 decimals")
+    {
+        size_t len = 0;
+        for (double v : ticks)
+            len += size_t(to_chars(buf, buf + sizeof(buf), f128(v), 4, true, false, true).ptr - buf);
+        return len;
+    };
+
+    BENCHMARK("shortest_decimal capped, into buffer")
+    {
+        size_t len = 0;
+        for (double v : ticks)
+        {
+            fltx_decimal d;
+            shortest_decimal(v, d, 0, 4);
+            len += size_t(decimal_to_chars(buf, buf + sizeof(buf), d, true, false).ptr - buf);
+        }
+        return len;
+    };
+}
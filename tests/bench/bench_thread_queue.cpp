@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <bitloop/util/thread_queue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    using clock_t_ = std::chrono::steady_clock;
+
+    constexpr int producer_count = 8;
+    constexpr int posts_per_producer = 20000;
+
+    // The previous ThreadQueue design (heap-allocated closure + mutex + swapped vector), for comparison
+    class LockedQueue
+    {
+        struct Task
+        {
+            void* object;
+            void (*run)(void*) noexcept;
+            void (*cleanup)(void*) noexcept;
+        };
+
+        std::mutex mutex_;
+        std::vector<Task> tasks_;
+
+    public:
+
+        template <typename F>
+        void post(F&& fn)
+        {
+            using Fn = std::decay_t<F>;
+            Task t{ new Fn(std::forward<F>(fn)),
+                [](void* p) noexcept { (*static_cast<Fn*>(p))(); },
+                [](void* p) noexcept { delete static_cast<Fn*>(p); } };
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(t);
+        }
+
+        bool pumpOnce()
+        {
+            std::vector<Task> local;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (tasks_.empty()) return false;
+                local.swap(tasks_);
+            }
+            for (const Task& t : local) { t.run(t.object); t.cleanup(t.object); }
+            return true;
+        }
+
+        void pump() { pumpOnce(); }
+    };
+
+    struct RunResult
+    {
+        double seconds;
+        double p50_us, p99_us;
+    };
+
+    // 8 producers post timestamped closures while the calling thread pumps
+    template<typename Queue>
+    RunResult run(Queue& q, std::vector<double>& latencies_us)
+    {
+        const int total = producer_count * posts_per_producer;
+        latencies_us.clear();
+        latencies_us.reserve(total);
+
+        std::atomic<int> ready{ 0 };
+        std::atomic<bool> go{ false };
+        int consumed = 0;
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < producer_count; ++p)
+        {
+            producers.emplace_back([&]
+            {
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+                for (int i = 0; i < posts_per_producer; ++i)
+                {
+                    const auto stamp = clock_t_::now();
+                    q.post([&latencies_us, &consumed, stamp]
+                    {
+                        latencies_us.push_back(std::chrono::duration<double, std::micro>(clock_t_::now() - stamp).count());
+                        ++consumed;
+                    });
+                }
+            });
+        }
+
+        while (ready.load() < producer_count) std::this_thread::yield();
+
+        const auto t0 = clock_t_::now();
+        go.store(true, std::memory_order_release);
+        while (consumed < total)
+            q.pump();
+        const auto t1 = clock_t_::now();
+
+        for (auto& t : producers) t.join();
+
+        std::sort(latencies_us.begin(), latencies_us.end());
+        return {
+            std::chrono::duration<double>(t1 - t0).count(),
+            latencies_us[latencies_us.size() / 2],
+            latencies_us[latencies_us.size() * 99 / 100]
+        };
+    }
+}
+
+TEST_CASE("ThreadQueue post/pump under 8 producers", "[bench]")
+{
+    std::vector<double> latencies;
+    const double total = double(producer_count) * posts_per_producer;
+
+    {
+        LockedQueue q;
+        RunResult r = run(q, latencies);
+        std::printf("mutex queue:    %6.2f Mposts/s  latency p50 %8.1f us  p99 %8.1f us\n",
+            total / r.seconds * 1e-6, r.p50_us, r.p99_us);
+    }
+    {
+        ThreadQueue q;
+        RunResult r = run(q, latencies);
+        std::printf("lock-free MPSC: %6.2f Mposts/s  latency p50 %8.1f us  p99 %8.1f us\n",
+            total / r.seconds * 1e-6, r.p50_us, r.p99_us);
+    }
+
+    BENCHMARK("mutex queue")    { LockedQueue q; return run(q, latencies).seconds; };
+    BENCHMARK("lock-free MPSC") { ThreadQueue q; return run(q, latencies).seconds; };
+}
+
+TEST_CASE("ThreadQueue invokeBlocking round trip", "[bench]")
+{
+    ThreadQueue q;
+    std::atomic<bool> stop{ false }, finished{ false };
+    std::atomic<int> calls{ 0 };
+
+    std::thread caller([&]
+    {
+        while (!stop.load(std::memory_order_relaxed))
+            calls += q.invokeBlocking([] { return 1; });
+        finished.store(true);
+    });
+
+    const auto t0 = clock_t_::now();
+    while (clock_t_::now() - t0 < std::chrono::milliseconds(500))
+        q.pump();
+
+    // let the caller's last request complete
+    stop.store(true);
+    while (!finished.load())
+        q.pump();
+    caller.join();
+
+    std::printf("invokeBlocking: %.2f us per round trip\n", 500000.0 / std::max(1, calls.load()));
+}
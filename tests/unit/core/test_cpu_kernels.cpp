@@ -0,0 +1,326 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/core/cpu_kernels.h>
+#include <bitloop/core/raster_grid.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    bool sameBits(double a, double b)
+    {
+        if (std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    bool sameBits(f128 a, f128 b)
+    {
+        return sameBits(a.hi, b.hi) && sameBits(a.lo, b.lo);
+    }
+
+    // odd count so every variant also runs its scalar tail
+    std::vector<f128> sampleValues(int count, uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> mant(-1.0, 1.0);
+        std::uniform_int_distribution<int> expo(-60, 60);
+
+        std::vector<f128> out;
+        for (int i = 0; i < count; i++)
+        {
+            const double hi = std::ldexp(mant(rng), expo(rng));
+            out.push_back(renorm(hi, hi * 0x1p-54 * mant(rng)));
+        }
+        return out;
+    }
+
+    template<class Fn>
+    void forEachSupportedLevel(Fn&& fn)
+    {
+        for (int i = 0; i < static_cast<int>(CpuLevel::COUNT); i++)
+        {
+            if (const CpuKernels* k = cpuKernelsFor(CpuLevel(i)))
+                fn(CpuLevel(i), *k);
+        }
+    }
+}
+
+TEST_CASE("CPU level names round-trip and overrides clamp to the detected level")
+{
+    for (int i = 0; i < static_cast<int>(CpuLevel::COUNT); i++)
+    {
+        CpuLevel parsed;
+        REQUIRE(parseCpuLevel(cpuLevelName(CpuLevel(i)), parsed));
+        REQUIRE(parsed == CpuLevel(i));
+    }
+
+    CpuLevel parsed;
+    REQUIRE(parseCpuLevel("SSE2", parsed));
+    REQUIRE(parsed == CpuLevel::BASELINE);
+    REQUIRE_FALSE(parseCpuLevel("avx9000", parsed));
+
+    const CpuLevel before = cpuLevel();
+
+    REQUIRE(setCpuLevel(CpuLevel::SCALAR) == CpuLevel::SCALAR);
+    REQUIRE(cpuKernels().level == CpuLevel::SCALAR);
+
+    REQUIRE(setCpuLevel(CpuLevel::AVX512) == detectCpuLevel());
+
+    char arg0[] = "bitloop", arg1[] = "--cpu-level=scalar";
+    char* argv[] = { arg0, arg1 };
+    applyCpuLevelArgs(2, argv);
+    REQUIRE(cpuLevel() == CpuLevel::SCALAR);
+
+    setCpuLevel(before);
+    REQUIRE(cpuKernels().level == before);
+}
+
+TEST_CASE("Every CPU kernel variant matches the scalar variant bit-for-bit")
+{
+    const CpuKernels& ref = *cpuKernelsFor(CpuLevel::SCALAR);
+
+    SECTION("f128 arithmetic")
+    {
+        const size_t n = 1001;
+        const auto a = sampleValues((int)n, 1);
+        const auto b = sampleValues((int)n, 2);
+
+        std::vector<f128> abs_a(n);
+        for (size_t i = 0; i < n; i++) abs_a[i] = abs(a[i]);
+
+        std::vector<f128> want[5], got(n);
+        for (auto& w : want) w.resize(n);
+        ref.f128_add(a.data(), b.data(), want[0].data(), n);
+        ref.f128_sub(a.data(), b.data(), want[1].data(), n);
+        ref.f128_mul(a.data(), b.data(), want[2].data(), n);
+        ref.f128_div(a.data(), b.data(), want[3].data(), n);
+        ref.f128_sqrt(abs_a.data(), want[4].data(), n);
+
+        // the scalar variant itself is plain f128
+        for (size_t i = 0; i < n; i++)
+            REQUIRE(sameBits(want[2][i], a[i] * b[i]));
+
+        forEachSupportedLevel([&](CpuLevel level, const CpuKernels& k)
+        {
+            INFO("level " << cpuLevelName(level));
+            REQUIRE(k.level == level);
+
+            k.f128_add(a.data(), b.data(), got.data(), n);
+            for (size_t i = 0; i < n; i++) REQUIRE(sameBits(got[i], want[0][i]));
+            k.f128_sub(a.data(), b.data(), got.data(), n);
+            for (size_t i = 0; i < n; i++) REQUIRE(sameBits(got[i], want[1][i]));
+            k.f128_mul(a.data(), b.data(), got.data(), n);
+            for (size_t i = 0; i < n; i++) REQUIRE(sameBits(got[i], want[2][i]));
+            k.f128_div(a.data(), b.data(), got.data(), n);
+            for (size_t i = 0; i < n; i++) REQUIRE(sameBits(got[i], want[3][i]));
+            k.f128_sqrt(abs_a.data(), got.data(), n);
+            for (size_t i = 0; i < n; i++) REQUIRE(sameBits(got[i], want[4][i]));
+        });
+    }
+
+    SECTION("world row coordinates")
+    {
+        const int w = 333, h = 17;
+        const Quad<f128> q{
+            { f128{ -0.743643887037151, 1.3e-18 }, f128{ 0.131825904205330, -3.1e-19 } },
+            { f128{ -0.743643887037141, 2.1e-18 }, f128{ 0.131825904205331, 1.7e-19 } },
+            { f128{ -0.743643887037142, 0.0 },     f128{ 0.131825904205339, 0.0 } },
+            { f128{ -0.743643887037152, 0.0 },     f128{ 0.131825904205338, 0.0 } }
+        };
+
+        const auto d = [](const Vec2<f128>& p) { return DVec2{ (double)p.x, (double)p.y }; };
+        const Quad<f64> q64{ d(q.a), d(q.b), d(q.c), d(q.d) };
+
+        for (WorldStepMode mode : { WorldStepMode::INCREMENTAL, WorldStepMode::PER_PIXEL })
+        {
+            const detail::WorldScan<f128> scan128(q, w, h, mode);
+            const detail::WorldScan<f64>  scan64(q64, w, h, mode);
+
+            std::vector<f64>  want64x(w), want64y(w), got64x(w), got64y(w);
+            std::vector<f128> want128x(w), want128y(w), got128x(w), got128y(w);
+
+            forEachSupportedLevel([&](CpuLevel level, const CpuKernels& k)
+            {
+                INFO("level " << cpuLevelName(level));
+                for (int row = 0; row < h; row++)
+                {
+                    // partial spans, as tiles produce
+                    const int x0 = row % 5, x1 = w - row % 3;
+                    ref.world_row_f64(scan64, row, x0, x1, want64x.data(), want64y.data());
+                    ref.world_row_f128(scan128, row, x0, x1, want128x.data(), want128y.data());
+                    k.world_row_f64(scan64, row, x0, x1, got64x.data(), got64y.data());
+                    k.world_row_f128(scan128, row, x0, x1, got128x.data(), got128y.data());
+
+                    for (int i = 0; i < x1 - x0; i++)
+                    {
+                        REQUIRE(sameBits(got64x[i], want64x[i]));
+                        REQUIRE(sameBits(got64y[i], want64y[i]));
+                        REQUIRE(sameBits(got128x[i], want128x[i]));
+                        REQUIRE(sameBits(got128y[i], want128y[i]));
+                    }
+                }
+            });
+        }
+    }
+
+    SECTION("colour mapping")
+    {
+        std::vector<uint32_t> lut(256);
+        for (int i = 0; i < 256; i++) lut[i] = 0xff000000u | (uint32_t(i) << 16) | uint32_t(255 - i);
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> dist(-0.25f, 1.25f);
+        std::vector<float> t(4099);
+        for (float& v : t) v = dist(rng);
+        t[0] = std::numeric_limits<float>::quiet_NaN();
+        t[1] = 0.0f;
+        t[2] = 1.0f;
+
+        std::vector<uint32_t> want(t.size()), got(t.size());
+        ref.map_colors(t.data(), want.data(), t.size(), lut.data(), (int)lut.size());
+        REQUIRE(want[0] == lut[0]);
+        REQUIRE(want[1] == lut[0]);
+        REQUIRE(want[2] == lut[255]);
+
+        forEachSupportedLevel([&](CpuLevel level, const CpuKernels& k)
+        {
+            INFO("level " << cpuLevelName(level));
+            k.map_colors(t.data(), got.data(), t.size(), lut.data(), (int)lut.size());
+            REQUIRE(got == want);
+        });
+    }
+}
+
+TEST_CASE("forEachWorldPixel rows come from the kernel table, bit-identical at every level")
+{
+    const int w = 257, h = 9;
+    WorldRasterGridT<f128> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(f128{ -0.743643887037151, 1.3e-18 }, f128{ 0.131825904205330, -3.1e-19 }, f128{ 1e-20 }, f128{ 0.5625e-20 });
+
+    for (WorldStepMode mode : { WorldStepMode::INCREMENTAL, WorldStepMode::PER_PIXEL })
+    {
+        grid.setWorldStepMode(mode);
+
+        // reference: the inline row stepper
+        const detail::WorldScan<f128> scan(grid.worldQuad(), w, h, mode);
+        std::vector<f128> want_x(w * h), want_y(w * h);
+        for (int row = 0; row < h; row++)
+        {
+            scan.forEachRowPixel(row, 0, w, [&](int x, f128 wx, f128 wy) {
+                want_x[row * w + x] = wx;
+                want_y[row * w + x] = wy;
+            });
+        }
+
+        const CpuLevel before = cpuLevel();
+        forEachSupportedLevel([&](CpuLevel level, const CpuKernels&)
+        {
+            INFO("level " << cpuLevelName(level));
+            setCpuLevel(level);
+
+            std::vector<f128> got_x(w * h), got_y(w * h);
+            int current_row = 0;
+            grid.forEachWorldPixel<f128>(current_row, [&](int x, int y, f128 wx, f128 wy) {
+                got_x[y * w + x] = wx;
+                got_y[y * w + x] = wy;
+            }, 0);
+
+            for (int i = 0; i < w * h; i++)
+            {
+                REQUIRE(sameBits(got_x[i], want_x[i]));
+                REQUIRE(sameBits(got_y[i], want_y[i]));
+            }
+        });
+        setCpuLevel(before);
+    }
+}
+
+TEST_CASE("Tile, batch and adaptive traversals use the kernel table, bit-identical at every level")
+{
+    const int w = 203, h = 37;
+    WorldRasterGridT<f128> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(f128{ -0.743643887037151, 1.3e-18 }, f128{ 0.131825904205330, -3.1e-19 }, f128{ 1e-20 }, f128{ 0.5625e-20 });
+
+    for (WorldStepMode mode : { WorldStepMode::INCREMENTAL, WorldStepMode::PER_PIXEL })
+    {
+        grid.setWorldStepMode(mode);
+        const detail::WorldScan<f128> scan(grid.worldQuad(), w, h, mode);
+
+        // reference: the inline stepper over the same block spans (blocks start mid-row)
+        TileBlockProgress plan;
+        detail::ensureBlocksBuilt(plan, w, h, 64, 32, 48, 8);
+        std::vector<f128> want_x(w * h), want_y(w * h);
+        for (const TileBlock& b : plan.blocks)
+        {
+            for (int row = b.y0; row < b.y1; row++)
+            {
+                scan.forEachRowPixel(row, b.x0, b.x1, [&](int x, f128 wx, f128 wy) {
+                    want_x[row * w + x] = wx;
+                    want_y[row * w + x] = wy;
+                });
+            }
+        }
+
+        // per-pixel reference for the adaptive fill, whose spans depend on the field
+        const detail::WorldScan<f128> lerp(grid.worldQuad(), w, h, WorldStepMode::PER_PIXEL);
+        std::vector<f128> lerp_x(w * h), lerp_y(w * h);
+        for (int row = 0; row < h; row++)
+        {
+            lerp.forEachRowPixel(row, 0, w, [&](int x, f128 wx, f128 wy) {
+                lerp_x[row * w + x] = wx;
+                lerp_y[row * w + x] = wy;
+            });
+        }
+
+        const CpuLevel before = cpuLevel();
+        forEachSupportedLevel([&](CpuLevel level, const CpuKernels&)
+        {
+            INFO("level " << cpuLevelName(level));
+            setCpuLevel(level);
+
+            std::vector<f128> got_x(w * h), got_y(w * h);
+            auto requireSame = [&](const std::vector<f128>& ref_x, const std::vector<f128>& ref_y)
+            {
+                for (int i = 0; i < w * h; i++)
+                {
+                    REQUIRE(sameBits(got_x[i], ref_x[i]));
+                    REQUIRE(sameBits(got_y[i], ref_y[i]));
+                }
+            };
+
+            TileBlockProgress P;
+            REQUIRE(grid.forEachWorldTilePixel<f128>(64, 32, P, [&](int x, int y, f128 wx, f128 wy) {
+                got_x[y * w + x] = wx;
+                got_y[y * w + x] = wy;
+            }, 2, 0, 48, 8));
+            requireSame(want_x, want_y);
+
+            TileBlockProgress PB;
+            REQUIRE(grid.forEachWorldTilePixelBatch<f128, 4>(64, 32, PB, [&](const PixelBatch<f128, 4>& b) {
+                for (int l = 0; l < b.count; l++)
+                {
+                    got_x[b.y * w + b.x[l]] = b.wx[l];
+                    got_y[b.y * w + b.x[l]] = b.wy[l];
+                }
+            }, 2, 0, 48, 8));
+            requireSame(want_x, want_y);
+
+            if (mode == WorldStepMode::PER_PIXEL)
+            {
+                // every pixel evaluated (checkerboard), so every coordinate is checked
+                TileBlockProgress PA;
+                REQUIRE(grid.forEachWorldPixelAdaptive<f128>(PA, [&](int x, int y, f128 wx, f128 wy) {
+                    got_x[y * w + x] = wx;
+                    got_y[y * w + x] = wy;
+                    return (x + y) & 1;
+                }, [](int a, int b) { return a == b; }, [](int, int, int, int, int) {}, 2, 0, 32));
+                requireSame(lerp_x, lerp_y);
+            }
+        });
+        setCpuLevel(before);
+    }
+}
@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/core/threads.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    struct HandoffResult
+    {
+        std::vector<int> drawn;         // snapshot value of every drawn frame, in draw order
+        uint64_t max_queued = 0;        // undrawn frames seen by the GUI
+        int frames_processed_ahead = 0; // frames the worker began before the GUI drew the previous one
+    };
+
+    // Worker/GUI pair following ProjectWorker / MainWindow: the worker "processes" frame N into live state,
+    // snapshots it into the publish slot and publishes; the GUI draws the oldest undrawn slot with
+    // state_mutex held. Drawing is slower than processing, so a pipeline fills up.
+    HandoffResult runHandoff(int depth, int frames)
+    {
+        SharedSync sync;
+        HandoffResult result;
+
+        int snapshot[SharedSync::max_pipeline_depth]{ -1, -1, -1 };
+
+        std::thread worker([&] {
+            for (int frame = 0; frame < frames; frame++)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(sync.state_mutex);
+                    if (sync.frames_consumed < static_cast<uint64_t>(frame))
+                        result.frames_processed_ahead++;
+                }
+
+                const int live = frame; // processing
+
+                {
+                    auto lock = sync.wait_for_free_frame_slot(depth);
+                    snapshot[sync.publish_slot()] = live;
+                    sync.publish_frame_locked(depth);
+                }
+                sync.cv.notify_all();
+
+                if (depth == 1)
+                    sync.wait_until_gui_consumes_frame();
+            }
+        });
+
+        while (result.drawn.size() < static_cast<size_t>(frames))
+        {
+            {
+                std::unique_lock<std::mutex> lock(sync.state_mutex);
+                sync.cv.wait(lock, [&] { return sync.frame_ready_to_draw; });
+
+                result.max_queued = std::max(result.max_queued, sync.frames_published - sync.frames_consumed);
+
+                const int slot = sync.consume_frame_locked();
+                std::this_thread::sleep_for(std::chrono::microseconds(300)); // draw
+                result.drawn.push_back(snapshot[slot]);
+            }
+            sync.cv.notify_all();
+        }
+
+        worker.join();
+        return result;
+    }
+}
+
+TEST_CASE("Frame handoff draws every frame once, in order")
+{
+    const int frames = 200;
+
+    for (int depth : { 1, 2, 3 })
+    {
+        const HandoffResult r = runHandoff(depth, frames);
+
+        REQUIRE(r.drawn.size() == frames);
+        for (int i = 0; i < frames; i++)
+            REQUIRE(r.drawn[i] == i);
+
+        // never more than (depth-1) frames waiting, a full pipeline once the GUI falls behind
+        const uint64_t max_queued = static_cast<uint64_t>(std::max(depth - 1, 1));
+        REQUIRE(r.max_queued <= max_queued);
+
+        if (depth == 1)
+        {
+            REQUIRE(r.frames_processed_ahead == 0);
+        }
+        else
+        {
+            REQUIRE(r.max_queued == max_queued);
+            REQUIRE(r.frames_processed_ahead > 0);
+        }
+    }
+}
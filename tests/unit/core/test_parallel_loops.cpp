@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/core/threads.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace bl;
+
+TEST_CASE("forEachClaimed runs every index once")
+{
+    std::vector<std::atomic<int>> hits(1000);
+
+    const int next = Thread::forEachClaimed(0, 1000, [&](int i, int) {
+        hits[i].fetch_add(1);
+    }, [] { return false; }, 4);
+
+    REQUIRE(next == 1000);
+    for (auto& h : hits)
+        REQUIRE(h.load() == 1);
+}
+
+TEST_CASE("forEachClaimed rethrows the first exception instead of hanging")
+{
+    std::atomic<int> ran{ 0 };
+
+    bool caught = false;
+    try
+    {
+        (void)Thread::forEachClaimed(0, 100000, [&](int i, int) {
+            ran.fetch_add(1);
+            if (i == 10)
+                throw std::runtime_error("index 10");
+        }, [] { return false; }, 4);
+    }
+    catch (const std::runtime_error& e)
+    {
+        caught = (std::string(e.what()) == "index 10");
+    }
+
+    REQUIRE(caught);
+
+    // workers stop claiming once one has failed
+    REQUIRE(ran.load() < 100000);
+}
+
+TEST_CASE("Value-returning forEachBatch returns one result per thread")
+{
+    std::vector<int> items(1003);
+    std::iota(items.begin(), items.end(), 0);
+    const long long total = std::accumulate(items.begin(), items.end(), 0LL);
+
+    // each thread reduces its own contiguous slice
+    const auto sums = Thread::forEachBatch(items, [](std::span<int> slice) {
+        return std::accumulate(slice.begin(), slice.end(), 0LL);
+    }, 4);
+
+    REQUIRE(sums.size() == 4);
+    REQUIRE(std::accumulate(sums.begin(), sums.end(), 0LL) == total);
+
+    const auto bounds = Thread::forEachBatch(items, [](int i0, int i1) { return std::pair{ i0, i1 }; }, 4);
+    REQUIRE(bounds.size() == 4);
+    REQUIRE(bounds.front().first == 0);
+    REQUIRE(bounds.back().second == 1003);
+    for (size_t i = 1; i < bounds.size(); i++)
+        REQUIRE(bounds[i].first == bounds[i - 1].second);
+}
+
+TEST_CASE("forEachBatchChunks returns one result per chunk, in order")
+{
+    std::vector<int> items(10000);
+    std::iota(items.begin(), items.end(), 0);
+
+    const auto chunks = Thread::forEachBatchChunks(items, [](int i0, int i1) { return std::pair{ i0, i1 }; }, 4, 64);
+
+    REQUIRE(chunks.size() > 4);
+    REQUIRE(chunks.front().first == 0);
+    REQUIRE(chunks.back().second == 10000);
+    for (size_t i = 1; i < chunks.size(); i++)
+        REQUIRE(chunks[i].first == chunks[i - 1].second);
+
+    const std::vector<int>& ro = items;
+    const auto sums = Thread::forEachBatchChunks(ro, [](std::span<const int> s) {
+        return std::accumulate(s.begin(), s.end(), 0LL);
+    }, 4, 64);
+    REQUIRE(std::accumulate(sums.begin(), sums.end(), 0LL) == 9999LL * 10000 / 2);
+}
+
+TEST_CASE("Work-stealing forEachBatch visits every item once")
+{
+    for (int threads : { 1, 3, 8 })
+    {
+        std::vector<std::atomic<int>> hits(5000);
+        std::vector<int> items(hits.size());
+
+        Thread::WorkStealingStats stats;
+        Thread::forEachBatch(items, [&](int i0, int i1) {
+            for (int i = i0; i < i1; i++)
+                hits[i].fetch_add(1);
+        }, threads, &stats);
+
+        for (auto& h : hits)
+            REQUIRE(h.load() == 1);
+        REQUIRE(stats.tasks_run.size() == static_cast<size_t>(threads));
+    }
+}
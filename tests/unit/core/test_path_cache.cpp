@@ -0,0 +1,182 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/nanovgx/nano_path_cache.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    // Records replayed calls, points converted back to world space
+    struct RecordSink
+    {
+        DVec2 origin;
+        std::vector<std::string> calls;
+        std::vector<std::vector<DVec2>> subpaths;
+        std::vector<Color> colors;
+        std::vector<f64> widths;
+
+        void beginPath()            { calls.push_back("begin"); }
+        void moveTo(f32 x, f32 y)   { calls.push_back("move"); subpaths.push_back({ DVec2{ origin.x + x, origin.y + y } }); }
+        void lineTo(f32 x, f32 y)   { subpaths.back().push_back(DVec2{ origin.x + x, origin.y + y }); }
+        void closePath()            { calls.push_back("close"); }
+        void fill(Color c)          { calls.push_back("fill"); colors.push_back(c); }
+        void stroke(Color c, f64 w) { calls.push_back("stroke"); colors.push_back(c); widths.push_back(w); }
+    };
+
+    RecordSink replay(const PathCache& cache)
+    {
+        RecordSink sink{ cache.origin() };
+        cache.replay(sink);
+        return sink;
+    }
+
+    f64 distToSegment(DVec2 p, DVec2 a, DVec2 b)
+    {
+        const DVec2 ab = b - a, ap = p - a;
+        const f64 len2 = ab.x * ab.x + ab.y * ab.y;
+        const f64 t = len2 > 0 ? std::clamp((ap.x * ab.x + ap.y * ab.y) / len2, 0.0, 1.0) : 0.0;
+        const DVec2 d = DVec2{ a.x + ab.x * t, a.y + ab.y * t } - p;
+        return std::sqrt(d.x * d.x + d.y * d.y);
+    }
+
+    f64 distToPolyline(DVec2 p, const std::vector<DVec2>& line)
+    {
+        f64 best = 1e300;
+        for (size_t i = 0; i + 1 < line.size(); i++)
+            best = std::min(best, distToSegment(p, line[i], line[i + 1]));
+        return best;
+    }
+}
+
+TEST_CASE("PathCache flattens curves within tolerance")
+{
+    const DVec2 p0{ 1000, 1000 }, p1{ 1040, 1100 }, p2{ 1090, 930 }, p3{ 1120, 1010 };
+    const DVec2 q0{ 1120, 1010 }, q1{ 1200, 1200 }, q2{ 1250, 1000 };
+
+    PathCache cache;
+    cache.beginPath();
+    cache.moveTo(p0);
+    cache.bezierTo(p1.x, p1.y, p2.x, p2.y, p3.x, p3.y);
+    cache.quadraticTo(q1.x, q1.y, q2.x, q2.y);
+    cache.stroke();
+
+    for (f64 pixels_per_unit : { 0.05, 1.0, 20.0, 400.0 })
+    {
+        REQUIRE(cache.prepare(pixels_per_unit));
+        const f64 tol = cache.tess_tol / pixels_per_unit;
+
+        const RecordSink sink = replay(cache);
+        REQUIRE(sink.subpaths.size() == 1);
+        const std::vector<DVec2>& line = sink.subpaths[0];
+
+        // endpoints survive the float offsets
+        REQUIRE(std::fabs(line.front().x - p0.x) < 1e-3);
+        REQUIRE(std::fabs(line.back().y - q2.y) < 1e-3);
+
+        for (int i = 0; i <= 1000; i++)
+        {
+            const f64 t = i / 1000.0, u = 1.0 - t;
+            const DVec2 c = p0 * (u * u * u) + p1 * (3 * u * u * t) + p2 * (3 * u * t * t) + p3 * (t * t * t);
+            const DVec2 q = q0 * (u * u) + q1 * (2 * u * t) + q2 * (t * t);
+            REQUIRE(distToPolyline(c, line) <= tol + 1e-3);
+            REQUIRE(distToPolyline(q, line) <= tol + 1e-3);
+        }
+    }
+}
+
+TEST_CASE("PathCache only re-flattens outside its zoom band")
+{
+    PathCache cache;
+    cache.zoom_tolerance = 0.25;
+    cache.beginPath();
+    cache.moveTo(0.0, 0.0);
+    cache.bezierTo(10.0, 20.0, 30.0, -20.0, 40.0, 0.0);
+    cache.fill();
+
+    REQUIRE(cache.prepare(100));
+    const size_t points = cache.flatPointCount();
+
+    // flattened for 125, reused down to 125 / 1.25^2 = 80
+    REQUIRE_FALSE(cache.prepare(100));
+    REQUIRE_FALSE(cache.prepare(124));
+    REQUIRE_FALSE(cache.prepare(81));
+    REQUIRE(cache.flattenCount() == 1);
+
+    REQUIRE(cache.prepare(126));
+    REQUIRE(cache.flatPointCount() >= points);
+    REQUIRE(cache.prepare(50));
+    REQUIRE(cache.flatPointCount() <= points);
+    REQUIRE(cache.flattenCount() == 3);
+
+    // recording invalidates
+    cache.beginPath();
+    cache.moveTo(0.0, 0.0);
+    cache.lineTo(1.0, 1.0);
+    cache.stroke();
+    REQUIRE(cache.prepare(50));
+}
+
+TEST_CASE("PathCache shares geometry between fill and stroke of the same outline")
+{
+    PathCache cache;
+    auto outline = [&]() {
+        cache.beginPath();
+        cache.moveTo(0.0, 0.0);
+        cache.lineTo(10.0, 0.0);
+        cache.lineTo(10.0, 10.0);
+        cache.closePath();
+    };
+
+    cache.setLineWidth(0.5);
+    outline();
+    cache.setFillStyle(255, 0, 0);
+    cache.fill();
+    outline();
+    cache.setStrokeStyle(0, 0, 255, 128);
+    cache.stroke();
+
+    REQUIRE(cache.pathCount() == 1);
+    REQUIRE(cache.commandCount() == 2);
+
+    cache.prepare(1);
+    const RecordSink sink = replay(cache);
+    REQUIRE(sink.calls == std::vector<std::string>{ "begin", "move", "close", "fill", "begin", "move", "close", "stroke" });
+    REQUIRE(sink.subpaths[0].size() == 3);
+    REQUIRE(sink.subpaths[1] == sink.subpaths[0]);
+    REQUIRE(sink.colors[0].r == 255);
+    REQUIRE(sink.colors[1].b == 255);
+    REQUIRE(sink.colors[1].a == 128);
+    REQUIRE(sink.widths[0] == 0.5);
+
+    // origin is the centre of the bounds
+    REQUIRE(cache.origin() == DVec2{ 5, 5 });
+}
+
+TEST_CASE("PathCache keeps extending a path after fill()")
+{
+    PathCache cache;
+    cache.beginPath();
+    cache.moveTo(0.0, 0.0);
+    cache.lineTo(10.0, 0.0);
+    cache.fill();
+
+    // same outline as before, then extended: must not alter the path already drawn
+    cache.beginPath();
+    cache.moveTo(0.0, 0.0);
+    cache.lineTo(10.0, 0.0);
+    cache.fill();
+    cache.lineTo(10.0, 10.0);
+    cache.stroke();
+
+    REQUIRE(cache.pathCount() == 2);
+
+    cache.prepare(1);
+    const RecordSink sink = replay(cache);
+    REQUIRE(sink.subpaths.size() == 3);
+    REQUIRE(sink.subpaths[0].size() == 2);
+    REQUIRE(sink.subpaths[1].size() == 2);
+    REQUIRE(sink.subpaths[2].size() == 3);
+    REQUIRE(sink.subpaths[2].back() == DVec2{ 10, 10 });
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/core/perturbation.h>
+
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    constexpr int w = 64, h = 48;
+
+    std::vector<int> directIterations(WorldRasterGrid128& grid, int max_iter)
+    {
+        std::vector<int> out(w * h);
+        for (int y = 0; y < h; ++y)
+        {
+            for (int x = 0; x < w; ++x)
+            {
+                f128 cx, cy;
+                grid.pixelWorldPos(x, y, cx, cy);
+
+                const Complex<f128> c{ cx, cy };
+                Complex<f128> z{ f128{0}, f128{0} };
+                int i = 0;
+                while (i < max_iter)
+                {
+                    z = z * z + c;
+                    ++i;
+                    if (z.mag2() > 4.0) break;
+                }
+                out[y * w + x] = i;
+            }
+        }
+        return out;
+    }
+
+    std::vector<int> perturbedIterations(WorldRasterGrid128& grid, PerturbationEngine<f128>& engine, int max_iter)
+    {
+        std::vector<int> out(w * h);
+        TileBlockProgress progress;
+        while (!engine.render(grid, progress, MandelbrotFormula{}, max_iter, [&](int x, int y, const PerturbationResult& r) {
+            out[y * w + x] = r.iter;
+        }, 4.0, 32, 32, 1, 0));
+        return out;
+    }
+
+    double matchRatio(const std::vector<int>& a, const std::vector<int>& b)
+    {
+        int same = 0;
+        for (size_t i = 0; i < a.size(); ++i)
+            same += (a[i] == b[i]);
+        return double(same) / double(a.size());
+    }
+}
+
+TEST_CASE("Perturbation matches direct f128 iteration past f64 precision")
+{
+    // near the Misiurewicz point c = i, escape times keep varying at any depth
+    const f128 cx = f128{ 0.0 } + f128{ 3.1e-31 };
+    const f128 cy = f128{ 1.0 } + f128{ -1.7e-31 };
+    const int max_iter = 1000;
+
+    for (double size : { 1e-10, 1e-18, 1e-26, 1e-30 })
+    {
+        WorldRasterGrid128 grid;
+        grid.setRasterSize(w, h);
+        grid.setWorldRect(cx - f128{ size } * 0.5, cy - f128{ size * 0.75 } * 0.5, f128{ size }, f128{ size * 0.75 });
+
+        PerturbationEngine<f128> engine;
+        const auto direct = directIterations(grid, max_iter);
+        const auto perturbed = perturbedIterations(grid, engine, max_iter);
+
+        // double deltas can shift a handful of boundary pixels by an iteration
+        REQUIRE(matchRatio(direct, perturbed) >= 0.99);
+        REQUIRE(engine.getStats().reference_orbits == 1);
+    }
+}
+
+TEST_CASE("Perturbation rebases when the reference escapes first")
+{
+    // view straddles the set boundary, reference at the centre escapes early
+    WorldRasterGrid128 grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(f128{ 0.25 }, f128{ -0.05 }, f128{ 0.1 }, f128{ 0.1 });
+
+    PerturbationEngine<f128> engine;
+    const int max_iter = 500;
+    const auto direct = directIterations(grid, max_iter);
+    const auto perturbed = perturbedIterations(grid, engine, max_iter);
+
+    REQUIRE(engine.referenceLength() < max_iter);
+    REQUIRE(engine.getStats().rebases > 0);
+    REQUIRE(matchRatio(direct, perturbed) >= 0.99);
+}
+
+TEST_CASE("Perturbation keeps its reference while it stays in view")
+{
+    WorldRasterGrid128 grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(f128{ -0.75 }, f128{ 0.1 }, f128{ 1e-6 }, f128{ 1e-6 });
+
+    PerturbationEngine<f128> engine;
+    perturbedIterations(grid, engine, 300);
+    REQUIRE(engine.getStats().reference_orbits == 1);
+
+    // small pan, reference still inside
+    grid.setWorldRect(f128{ -0.75 } + f128{ 2e-7 }, f128{ 0.1 }, f128{ 1e-6 }, f128{ 1e-6 });
+    perturbedIterations(grid, engine, 300);
+    REQUIRE(engine.getStats().reference_orbits == 1);
+
+    // panned past the reference
+    grid.setWorldRect(f128{ -0.75 } + f128{ 2e-6 }, f128{ 0.1 }, f128{ 1e-6 }, f128{ 1e-6 });
+    perturbedIterations(grid, engine, 300);
+    REQUIRE(engine.getStats().reference_orbits == 2);
+
+    // iteration limit change
+    perturbedIterations(grid, engine, 400);
+    REQUIRE(engine.getStats().reference_orbits == 3);
+}
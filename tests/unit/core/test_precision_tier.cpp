@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/core/precision_tier.h>
+
+#include <type_traits>
+
+using namespace bl;
+
+namespace {
+    // pixel size giving exactly 'bits' bits at coordinate magnitude 1
+    f128 pixelForBits(int bits) { return f128{ std::ldexp(1.0, -bits) }; }
+}
+
+TEST_CASE("PrecisionTierSelector picks the cheapest sufficient type")
+{
+    PrecisionTierSelector tier;
+    tier.setGuardBits(0);
+
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(10)) == FloatingPointType::F32);
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(40)) == FloatingPointType::F64);
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(80)) == FloatingPointType::F128);
+    REQUIRE(!tier.precisionExhausted());
+
+    // beyond f128: stays on the widest type and says so
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(120)) == FloatingPointType::F128);
+    REQUIRE(tier.precisionExhausted());
+}
+
+TEST_CASE("PrecisionTierSelector widens immediately but narrows with hysteresis")
+{
+    PrecisionTierSelector tier(FloatingPointType::F64, FloatingPointType::F128);
+    tier.setGuardBits(0);
+    tier.setHysteresisBits(4);
+
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(50)) == FloatingPointType::F64);
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(54)) == FloatingPointType::F128);
+
+    // hovering just under the f64 limit keeps f128
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(52)) == FloatingPointType::F128);
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(54)) == FloatingPointType::F128);
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(50)) == FloatingPointType::F128);
+    REQUIRE(tier.switchCount() == 1);
+
+    // enough margin, drop back
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(49)) == FloatingPointType::F64);
+
+    // the range floor is respected even at shallow zoom
+    REQUIRE(tier.update(f128{ 1.0 }, pixelForBits(4)) == FloatingPointType::F64);
+}
+
+TEST_CASE("PrecisionTierSelector derives bits from a raster grid and dispatches the kernel")
+{
+    WorldRasterGrid128 grid;
+    grid.setRasterSize(1000, 1000);
+
+    PrecisionTierSelector tier;
+    auto kernelType = [&]() {
+        return tier.dispatch([&]<typename T>() -> int {
+            if constexpr (std::is_same_v<T, f32>)  return 32;
+            if constexpr (std::is_same_v<T, f64>)  return 64;
+            if constexpr (std::is_same_v<T, f128>) return 128;
+            return 0;
+        });
+    };
+
+    grid.setWorldRect(f128{ -2.0 }, f128{ -1.0 }, f128{ 3.0 }, f128{ 2.0 });
+    tier.update(grid);
+    REQUIRE(kernelType() == 32);
+
+    grid.setWorldRect(f128{ -0.75 }, f128{ 0.1 }, f128{ 1e-9 }, f128{ 1e-9 });
+    tier.update(grid);
+    REQUIRE(kernelType() == 64);
+
+    grid.setWorldRect(f128{ -0.75 }, f128{ 0.1 }, f128{ 1e-14 }, f128{ 1e-14 });
+    tier.update(grid);
+    REQUIRE(kernelType() == 128);
+}
+
+TEST_CASE("PrecisionTierSelector reports its latest tier for the debug UI")
+{
+    PrecisionTierReport& report = precisionTierReport();
+    const uint64_t switches_before = report.switches.load();
+
+    PrecisionTierSelector tier(FloatingPointType::F32, FloatingPointType::F128);
+    tier.setGuardBits(0);
+
+    tier.update(f128{ 1.0 }, pixelForBits(80));
+    REQUIRE(report.tier.load() == int(FloatingPointType::F128));
+    REQUIRE(report.required_bits.load() == tier.requiredBits());
+    REQUIRE_FALSE(report.exhausted.load());
+
+    tier.update(f128{ 1.0 }, pixelForBits(120));
+    REQUIRE(report.exhausted.load());
+
+    tier.update(f128{ 1.0 }, pixelForBits(10));
+    REQUIRE(report.tier.load() == int(FloatingPointType::F32));
+    REQUIRE(report.switches.load() - switches_before == tier.switchCount());
+}
@@ -0,0 +1,987 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/core/raster_grid.h>
+#include <bitloop/util/fltx/f256_simd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    // one ulp at the binade of 'scale' (f128 carries 106 significant bits)
+    double ulpAt(double scale, int mantissa_bits)
+    {
+        int e;
+        std::frexp(scale, &e);
+        return std::ldexp(1.0, e - mantissa_bits);
+    }
+
+    template<typename T>
+    struct Sample { T wx, wy; };
+
+    template<typename T>
+    std::vector<Sample<T>> traverse(WorldRasterGridT<T>& grid, WorldStepMode mode)
+    {
+        const int w = grid.rasterWidth();
+        std::vector<Sample<T>> out(grid.rasterCount());
+
+        grid.setWorldStepMode(mode);
+        int row = 0;
+        grid.template forEachWorldPixel<T>(row, [&](int x, int y, T wx, T wy) {
+            out[y * w + x] = { wx, wy };
+        }, 0);
+        return out;
+    }
+
+    // Largest difference between the two traversals, in ulps of each scanline's coordinate scale
+    template<typename T>
+    double maxRowUlpError(const std::vector<Sample<T>>& ref, const std::vector<Sample<T>>& inc,
+        int w, int h, int mantissa_bits)
+    {
+        double worst = 0;
+        for (int y = 0; y < h; ++y)
+        {
+            double scale_x = 0, scale_y = 0;
+            for (int x = 0; x < w; ++x)
+            {
+                scale_x = std::max(scale_x, std::fabs(static_cast<double>(ref[y * w + x].wx)));
+                scale_y = std::max(scale_y, std::fabs(static_cast<double>(ref[y * w + x].wy)));
+            }
+
+            const double ulp_x = ulpAt(scale_x, mantissa_bits);
+            const double ulp_y = ulpAt(scale_y, mantissa_bits);
+            for (int x = 0; x < w; ++x)
+            {
+                const Sample<T>& a = ref[y * w + x];
+                const Sample<T>& b = inc[y * w + x];
+                worst = std::max(worst, std::fabs(static_cast<double>(a.wx - b.wx)) / ulp_x);
+                worst = std::max(worst, std::fabs(static_cast<double>(a.wy - b.wy)) / ulp_y);
+            }
+        }
+        return worst;
+    }
+}
+
+TEST_CASE("Incremental world stepping stays within 1 ulp of per-pixel lerp (f64)")
+{
+    const int w = 3840, h = 16;
+    for (double size : { 4.0, 1e-3, 1e-8, 1e-13 })
+    {
+        WorldRasterGridT<f64> grid;
+        grid.setRasterSize(w, h);
+        grid.setWorldRect(-0.743643887037151 - size * 0.5, 0.131825904205330 - size * 0.5, size, size * 0.5625);
+
+        auto ref = traverse(grid, WorldStepMode::PER_PIXEL);
+        auto inc = traverse(grid, WorldStepMode::INCREMENTAL);
+
+        REQUIRE(maxRowUlpError(ref, inc, w, h, 53) <= 1.0);
+    }
+}
+
+TEST_CASE("Incremental world stepping stays within 1 ulp of per-pixel lerp (f128)")
+{
+    const int w = 3840, h = 16;
+    const f128 cx = f128{ -0.743643887037151, 1.3e-18 };
+    const f128 cy = f128{ 0.131825904205330, -3.1e-19 };
+
+    // covers both the full double-double step and the deep-zoom f64 offset regime
+    for (double size : { 4.0, 1e-3, 1e-8, 1e-13, 1e-17, 1e-25 })
+    {
+        const f128 sw = f128{ size };
+        const f128 sh = f128{ size * 0.5625 };
+
+        WorldRasterGridT<f128> grid;
+        grid.setRasterSize(w, h);
+        grid.setWorldRect(cx - sw * 0.5, cy - sh * 0.5, sw, sh);
+
+        auto ref = traverse(grid, WorldStepMode::PER_PIXEL);
+        auto inc = traverse(grid, WorldStepMode::INCREMENTAL);
+
+        REQUIRE(maxRowUlpError(ref, inc, w, h, 106) <= 1.0);
+    }
+}
+
+TEST_CASE("World stepping defaults to per-pixel, types without a stepper always lerp")
+{
+    WorldRasterGridT<f64> grid64;
+    REQUIRE(grid64.worldStepMode() == WorldStepMode::PER_PIXEL);
+
+    // no incremental stepper for f256, INCREMENTAL must give the per-pixel coordinates exactly
+    const int w = 64, h = 4;
+    WorldRasterGridT<f256> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(f256{ -0.743643887037151 }, f256{ 0.131825904205330 }, f256{ 1e-30 }, f256{ 0.5625e-30 });
+
+    auto ref = traverse(grid, WorldStepMode::PER_PIXEL);
+    auto inc = traverse(grid, WorldStepMode::INCREMENTAL);
+
+    for (int i = 0; i < w * h; i++)
+    {
+        REQUIRE(ref[i].wx == inc[i].wx);
+        REQUIRE(ref[i].wy == inc[i].wy);
+    }
+}
+
+TEST_CASE("Incremental world stepping matches per-pixel lerp for blocks starting mid-row")
+{
+    WorldRasterGridT<f128> grid;
+    grid.setRasterSize(1000, 40);
+    grid.setWorldRect(f128{ -1.25 }, f128{ 0.25 }, f128{ 1e-12 }, f128{ 4e-13 });
+
+    auto collect = [&](WorldStepMode mode)
+    {
+        std::vector<Sample<f128>> out(grid.rasterCount());
+        TileBlockProgress progress;
+        grid.setWorldStepMode(mode);
+        while (!grid.forEachWorldTilePixel<f128>(96, 16, progress, [&](int x, int y, f128 wx, f128 wy) {
+            out[y * 1000 + x] = { wx, wy };
+        }, 1, 0, 40, 8));
+        return out;
+    };
+
+    auto ref = collect(WorldStepMode::PER_PIXEL);
+    auto inc = collect(WorldStepMode::INCREMENTAL);
+
+    REQUIRE(maxRowUlpError(ref, inc, 1000, 40, 106) <= 1.0);
+}
+
+TEST_CASE("forEachWorldTilePixel resumes across frames and thread-count changes")
+{
+    const int w = 300, h = 200;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+    std::vector<std::atomic<int>> hits(w * h);
+    TileBlockProgress progress;
+
+    const int thread_counts[] = { 4, 1, 3, 2 };
+    int frame = 0;
+    bool done = false;
+    while (!done)
+    {
+        // budget of 1ms with a slow callback forces several partial frames
+        done = grid.forEachWorldTilePixel<f64>(64, 64, progress, [&](int x, int y, f64, f64) {
+            hits[y * w + x].fetch_add(1, std::memory_order_relaxed);
+            volatile double spin = 0;
+            for (int i = 0; i < 200; ++i) spin = spin + i;
+        }, thread_counts[frame++ % 4], 1, 32, 8);
+
+        // every block before the cursor is done, so per-tile counts never exceed their totals
+        for (size_t t = 0; t < progress.blocks_total_per_tile.size(); ++t)
+            REQUIRE(progress.blocks_done_per_tile[t] <= progress.blocks_total_per_tile[t]);
+    }
+
+    for (auto& n : hits)
+        REQUIRE(n.load() == 1);
+
+    for (int t = 0; t < progress.tiles_x * progress.tiles_y; ++t)
+        REQUIRE(progress.tileFinished(t));
+}
+
+namespace {
+    // Same stepping code on both sides, but FMA contraction can differ per inlining site, so allow 1 ulp
+    template<typename T, int W>
+    void checkBatchedMatchesPerPixel(WorldRasterGridT<T>& grid, int mantissa_bits)
+    {
+        const int w = grid.rasterWidth(), h = grid.rasterHeight();
+
+        std::vector<Sample<T>> ref(grid.rasterCount());
+        TileBlockProgress ref_progress;
+        while (!grid.template forEachWorldTilePixel<T>(96, 16, ref_progress, [&](int x, int y, T wx, T wy) {
+            ref[y * w + x] = { wx, wy };
+        }, 1, 0, 40, 8));
+
+        std::vector<Sample<T>> got(grid.rasterCount());
+        std::vector<std::atomic<int>> hits(grid.rasterCount());
+        TileBlockProgress progress;
+        while (!grid.template forEachWorldTilePixelBatch<T, W>(96, 16, progress, [&](const PixelBatch<T, W>& b)
+        {
+            REQUIRE(b.count >= 1);
+            REQUIRE(b.count <= W);
+            REQUIRE(b.tailMask() == (1 << b.count) - 1);
+            REQUIRE(b.thread_index >= 0);
+            REQUIRE(b.thread_index < 3);
+
+            for (int l = 0; l < b.count; ++l)
+            {
+                if (l > 0) REQUIRE(b.x[l] == b.x[l - 1] + 1);
+                got[b.y * w + b.x[l]] = { b.wx[l], b.wy[l] };
+                hits[b.y * w + b.x[l]].fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // padding repeats the last valid lane
+            for (int l = b.count; l < W; ++l)
+            {
+                REQUIRE(b.x[l] == b.x[b.count - 1]);
+                REQUIRE(b.wx[l] == b.wx[b.count - 1]);
+                REQUIRE(b.wy[l] == b.wy[b.count - 1]);
+            }
+        }, 3, 0, 40, 8));
+
+        for (int i = 0; i < w * h; ++i)
+            REQUIRE(hits[i].load() == 1);
+
+        REQUIRE(maxRowUlpError(ref, got, w, h, mantissa_bits) <= 1.0);
+    }
+}
+
+TEST_CASE("forEachWorldTilePixelBatch visits the same coordinates as forEachWorldTilePixel")
+{
+    SECTION("f64")
+    {
+        WorldRasterGridT<f64> grid;
+        grid.setRasterSize(333, 50);
+        grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+        for (WorldStepMode mode : { WorldStepMode::PER_PIXEL, WorldStepMode::INCREMENTAL })
+        {
+            grid.setWorldStepMode(mode);
+            checkBatchedMatchesPerPixel<f64, pixelBatchWidth<f64>()>(grid, 53);
+            checkBatchedMatchesPerPixel<f64, 8>(grid, 53);
+            checkBatchedMatchesPerPixel<f64, 3>(grid, 53); // block width not a multiple of W
+        }
+    }
+
+    SECTION("f128")
+    {
+        WorldRasterGridT<f128> grid;
+        grid.setRasterSize(333, 50);
+        grid.setWorldRect(f128{ -1.25 }, f128{ 0.25 }, f128{ 1e-12 }, f128{ 4e-13 });
+
+        for (WorldStepMode mode : { WorldStepMode::PER_PIXEL, WorldStepMode::INCREMENTAL })
+        {
+            grid.setWorldStepMode(mode);
+            checkBatchedMatchesPerPixel<f128, pixelBatchWidth<f128>()>(grid, 106);
+            checkBatchedMatchesPerPixel<f128, 1>(grid, 106);
+        }
+    }
+}
+
+TEST_CASE("forEachWorldTilePixelBatch resumes across frames")
+{
+    const int w = 300, h = 200;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+    std::vector<std::atomic<int>> hits(w * h);
+    TileBlockProgress progress;
+
+    int frames = 0;
+    while (!grid.forEachWorldTilePixelBatch<f64, 4>(64, 64, progress, [&](const PixelBatch<f64, 4>& b)
+    {
+        for (int l = 0; l < b.count; ++l)
+            hits[b.y * w + b.x[l]].fetch_add(1, std::memory_order_relaxed);
+        volatile double spin = 0;
+        for (int i = 0; i < 800; ++i) spin = spin + i;
+    }, 2, 1, 32, 8))
+    {
+        ++frames;
+    }
+
+    REQUIRE(frames > 0);
+    for (auto& n : hits)
+        REQUIRE(n.load() == 1);
+}
+
+TEST_CASE("forEachWorldTile samples every tile centre once")
+{
+    const int w = 300, h = 200, tile = 48;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+    const auto ref = traverse(grid, WorldStepMode::PER_PIXEL);
+    const int tiles_x = (w + tile - 1) / tile;
+    const int tiles_y = (h + tile - 1) / tile;
+
+    for (int thread_count : { 1, 3, 8 })
+    {
+        std::vector<std::atomic<int>> visits(size_t(tiles_x) * tiles_y);
+        std::atomic<int> mismatches{ 0 };
+
+        REQUIRE(grid.forEachWorldTile<f64>(tile, tile, [&](int px, int py, f64 wx, f64 wy, int tile_index, int x0, int y0, int x1, int y1)
+        {
+            visits[tile_index].fetch_add(1, std::memory_order_relaxed);
+
+            const bool centred = px == x0 + (x1 - x0 - 1) / 2 && py == y0 + (y1 - y0 - 1) / 2;
+            const bool bounds = x0 == (tile_index % tiles_x) * tile && y0 == (tile_index / tiles_x) * tile &&
+                                x1 == std::min(x0 + tile, w) && y1 == std::min(y0 + tile, h);
+            const Sample<f64>& s = ref[size_t(py) * w + px];
+            if (!centred || !bounds || wx != s.wx || wy != s.wy)
+                mismatches.fetch_add(1);
+        }, thread_count));
+
+        REQUIRE(mismatches.load() == 0);
+        for (auto& n : visits)
+            REQUIRE(n.load() == 1);
+    }
+}
+
+namespace {
+    // records markDirty() coverage per pixel
+    struct DirtyRecordingGrid : public WorldRasterGridT<f64>
+    {
+        std::vector<std::atomic<int>> marked;
+
+        void markDirty(int x0, int y0, int x1, int y1) override
+        {
+            for (int y = y0; y < y1; ++y)
+                for (int x = x0; x < x1; ++x)
+                    marked[size_t(y) * raster_w + x].store(1, std::memory_order_relaxed);
+        }
+
+        void reset()
+        {
+            marked = std::vector<std::atomic<int>>(rasterCount());
+        }
+    };
+}
+
+TEST_CASE("Traversals report the pixels they wrote through markDirty")
+{
+    const int w = 150, h = 90;
+    DirtyRecordingGrid grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+    std::vector<std::atomic<int>> written(size_t(w) * h);
+    auto write = [&](int x, int y) { written[size_t(y) * w + x].store(1, std::memory_order_relaxed); };
+
+    // every pixel written in a frame was reported by the end of that frame
+    auto requireCovered = [&]
+    {
+        for (size_t i = 0; i < written.size(); ++i)
+            if (written[i].load()) REQUIRE(grid.marked[i].load() == 1);
+    };
+
+    auto resetFrame = [&]
+    {
+        grid.reset();
+        for (auto& v : written) v.store(0);
+    };
+
+    SECTION("forEachWorldPixel, partial frames")
+    {
+        int row = 0;
+        bool done = false;
+        while (!done)
+        {
+            resetFrame();
+            done = grid.forEachWorldPixel<f64>(row, [&](int x, int y, f64, f64) {
+                write(x, y);
+                volatile double spin = 0;
+                for (int i = 0; i < 100; ++i) spin = spin + i;
+            }, 3, 1);
+            requireCovered();
+        }
+    }
+
+    SECTION("forEachWorldTilePixel, partial frames")
+    {
+        TileBlockProgress progress;
+        bool done = false;
+        while (!done)
+        {
+            resetFrame();
+            done = grid.forEachWorldTilePixel<f64>(64, 64, progress, [&](int x, int y, f64, f64) {
+                write(x, y);
+                volatile double spin = 0;
+                for (int i = 0; i < 100; ++i) spin = spin + i;
+            }, 2, 1, 32, 8);
+            requireCovered();
+        }
+    }
+
+    SECTION("forEachWorldPixelAdaptive fills")
+    {
+        resetFrame();
+        TileBlockProgress progress;
+        grid.forEachWorldPixelAdaptive<f64>(progress, [&](int x, int y, f64, f64) { write(x, y); return 0; },
+            [](int a, int b) { return a == b; },
+            [&](int x0, int y0, int x1, int y1, int) {
+                for (int y = y0; y < y1; ++y)
+                    for (int x = x0; x < x1; ++x) write(x, y);
+            }, 2, 0, 32);
+        requireCovered();
+    }
+}
+
+namespace {
+    TileBlockProgress buildBlocks(int w, int h)
+    {
+        TileBlockProgress P;
+        detail::ensureBlocksBuilt(P, w, h, 64, 64, 32, 8);
+        return P;
+    }
+
+    bool isPermutation(std::vector<int> order, size_t n)
+    {
+        if (order.size() != n) return false;
+        std::sort(order.begin(), order.end());
+        for (size_t i = 0; i < n; ++i)
+            if (order[i] != int(i)) return false;
+        return true;
+    }
+
+    double focusDistance(const TileBlockProgress& P, int block)
+    {
+        const TileBlock& b = P.blocks[block];
+        const double dx = 0.5 * (b.x0 + b.x1) - P.focus_x;
+        const double dy = 0.5 * (b.y0 + b.y1) - P.focus_y;
+        return dx * dx + dy * dy;
+    }
+}
+
+TEST_CASE("TileBlockProgress orders are permutations of the blocks")
+{
+    TileBlockProgress P = buildBlocks(300, 200);
+    const size_t N = P.blocks.size();
+
+    // RASTER is the build layout
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(P.order[i] == int(i));
+
+    for (BlockOrder mode : { BlockOrder::SPIRAL, BlockOrder::FOCUS_DISTANCE, BlockOrder::HILBERT, BlockOrder::RASTER })
+    {
+        P.set_order(mode);
+        REQUIRE(isPermutation(P.order, N));
+    }
+
+    SECTION("spiral rings grow outward from the centre")
+    {
+        P.set_order(BlockOrder::SPIRAL);
+        double last_ring = -1;
+        for (int bi : P.order)
+        {
+            const TileBlock& b = P.blocks[bi];
+            const double dx = (0.5 * (b.x0 + b.x1) - 150.0) / 32;
+            const double dy = (0.5 * (b.y0 + b.y1) - 100.0) / 8;
+            const double ring = std::floor(std::max(std::fabs(dx), std::fabs(dy)));
+            REQUIRE(ring >= last_ring);
+            last_ring = ring;
+        }
+    }
+
+    SECTION("Hilbert order starts at the raster origin")
+    {
+        P.set_order(BlockOrder::HILBERT);
+        const TileBlock& first = P.blocks[P.order[0]];
+        REQUIRE(first.x0 == 0);
+        REQUIRE(first.y0 == 0);
+    }
+}
+
+TEST_CASE("TileBlockProgress focus order is nearest-first and follows the focus")
+{
+    TileBlockProgress P = buildBlocks(300, 200);
+    P.set_order(BlockOrder::FOCUS_DISTANCE);
+
+    auto requireNearestFirst = [&](int from)
+    {
+        for (size_t i = from + 1; i < P.order.size(); ++i)
+            REQUIRE(focusDistance(P, P.order[i - 1]) <= focusDistance(P, P.order[i]));
+    };
+
+    P.set_focus(250, 40);
+    requireNearestFirst(0);
+    const TileBlock& nearest = P.blocks[P.order[0]];
+    REQUIRE((nearest.x0 <= 250 && 250 < nearest.x1 && nearest.y0 <= 40 && 40 < nearest.y1));
+
+    // movements under half a block are ignored
+    const std::vector<int> before = P.order;
+    P.set_focus(252, 41);
+    REQUIRE(P.focus_x == 250);
+    REQUIRE(P.order == before);
+
+    P.set_focus(20, 180);
+    requireNearestFirst(0);
+}
+
+TEST_CASE("TileBlockProgress never reorders claimed blocks")
+{
+    TileBlockProgress P = buildBlocks(300, 200);
+    const int N = int(P.blocks.size());
+    P.set_order(BlockOrder::FOCUS_DISTANCE);
+    P.set_focus(30, 30);
+
+    // a third of the pass has been claimed
+    const int claimed = N / 3;
+    P.next_block.store(claimed);
+    const std::vector<int> before = P.order;
+
+    auto requireClaimedKept = [&]
+    {
+        REQUIRE(isPermutation(P.order, N));
+        for (int i = 0; i < claimed; ++i)
+            REQUIRE(P.order[i] == before[i]);
+    };
+
+    P.set_focus(270, 170);
+    requireClaimedKept();
+    for (int i = claimed + 1; i < N; ++i)
+        REQUIRE(focusDistance(P, P.order[i - 1]) <= focusDistance(P, P.order[i]));
+
+    P.set_order(BlockOrder::HILBERT);
+    requireClaimedKept();
+
+    P.set_order(BlockOrder::RASTER);
+    requireClaimedKept();
+    REQUIRE(std::is_sorted(P.order.begin() + claimed, P.order.end()));
+}
+
+TEST_CASE("Moving the focus mid-pass renders every pixel once")
+{
+    const int w = 300, h = 200;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+    std::vector<std::atomic<int>> hits(size_t(w) * h);
+    std::vector<int> first_pixel_of_call;
+
+    TileBlockProgress progress;
+    progress.set_order(BlockOrder::FOCUS_DISTANCE);
+
+    const double focus[][2] = { { 280, 20 }, { 10, 190 }, { 150, 100 } };
+    int frame = 0;
+    bool done = false;
+    while (!done)
+    {
+        // one thread, so the first block of each call is the front of the pending order
+        bool first = true;
+        done = grid.forEachWorldTilePixel<f64>(64, 64, progress, [&](int x, int y, f64, f64) {
+            if (first) { first_pixel_of_call.push_back(y * w + x); first = false; }
+            hits[size_t(y) * w + x].fetch_add(1, std::memory_order_relaxed);
+            volatile double spin = 0;
+            for (int i = 0; i < 200; ++i) spin = spin + i;
+        }, 1, 1, 32, 8);
+
+        progress.set_focus(focus[frame % 3][0], focus[frame % 3][1]);
+        frame++;
+    }
+
+    REQUIRE(frame > 3);
+    for (auto& n : hits)
+        REQUIRE(n.load() == 1);
+
+    // the call after a focus move starts at the unfinished block nearest the focus
+    const int x = first_pixel_of_call[1] % w, y = first_pixel_of_call[1] / w;
+    REQUIRE(std::abs(x - 280) < 64);
+    REQUIRE(std::abs(y - 20) < 64);
+}
+
+namespace {
+    // Piecewise constant over the view: two half-planes and a disc, no region small enough to
+    // hide inside a cell without touching its border, so the adaptive fill must reproduce it exactly
+    int regionOf(f64 wx, f64 wy)
+    {
+        return (wx < 0.3 ? 1 : 0) + (wy < 0.7 ? 2 : 0) + (wx * wx + wy * wy < 1.0 ? 4 : 0);
+    }
+
+    std::vector<int> evaluateEveryPixel(WorldRasterGridT<f64>& grid)
+    {
+        const int w = grid.rasterWidth();
+        std::vector<int> out(grid.rasterCount());
+        int row = 0;
+        grid.forEachWorldPixel<f64>(row, [&](int x, int y, f64 wx, f64 wy) {
+            out[size_t(y) * w + x] = regionOf(wx, wy);
+        }, 0);
+        return out;
+    }
+}
+
+TEST_CASE("forEachWorldPixelAdaptive matches per-pixel evaluation of a piecewise constant field")
+{
+    const int w = 300, h = 200;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+    const std::vector<int> ref = evaluateEveryPixel(grid);
+
+    std::vector<int> out(size_t(w) * h, -1);
+    std::vector<std::atomic<int>> writes(size_t(w) * h);
+    auto same = [](int a, int b) { return a == b; };
+    auto fill = [&](int x0, int y0, int x1, int y1, int v)
+    {
+        for (int y = y0; y < y1; ++y)
+        {
+            for (int x = x0; x < x1; ++x)
+            {
+                out[size_t(y) * w + x] = v;
+                writes[size_t(y) * w + x].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    auto resetOutput = [&]
+    {
+        std::fill(out.begin(), out.end(), -1);
+        for (auto& n : writes) n.store(0);
+    };
+
+    auto requireMatchesReference = [&]
+    {
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            REQUIRE(writes[i].load() == 1);
+            REQUIRE(out[i] == ref[i]);
+        }
+    };
+
+    SECTION("single call")
+    {
+        resetOutput();
+        TileBlockProgress progress;
+        AdaptiveFillStats stats;
+        REQUIRE(grid.forEachWorldPixelAdaptive<f64>(progress, [&](int x, int y, f64 wx, f64 wy)
+        {
+            writes[size_t(y) * w + x].fetch_add(1, std::memory_order_relaxed);
+            return out[size_t(y) * w + x] = regionOf(wx, wy);
+        }, same, fill, 4, 0, 64, &stats));
+
+        requireMatchesReference();
+
+        // most of the field is uniform, so most pixels are filled
+        REQUIRE(stats.evaluated.load() + stats.filled.load() == uint64_t(w) * h);
+        REQUIRE(stats.filled.load() > stats.evaluated.load());
+    }
+
+    SECTION("resumes across frames and thread-count changes within a budget")
+    {
+        resetOutput();
+        TileBlockProgress progress;
+        const int thread_counts[] = { 3, 1, 4, 2 };
+        int frame = 0;
+        bool done = false;
+        while (!done)
+        {
+            // budget of 1ms with a slow callback forces several partial frames
+            done = grid.forEachWorldPixelAdaptive<f64>(progress, [&](int x, int y, f64 wx, f64 wy)
+            {
+                writes[size_t(y) * w + x].fetch_add(1, std::memory_order_relaxed);
+                volatile double spin = 0;
+                for (int i = 0; i < 2000; ++i) spin = spin + i;
+                return out[size_t(y) * w + x] = regionOf(wx, wy);
+            }, same, fill, thread_counts[frame++ % 4], 1, 32);
+
+            // cells before the cursor are complete, later ones untouched
+            for (size_t t = 0; t < progress.blocks_total_per_tile.size(); ++t)
+                REQUIRE(progress.blocks_done_per_tile[t] <= progress.blocks_total_per_tile[t]);
+        }
+
+        REQUIRE(frame > 1);
+        REQUIRE(progress.next_block.load() == 0);
+        requireMatchesReference();
+    }
+}
+
+TEST_CASE("forEachWorldPixelAdaptive evaluates small non-uniform cells directly")
+{
+    const int w = 120, h = 84;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+    grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+
+    auto same = [](int a, int b) { return a == b; };
+
+    struct Result { uint64_t evaluated, filled; };
+    auto run = [&](int cell_size, auto&& field) -> Result
+    {
+        std::vector<std::atomic<int>> evaluated(size_t(w) * h);
+        AdaptiveFillStats stats;
+        TileBlockProgress progress;
+
+        REQUIRE(grid.forEachWorldPixelAdaptive<f64>(progress, [&](int x, int y, f64, f64)
+        {
+            evaluated[size_t(y) * w + x].fetch_add(1, std::memory_order_relaxed);
+            return field(x, y);
+        }, same, [](int, int, int, int, int) {}, 2, 0, cell_size, &stats));
+
+        // no pixel is evaluated twice, even where split rectangles share an edge
+        for (auto& n : evaluated)
+            REQUIRE(n.load() <= 1);
+        REQUIRE(stats.evaluated.load() + stats.filled.load() == uint64_t(w) * h);
+        return { stats.evaluated.load(), stats.filled.load() };
+    };
+
+    // Every 6x6 cell has a different left border column around a uniform 4x4 interior. The interior
+    // is no wider than min_interior, so it's evaluated rather than split or filled
+    auto left_column = [](int x, int) { return x % 6 == 0 ? 1 : 0; };
+    const Result small = run(6, left_column);
+    REQUIRE(small.evaluated == uint64_t(w) * h);
+    REQUIRE(small.filled == 0);
+
+    // the same field in larger cells splits down to uniform rectangles that are filled
+    REQUIRE(run(64, left_column).filled > 0);
+
+    // a 1px checkerboard never has a uniform border, so everything is evaluated whatever the cell size
+    for (int cell_size : { 6, 16, 64 })
+    {
+        const Result r = run(cell_size, [](int x, int y) { return (x + y) & 1; });
+        REQUIRE(r.evaluated == uint64_t(w) * h);
+        REQUIRE(r.filled == 0);
+    }
+}
+
+namespace {
+    // Pixel counts and coordinates seen by a traversal, checked against the grid's current view
+    struct PassRecorder
+    {
+        int w, h;
+        std::vector<std::atomic<int>> hits;
+        std::vector<Sample<f64>> seen;
+
+        PassRecorder(int _w, int _h) : w(_w), h(_h), hits(size_t(_w) * _h), seen(size_t(_w) * _h) {}
+
+        void reset()
+        {
+            for (auto& n : hits) n.store(0);
+            for (auto& s : seen) s = { -1.0, -1.0 };
+        }
+
+        void visit(int x, int y, f64 wx, f64 wy)
+        {
+            hits[size_t(y) * w + x].fetch_add(1, std::memory_order_relaxed);
+            seen[size_t(y) * w + x] = { wx, wy };
+            volatile double spin = 0;
+            for (int i = 0; i < 300; ++i) spin = spin + i;
+        }
+
+        // every pixel reached exactly once, and evaluated pixels carry coordinates of the current view
+        void requireSinglePass(WorldRasterGridT<f64>& grid)
+        {
+            const auto ref = traverse(grid, WorldStepMode::PER_PIXEL);
+            for (size_t i = 0; i < hits.size(); ++i)
+            {
+                REQUIRE(hits[i].load() == 1);
+                if (seen[i].wx != -1.0)
+                {
+                    REQUIRE(seen[i].wx == ref[i].wx);
+                    REQUIRE(seen[i].wy == ref[i].wy);
+                }
+            }
+        }
+    };
+}
+
+TEST_CASE("forEachWorldPixel restarts a pass abandoned by the cancellation token")
+{
+    const int w = 160, h = 120;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+
+    Thread::CancellationToken token;
+    PassRecorder rec(w, h);
+    auto visit = [&](int x, int y, f64 wx, f64 wy) { rec.visit(x, y, wx, wy); };
+
+    auto finishPass = [&](RowProgress& P, int thread_count, int timeout_ms)
+    {
+        bool done = false;
+        while (!done)
+        {
+            done = grid.forEachWorldPixel<f64>(P, visit, thread_count, timeout_ms, nullptr, &token);
+            REQUIRE_FALSE(P.cancelled);
+        }
+        REQUIRE(P.current_row == 0);
+        rec.requireSinglePass(grid);
+    };
+
+    SECTION("token moves between calls")
+    {
+        grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+        rec.reset();
+
+        // render part of the pass for the first view
+        RowProgress P;
+        REQUIRE_FALSE(grid.forEachWorldPixel<f64>(P, visit, 3, 1, nullptr, &token));
+        REQUIRE(P.current_row > 0);
+
+        // the view changes while the pass is unfinished, the next call starts over for the new view
+        grid.setWorldRect(0.5, 0.25, 1.5, 1.0);
+        token.cancel();
+        rec.reset();
+        finishPass(P, 3, 1);
+    }
+
+    SECTION("token moves mid-call")
+    {
+        struct Config { int thread_count, timeout_ms; };
+        for (Config c : { Config{ 0, 0 }, Config{ 3, 0 }, Config{ 3, 1 } })
+        {
+            grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+            rec.reset();
+
+            // trips once, halfway down the raster
+            RowProgress P;
+            std::atomic<bool> tripped{ false };
+            bool done = false;
+            while (!done && !P.cancelled)
+            {
+                done = grid.forEachWorldPixel<f64>(P, [&](int x, int y, f64 wx, f64 wy)
+                {
+                    rec.visit(x, y, wx, wy);
+                    if (y == h / 2 && !tripped.exchange(true)) token.cancel();
+                }, c.thread_count, c.timeout_ms, nullptr, &token);
+            }
+
+            REQUIRE_FALSE(done);
+            REQUIRE(P.cancelled);
+            REQUIRE(P.current_row == 0);
+
+            rec.reset();
+            finishPass(P, c.thread_count, c.timeout_ms);
+        }
+    }
+}
+
+TEST_CASE("forEachWorldTilePixel restarts a pass abandoned by the cancellation token")
+{
+    const int w = 160, h = 120;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+
+    Thread::CancellationToken token;
+    PassRecorder rec(w, h);
+    auto visit = [&](int x, int y, f64 wx, f64 wy) { rec.visit(x, y, wx, wy); };
+
+    auto requireProgressReset = [](const TileBlockProgress& P)
+    {
+        REQUIRE(P.next_block.load() == 0);
+        for (uint32_t n : P.blocks_done_per_tile)
+            REQUIRE(n == 0u);
+    };
+
+    auto finishPass = [&](TileBlockProgress& P)
+    {
+        bool done = false;
+        while (!done)
+        {
+            done = grid.forEachWorldTilePixel<f64>(64, 64, P, visit, 2, 1, 32, 8, &token);
+            REQUIRE_FALSE(P.cancelled);
+        }
+        for (int t = 0; t < P.tiles_x * P.tiles_y; ++t)
+            REQUIRE(P.tileFinished(t));
+        rec.requireSinglePass(grid);
+    };
+
+    SECTION("token moves between calls")
+    {
+        grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+        rec.reset();
+
+        TileBlockProgress P;
+        REQUIRE_FALSE(grid.forEachWorldTilePixel<f64>(64, 64, P, visit, 2, 1, 32, 8, &token));
+        REQUIRE(P.next_block.load() > 0);
+
+        grid.setWorldRect(0.5, 0.25, 1.5, 1.0);
+        token.cancel();
+        rec.reset();
+        finishPass(P);
+    }
+
+    SECTION("token moves mid-call")
+    {
+        grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+        rec.reset();
+
+        TileBlockProgress P;
+        std::atomic<int> visited{ 0 };
+        bool done = false;
+        while (!done && !P.cancelled)
+        {
+            done = grid.forEachWorldTilePixel<f64>(64, 64, P, [&](int x, int y, f64 wx, f64 wy)
+            {
+                rec.visit(x, y, wx, wy);
+                if (visited.fetch_add(1) == w * h / 2) token.cancel();
+            }, 2, 1, 32, 8, &token);
+        }
+
+        REQUIRE_FALSE(done);
+        REQUIRE(P.cancelled);
+        requireProgressReset(P);
+
+        rec.reset();
+        finishPass(P);
+    }
+}
+
+TEST_CASE("forEachWorldPixelAdaptive restarts a pass abandoned by the cancellation token")
+{
+    const int w = 160, h = 120;
+    WorldRasterGridT<f64> grid;
+    grid.setRasterSize(w, h);
+
+    Thread::CancellationToken token;
+    PassRecorder rec(w, h);
+
+    // piecewise constant, so most cells are filled rather than evaluated
+    auto eval = [&](int x, int y, f64 wx, f64 wy) { rec.visit(x, y, wx, wy); return wx < 1.0 ? 0 : 1; };
+    auto same = [](int a, int b) { return a == b; };
+    auto fill = [&](int x0, int y0, int x1, int y1, int)
+    {
+        for (int y = y0; y < y1; ++y)
+            for (int x = x0; x < x1; ++x)
+                rec.hits[size_t(y) * w + x].fetch_add(1, std::memory_order_relaxed);
+    };
+
+    auto finishPass = [&](TileBlockProgress& P)
+    {
+        bool done = false;
+        while (!done)
+        {
+            done = grid.forEachWorldPixelAdaptive<f64>(P, eval, same, fill, 2, 1, 32, nullptr, &token);
+            REQUIRE_FALSE(P.cancelled);
+        }
+        rec.requireSinglePass(grid);
+    };
+
+    SECTION("token moves between calls")
+    {
+        grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+        rec.reset();
+
+        TileBlockProgress P;
+        bool done = false;
+        while (!done && P.next_block.load() == 0)
+            done = grid.forEachWorldPixelAdaptive<f64>(P, eval, same, fill, 2, 1, 32, nullptr, &token);
+        REQUIRE_FALSE(done);
+
+        grid.setWorldRect(0.5, 0.25, 1.5, 1.0);
+        token.cancel();
+        rec.reset();
+        finishPass(P);
+    }
+
+    SECTION("token moves mid-call")
+    {
+        grid.setWorldRect(-2.0, -1.0, 3.0, 2.0);
+        rec.reset();
+
+        TileBlockProgress P;
+        std::atomic<int> cells{ 0 };
+        bool done = false;
+        while (!done && !P.cancelled)
+        {
+            done = grid.forEachWorldPixelAdaptive<f64>(P, eval, same,
+                [&](int x0, int y0, int x1, int y1, int v)
+                {
+                    fill(x0, y0, x1, y1, v);
+                    if (cells.fetch_add(1) == 4) token.cancel();
+                }, 2, 0, 32, nullptr, &token);
+        }
+
+        REQUIRE_FALSE(done);
+        REQUIRE(P.cancelled);
+        REQUIRE(P.next_block.load() == 0);
+        for (uint32_t n : P.blocks_done_per_tile)
+            REQUIRE(n == 0u);
+
+        rec.reset();
+        finishPass(P);
+    }
+}
@@ -0,0 +1,415 @@
+// Generated by scripts/gen_fltx_math_reference.py (mpmath, 400 bits) - do not edit.
+// x, y: exact double-double inputs. ref: the exact result as four non-overlapping doubles.
+#pragma once
+
+namespace fltx_math_reference
+{
+    struct Case
+    {
+        double x[2];
+        double y[2];
+        double ref[4];
+    };
+
+    inline constexpr Case exp_cases[] = {
+        { { 0x1.0000000000000p+0, 0.0 }, { 0.0, 0.0 }, { 0x1.5bf0a8b145769p+1, 0x1.4d57ee2b1013ap-53, -0x1.618713a31d3e2p-109, 0x1.c5a6d2b53c26dp-163 } },
+        { { -0x1.0000000000000p+0, 0.0 }, { 0.0, 0.0 }, { 0x1.78b56362cef38p-2, -0x1.ca8a4270fadf5p-57, -0x1.837912b3fd2aap-111, -0x1.52711999fb68cp-165 } },
+        { { 0x1.0000000000000p-1, 0.0 }, { 0.0, 0.0 }, { 0x1.a61298e1e069cp+0, -0x1.b4690082a4906p-55, -0x1.80c9c135c1d28p-109, 0x1.30b4759c44bfdp-164 } },
+        { { 0x1.0000000000000p-40, 0.0 }, { 0.0, 0.0 }, { 0x1.0000000001000p+0, 0x1.0000000000555p-81, 0x1.5555555aaaaabp-135, -0x1.5555111111111p-189 } },
+        { { 0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56 }, { 0.0, 0.0 }, { 0x1.0000000000000p+1, -0x1.7b57a079a1934p-110, 0x1.ace93a4ebe5d1p-164, 0x1.46c471610a7d2p-218 } },
+        { { 0x1.5e00000000000p+9, 0.0 }, { 0.0, 0.0 }, { 0x1.d945df4f8ec8ep+1009, 0x1.183392684a46ep+954, 0x1.574512d5beeeep+900, 0x1.8059a31d69d3dp+845 } },
+        { { -0x1.2c00000000000p+9, 0.0 }, { 0.0, 0.0 }, { 0x1.4dd4d0d12c071p-866, 0x1.2167a13398003p-921, -0x1.d60ab16f6f402p-977, 0x0.00ad75c9e2665p-1022 } },
+        { { 0x1.03c1c11dac5a8p+6, 0.0 }, { 0.0, 0.0 }, { 0x1.9c47b27f3797ap+93, -0x1.d521f02286270p+35, 0x1.f714e01d8ef3ap-20, -0x1.e7c456341c2bep-74 } },
+        { { 0x1.e8e4bd22c86bdp-42, -0x1.2033194d252f2p-97 }, { 0.0, 0.0 }, { 0x1.00000000007a4p+0, -0x1.b42dd371f7d25p-54, 0x1.223cc7524018ap-108, -0x1.6cb0eaac44991p-164 } },
+        { { -0x1.cc1018f456b6dp+8, 0.0 }, { 0.0, 0.0 }, { 0x1.3497e93db204ap-664, 0x1.e4fff8cb283e5p-718, 0x1.bd02061a3e169p-772, 0x1.a90baca4afafcp-826 } },
+        { { 0x1.1859ca9cf8f61p-1, 0x1.eb36f42cf963cp-55 }, { 0.0, 0.0 }, { 0x1.baa1a72f3e0f2p+0, -0x1.ae195afdda2eap-54, 0x1.96f81d9fc48f4p-108, -0x1.438d3a2f795d9p-164 } },
+        { { 0x1.d8be0ce1c72f4p-59, 0x1.eff65a7d55b8cp-114 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, 0x1.d8be0ce1c72f4p-59, 0x1.059f22b109958p-113, -0x1.97e30875847ddp-171 } },
+        { { 0x1.7e5cb17314560p+8, 0.0 }, { 0.0, 0.0 }, { 0x1.8cb180dcbdf1fp+551, -0x1.edfaa30bceab3p+497, 0x1.27f44afd8c0e8p+442, 0x1.0924924071da9p+387 } },
+        { { 0x1.ab7bcef26c330p-35, -0x1.0e6d633815512p-90 }, { 0.0, 0.0 }, { 0x1.00000000356f8p+0, -0x1.886b397cf0c82p-54, -0x1.8b275762fad4fp-111, -0x1.35a46ca81528ap-165 } },
+        { { -0x1.5b4b17660f1adp-9, -0x1.8a0df01d7179dp-64 }, { 0.0, 0.0 }, { 0x1.fea52a97269dbp-1, -0x1.915e417b0cfcap-57, 0x1.f15e6b08f9b7ep-111, 0x1.a203a8e3444abp-165 } },
+        { { -0x1.192244a61844bp-8, 0x1.225036bad0d5dp-64 }, { 0.0, 0.0 }, { 0x1.fdceefc20e1e5p-1, -0x1.2b2e0506c3e09p-55, -0x1.fc21baa62494ap-111, -0x1.fc543e9fb352fp-165 } },
+        { { 0x1.77a824dff70c1p-27, -0x1.81fdf3e2b1363p-82 }, { 0.0, 0.0 }, { 0x1.0000002ef504ap+0, 0x1.35765b502c51dp-58, -0x1.521f434819b79p-112, -0x1.540f09483dadap-168 } },
+        { { -0x1.7de863da198ccp-29, 0x1.dc9e0ece1f2cdp-83 }, { 0.0, 0.0 }, { 0x1.ffffffe82179cp-1, 0x1.766b4bc002ba2p-56, -0x1.0221ab2db8cfap-111, -0x1.a76ad076bcba3p-165 } },
+        { { -0x1.9000e777ae1b8p-2, 0x1.f33c65af04130p-57 }, { 0.0, 0.0 }, { 0x1.5a6f7212190c7p-1, -0x1.64ed4a0bb0150p-55, 0x1.348c865877738p-114, 0x1.2206f1881f224p-169 } },
+        { { 0x1.24f3cbf9a3f60p+4, 0.0 }, { 0.0, 0.0 }, { 0x1.555660388ed5dp+26, -0x1.f0a91205a5c1ep-29, 0x1.041f4dd1f6882p-87, -0x1.bda275a065b18p-143 } },
+        { { -0x1.08092a6f49ed1p-37, 0x1.13a791349627ep-92 }, { 0.0, 0.0 }, { 0x1.ffffffffef7f7p-1, -0x1.537a2d5e11ca5p-56, -0x1.77eef86763873p-110, 0x1.335fb1a90822ap-164 } },
+        { { -0x1.a9be0b0c4c650p+5, 0.0 }, { 0.0, 0.0 }, { 0x1.2ac8510361aacp-77, -0x1.6b3dc1ae05f1cp-133, 0x1.e7b09297cf1cbp-190, -0x1.0679979c765f4p-246 } },
+        { { -0x1.2186587a445c0p+9, 0.0 }, { 0.0, 0.0 }, { 0x1.8631c92803609p-836, -0x1.d2e11ccc89407p-891, -0x1.9f3d67a7424d1p-945, -0x1.e32aa2114b5d2p-1002 } },
+        { { -0x1.46d901f468410p+5, 0.0 }, { 0.0, 0.0 }, { 0x1.0a5fad09158afp-59, 0x1.1f7193d248a21p-116, 0x1.fdc0b174563dbp-170, 0x1.d24ec35baf23ep-226 } },
+        { { -0x1.4403b0509e81ap-6, -0x1.58f6d463aa3a5p-62 }, { 0.0, 0.0 }, { 0x1.f5f959083e541p-1, -0x1.39e18e705373fp-55, 0x1.4d77780e382a1p-109, -0x1.e035922c35be3p-163 } },
+        { { 0x1.0ec9412fc1bd6p+9, 0.0 }, { 0.0, 0.0 }, { 0x1.40633480f79b5p+781, 0x1.ac48a76b023dcp+726, -0x1.53e3bb9fcaf13p+670, 0x1.fab29b409bc36p+616 } },
+        { { 0x1.4b0356f5e3dc8p+7, 0.0 }, { 0.0, 0.0 }, { 0x1.b632bcbdbf8e7p+238, -0x1.e237027c39a31p+182, -0x1.17e136f2f7e8fp+127, 0x1.40098e0857e23p+73 } },
+        { { -0x1.f01e51497a34fp-52, -0x1.20b0da8a82670p-106 }, { 0.0, 0.0 }, { 0x1.ffffffffffffcp-1, 0x1.fc35d6d0b9653p-57, 0x1.1d114e9f61c58p-113, -0x1.ff221916a79b1p-170 } },
+        { { 0x1.ae439848a7650p+5, 0.0 }, { 0.0, 0.0 }, { 0x1.82013b8de6e23p+77, 0x1.eef6cb3b1709ap+23, 0x1.895e8de108e63p-33, 0x1.d3724076686d4p-90 } },
+        { { 0x1.4bab117e5183ep+8, 0.0 }, { 0.0, 0.0 }, { 0x1.6910e684d31cdp+478, 0x1.e1bc928a5fdf5p+424, -0x1.91064d0f4901ep+364, 0x1.c9000a995b50ap+307 } },
+        { { 0x1.c0fea9a3f4e60p+5, 0.0 }, { 0.0, 0.0 }, { 0x1.f592cbc20cf68p+80, 0x1.a6d96788ab3a8p+26, -0x1.3a11a9ee6b7e1p-28, 0x1.8e098f577b4c7p-83 } },
+        { { 0x1.e74621ae97633p-7, 0x1.2181d2e9a6331p-64 }, { 0.0, 0.0 }, { 0x1.03d5d475cbd12p+0, -0x1.3bef43e054456p-54, 0x1.c8a905473797ap-108, -0x1.6d5718d36f4d4p-164 } },
+        { { 0x1.08895a31b4a52p+9, 0.0 }, { 0.0, 0.0 }, { 0x1.393b5b3588257p+763, 0x1.25b839bfa1031p+708, 0x1.b2f5fd5f779f4p+653, -0x1.831b0d7c76a0ep+599 } },
+        { { 0x1.fd4ed101aad20p-15, -0x1.ca6906b06fe6fp-70 }, { 0.0, 0.0 }, { 0x1.0003faa58c92ep+0, -0x1.db53f14a5d4c0p-55, 0x1.ed3ca615aa04bp-114, -0x1.927799468e3d0p-168 } },
+        { { -0x1.dd037c0ca9748p+8, 0.0 }, { 0.0, 0.0 }, { 0x1.c253a0bbc2853p-689, 0x1.e7c5f3f8db60bp-743, -0x1.9601990a1c518p-797, -0x1.cbe4edeee792cp-851 } },
+        { { -0x1.77ccc59d0215ap+7, 0.0 }, { 0.0, 0.0 }, { 0x1.e39a7ff36125bp-272, -0x1.1936ba0408090p-326, -0x1.a403d4e5b71c3p-382, -0x1.78448cb1deba2p-436 } },
+        { { -0x1.04c7f21c4f2abp-33, -0x1.227118698ededp-87 }, { 0.0, 0.0 }, { 0x1.fffffffefb381p-1, -0x1.0e066082466e2p-56, 0x1.54f97bb604d27p-110, 0x1.c5d249fb89d18p-165 } },
+        { { 0x1.fa10914892e61p+4, 0x1.8e1f54cfdb0cep-51 }, { 0.0, 0.0 }, { 0x1.8c783157fb90cp+45, -0x1.1d03b396fca11p-9, 0x1.e4cf24ee7c6b2p-63, -0x1.0c895f7f2ea5cp-118 } },
+        { { 0x1.5bbb503e7bf08p-15, -0x1.dcc011aa48b1ep-69 }, { 0.0, 0.0 }, { 0x1.0002b77a512b0p+0, -0x1.deea3ee436080p-54, -0x1.28df53d1392eep-110, -0x1.48903dfa87ea7p-166 } },
+        { { -0x1.d6e1c2d3bdcc2p-15, 0x1.9f70d306a6035p-71 }, { 0.0, 0.0 }, { 0x1.fff8a4867d277p-1, -0x1.67f336dde863ep-55, -0x1.335383d584c0dp-109, 0x1.0944855d0ef78p-164 } },
+        { { 0x1.4cab232e409acp+7, 0.0 }, { 0.0, 0.0 }, { 0x1.f553221993f82p+239, 0x1.4760765679307p+184, 0x1.1816fc3280cb3p+129, 0x1.33abe168e97b1p+75 } },
+        { { -0x1.eadd7bab0eb38p-58, 0x1.090105dcc31e7p-114 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.eadd7bab0eb38p-58, 0x1.7ea7997df5ca0p-114, -0x1.51b429df67602p-168 } },
+        { { -0x1.0814797825865p+8, 0.0 }, { 0.0, 0.0 }, { 0x1.0256ec0a3ed43p-381, 0x1.f9d8da6546443p-435, -0x1.0cabd6f2c6b59p-492, -0x1.f168dead68298p-547 } },
+        { { 0x1.25d667b6b848cp-33, -0x1.eab184e1bbd78p-90 }, { 0.0, 0.0 }, { 0x1.0000000092eb3p+0, 0x1.edc32677924afp-55, -0x1.6d0013fe06795p-110, -0x1.b77338bf2d359p-167 } },
+        { { -0x1.237eaba099f1dp-24, 0x1.4802747d101c6p-80 }, { 0.0, 0.0 }, { 0x1.fffffdb902aa1p-1, -0x1.52aacfb9bd2d8p-55, 0x1.8ac4e372dd1a9p-111, 0x1.cb798d8c7dd4bp-165 } },
+        { { -0x1.213c5530b6418p+7, 0.0 }, { 0.0, 0.0 }, { 0x1.48af6f3e5d2aep-209, 0x1.74f6c2c40ee20p-268, 0x1.ff01866d4ecaap-323, -0x1.baa294e4b971cp-377 } },
+        { { 0x1.24b7f3dd8f2bfp-63, 0x1.06dd8296c85f8p-117 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, 0x1.24b7f3dd8f2bfp-63, 0x1.07312fa0e85efp-117, -0x1.2acbb68efe1a8p-171 } },
+        { { 0x1.0fb99aec46478p-59, 0x1.11ae90c74efb3p-114 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, 0x1.0fb99aec46478p-59, 0x1.1ab1e4abdb1b8p-114, 0x1.78d676836b01bp-171 } },
+        { { -0x1.e836211122f75p+8, 0.0 }, { 0.0, 0.0 }, { 0x1.94700c52f088ap-705, 0x1.797209d6403eap-764, 0x1.f5648584911ddp-818, 0x1.d365748c7d18bp-872 } },
+        { { 0x1.8c52997e3f212p-35, -0x1.1f30c2c1bb5edp-89 }, { 0.0, 0.0 }, { 0x1.00000000318a5p+0, 0x1.97e657a15db94p-55, -0x1.395a3deaad605p-109, -0x1.b444833196514p-163 } },
+        { { 0x1.016d6a8ce4800p+5, 0.0 }, { 0.0, 0.0 }, { 0x1.5760de5161b7cp+46, 0x1.e4836b1b5c193p-8, -0x1.42a472469f439p-68, 0x1.958581f064b14p-123 } },
+        { { 0x1.b403725953a56p-48, -0x1.5fd622f73b9d9p-102 }, { 0.0, 0.0 }, { 0x1.000000000001bp+0, 0x1.00dc9654e9b37p-54, 0x1.d0c746c3b98eap-109, -0x1.1cf1458129456p-166 } },
+        { { 0x1.5a6e33c20b0bcp+9, 0.0 }, { 0.0, 0.0 }, { 0x1.808f3d278214fp+999, -0x1.14ca2bb7e0dfcp+944, 0x1.7e7ecbbd572d0p+888, 0x1.b993ab74e9b6dp+834 } },
+        { { -0x1.b1c83956797b2p-49, 0x1.57be4bf31409bp-103 }, { 0.0, 0.0 }, { 0x1.fffffffffffe5p-1, -0x1.c83956797a62ep-57, 0x1.69a7ae13d5946p-114, -0x1.6e569eed36cfdp-169 } },
+        { { -0x1.e584b60933b5ap+8, 0.0 }, { 0.0, 0.0 }, { 0x1.7582e742a3aadp-701, -0x1.3617436343cb6p-755, -0x1.900d88d9c971ap-810, -0x1.4e7d8c1cc3ecdp-866 } },
+        { { 0x1.26e37cd1e940ap+8, 0.0 }, { 0.0, 0.0 }, { 0x1.59ef327ce2b4cp+425, 0x1.292f3972b9aa2p+371, -0x1.11ff3926ca578p+316, -0x1.05b7155f8ce8ap+262 } },
+        { { 0x1.b85c8667de160p-40, 0x1.05f502fa40b95p-96 }, { 0.0, 0.0 }, { 0x1.0000000001b86p+0, -0x1.bccc10379ff13p-55, 0x1.ff44b01a38affp-109, 0x1.013bb35ccb841p-163 } },
+        { { -0x1.4676b60a2388ep+7, 0.0 }, { 0.0, 0.0 }, { 0x1.6b999bcd017cep-236, -0x1.39679b5cecd04p-290, -0x1.593151ac6477bp-348, -0x1.1acb4137fcfe4p-403 } },
+        { { -0x1.f9e70a88fff18p-49, 0x1.7294ccc7d4269p-103 }, { 0.0, 0.0 }, { 0x1.fffffffffffe0p-1, 0x1.863d5dc003dffp-55, -0x1.55b1efd4b4906p-111, -0x1.4fc0666fc8680p-165 } },
+        { { 0x1.0cbf98b60a3c1p-64, -0x1.3e6be34a137b2p-118 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, 0x1.0cbf98b60a3c1p-64, -0x1.3e489f132f2f2p-118, 0x1.4d523f4bb486ap-172 } },
+        { { 0x1.596117c3f8a0ap+9, 0.0 }, { 0.0, 0.0 }, { 0x1.77d32d5dc1bcfp+996, -0x1.5df1a5c7f292fp+942, -0x1.1b09f80a535f1p+883, -0x1.e1ec5de50492dp+829 } },
+        { { -0x1.7f1c7e68bf644p+8, 0.0 }, { 0.0, 0.0 }, { 0x1.3864cd73fca20p-553, 0x1.8a8f82467cd4cp-608, -0x1.6d37df3ae0b3cp-662, -0x1.464633065dafdp-716 } },
+        { { 0x1.fbed6456fb6cbp-55, 0x1.a2c6ed8a32403p-109 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, 0x1.fbed6456fb6ccp-55, -0x1.61478890efaf4p-109, -0x1.9ecb5c6665f09p-165 } },
+        { { 0x1.7aa4c7a4f5e7cp-55, 0x1.9f71c0a225bb9p-110 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, 0x1.7aa4c7a4f5e7cp-55, 0x1.5bbba239f62d2p-109, 0x1.29a93aa15d4d2p-169 } },
+    };
+
+    inline constexpr Case log_cases[] = {
+        { { 0x1.0000000000000p+1, 0.0 }, { 0.0, 0.0 }, { 0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56, 0x1.7b57a079a1934p-111, -0x1.ace93a4ebe5d1p-165 } },
+        { { 0x1.0000000000000p-1, 0.0 }, { 0.0, 0.0 }, { -0x1.62e42fefa39efp-1, -0x1.abc9e3b39803fp-56, -0x1.7b57a079a1934p-111, 0x1.ace93a4ebe5d1p-165 } },
+        { { 0x1.0000000000004p+0, 0.0 }, { 0.0, 0.0 }, { 0x1.ffffffffffffcp-51, 0x1.5555555555551p-152, 0x1.5555555555589p-206, -0x1.ddddddddde089p-260 } },
+        { { 0x1.fffffffffe000p-1, 0.0 }, { 0.0, 0.0 }, { -0x1.0000000000800p-40, -0x1.5555555556555p-122, -0x1.5555558888889p-176, 0x1.ddd3333333333p-230 } },
+        { { 0x1.4000000000000p+3, 0.0 }, { 0.0, 0.0 }, { 0x1.26bb1bbb55516p+1, -0x1.f48ad494ea3e9p-53, -0x1.9ebae3ae0260cp-107, -0x1.2d10378be1cf1p-161 } },
+        { { 0x1.56e1fc2f8f359p-997, -0x0.00000004d6491p-1022 }, { 0.0, 0.0 }, { -0x1.5963447f87fb5p+9, -0x1.aada9dc37f872p-46, -0x1.77154a1439308p-100, 0x1.c4970e85525d0p-154 } },
+        { { 0x1.7e43c8800759cp+996, -0x1.698fdc7ace0cap+942 }, { 0.0, 0.0 }, { 0x1.5963447f87fb5p+9, 0x1.aada9dc2fafd5p-46, -0x1.5e67f4c7f401dp-103, -0x1.39cf9661cd7a6p-157 } },
+        { { 0x1.5e60495ef85c6p+970, 0x1.2768ab173b212p+912 }, { 0.0, 0.0 }, { 0x1.505552fb56fcbp+9, 0x1.a3bd960ab3036p-46, 0x1.441ff66cbd2e2p-101, 0x1.73d8dfb6f077cp-155 } },
+        { { 0x1.fffffffff9b3ap-1, 0x1.72b60a568feebp-58 }, { 0.0, 0.0 }, { -0x1.9317d1a9412fep-39, -0x1.013e1c6100ca1p-94, 0x1.1f04c5760a7a0p-148, 0x1.de55992c7d836p-202 } },
+        { { 0x1.0002fdbf269d1p+0, -0x1.dd8106555aec8p-56 }, { 0.0, 0.0 }, { 0x1.7edd56b2fe0abp-15, 0x1.32c0735058716p-69, -0x1.0ceab072b8694p-123, -0x1.0ce287cdca4e3p-179 } },
+        { { 0x1.ffffc3766750dp-1, 0x1.baf335b6078a3p-56 }, { 0.0, 0.0 }, { -0x1.e44ce21af9a05p-20, -0x1.18481d4cee029p-74, 0x1.263e64d04f531p-128, -0x1.d41626d90406ap-182 } },
+        { { 0x1.ffffcc225f551p-1, 0x1.cfc5602657ab3p-57 }, { 0.0, 0.0 }, { -0x1.9eed1a5b8eb30p-20, 0x1.b007ca39a9e48p-74, 0x1.62fd1047ef105p-128, 0x1.0c7f552adea07p-182 } },
+        { { 0x1.0000036ed9437p+0, 0x1.ee6b22eed2f30p-54 }, { 0.0, 0.0 }, { 0x1.b76c9ec9971c4p-23, -0x1.c1bb70d2206f7p-77, -0x1.409fb68917db0p-131, -0x1.56a02e32d4bfbp-185 } },
+        { { 0x1.1f2625623a523p-700, 0x1.a67d7441e603cp-754 }, { 0.0, 0.0 }, { -0x1.e516947177e4dp+8, 0x1.f8873b69f76cbp-47, 0x1.54e929c1d0123p-105, 0x1.257b1275a24a1p-161 } },
+        { { 0x1.43cb51ba6478ap+487, 0x1.31e27b526432cp+433 }, { 0.0, 0.0 }, { 0x1.51cc300417f24p+8, 0x1.d680adff433fdp-46, -0x1.977eefa7b59f2p-101, -0x1.3889107ed141dp-155 } },
+        { { 0x1.9dcc48e85501bp+30, 0x1.168857b0419eep-24 }, { 0.0, 0.0 }, { 0x1.5464d39d64594p+4, -0x1.3291a59820429p-52, -0x1.0c733ef0dce3dp-107, 0x1.792c1d4f5e6dap-161 } },
+        { { 0x1.ffffffd7cf70fp-1, 0x1.64be4b1ef373dp-55 }, { 0.0, 0.0 }, { -0x1.4184786006a27p-28, 0x1.932536f98c453p-85, 0x1.5ff86da18e525p-140, 0x1.48d6a768ce85ap-195 } },
+        { { 0x1.ffffffdc9d803p-1, -0x1.9f4436c40d137p-55 }, { 0.0, 0.0 }, { -0x1.1b13febdb0b09p-28, 0x1.7e7b69581a133p-84, 0x1.9ec4ec6b51023p-138, -0x1.13113d87b839dp-192 } },
+        { { 0x1.6aa0b6ff4d24fp+884, -0x1.238dabc12c9f9p+830 }, { 0.0, 0.0 }, { 0x1.328b8f2ef8eb8p+9, -0x1.d20e72d5908aap-45, -0x1.183e030c61428p-99, -0x1.7ed34340013e3p-153 } },
+        { { 0x1.da8f397b499a8p+982, -0x1.8d1b95376ee61p+923 }, { 0.0, 0.0 }, { 0x1.54a4d4b0dad67p+9, 0x1.57bc5417b1bddp-45, 0x1.7fe93134f4a68p-101, -0x1.a46ba1a2fb502p-155 } },
+        { { 0x1.05d0e649bd5c3p+0, 0x1.89566858b1f0ap-55 }, { 0.0, 0.0 }, { 0x1.700f426be92d6p-6, 0x1.8c350b38dc3f9p-60, -0x1.6063c1225a47ep-114, 0x1.127049c654f15p-170 } },
+        { { 0x1.000000000642fp+0, -0x1.c017506b70298p-54 }, { 0.0, 0.0 }, { 0x1.90ba3fe8aaae0p-38, 0x1.5c07f776a7b09p-93, -0x1.456a40dd1b0fdp-148, -0x1.ac91b491bc648p-203 } },
+        { { 0x1.fb1cc972c69fep-1, 0x1.43397d44b88e6p-58 }, { 0.0, 0.0 }, { -0x1.3a4e4c60960a9p-7, 0x1.875547ebdc6afp-62, -0x1.e5766e3b84f49p-116, 0x1.58fabf6824cb6p-171 } },
+        { { 0x1.ffffffbe1cf3ap-1, 0x1.6eecdaf4e5d91p-56 }, { 0.0, 0.0 }, { -0x1.078c31857daedp-27, -0x1.9613269b6a4bbp-89, 0x1.0a8ce41786fd1p-143, 0x1.4b17163e5a454p-198 } },
+        { { 0x1.36b4cc6ffbe05p+804, -0x1.fafe33d57999ep+750 }, { 0.0, 0.0 }, { 0x1.16bdf3d4ce6b4p+9, -0x1.0ae3fece6e0aep-53, -0x1.ff0ca9f16674dp-108, 0x1.86c1f2710ff62p-164 } },
+        { { 0x1.2b376569ed689p-355, 0x1.00ca96b158761p-409 }, { 0.0, 0.0 }, { -0x1.ebd2909b70308p+7, -0x1.5395f376ed339p-48, -0x1.75178d7069683p-104, -0x1.59acb470436dbp-159 } },
+        { { 0x1.f1b15c1c94ee6p-1, -0x1.909c303eacbc6p-60 }, { 0.0, 0.0 }, { -0x1.d059362880303p-6, 0x1.dae3aa17c0b79p-61, 0x1.c20beae38b534p-118, -0x1.1ca3ecf90a00fp-173 } },
+        { { 0x1.5c7b3c64628c8p-645, 0x1.a615fa816717cp-699 }, { 0.0, 0.0 }, { -0x1.bec5829a14400p+8, -0x1.64e017c6989dap-50, -0x1.9cccb24571484p-104, 0x1.c66420c08a293p-159 } },
+        { { 0x1.001ffaa322badp+0, -0x1.b60a4c139ca70p-54 }, { 0.0, 0.0 }, { 0x1.ff8a3f8d94e86p-12, -0x1.788d5e4e9a4ecp-68, 0x1.b7dfde8d1d292p-122, -0x1.31a374690b1b8p-176 } },
+        { { 0x1.6c451d30a51b8p+769, 0x1.9ed2782a708ecp+714 }, { 0.0, 0.0 }, { 0x1.0ab102db6d6a7p+9, -0x1.92f2c0056e0acp-46, -0x1.ae52ebbad981dp-100, 0x1.da14842e7a25cp-154 } },
+        { { 0x1.8c925a34ab5aep-365, -0x1.432600ce58279p-419 }, { 0.0, 0.0 }, { -0x1.f91f40d5862acp+7, -0x1.464849092c3d0p-48, 0x1.421b9a3342665p-102, 0x1.37ee2ce66dc21p-156 } },
+        { { 0x1.fffffff6d5060p-1, 0x1.2e14027c94e8bp-56 }, { 0.0, 0.0 }, { -0x1.255f3fb71b65bp-30, -0x1.da6fd6f76d89cp-84, -0x1.0223366fa63f7p-138, 0x1.be1edec8be3dcp-194 } },
+        { { 0x1.4016793171e49p-479, 0x1.a85539817ec67p-533 }, { 0.0, 0.0 }, { -0x1.4bcb48ef35ffcp+8, -0x1.6b76a4f744ad0p-47, 0x1.59ec42e368c54p-102, -0x1.796bb2f67a47ap-156 } },
+        { { 0x1.2d94b42f16509p+576, 0x1.cd908e485b0edp+522 }, { 0.0, 0.0 }, { 0x1.8f6aa8b539495p+8, 0x1.ff05a835c52a1p-47, -0x1.f4f6ee98f1e99p-101, 0x1.4da84e99c224dp-155 } },
+        { { 0x1.fffff02837ee2p-1, -0x1.a6cb93b7b6291p-55 }, { 0.0, 0.0 }, { -0x1.faf90a14ce2d5p-22, -0x1.8a35f4cfc1770p-78, -0x1.feb420c12f78dp-135, 0x1.54fe4a3a630b1p-189 } },
+        { { 0x1.47d30e36f1cb2p+710, -0x1.d85925515da3ep+656 }, { 0.0, 0.0 }, { 0x1.ec61bd93a31d7p+8, -0x1.314fba822237bp-46, 0x1.ded8e8333bf5bp-101, -0x1.4a6a73bc49d7ep-160 } },
+        { { 0x1.06cef9783c1e0p+0, 0x1.a7986bc1f8ec2p-54 }, { 0.0, 0.0 }, { 0x1.ae0cc697eb4c7p-6, -0x1.7618d514b8a1fp-62, 0x1.f419f92d39973p-116, 0x1.74bb06b46fe23p-171 } },
+        { { 0x1.5a8a70f71dbd2p+181, 0x1.07d415aae3be0p+127 }, { 0.0, 0.0 }, { 0x1.f70cc30983052p+6, -0x1.0122af37f689cp-48, -0x1.8ca97353b729fp-104, 0x1.cf5bb1ded3c19p-160 } },
+        { { 0x1.000069d3025d1p+0, -0x1.41cc80c28d999p-55 }, { 0.0, 0.0 }, { 0x1.a74bb1f6c2538p-18, 0x1.d1e0624b74f68p-72, 0x1.a7b2e0007c18ep-126, 0x1.648bbeb071a27p-180 } },
+        { { 0x1.245b11bfea31fp-402, 0x1.20ddb7c83c2fbp-456 }, { 0.0, 0.0 }, { -0x1.16832adb2af13p+8, 0x1.44959178fe5c2p-49, -0x1.33d09d174196cp-104, 0x1.bcb55b5425bc6p-159 } },
+        { { 0x1.006a52e946049p+0, -0x1.d02a49570cceep-54 }, { 0.0, 0.0 }, { 0x1.a8f36bfca4125p-10, 0x1.4d3d14afc11b0p-64, 0x1.9bd79e02e24e6p-121, 0x1.b5ef783907e90p-175 } },
+        { { 0x1.c8238bfa48462p+45, 0x1.dfaea7244160bp-10 }, { 0.0, 0.0 }, { 0x1.fc4ed1b1f815ep+4, 0x1.e1e35ae074973p-51, -0x1.d680ff477bd01p-106, 0x1.bbbd1adb01495p-160 } },
+        { { 0x1.2711dddbc6d65p+865, 0x1.2c632f593071ep+806 }, { 0.0, 0.0 }, { 0x1.2bdb6fada1d10p+9, -0x1.0513bd43756fdp-46, -0x1.9d59f49b0930ep-104, 0x1.4bd7fea6a2750p-158 } },
+        { { 0x1.fffffffc3837fp-1, 0x1.e6433a0bb67b7p-55 }, { 0.0, 0.0 }, { -0x1.e3e4043542df0p-32, -0x1.0712cf0ff05e2p-87, -0x1.9664a5eca08b9p-141, 0x1.bd7c34277db22p-195 } },
+        { { 0x1.4ea9d7b5ae8ddp-641, -0x1.4916895eb3a45p-695 }, { 0.0, 0.0 }, { -0x1.bc0a15c6e7b3fp+8, -0x1.1ac6e831223b5p-46, -0x1.85a123fea448ap-100, -0x1.c1b4dbc3267f7p-154 } },
+        { { 0x1.cfd47e965d66cp+495, -0x1.dec28cef8a008p+439 }, { 0.0, 0.0 }, { 0x1.57b3c30fe17e2p+8, 0x1.5c9ea8d300090p-48, 0x1.0aa49946e55b1p-102, -0x1.e0fc75582de2fp-158 } },
+        { { 0x1.ffffffb48f26ep-1, 0x1.8195c42e58adap-56 }, { 0.0, 0.0 }, { -0x1.2dc3648a2ea2dp-27, -0x1.9a7b67f8f18f5p-81, -0x1.1e271d8a6f517p-135, -0x1.220e73e3e8055p-190 } },
+        { { 0x1.ecfdbaebd5224p+693, -0x1.27546d47ecf8fp+637 }, { 0.0, 0.0 }, { 0x1.e1019d8618311p+8, 0x1.4a1f8b98e4682p-47, -0x1.b11c0a2a7dc70p-102, -0x1.2efadd4e425a1p-156 } },
+        { { 0x1.19002bc9874f9p-107, -0x1.de37f045e430ep-163 }, { 0.0, 0.0 }, { -0x1.284b55990bf1cp+6, 0x1.c69d7e49c4517p-48, 0x1.93b475f8c3445p-102, 0x1.40fce5e59390ap-156 } },
+        { { 0x1.67a574d84435ap+60, -0x1.1c69e3aeafba9p-2 }, { 0.0, 0.0 }, { 0x1.4f6e21501f8fap+5, -0x1.4cd4eeb3170f9p-49, 0x1.b8e1f67282087p-103, 0x1.eee31afac92ecp-157 } },
+        { { 0x1.49b44778760e9p+146, 0x1.51c3e136dc4ecp+92 }, { 0.0, 0.0 }, { 0x1.95cf5df4e0876p+6, -0x1.ca9f6db525505p-49, -0x1.48cc4f88021eap-103, -0x1.d6016cf3ba598p-159 } },
+        { { 0x1.fffffffff77a6p-1, 0x1.b7f5bcb50f7e8p-56 }, { 0.0, 0.0 }, { -0x1.10b392029317cp-38, 0x1.edca8314c686dp-92, -0x1.04f3f465e3b9fp-147, -0x1.f7a031cb7f56cp-203 } },
+        { { 0x1.06ae11ee754a5p+803, 0x1.0023280a07995p+743 }, { 0.0, 0.0 }, { 0x1.164fbca90fd9cp+9, -0x1.903c1fff05559p-47, 0x1.d4b7afd1b4690p-102, 0x1.5bf4c032ae626p-156 } },
+        { { 0x1.ffffff9526d84p-1, 0x1.b254147ce991cp-56 }, { 0.0, 0.0 }, { -0x1.ab649f1f05ec8p-27, 0x1.1e688e9404e1dp-83, -0x1.a21d59c981752p-138, -0x1.78ebb295bc0d6p-192 } },
+        { { 0x1.7a4d80676cd20p-717, -0x1.89aa906ad58e4p-773 }, { 0.0, 0.0 }, { -0x1.f098942f775e7p+8, -0x1.200ddfdd82c48p-50, -0x1.1cd994737be3fp-104, -0x1.6f89dad6f1015p-162 } },
+        { { 0x1.ffffe99b9aa0ep-1, 0x1.1369bcf67eafep-55 }, { 0.0, 0.0 }, { -0x1.66465dc75e8edp-21, -0x1.f1e133bb84614p-75, -0x1.50068be69ccb7p-130, 0x1.be1a35121f0dcp-187 } },
+        { { 0x1.000044a3c7354p+0, 0x1.f1f886342d1afp-55 }, { 0.0, 0.0 }, { 0x1.128ef80640ecfp-18, -0x1.d1a7f9ee89ddbp-73, 0x1.45fa4ea806aeap-127, -0x1.74d14510ac5dfp-183 } },
+        { { 0x1.232399641f1adp-177, 0x1.c8717b808538dp-231 }, { 0.0, 0.0 }, { -0x1.ea3bd463556bep+6, -0x1.e14fc260a4cc0p-49, -0x1.7a6d744fb86e9p-104, -0x1.22c6953c65d91p-158 } },
+        { { 0x1.00000f7373ba2p+0, 0x1.ab7962aeff373p-54 }, { 0.0, 0.0 }, { 0x1.ee6e68591c468p-21, 0x1.83979989db8dcp-77, 0x1.a14da83275249p-131, -0x1.7d58cc2b5000cp-185 } },
+        { { 0x1.3a1de43dbf83fp-110, 0x1.321727eb4ba7ap-164 }, { 0.0, 0.0 }, { -0x1.302a99da80ab6p+6, -0x1.ee9621ddc1f5ep-49, -0x1.4a01a3b4f657ap-103, 0x1.ebfc347969af3p-158 } },
+        { { 0x1.fffffe34250dbp-1, -0x1.7b7d1b33ebdbap-56 }, { 0.0, 0.0 }, { -0x1.cbdaf32179b1cp-25, 0x1.50a1fd4e205e3p-84, 0x1.058788c674a9dp-140, -0x1.0556a89999713p-198 } },
+        { { 0x1.fffffb01a865cp-1, -0x1.bb1963f7385e3p-57 }, { 0.0, 0.0 }, { -0x1.3f95e81f65b55p-23, -0x1.9d0ac35ddcc85p-78, -0x1.0c4358cd6dbbfp-136, 0x1.03783aeca42eap-196 } },
+        { { 0x1.ffffffee50383p-1, -0x1.ce955b53e3e91p-55 }, { 0.0, 0.0 }, { -0x1.1afc7d78889bdp-29, 0x1.508bc9470fdeep-83, 0x1.4352e407f147ep-137, -0x1.fd6e0da077c10p-191 } },
+        { { 0x1.ffffffffcb45fp-1, -0x1.cd1cea057fd70p-55 }, { 0.0, 0.0 }, { -0x1.a5d0b9a3b2f8fp-36, -0x1.60f41b5e78f25p-92, -0x1.6f2dd30a9ea99p-146, 0x1.ff7a28bd357d3p-200 } },
+    };
+
+    inline constexpr Case sin_cases[] = {
+        { { 0x1.0000000000000p+0, 0.0 }, { 0.0, 0.0 }, { 0x1.aed548f090ceep-1, 0x1.06374f484e288p-59, -0x1.879aec35ddd9ap-113, -0x1.5ce96420926b4p-169 } },
+        { { -0x1.0000000000000p+0, 0.0 }, { 0.0, 0.0 }, { -0x1.aed548f090ceep-1, -0x1.06374f484e288p-59, 0x1.879aec35ddd9ap-113, 0x1.5ce96420926b4p-169 } },
+        { { 0x1.0000000000000p-1, 0.0 }, { 0.0, 0.0 }, { 0x1.eaee8744b05f0p-2, -0x1.789b43c9b027dp-58, 0x1.ed9992f45b4fdp-112, -0x1.43b0ca9d33f26p-166 } },
+        { { 0x1.0000000000000p-30, 0.0 }, { 0.0, 0.0 }, { 0x1.0000000000000p-30, -0x1.5555555555555p-93, -0x1.5511111111111p-147, -0x1.11112b12b12b1p-203 } },
+        { { 0x1.8000000000000p+1, 0.0 }, { 0.0, 0.0 }, { 0x1.210386db6d55bp-3, 0x1.3c7205d08d063p-57, -0x1.7cb4d28748215p-111, 0x1.678f73900049cp-166 } },
+        { { 0x1.9000000000000p+6, 0.0 }, { 0.0, 0.0 }, { -0x1.03425b78c4db8p-1, -0x1.c23d8557420fbp-59, 0x1.bc72a1db6abccp-114, 0x1.5ea8bdfb260bdp-168 } },
+        { { 0x1.81cd6c8b43958p+13, 0x1.0624dd2f1a9fcp-43 }, { 0.0, 0.0 }, { -0x1.687d5890971bdp-1, 0x1.bfa4e8ee57f57p-55, 0x1.b4cd8da8858e3p-109, -0x1.f35c33c40707bp-163 } },
+        { { 0x1.f67fd56d6ca62p+15, 0x1.d61334708d912p-39 }, { 0.0, 0.0 }, { -0x1.bc691d588ac6ep-1, 0x1.1f6636f8d3bddp-56, -0x1.8db92d803f58cp-111, -0x1.5e58e2a05b112p-165 } },
+        { { -0x1.31caab0393320p-18, 0x1.2c853881951dep-72 }, { 0.0, 0.0 }, { -0x1.31caab038ea68p-18, 0x1.111162d40fdd4p-72, 0x1.48e5f34fffb5bp-126, -0x1.c92c0739d8a81p-180 } },
+        { { 0x1.4dd6ffba75715p-8, 0x1.c50cde043422ep-62 }, { 0.0, 0.0 }, { 0x1.4dd6a11bbff70p-8, 0x1.474745b587b4ap-62, 0x1.b32785b8117fbp-117, 0x1.e241386acf35ep-171 } },
+        { { 0x1.9dd6b615d9705p+5, 0x1.d44558f943e0dp-49 }, { 0.0, 0.0 }, { 0x1.fd1a38ded2b3ap-1, -0x1.124d2b84849f3p-55, 0x1.0dc949a5852c6p-109, 0x1.5dbca7f656719p-164 } },
+        { { 0x1.52eb045adfee8p-17, 0x1.eee799b9d893fp-75 }, { 0.0, 0.0 }, { 0x1.52eb045ac72e4p-17, -0x1.7de4fd12f5adfp-73, 0x1.3c5aa0b206b8bp-127, 0x1.ea95402368cb4p-182 } },
+        { { -0x1.1dffafc9fb32ap-15, -0x1.e0426a54933c4p-71 }, { 0.0, 0.0 }, { -0x1.1dffafc90d3a7p-15, 0x1.221aa87004efep-72, -0x1.c03eebcd811fbp-126, 0x1.998a90e7d69a9p-182 } },
+        { { 0x1.06aa02ccfa89bp-4, 0x1.3e4dc80e56b8ep-58 }, { 0.0, 0.0 }, { 0x1.067bef2805bb7p-4, 0x1.3143ceae7927ap-58, -0x1.ab4db72ec5521p-113, 0x1.9930fa6c7e1b9p-167 } },
+        { { -0x1.7cdae134d6475p-19, 0x1.2d37b5b0c85fdp-73 }, { 0.0, 0.0 }, { -0x1.7cdae134d4155p-19, -0x1.2f88162d6027bp-73, -0x1.95bf640919b16p-127, 0x1.8eafa1daecec9p-181 } },
+        { { -0x1.743cb311e50f2p-17, -0x1.61c280eb555b3p-73 }, { 0.0, 0.0 }, { -0x1.743cb311c4446p-17, -0x1.4891e62f3396ep-73, 0x1.20bdcfd6e798cp-127, 0x1.263090c3ff1c6p-183 } },
+        { { 0x1.e824096564c55p-4, -0x1.57c1075e05adfp-62 }, { 0.0, 0.0 }, { 0x1.e6fc71538589cp-4, -0x1.86556fc66fd2fp-58, -0x1.1b73b9263b10dp-115, 0x1.62de3986b0c9fp-169 } },
+        { { -0x1.5f95caa311c00p+2, 0x1.f12fd31b59ad7p-52 }, { 0.0, 0.0 }, { 0x1.6b94c49f18446p-1, 0x1.9320631ef4f30p-61, 0x1.7f2076017d886p-115, 0x1.29bc7a3921223p-169 } },
+        { { 0x1.44cd1b3d2f931p-4, 0x1.9b50946a7742cp-58 }, { 0.0, 0.0 }, { 0x1.4475fe33200edp-4, -0x1.0b55bfb2e5fa0p-58, 0x1.8c65016646aa7p-114, -0x1.bdce58e1efbc0p-170 } },
+        { { 0x1.36f90891b9dcep+3, 0x1.caed79d7ce0ffp-51 }, { 0.0, 0.0 }, { -0x1.27e070f4f74d0p-2, -0x1.a845da1ae9c9ap-61, -0x1.8fa060f341dbcp-118, 0x1.b10efc8871887p-175 } },
+        { { -0x1.6a50dc37bedfap-5, -0x1.a956f986910a0p-60 }, { 0.0, 0.0 }, { -0x1.6a329fbac41f5p-5, -0x1.e98855aea747bp-60, 0x1.2a73ef22e41a8p-114, -0x1.54703cc74f7dfp-168 } },
+        { { -0x1.899635b10777ep-23, -0x1.d7af11a9e08ebp-77 }, { 0.0, 0.0 }, { -0x1.899635b107758p-23, 0x1.36ce1d47cb37fp-77, 0x1.7b4a241e08d55p-134, -0x1.18fa49b3744f0p-188 } },
+        { { 0x1.55e55684752eep-27, -0x1.542de72de438ap-81 }, { 0.0, 0.0 }, { 0x1.55e55684752eep-27, -0x1.b9d0e2372d0ddp-81, -0x1.1b63963b294b5p-137, -0x1.a921f3c064863p-191 } },
+        { { -0x1.d36ce155dce50p-22, -0x1.ba14bd771e615p-78 }, { 0.0, 0.0 }, { -0x1.d36ce155dcd4cp-22, -0x1.8d2c8600326d5p-76, 0x1.110ef9e539ae6p-132, 0x1.d6df7a01b6124p-186 } },
+        { { -0x1.4abc55b3c96f1p-2, -0x1.cd447864174dep-57 }, { 0.0, 0.0 }, { -0x1.4503e983110c2p-2, -0x1.81947acdbfffdp-56, 0x1.b9f2ddfd3cff2p-112, -0x1.4764ad9f21070p-166 } },
+        { { 0x1.c6843a77f4875p-15, 0x1.e6867c9bcda32p-69 }, { 0.0, 0.0 }, { 0x1.c6843a74395d7p-15, -0x1.25b053724f33ap-70, -0x1.e456b6e647ca9p-125, 0x1.f1f355d3793d8p-179 } },
+        { { -0x1.63862ab4eb872p-27, -0x1.db03bf1a30c86p-81 }, { 0.0, 0.0 }, { -0x1.63862ab4eb872p-27, -0x1.68bbaefd75f22p-81, 0x1.296676f838915p-135, 0x1.58fde4d796955p-190 } },
+        { { 0x1.ed9453f208521p-34, -0x1.95cea2b3b3753p-88 }, { 0.0, 0.0 }, { 0x1.ed9453f208521p-34, -0x1.95d369e8a7514p-88, 0x1.d08a8b0afade0p-143, 0x1.a02c88f38c01ep-199 } },
+        { { 0x1.8ab913f7654e4p-4, 0x1.2e14ac479b1e7p-59 }, { 0.0, 0.0 }, { 0x1.8a1cbf4d5c895p-4, -0x1.6e964ec920c72p-58, 0x1.8aab20f3d62b1p-112, 0x1.6b369c9488d6ep-167 } },
+        { { -0x1.f4318fbf19517p-30, 0x1.90b8541eea45fp-84 }, { 0.0, 0.0 }, { -0x1.f4318fbf19517p-30, 0x1.95b15f398ec79p-84, 0x1.2ed0c63978071p-138, -0x1.abf6c6cc5eed5p-192 } },
+        { { -0x1.a8806fdaefe6bp-7, -0x1.a38a267b59ec8p-64 }, { 0.0, 0.0 }, { -0x1.a87d65b475f52p-7, -0x1.35f66f031da89p-61, -0x1.d12fe18f0e4eep-115, -0x1.64145f1f700e6p-171 } },
+        { { 0x1.ecba7efb874fep-3, -0x1.2dde95cc48f2dp-58 }, { 0.0, 0.0 }, { 0x1.e7fd1f1f4f615p-3, -0x1.e991170681bf9p-59, -0x1.844d55d8367dfp-115, -0x1.1bbfdfbf8f8b4p-169 } },
+        { { 0x1.6f470f4751fefp-25, -0x1.08bc39a516e6cp-81 }, { 0.0, 0.0 }, { 0x1.6f470f4751fedp-25, -0x1.10c8be2ea0015p-82, -0x1.2ead5ad523370p-138, 0x1.48fd6beaf59f6p-194 } },
+        { { -0x1.0e71390c9d788p-28, 0x1.b1e1ba27de678p-82 }, { 0.0, 0.0 }, { -0x1.0e71390c9d788p-28, 0x1.be751c020f645p-82, 0x1.72a05e50c7512p-137, -0x1.0f62d918c0199p-191 } },
+        { { -0x1.0913caffded8dp+3, -0x1.2ab02a2fed555p-51 }, { 0.0, 0.0 }, { -0x1.d17531185f00bp-1, 0x1.883bdccc9b964p-55, -0x1.b35606a4aaf28p-109, -0x1.dec0075d3d880p-173 } },
+        { { -0x1.6d2a8d799d549p+11, -0x1.ca2334abbb231p-43 }, { 0.0, 0.0 }, { 0x1.6078c1e86e6e3p-2, 0x1.89d9df68a37afp-56, 0x1.404142a748c9bp-113, -0x1.64c28cf3073acp-168 } },
+        { { -0x1.e380bd938fba5p+12, 0x1.1a71b4b3e368cp-42 }, { 0.0, 0.0 }, { -0x1.fbf713271af5bp-1, -0x1.ff50996dcbd9ep-56, -0x1.042cbe3fcd62ap-112, 0x1.e2fcd8e8e2e6ep-166 } },
+        { { -0x1.34dd2f9db017fp-8, 0x1.69c4616c60e7bp-63 }, { 0.0, 0.0 }, { -0x1.34dce4aef7868p-8, 0x1.a60824196daa2p-65, -0x1.08c2b9592087dp-120, -0x1.e130d16f896f7p-174 } },
+        { { -0x1.70241da08fbe3p-7, -0x1.387fb9b8dda3bp-62 }, { 0.0, 0.0 }, { -0x1.70222216bb3bcp-7, 0x1.7c95b18f187b9p-62, 0x1.430fecbfdcc95p-119, -0x1.d4a75106f9405p-173 } },
+        { { 0x1.760e56125d8c9p-12, -0x1.7cba73354a89bp-66 }, { 0.0, 0.0 }, { 0x1.760e558d43e61p-12, 0x1.990f192c5d944p-66, 0x1.5f64ff7560413p-122, 0x1.ae7bffd0f3c27p-177 } },
+        { { -0x1.1cc293edf1eb8p-1, 0x1.0594a45c6ecb3p-57 }, { 0.0, 0.0 }, { -0x1.0e4e064fe137fp-1, -0x1.999dfc5614062p-55, 0x1.09db2323446efp-109, -0x1.70cb0ca8c6690p-167 } },
+        { { 0x1.31042e37c87dfp-20, -0x1.1547bc1e0edb2p-75 }, { 0.0, 0.0 }, { 0x1.31042e37c835cp-20, 0x1.8d80bd7b3489ap-75, -0x1.b7b9cafbc301ep-129, 0x1.8be21c364e690p-185 } },
+        { { -0x1.abc0a2b16205cp-20, 0x1.f56705eaaece8p-74 }, { 0.0, 0.0 }, { -0x1.abc0a2b1613ebp-20, 0x1.64b6cae9a2eb5p-75, 0x1.cf7f55fab4d3ap-129, 0x1.8abf206bde444p-183 } },
+        { { -0x1.4639e16ef887bp-12, -0x1.921948abc659fp-66 }, { 0.0, 0.0 }, { -0x1.4639e116ad97cp-12, -0x1.cdc6f54326300p-66, 0x1.8c987fad9045bp-120, 0x1.26f654dfe56aep-174 } },
+        { { 0x1.b6a9ec480c3f6p-8, 0x1.aa49725fd46edp-62 }, { 0.0, 0.0 }, { 0x1.b6a9159d91e29p-8, 0x1.17bdd957eb563p-64, 0x1.de803b22a442ap-120, 0x1.e3c2378a1063dp-174 } },
+        { { -0x1.39c279b3a68fep+8, 0x1.5f07a1dfb325ap-46 }, { 0.0, 0.0 }, { 0x1.8e62169b31243p-2, 0x1.eb396090292b1p-56, 0x1.72365069a6791p-113, -0x1.8be986dbb39e3p-167 } },
+        { { 0x1.1e63318ff98a4p-7, -0x1.399d639d31ddfp-68 }, { 0.0, 0.0 }, { 0x1.1e62429f48f36p-7, -0x1.fb50b3fc4c182p-61, -0x1.5573b86904859p-120, 0x1.49a1812031d5fp-174 } },
+        { { 0x1.7548acbd175d2p-14, -0x1.40923cd2fcc72p-72 }, { 0.0, 0.0 }, { 0x1.7548acb4d2ebcp-14, 0x1.a47b9fb26a511p-68, -0x1.c9aafb5b76648p-123, -0x1.c688fbbc562f4p-180 } },
+        { { -0x1.f80efe00147adp+12, -0x1.ea6fb15256299p-42 }, { 0.0, 0.0 }, { 0x1.ce8a7a55bb9c9p-2, -0x1.ce12e8c91913ap-58, 0x1.252914899ecdcp-112, 0x1.0c6c92ab68584p-167 } },
+        { { -0x1.b737bb47b7fb7p+0, -0x1.27578508ce512p-56 }, { 0.0, 0.0 }, { -0x1.faa273de13604p-1, 0x1.c881834e6838dp-55, 0x1.963fbcadfd5e4p-112, -0x1.de99af503d4d1p-169 } },
+        { { 0x1.8978b8ba44cd1p-16, -0x1.c6dd505096c2fp-70 }, { 0.0, 0.0 }, { 0x1.8978b8b9a9e16p-16, 0x1.828ac2f0cae40p-71, 0x1.d64e875907f9dp-126, -0x1.94eb4a4d84df9p-182 } },
+        { { 0x1.5aeb1066a5926p-11, -0x1.3ce9044036e0ap-67 }, { 0.0, 0.0 }, { 0x1.5aeb0ebdeb655p-11, 0x1.bdfc4108fa46cp-65, 0x1.045cdc7d6d598p-123, 0x1.f7f489bccdc21p-177 } },
+        { { -0x1.2f2fe1a5a2a01p-8, -0x1.ab70ade8c6683p-62 }, { 0.0, 0.0 }, { -0x1.2f2f9ac555f64p-8, 0x1.2d3134661a0e9p-66, -0x1.8a15d46002edep-121, -0x1.0e1a4c3a799cap-175 } },
+        { { 0x1.88944c994ec76p+12, 0x1.1a6dae551293bp-42 }, { 0.0, 0.0 }, { -0x1.e1b0b28126d5bp-1, 0x1.fd5269ef23ed3p-57, -0x1.76f0a34461657p-111, 0x1.4de5b4b7c6c09p-171 } },
+        { { 0x1.a6b4fccee7940p-7, 0x1.66c2c1dce1c06p-61 }, { 0.0, 0.0 }, { 0x1.a6b1fc7c628f3p-7, -0x1.aebee725a803ep-63, 0x1.68b302bb3f7a6p-117, -0x1.88bb1ec8bece7p-172 } },
+        { { -0x1.1d445c8ca2ab7p-7, 0x1.6e29a03c9810ap-63 }, { 0.0, 0.0 }, { -0x1.1d43706712770p-7, -0x1.b6abc1a98c2e6p-62, -0x1.f25f8dd8aa53fp-116, -0x1.90c7e0798f62fp-170 } },
+        { { 0x1.0e9911f48347fp-29, -0x1.33fb0cde8b4d8p-84 }, { 0.0, 0.0 }, { 0x1.0e9911f48347fp-29, -0x1.3a4785b9fc5afp-84, 0x1.8f20d4527a375p-138, -0x1.76fbb41b54732p-192 } },
+        { { 0x1.aaae9a0e82553p-19, -0x1.d6ef1be16a38ap-74 }, { 0.0, 0.0 }, { 0x1.aaae9a0e7f3efp-19, 0x1.b69d1e9fd6c86p-73, 0x1.1711064f9121dp-127, 0x1.02415630dd327p-182 } },
+        { { -0x1.2853a749b0cafp-28, 0x1.893c1ac48c4dep-82 }, { 0.0, 0.0 }, { -0x1.2853a749b0cafp-28, 0x1.99c72eda73e50p-82, -0x1.a2adbaaa159bfp-136, -0x1.9118f8e5ac835p-190 } },
+        { { 0x1.11c49355a1b7cp+14, -0x1.a337878197ae0p-40 }, { 0.0, 0.0 }, { -0x1.da5ca9a7b4b08p-2, -0x1.f587004a7d2b3p-57, -0x1.11ba616d9b4f5p-111, 0x1.46a2950896bf0p-170 } },
+        { { -0x1.9945f35b921bcp-7, 0x1.ca2be48d16ec7p-61 }, { 0.0, 0.0 }, { -0x1.994339fbef956p-7, -0x1.097cb7b9c0167p-65, 0x1.5b807e1d31fcbp-120, 0x1.a475251a0b9b6p-177 } },
+        { { -0x1.6076be0637771p-26, -0x1.69c8bc2d6da91p-80 }, { 0.0, 0.0 }, { -0x1.6076be0637771p-26, 0x1.4e8e1230217bbp-82, 0x1.16dd0979f86f4p-137, 0x1.12f1293d7fd6cp-191 } },
+        { { -0x1.27c6fefc8da0dp-13, -0x1.7077c9b268f21p-68 }, { 0.0, 0.0 }, { -0x1.27c6feec1a106p-13, 0x1.168dcfb691391p-67, 0x1.af3e8e10ff293p-122, 0x1.189984e5d15ebp-176 } },
+        { { -0x1.36b111672c10bp-25, 0x1.5666431ab331dp-82 }, { 0.0, 0.0 }, { -0x1.36b111672c10ap-25, 0x1.de43075864713p-80, 0x1.284782d3bdac8p-134, 0x1.9f6dc3cae972ap-188 } },
+    };
+
+    inline constexpr Case cos_cases[] = {
+        { { 0x1.0000000000000p+0, 0.0 }, { 0.0, 0.0 }, { 0x1.14a280fb5068cp-1, -0x1.b71edcc9344bcp-55, -0x1.c85acbb918aedp-109, -0x1.8349e2406e7ffp-163 } },
+        { { -0x1.0000000000000p+0, 0.0 }, { 0.0, 0.0 }, { 0x1.14a280fb5068cp-1, -0x1.b71edcc9344bcp-55, -0x1.c85acbb918aedp-109, -0x1.8349e2406e7ffp-163 } },
+        { { 0x1.0000000000000p-1, 0.0 }, { 0.0, 0.0 }, { 0x1.c1528065b7d50p-1, -0x1.892111312e828p-55, -0x1.499eaa6a65316p-110, 0x1.3e87d57ae46a1p-165 } },
+        { { 0x1.0000000000000p-30, 0.0 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.0000000000000p-61, 0x1.5555555555555p-125, 0x1.5527d27d27d28p-179 } },
+        { { 0x1.8000000000000p+1, 0.0 }, { 0.0, 0.0 }, { -0x1.fae04be85e5d2p-1, -0x1.83effc17efb54p-55, 0x1.f582942b6b8f2p-109, -0x1.03577e1b3231ep-163 } },
+        { { 0x1.9000000000000p+6, 0.0 }, { 0.0, 0.0 }, { 0x1.b981dbf665fdfp-1, 0x1.8fd0cdcd985e8p-55, 0x1.057627d5fae8dp-111, -0x1.a08670f073328p-165 } },
+        { { 0x1.81cd6c8b43958p+13, 0x1.0624dd2f1a9fcp-43 }, { 0.0, 0.0 }, { 0x1.6b94c3bbe279ap-1, 0x1.e55a87200beffp-58, -0x1.513587843ca70p-113, 0x1.797c43038f214p-167 } },
+        { { 0x1.f67fd56d6ca62p+15, 0x1.d61334708d912p-39 }, { 0.0, 0.0 }, { 0x1.fc802750941ffp-2, 0x1.fa563f538f55fp-56, 0x1.b3efd347dc78ap-110, -0x1.e9fe150e85580p-164 } },
+        { { -0x1.31caab0393320p-18, 0x1.2c853881951dep-72 }, { 0.0, 0.0 }, { 0x1.ffffffffe92bbp-1, 0x1.d03ca85eeeaafp-55, -0x1.ad7ef398a9e30p-110, -0x1.4223fb9735a9dp-164 } },
+        { { 0x1.4dd6ffba75715p-8, 0x1.c50cde043422ep-62 }, { 0.0, 0.0 }, { 0x1.fffe4ca733d65p-1, 0x1.6976c95e72741p-55, -0x1.5b4b20e6e91f1p-111, 0x1.614262604c25ap-167 } },
+        { { 0x1.9dd6b615d9705p+5, 0x1.d44558f943e0dp-49 }, { 0.0, 0.0 }, { 0x1.b327113fcb34ep-4, -0x1.ce2717f0e1893p-58, 0x1.da96f2e6f6ed0p-113, 0x1.eb41ec87ad5dbp-167 } },
+        { { 0x1.52eb045adfee8p-17, 0x1.eee799b9d893fp-75 }, { 0.0, 0.0 }, { 0x1.ffffffff8fd3ap-1, 0x1.0bf1a266599b2p-55, -0x1.ad3f6e4d7258cp-109, 0x1.190e59f06e5a0p-163 } },
+        { { -0x1.1dffafc9fb32ap-15, -0x1.e0426a54933c4p-71 }, { 0.0, 0.0 }, { 0x1.fffffffb01f2dp-1, -0x1.8dc2f2e264054p-56, -0x1.d878790a10e62p-110, -0x1.f660fad4a45dep-168 } },
+        { { 0x1.06aa02ccfa89bp-4, 0x1.3e4dc80e56b8ep-58 }, { 0.0, 0.0 }, { 0x1.fef297352114ep-1, 0x1.c319127c4b6c5p-55, -0x1.db135b63828bcp-112, -0x1.5c67da72ee8d1p-168 } },
+        { { -0x1.7cdae134d6475p-19, 0x1.2d37b5b0c85fdp-73 }, { 0.0, 0.0 }, { 0x1.fffffffff7259p-1, 0x1.7846d16380b57p-55, 0x1.9a2e3b7250720p-109, 0x1.83e84619c833fp-164 } },
+        { { -0x1.743cb311e50f2p-17, -0x1.61c280eb555b3p-73 }, { 0.0, 0.0 }, { 0x1.ffffffff78afep-1, 0x1.25f50fba63b67p-56, -0x1.aab654df10999p-110, -0x1.72490d437c632p-165 } },
+        { { 0x1.e824096564c55p-4, -0x1.57c1075e05adfp-62 }, { 0.0, 0.0 }, { 0x1.fc5e5079eeb9ep-1, 0x1.93c5c06df3e47p-56, -0x1.9c21cc9602db4p-110, -0x1.ea7ae2844e863p-164 } },
+        { { -0x1.5f95caa311c00p+2, 0x1.f12fd31b59ad7p-52 }, { 0.0, 0.0 }, { 0x1.687d57ab6e7f6p-1, -0x1.f1f306d0b287dp-55, 0x1.49d05646a09cfp-111, 0x1.744aeb8327641p-165 } },
+        { { 0x1.44cd1b3d2f931p-4, 0x1.9b50946a7742cp-58 }, { 0.0, 0.0 }, { 0x1.fe641f737a34cp-1, 0x1.484e5b75ddd62p-57, -0x1.c6d17a26d9499p-114, -0x1.51cfb4a0c79acp-169 } },
+        { { 0x1.36f90891b9dcep+3, 0x1.caed79d7ce0ffp-51 }, { 0.0, 0.0 }, { -0x1.ea295463978d5p-1, -0x1.d8a0a4e6ea733p-55, -0x1.93b755192fde3p-110, -0x1.9b90d6cd7cbedp-165 } },
+        { { -0x1.6a50dc37bedfap-5, -0x1.a956f986910a0p-60 }, { 0.0, 0.0 }, { 0x1.ff7fd32758207p-1, -0x1.76399f2dfdf9ap-55, -0x1.ce2566d0a9044p-110, -0x1.27f1ca9b4142dp-165 } },
+        { { -0x1.899635b10777ep-23, -0x1.d7af11a9e08ebp-77 }, { 0.0, 0.0 }, { 0x1.fffffffffff69p-1, -0x1.1e88fc7fa3cfap-55, 0x1.7776c50fa4529p-111, 0x1.af58c7df77d1fp-165 } },
+        { { 0x1.55e55684752eep-27, -0x1.542de72de438ap-81 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.c89cc5f0c665cp-55, 0x1.582f3dfa04fb5p-109, -0x1.857b03cf9b690p-163 } },
+        { { -0x1.d36ce155dce50p-22, -0x1.ba14bd771e615p-78 }, { 0.0, 0.0 }, { 0x1.ffffffffffcabp-1, -0x1.d9b1b8aa9c7b8p-55, 0x1.0834a8cdbb40ep-110, -0x1.3fa1139468cedp-165 } },
+        { { -0x1.4abc55b3c96f1p-2, -0x1.cd447864174dep-57 }, { 0.0, 0.0 }, { 0x1.e586986930607p-1, 0x1.9943a2d2b762fp-55, -0x1.fead481681e4dp-111, -0x1.ef791264573e7p-165 } },
+        { { 0x1.c6843a77f4875p-15, 0x1.e6867c9bcda32p-69 }, { 0.0, 0.0 }, { 0x1.fffffff3641afp-1, 0x1.55fe383bf613cp-57, 0x1.96188baedf4efp-111, -0x1.b4ece73df5a94p-165 } },
+        { { -0x1.63862ab4eb872p-27, -0x1.db03bf1a30c86p-81 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.edbd60c281bf4p-55, -0x1.2e7cae71eb24dp-109, 0x1.89d0f2405c4c4p-163 } },
+        { { 0x1.ed9453f208521p-34, -0x1.95cea2b3b3753p-88 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.dbd250a1afb63p-68, -0x1.c901dbfa32af8p-122, -0x1.d5749dd5418bep-177 } },
+        { { 0x1.8ab913f7654e4p-4, 0x1.2e14ac479b1e7p-59 }, { 0.0, 0.0 }, { 0x1.fd9fda532cd9bp-1, 0x1.6cba3b4622c10p-58, -0x1.57e5618e95b76p-114, -0x1.2f483cb2320c6p-168 } },
+        { { -0x1.f4318fbf19517p-30, 0x1.90b8541eea45fp-84 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.e8a8d18d69626p-60, -0x1.88c4d090989d0p-116, -0x1.ea94603df3e8ap-170 } },
+        { { -0x1.a8806fdaefe6bp-7, -0x1.a38a267b59ec8p-64 }, { 0.0, 0.0 }, { 0x1.fff5006348d90p-1, 0x1.8cae7737e09bdp-57, 0x1.3f24bec9e35b8p-112, -0x1.33ed7a6a133f1p-166 } },
+        { { 0x1.ecba7efb874fep-3, -0x1.2dde95cc48f2dp-58 }, { 0.0, 0.0 }, { 0x1.f140cdd30c7e8p-1, -0x1.85b84a1228a75p-55, 0x1.dd6cbca7b45d7p-114, -0x1.7a5937ed3e9ffp-169 } },
+        { { 0x1.6f470f4751fefp-25, -0x1.08bc39a516e6cp-81 }, { 0.0, 0.0 }, { 0x1.ffffffffffff8p-1, -0x1.dd9a30fef238bp-56, 0x1.8d20840bcd6bap-112, -0x1.0066e9366345fp-166 } },
+        { { -0x1.0e71390c9d788p-28, 0x1.b1e1ba27de678p-82 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.1db3066a0603cp-57, -0x1.592db4cbab60fp-112, -0x1.e6f3cd9fc644cp-167 } },
+        { { -0x1.0913caffded8dp+3, -0x1.2ab02a2fed555p-51 }, { 0.0, 0.0 }, { -0x1.aa94ff2e51f81p-2, 0x1.9cc074d0675a2p-58, -0x1.d8f99f35c27b5p-112, 0x1.e411487287bf8p-167 } },
+        { { -0x1.6d2a8d799d549p+11, -0x1.ca2334abbb231p-43 }, { 0.0, 0.0 }, { 0x1.e0b682c12ec73p-1, 0x1.565ab8d585835p-56, 0x1.a72901ae839c7p-114, -0x1.182ff008bb399p-170 } },
+        { { -0x1.e380bd938fba5p+12, 0x1.1a71b4b3e368cp-42 }, { 0.0, 0.0 }, { 0x1.009b2e6089e89p-3, -0x1.9adb2876d4b68p-58, 0x1.771fb34c8d890p-112, -0x1.1086cdc6a684cp-167 } },
+        { { -0x1.34dd2f9db017fp-8, 0x1.69c4616c60e7bp-63 }, { 0.0, 0.0 }, { 0x1.fffe8b5b33855p-1, -0x1.da002f8d3922dp-56, 0x1.2062469ada750p-111, -0x1.ca7fb29e4b805p-166 } },
+        { { -0x1.70241da08fbe3p-7, -0x1.387fb9b8dda3bp-62 }, { 0.0, 0.0 }, { 0x1.fff7ba664aa47p-1, -0x1.bbf877764714bp-55, 0x1.b4ce63d5d485bp-110, 0x1.10d7b4d3ab0c7p-164 } },
+        { { 0x1.760e56125d8c9p-12, -0x1.7cba73354a89bp-66 }, { 0.0, 0.0 }, { 0x1.fffffddd721c1p-1, 0x1.834b5daada8afp-55, -0x1.3eb11fda61a14p-109, -0x1.350b7a0c4b255p-163 } },
+        { { -0x1.1cc293edf1eb8p-1, 0x1.0594a45c6ecb3p-57 }, { 0.0, 0.0 }, { 0x1.b2d52049698b7p-1, 0x1.9a42b5861007bp-57, 0x1.c690155a921a5p-111, 0x1.d2b845b8e85e3p-165 } },
+        { { 0x1.31042e37c87dfp-20, -0x1.1547bc1e0edb2p-75 }, { 0.0, 0.0 }, { 0x1.fffffffffe949p-1, 0x1.42736696244bfp-55, 0x1.ee6ac407c7adep-109, 0x1.a5e146e638bc1p-165 } },
+        { { -0x1.abc0a2b16205cp-20, 0x1.f56705eaaece8p-74 }, { 0.0, 0.0 }, { 0x1.fffffffffd354p-1, 0x1.e827e917994e1p-56, -0x1.54f0d911cf6ddp-111, -0x1.e4e525dc668d6p-166 } },
+        { { -0x1.4639e16ef887bp-12, -0x1.921948abc659fp-66 }, { 0.0, 0.0 }, { 0x1.fffffe6048890p-1, -0x1.224da4c8d55f7p-55, -0x1.14becda0ae98bp-110, 0x1.0ff8f479c32f2p-165 } },
+        { { 0x1.b6a9ec480c3f6p-8, 0x1.aa49725fd46edp-62 }, { 0.0, 0.0 }, { 0x1.fffd1056d29acp-1, 0x1.72d132dd66404p-56, 0x1.5d49f43da1281p-110, -0x1.18aeb036e02b1p-166 } },
+        { { -0x1.39c279b3a68fep+8, 0x1.5f07a1dfb325ap-46 }, { 0.0, 0.0 }, { 0x1.d7a9ed0aa7b04p-1, 0x1.1c478e07df8fdp-59, 0x1.4792252a978f6p-114, 0x1.2ecd4da3df5dbp-168 } },
+        { { 0x1.1e63318ff98a4p-7, -0x1.399d639d31ddfp-68 }, { 0.0, 0.0 }, { 0x1.fffafe7af1e6ep-1, -0x1.c130f7850fd95p-60, -0x1.2acb6f5605419p-114, 0x1.bf3419f5cc535p-169 } },
+        { { 0x1.7548acbd175d2p-14, -0x1.40923cd2fcc72p-72 }, { 0.0, 0.0 }, { 0x1.ffffffddfb324p-1, 0x1.5881f5e8c2fd2p-59, 0x1.977aca1918181p-115, 0x1.8df279d107243p-170 } },
+        { { -0x1.f80efe00147adp+12, -0x1.ea6fb15256299p-42 }, { 0.0, 0.0 }, { -0x1.c8ca7bb6c6ab4p-1, 0x1.68565ad321389p-56, -0x1.abde159c08853p-110, 0x1.1e66732b1efe4p-164 } },
+        { { -0x1.b737bb47b7fb7p+0, -0x1.27578508ce512p-56 }, { 0.0, 0.0 }, { -0x1.27b6a2ff1c922p-3, 0x1.87652167e8d19p-57, -0x1.49c6ae7877b56p-111, -0x1.1641563beb91cp-165 } },
+        { { 0x1.8978b8ba44cd1p-16, -0x1.c6dd505096c2fp-70 }, { 0.0, 0.0 }, { 0x1.fffffffda33c2p-1, -0x1.9241be802dae4p-61, -0x1.82aa6ba495972p-116, 0x1.d9e7ee12e0d55p-172 } },
+        { { 0x1.5aeb1066a5926p-11, -0x1.3ce9044036e0ap-67 }, { 0.0, 0.0 }, { 0x1.fffff8a77f03dp-1, -0x1.988201323ab01p-56, -0x1.88593085c8396p-110, -0x1.0af491e03066ep-164 } },
+        { { -0x1.2f2fe1a5a2a01p-8, -0x1.ab70ade8c6683p-62 }, { 0.0, 0.0 }, { 0x1.fffe98edc8ddap-1, 0x1.9ffe13b3c6988p-55, 0x1.528bd67c60695p-109, -0x1.0774d9646b5cep-163 } },
+        { { 0x1.88944c994ec76p+12, 0x1.1a6dae551293bp-42 }, { 0.0, 0.0 }, { -0x1.5b1803f7f7b3ap-2, 0x1.a4298a0f30dfep-57, 0x1.96ce0cb8f540bp-111, -0x1.88e110bbf77cep-165 } },
+        { { 0x1.a6b4fccee7940p-7, 0x1.66c2c1dce1c06p-61 }, { 0.0, 0.0 }, { 0x1.fff518252395cp-1, -0x1.910f29487a3e3p-56, 0x1.22d9d88baf6c0p-113, 0x1.03d6505624514p-167 } },
+        { { -0x1.1d445c8ca2ab7p-7, 0x1.6e29a03c9810ap-63 }, { 0.0, 0.0 }, { 0x1.fffb087ced003p-1, 0x1.f16ed5da80ffbp-56, -0x1.1b77dd8e94cedp-111, 0x1.d51407ad8cb5bp-165 } },
+        { { 0x1.0e9911f48347fp-29, -0x1.33fb0cde8b4d8p-84 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.1e073d663c731p-59, 0x1.f97874117861ap-113, 0x1.bae856da43092p-168 } },
+        { { 0x1.aaae9a0e82553p-19, -0x1.d6ef1be16a38ap-74 }, { 0.0, 0.0 }, { 0x1.fffffffff4e36p-1, -0x1.8fce0f9f90f41p-55, -0x1.baf4056336248p-111, -0x1.b6c9e49aacccdp-166 } },
+        { { -0x1.2853a749b0cafp-28, 0x1.893c1ac48c4dep-82 }, { 0.0, 0.0 }, { 0x1.0000000000000p+0, -0x1.57018e304fef2p-57, 0x1.7a425b3c205cep-111, -0x1.e7540ccb1a4fcp-165 } },
+        { { 0x1.11c49355a1b7cp+14, -0x1.a337878197ae0p-40 }, { 0.0, 0.0 }, { -0x1.c5c0089e4ba77p-1, -0x1.5e5f6016afecdp-55, 0x1.a8a6cc4321ee2p-112, 0x1.0d31c466eec8dp-166 } },
+        { { -0x1.9945f35b921bcp-7, 0x1.ca2be48d16ec7p-61 }, { 0.0, 0.0 }, { 0x1.fff5c6c65af37p-1, -0x1.90f21c8ab328ap-57, -0x1.d3a53a53ef81bp-111, 0x1.b9c87ec3fefe5p-165 } },
+        { { -0x1.6076be0637771p-26, -0x1.69c8bc2d6da91p-80 }, { 0.0, 0.0 }, { 0x1.ffffffffffffep-1, 0x1.ab93e5b2cb02dp-57, -0x1.1e4027007d51fp-115, -0x1.334b338df157ep-169 } },
+        { { -0x1.27c6fefc8da0dp-13, -0x1.7077c9b268f21p-68 }, { 0.0, 0.0 }, { 0x1.ffffffaa90f17p-1, -0x1.ff4267bd51e77p-56, 0x1.8322b43e59ffcp-110, 0x1.b20e710af1945p-164 } },
+        { { -0x1.36b111672c10bp-25, 0x1.5666431ab331dp-82 }, { 0.0, 0.0 }, { 0x1.ffffffffffffap-1, 0x1.bbabd843db75ap-57, -0x1.0726175c32efdp-111, -0x1.c21567ca33aebp-165 } },
+    };
+
+    inline constexpr Case atan2_cases[] = {
+        { { 0x1.0000000000000p+0, 0.0 }, { 0x1.0000000000000p+0, 0.0 }, { 0x1.921fb54442d18p-1, 0x1.1a62633145c07p-55, -0x1.f1976b7ed8fbcp-111, 0x1.4cf98e804177dp-165 } },
+        { { 0x1.0000000000000p+0, 0.0 }, { -0x1.0000000000000p+0, 0.0 }, { 0x1.2d97c7f3321d2p+1, 0x1.a79394c9e8a0ap-54, 0x1.456737b06ea1ap-108, -0x1.83226a8fe7731p-162 } },
+        { { -0x1.0000000000000p+0, 0.0 }, { -0x1.0000000000000p+0, 0.0 }, { -0x1.2d97c7f3321d2p+1, -0x1.a79394c9e8a0ap-54, -0x1.456737b06ea1ap-108, 0x1.83226a8fe7731p-162 } },
+        { { 0x1.0000000000000p+0, 0.0 }, { 0x1.79ca10c924223p-67, 0x1.75447a5d8e536p-121 }, { 0x1.921fb54442d18p+0, 0x1.1a5694e0bf775p-54, -0x1.81a30a071256cp-109, -0x1.4e06717fb5f63p-164 } },
+        { { 0x1.79ca10c924223p-67, 0x1.75447a5d8e536p-121 }, { 0x1.0000000000000p+0, 0.0 }, { 0x1.79ca10c924223p-67, 0x1.75447a5d8e536p-121, -0x1.124031c73196fp-201, 0x1.86859e07f378ap-256 } },
+        { { -0x1.7fd0ceae7cb09p+22, -0x1.268047f465dd8p-32 }, { 0x1.513a3e1ec10f1p+11, -0x1.9c359383382b8p-43 }, { -0x1.9203979ff5521p+0, 0x1.4bd93ff60abe9p-54, 0x1.7b6d60d3013aep-112, 0x1.03ed13b0ad8c1p-166 } },
+        { { 0x1.748e45e7b8c70p-6, -0x1.1beea55936523p-62 }, { 0x1.69c6772825157p+18, -0x1.9513776e571dbp-37 }, { 0x1.07a0e64b805aap-24, 0x1.38b9f64feb06ep-79, -0x1.07603860933eap-134, 0x1.0dcacaab5fd16p-190 } },
+        { { -0x1.66182902ec4bbp+23, -0x1.16b6106f02b4bp-31 }, { -0x1.40b174a54a2afp+19, 0x1.bf77aeff49542p-36 }, { -0x1.a07013ddcadddp+0, 0x1.4fcf535ceb80ap-56, -0x1.1fffef61a552bp-110, -0x1.757b81314a7c1p-165 } },
+        { { -0x1.5bb8d2b83119bp-29, 0x1.b7f53a7100f94p-86 }, { 0x1.90e4b58c850bdp-28, -0x1.a68ff64b82e3bp-85 }, { -0x1.a306142f002b6p-2, 0x1.b844650fdd782p-59, -0x1.f7d5abfb31676p-113, -0x1.bc3ad4e89c5b8p-170 } },
+        { { 0x1.083726888f8e7p-3, 0x1.e6125a1309daap-59 }, { 0x1.dd90068195fc7p-27, 0x1.f031970ec8880p-83 }, { 0x1.921fb3758c2f0p+0, -0x1.7f384979f4448p-54, 0x1.4f0872058ed45p-108, 0x1.321ff06c7e7acp-163 } },
+        { { 0x1.690bd313d014ap-29, 0x1.5c3c38c5ba3c6p-84 }, { 0x1.1fe589264e50cp-18, 0x1.15fa89eb7a5c7p-73 }, { 0x1.410b8e86af52cp-11, 0x1.f4c763772cbd8p-65, -0x1.e70fc4c63fb15p-121, -0x1.da3211f944703p-176 } },
+        { { 0x1.2195ef961426ep+16, -0x1.2faa233463da1p-41 }, { 0x1.c41d2e7a97b21p-17, 0x1.25a42e9f66136p-74 }, { 0x1.921fb5437afabp+0, -0x1.69147114e75c8p-54, 0x1.7ad76fa7d46a4p-109, -0x1.29a9ac0cab37ep-164 } },
+        { { 0x1.f5b0327b4cb9cp-4, -0x1.73206344d31cep-61 }, { 0x1.c97c675797daap-7, 0x1.216d09623de9bp-61 }, { 0x1.751195d48eff8p+0, -0x1.acccc74055843p-56, -0x1.7c8931f3b8595p-110, -0x1.0b1f5cfb6c66ap-164 } },
+        { { 0x1.1478df3ce3c16p+28, 0x1.4d7409fc68dc5p-30 }, { 0x1.e510a197aa507p-26, 0x1.ef6866decb9f9p-80 }, { 0x1.921fb54442d18p+0, -0x1.4d86793990872p-55, -0x1.1ba8c59a67712p-109, 0x1.544d1b71147fep-163 } },
+        { { 0x1.eec855e8b79b6p+13, 0x1.9c03f457b00bcp-41 }, { -0x1.66a415f7e9b64p+16, -0x1.05162767dfd03p-40 }, { 0x1.7c43e3503eb95p+1, 0x1.2d38af8ad712fp-53, -0x1.dcbb6b32d65b6p-108, 0x1.230b9bdb70251p-163 } },
+        { { -0x1.42c060b7685bep-1, 0x1.8f0cd176242b3p-57 }, { -0x1.9b10b2811071ep-26, 0x1.323b974104110p-86 }, { -0x1.921fb5e7490d2p+0, -0x1.2fcae6131d7aap-55, 0x1.3c35b94b831f3p-109, 0x1.3b827fbae66e8p-165 } },
+        { { 0x1.0202d08a14622p-13, -0x1.99893bcb9789bp-67 }, { -0x1.e6a8a4b382691p-30, 0x1.8ca20d7be1ed6p-84 }, { 0x1.9220a6b31006cp+0, -0x1.c22f8dab7d6d1p-54, -0x1.9cfb9ee36425dp-110, 0x1.97b14a72764d8p-166 } },
+        { { 0x1.097a42e1bc6fap+33, -0x1.b7f917b983efap-23 }, { 0x1.e9a4d75a28f57p+14, 0x1.2a625b8a8c956p-44 }, { 0x1.921f7a3f06eb5p+0, -0x1.d43bb8d71bd64p-54, 0x1.5cfaad86725e9p-108, -0x1.e8e1477bcf1c0p-166 } },
+        { { 0x1.ae3214d07ee17p+20, -0x1.07544e351609bp-34 }, { -0x1.079f53210d17ap+33, 0x1.f9292496dd2f9p-21 }, { 0x1.92192e3d1f15dp+1, -0x1.dbe18243ba2c4p-53, -0x1.09c74af2ca8ebp-109, 0x1.f29e855746866p-163 } },
+        { { -0x1.d52d79405835bp+1, 0x1.3dc5174a5e0c9p-53 }, { -0x1.0b038fd837466p+0, -0x1.d7b04288886c9p-55 }, { -0x1.d9181b65fcc96p+0, -0x1.576b36a291212p-55, -0x1.e73096ce03159p-110, -0x1.80d3809fed47fp-166 } },
+        { { -0x1.1d440b4600c91p+8, -0x1.5584a8c4a03d7p-49 }, { -0x1.229743fa491acp-17, -0x1.4cecae553ec1dp-71 }, { -0x1.921fb5c6a6807p+0, -0x1.e63cabe8fc745p-54, -0x1.fee0e6ed9d3d8p-111, -0x1.5164f797084b4p-165 } },
+        { { -0x1.10f9ce24154aep-7, 0x1.b30e7af622bc4p-61 }, { -0x1.182e649388764p-7, 0x1.9e81cb858505ap-65 }, { -0x1.2f4297bbd8c77p+1, -0x1.f64094d59307ep-56, 0x1.8217a8d1bb5bep-115, -0x1.3655882b0148ep-169 } },
+        { { -0x1.2181c10de2c00p-33, -0x1.67b92fa5cc58ep-88 }, { 0x1.6a13c356d4f04p-6, -0x1.998ab52d2819cp-60 }, { -0x1.99618601e5d60p-28, 0x1.7cb3c9fc720dap-82, 0x1.af57dd9f5f47fp-136, 0x1.24c7abd4f00e3p-190 } },
+        { { 0x1.da38e0f61ec43p+15, 0x1.09766e44725a7p-39 }, { -0x1.4dfee77ba0eb3p+32, 0x1.41596e3a1e585p-22 }, { 0x1.921f5a6584e0dp+1, -0x1.d134eca735464p-54, -0x1.fe495c6c870e8p-108, 0x1.d7e5a85052d39p-163 } },
+        { { -0x1.63f25a5df8f36p-33, 0x1.ab792ba42f98bp-87 }, { -0x1.4c4f2eda1fdd5p+10, -0x1.5a2ac23d2893bp-44 }, { -0x1.921fb54442c06p+1, -0x1.0fa08c90f3999p-55, 0x1.6380d54844fdbp-111, -0x1.59fbbe3d2d4ffp-165 } },
+        { { -0x1.52d93bd5ea463p-26, 0x1.7614ca9ccc496p-80 }, { 0x1.3a8c87265f261p+27, 0x1.0009c527a623ap-27 }, { -0x1.13c6ceb17db7bp-53, -0x1.b6ce44902d82dp-107, -0x1.0dc76dd32bcbep-162, 0x1.e77ba89b2a45cp-217 } },
+        { { -0x1.4193ae9b041a8p-9, -0x1.6ba010cb5ab39p-63 }, { 0x1.2a69a2c47db47p+20, -0x1.a46103f70dd83p-35 }, { -0x1.13df3940e2b2ep-29, 0x1.4c90eb61bb95bp-86, 0x1.7d409a6fc06cdp-140, 0x1.0eef9df8fb5b1p-194 } },
+        { { 0x1.23a8904ae1220p+12, -0x1.33804c8d1e6c9p-44 }, { -0x1.741a3b440530ap+5, 0x1.4274d8a7d7a80p-49 }, { 0x1.94ace775de56cp+0, -0x1.fe6c56da36814p-54, 0x1.424366602a999p-110, -0x1.8a2876ff03f3dp-164 } },
+        { { 0x1.7eb8d717449dbp-13, -0x1.bd9af15d99429p-70 }, { -0x1.08bf0e1582211p-19, -0x1.e2fdf90bcb03ap-74 }, { 0x1.94e4072ec335bp+0, -0x1.e770b2cbc234ep-55, -0x1.c47703fe215c8p-109, 0x1.b708ae6ad3269p-163 } },
+        { { -0x1.39579a0d6b0a7p-2, 0x1.452c423539934p-57 }, { 0x1.82e46a863b8eep+16, 0x1.aedb52963fc03p-38 }, { -0x1.9eaa96f6e7b08p-19, -0x1.ccfe5f5d23608p-75, -0x1.6f45964a1bf45p-130, 0x1.f236739110b3ep-184 } },
+        { { 0x1.778064907452ep-19, 0x1.d1f0df9f1f68fp-74 }, { -0x1.8189e0bd8d08ap-23, 0x1.2cd9c518798edp-77 }, { 0x1.a2876f4790e0ep+0, 0x1.abedd89d653a9p-54, -0x1.652b5808461f7p-108, 0x1.ecda5e70efaebp-162 } },
+        { { -0x1.304fa8e4c3d8bp+15, 0x1.0fe4e9793f534p-41 }, { -0x1.bf9be74fa1a8ep+32, 0x1.49838d3ff2979p-22 }, { -0x1.921f89c171f34p+1, 0x1.871a09b7ed63bp-53, 0x1.43978495d6fe4p-109, -0x1.d6e85363cd291p-163 } },
+        { { -0x1.283be57c5774dp+29, 0x1.838f09bebb65fp-26 }, { 0x1.150422827db02p-27, 0x1.1af60879bd58bp-81 }, { -0x1.921fb54442d18p+0, -0x1.bd128f22957aap-55, 0x1.97c30405d0853p-111, -0x1.66194f9bb6196p-166 } },
+        { { -0x1.2476accfc9932p+25, -0x1.6326ddfe34c0cp-29 }, { -0x1.bb5519fefa196p-2, -0x1.1b74d649b1a84p-56 }, { -0x1.921fb574c4b44p+0, -0x1.0a73d0147f1f2p-54, 0x1.5ac5afa6ac902p-109, -0x1.d8c5b9c27fd8cp-163 } },
+        { { -0x1.a001413b6456bp-7, 0x1.afb05f5f6a203p-62 }, { 0x1.906e7fa958687p+23, 0x1.86130066e4bf7p-31 }, { -0x1.09f4c608eb68cp-30, -0x1.1264c22dd4e75p-84, 0x1.16a764e58f15ap-140, 0x1.99d8be31d468bp-196 } },
+        { { -0x1.9f420af7b4548p+18, -0x1.46b50ec0710bap-37 }, { -0x1.2dda6fdd9bf74p+15, -0x1.15da49584291fp-42 }, { -0x1.a95235c111de9p+0, 0x1.8bcdd718cbf17p-55, 0x1.3274851c57a11p-110, 0x1.ccc588ba7301cp-166 } },
+        { { -0x1.06f04fba535c9p+6, -0x1.67ca20c490c00p-49 }, { 0x1.1e30fa0010eb5p+20, 0x1.d29f1c0e0ec9ap-34 }, { -0x1.d6669aadb8e5cp-15, -0x1.410fce277a353p-69, -0x1.7dbe84a2d7208p-123, 0x1.e5e8a33c0bd45p-177 } },
+        { { -0x1.36fc0289d354ap-33, 0x1.39cdb8b80c31ep-88 }, { 0x1.6180047a2f8a5p+11, -0x1.9c36f04de0952p-43 }, { -0x1.c26be5596cfffp-45, -0x1.05b26723f4f71p-104, 0x1.72f652ffd63ddp-158, 0x1.b64a84a2603cbp-212 } },
+        { { -0x1.249083c566ef1p-30, 0x1.14fe7d2068886p-84 }, { 0x1.83ac6faf6c68bp+23, -0x1.341ea081c4f6ap-31 }, { -0x1.8263bb2e528b4p-54, -0x1.4643bdbb90df9p-108, 0x1.e40a264138946p-166, -0x1.4b5e8e1c81d8cp-221 } },
+        { { 0x1.37aca3dabf4cap-10, -0x1.9c6ac774f124ep-64 }, { 0x1.0818adf764664p+5, -0x1.2322e568a9e64p-49 }, { 0x1.2e1e8f32dc1ffp-15, 0x1.37d880a5ae7c8p-69, -0x1.269862835aaaep-124, 0x1.ec1a088dc4496p-178 } },
+        { { 0x1.2a8c675ba6a66p-18, 0x1.2108ee037ff28p-74 }, { -0x1.d69b3ddb055bbp+1, 0x1.7846803377826p-54 }, { 0x1.921fab1dcbafep+1, 0x1.2ec9da715ba93p-54, 0x1.8ea511086d6b3p-108, 0x1.e38645d20c182p-162 } },
+        { { 0x1.3ba0bff1fd48ap+3, 0x1.0dbc97e3fab85p-52 }, { 0x1.499d6c15d0f53p+17, 0x1.76d5ac56fef4dp-38 }, { 0x1.ea460acef2df8p-15, -0x1.026977fd26031p-70, -0x1.1db2da23b943ep-125, 0x1.7bf2bddb8da8bp-180 } },
+        { { -0x1.1fc17c1b59671p-21, -0x1.c7b290b483c5dp-76 }, { 0x1.4d119be7e1e9cp+18, -0x1.dd9d7a4c08ff7p-37 }, { -0x1.ba580e967b216p-40, -0x1.0a5649fd4c6b5p-94, -0x1.3928ffb2a7939p-149, -0x1.7f8b4d161b87ap-204 } },
+        { { -0x1.ead648a182171p+19, 0x1.f8e1565369640p-35 }, { -0x1.f83846e1ba5abp+27, -0x1.7c15b252fb19fp-27 }, { -0x1.91a31b2271837p+1, -0x1.8e24fcc8b68b1p-53, 0x1.f1de92fe65446p-108, 0x1.aef87b4012f62p-165 } },
+        { { -0x1.25f8fda6bc304p-18, 0x1.dc91beaa3dd9fp-72 }, { 0x1.2814ce48bd9c8p+33, -0x1.6c4cd9f2bec57p-23 }, { -0x1.fc5a85b564deap-52, 0x1.2aa6313525b9fp-107, 0x1.2e7a424b6964bp-163, -0x1.0391e79d6d1efp-220 } },
+        { { 0x1.178b7fa0409acp-17, 0x1.d625778589ed0p-71 }, { -0x1.428a846d1e4a9p-22, -0x1.1dc321b47e13bp-77 }, { 0x1.9b59aedd6704dp+0, 0x1.b49a571492033p-55, 0x1.419a3fb397218p-109, 0x1.304f5e6a5f054p-164 } },
+        { { -0x1.2c9d2f54ae083p+13, -0x1.cf7718c7de6dap-44 }, { -0x1.a562b3233de74p-18, 0x1.6ad56ba2fd979p-72 }, { -0x1.921fb5471083ap+0, -0x1.49a03a4f58037p-55, 0x1.f2d2e078eec8ep-111, 0x1.4a2a1600e47fbp-168 } },
+        { { -0x1.0660bd266198cp-15, -0x1.684038058bf0fp-70 }, { 0x1.6db93da6ce791p+17, 0x1.a0d6fc7600050p-37 }, { -0x1.6f51d71baf111p-33, -0x1.08a6e1d146992p-90, 0x1.b4778b7de9168p-144, -0x1.20577eaabc661p-199 } },
+        { { 0x1.6f5630561cf7cp-19, 0x1.12654f6cfd92ap-73 }, { -0x1.e97911c1b4265p+18, -0x1.be0a2cb413218p-37 }, { 0x1.921fb5443fd11p+1, -0x1.f4f8671b2180fp-53, -0x1.9b635431caeccp-108, -0x1.9f83a88de9a22p-165 } },
+        { { 0x1.c9c8ef9088759p-23, 0x1.4829b3e4dab6ap-77 }, { 0x1.49648740c2c67p+3, -0x1.d31fd5288edeep-51 }, { 0x1.63c8ed682386ep-26, 0x1.c499a44675588p-81, -0x1.c7736ceff8f43p-135, -0x1.a4b9d221c33c7p-191 } },
+        { { 0x1.41cbff89116a3p+28, 0x1.fb7b63f88a8d5p-27 }, { 0x1.90239439ecb76p+1, 0x1.315cfeb362d79p-54 }, { 0x1.921fb51c78758p+0, 0x1.d0f82c8e2fc4ep-54, -0x1.ee6963b0f1dc3p-109, -0x1.063b0155bea3ep-163 } },
+        { { 0x1.30724c0d24c0ep-24, -0x1.08c920b824978p-78 }, { -0x1.3778e18d03fe2p+13, -0x1.9c740093faa95p-41 }, { 0x1.921fb5443ee8ap+1, -0x1.4518a74197526p-54, 0x1.9f0c39ba32ccdp-109, -0x1.c27c08c7fd05ep-163 } },
+        { { -0x1.620e909e78bffp+14, 0x1.2a77cfd5ac492p-42 }, { 0x1.4a9bf92691058p-20, -0x1.2090e347ebaf9p-74 }, { -0x1.921fb544070e9p+0, 0x1.5db968eae7d62p-56, 0x1.0c3be8b98ed65p-111, 0x1.1c6ef25eb22c9p-169 } },
+        { { 0x1.774d21446d0bcp+24, 0x1.5a0017978544dp-30 }, { -0x1.2e6395936df89p+0, 0x1.c8da34f573fdep-54 }, { 0x1.921fb61286b3cp+0, -0x1.d6e71b41025ffp-54, -0x1.86e2f01d88a87p-108, -0x1.993b359eee657p-162 } },
+        { { 0x1.8159b09d2098dp+27, 0x1.a1952ab18a375p-29 }, { -0x1.3b626f8d48374p+14, -0x1.f4fdbc1a3b284p-41 }, { 0x1.9226416c51280p+0, 0x1.ead8584fa59f5p-54, 0x1.df99585eb90d0p-108, 0x1.ccf9c169fd15fp-163 } },
+        { { 0x1.6749b5b6127c6p-9, -0x1.069e313bef169p-66 }, { -0x1.1963f473879cap+31, 0x1.11fa8f685e15fp-23 }, { 0x1.921fb544422e1p+1, 0x1.4e964d8b476bbp-53, -0x1.05b5e2de9d230p-109, 0x1.1546406ad9389p-163 } },
+        { { 0x1.70e53f624ac50p-32, 0x1.97885159341e5p-86 }, { -0x1.023c8252bfc3ap+15, 0x1.3ced7a8ba7b2ep-46 }, { 0x1.921fb54442d01p+1, 0x1.ad884cbcd9f5cp-53, 0x1.8f00a1e567a39p-110, 0x1.d0de12982c960p-164 } },
+        { { -0x1.acb8128735edep+32, -0x1.6bbc990e5e3e4p-23 }, { 0x1.a6b55ea267ea8p+30, 0x1.4f624bce80ff2p-26 }, { -0x1.5441271b0fe56p+0, 0x1.20c2c693dd59dp-54, 0x1.992801afbcf9fp-108, 0x1.52c64392921fep-163 } },
+        { { 0x1.8e07a5b52adcap-24, -0x1.f32a724b84decp-79 }, { -0x1.8c52932aaf7c6p-23, -0x1.44bd206253605p-77 }, { 0x1.568e7cccea1cfp+1, -0x1.f905dcb48ac7ep-53, -0x1.16106727629dap-107, -0x1.211df5f982a86p-162 } },
+        { { -0x1.092ed60d22d1bp-24, -0x1.edf353002ce2ep-80 }, { 0x1.619dc33c3fe3cp+4, -0x1.1c24899d39d09p-50 }, { -0x1.7ff5294922201p-29, 0x1.4fd542d5e0391p-83, -0x1.99a9445106901p-137, 0x1.4aa59e1d7603ep-193 } },
+        { { -0x1.4f1a03dd8cd88p-12, -0x1.b43896168408dp-66 }, { 0x1.aab9e073c0ed2p+19, -0x1.cf79bfa392936p-35 }, { -0x1.9210e28f814bep-32, 0x1.0c8aea5b927ddp-86, 0x1.86e42f1b70ebep-140, 0x1.b734fb771fc3ap-196 } },
+        { { 0x1.00f6efe48cdb9p+4, -0x1.20cd399a11e03p-52 }, { -0x1.50ffb8b8ab29ap-5, -0x1.9b1fea79a3ebap-60 }, { 0x1.92c7931bfd58fp+0, 0x1.6ea5a017561cfp-54, 0x1.02f8431d4306ep-108, 0x1.b603b9c1bb806p-163 } },
+        { { -0x1.548cad628760ep-6, -0x1.095eddc037acep-60 }, { 0x1.4b5d1deb1acecp+15, 0x1.870b46dd08590p-39 }, { -0x1.0718bbaba4447p-21, -0x1.a9da90ac26883p-76, -0x1.08b49da710a1ap-130, 0x1.1b86d359d6f39p-185 } },
+        { { -0x1.b5203ea78d944p-20, 0x1.51f8716b832e8p-74 }, { -0x1.bc3c6ffd8a4aap+4, 0x1.3e8322b86dc63p-50 }, { -0x1.921fb4c64f47ap+1, -0x1.2bd551d13fd0fp-55, 0x1.37442b144b023p-110, -0x1.0388300b237f2p-164 } },
+    };
+
+    inline constexpr Case pow_cases[] = {
+        { { 0x1.0000000000000p+1, 0.0 }, { 0x1.0000000000000p-1, 0.0 }, { 0x1.6a09e667f3bcdp+0, -0x1.bdd3413b26456p-54, 0x1.57d3e3adec175p-108, 0x1.2775099da2f59p-164 } },
+        { { 0x1.4000000000000p+3, 0.0 }, { -0x1.c000000000000p+2, 0.0 }, { 0x1.ad7f29abcaf48p-24, 0x1.5e1e99483b023p-78, 0x1.23699194119a6p-132, -0x1.e463c24737ccfp-187 } },
+        { { 0x1.0000000000000p-1, 0.0 }, { 0x1.9000000000000p+6, 0.0 }, { 0x1.0000000000000p-100, 0.0, 0.0, 0.0 } },
+        { { -0x1.8000000000000p+1, 0.0 }, { 0x1.4000000000000p+2, 0.0 }, { -0x1.e600000000000p+7, 0.0, 0.0, 0.0 } },
+        { { -0x1.8000000000000p+1, 0.0 }, { -0x1.0000000000000p+2, 0.0 }, { 0x1.948b0fcd6e9e0p-7, 0x1.948b0fcd6e9e0p-61, 0x1.948b0fcd6e9e0p-115, 0x1.948b0fcd6e9e0p-169 } },
+        { { 0x1.8000000000000p+0, 0.0 }, { 0x1.6000000000000p+1, 0.0 }, { 0x1.865b271ccd152p+1, -0x1.532c42721768ap-53, 0x1.0fc3790296be8p-107, -0x1.63840dfa360f8p-163 } },
+        { { 0x1.43d332e186ceep-5, 0x1.25b90cc5a5ae4p-59 }, { -0x1.c2cd146dc1dc0p+1, 0.0 }, { 0x1.5562402171fe3p+16, 0x1.b74af5e563b22p-38, 0x1.be9e4dcfbed46p-93, -0x1.35005a06935aap-147 } },
+        { { 0x1.65e0cd181c314p-3, 0x1.aa66992f1bdc0p-58 }, { 0x1.c534c0c8031b0p+4, 0.0 }, { 0x1.a3fdab363966bp-72, -0x1.7423373291fffp-131, -0x1.f433711f2db95p-185, -0x1.a6ca8fda7a5b1p-240 } },
+        { { 0x1.366173cda5e24p-3, -0x1.f6e04a6d5a30cp-59 }, { -0x1.08bc0fe466fdfp+5, 0.0 }, { 0x1.0e7d6b2f51528p+90, 0x1.cfdc5b89e0127p+36, 0x1.aa090804eceaep-19, 0x1.391e1949cb996p-73 } },
+        { { 0x1.8eda47b9c7b16p-3, 0x1.681aa24cf1097p-57 }, { -0x1.06e3864b45c57p+5, 0.0 }, { 0x1.79d82287a0590p+77, 0x1.f620073ce91bap+22, -0x1.4ce6812f8cffbp-33, -0x1.0e29ce2721ae8p-87 } },
+        { { 0x1.ff379f7b5e000p+0, 0x1.7633cbaf65148p-54 }, { -0x1.71688200ba0b0p+2, 0.0 }, { 0x1.2e7d0d38ec15ep-6, 0x1.4322a18ceea89p-66, 0x1.e194f17a36fd9p-121, -0x1.be5efb07d7ebep-177 } },
+        { { 0x1.41b12a6d96d01p+4, -0x1.c210f7a644a95p-51 }, { 0x1.1e16e80bc4160p+5, 0.0 }, { 0x1.c6e243e8abd09p+154, -0x1.ab4ff66237489p+100, -0x1.2aae07ce840d8p+46, -0x1.52f20a10e46d7p-10 } },
+        { { 0x1.68572b9ea26d1p-2, 0x1.f144a8505d07dp-57 }, { -0x1.dca05ff96d69bp+4, 0.0 }, { 0x1.d907d656428b0p+44, 0x1.579c866087abbp-15, -0x1.b60bbcff3e66dp-69, 0x1.baad99a7319c4p-123 } },
+        { { 0x1.9d0845ef5da74p+3, 0x1.ca2ca6cee981bp-56 }, { 0x1.0da186414b724p+4, 0.0 }, { 0x1.2320a1419e3b4p+62, -0x1.feb8e8e311f99p+7, -0x1.fec4ba3dece59p-49, -0x1.40d776d579dfep-105 } },
+        { { 0x1.52cfbd58d52a5p-3, 0x1.4c008f4d9d8b4p-58 }, { 0x1.8c3dd82f17834p+4, 0.0 }, { 0x1.a526f9a651d8bp-65, -0x1.eb370bd295b44p-121, 0x1.9c717bb2efc43p-175, -0x1.33872a1c5d755p-232 } },
+        { { 0x1.0bc6842111431p-3, -0x1.85199a12fdc7ap-60 }, { -0x1.0df384722831dp+4, 0.0 }, { 0x1.6f665427f6826p+49, 0x1.66b3071834fb4p-7, -0x1.130eb370537eep-62, -0x1.36fa374bb34c7p-116 } },
+        { { 0x1.83928384dfe78p-1, 0x1.accda54b980f1p-56 }, { 0x1.350dc77acc27cp+5, 0.0 }, { 0x1.65aacf60ec319p-16, 0x1.b7ab058c126c5p-71, -0x1.3d0f3668aadeap-125, -0x1.d83ef71611e3ap-179 } },
+        { { 0x1.e1f0d79f6c7dfp+3, -0x1.1346863d0d8d5p-51 }, { 0x1.c336ae0e1dd10p+4, 0.0 }, { 0x1.44707ff1e3875p+110, -0x1.aa9b342646c0dp+50, -0x1.bb2a13593e75bp-4, -0x1.bc39dd49fd4e8p-60 } },
+        { { 0x1.855099da7bdc2p-7, 0x1.8fee86bd8cbdap-62 }, { -0x1.07f83d402a1f7p+5, 0.0 }, { 0x1.032368043c6a2p+211, 0x1.9f0b97b01ce03p+155, -0x1.48c33656956ffp+101, -0x1.4a9f23ba43e58p+47 } },
+        { { 0x1.6e688e948cdf5p+3, 0x1.8f1a6c9a3ecf5p-52 }, { -0x1.5fa78d396e9c0p+1, 0.0 }, { 0x1.4356433f4f30dp-10, -0x1.8d05592c7f753p-65, -0x1.cd78f07ecf2c2p-121, 0x1.80f07449002d2p-179 } },
+        { { 0x1.317be8af453d6p+2, -0x1.887f1261c7492p-52 }, { -0x1.772136621e400p-5, 0.0 }, { 0x1.dca287a154943p-1, 0x1.f3788550a0813p-55, -0x1.f1075a23ec7c7p-110, 0x1.51d876c4123bcp-164 } },
+        { { 0x1.91442d51e6c8cp-3, 0x1.fc2b5865dd1d6p-58 }, { 0x1.afa662ff76f88p+4, 0.0 }, { 0x1.7911d405fedebp-64, -0x1.27c6e88cd191fp-119, -0x1.ccabf5484851ep-177, -0x1.dd467efb86e37p-231 } },
+        { { 0x1.b08bfe4e51bf7p+0, -0x1.a9e661a36277bp-54 }, { -0x1.04ac7b1d0c740p+0, 0.0 }, { 0x1.2c22cc3d90135p-1, -0x1.1b9bca7e63fe9p-57, -0x1.1e721de952639p-112, -0x1.003e6ad981f1bp-167 } },
+        { { 0x1.009dac742fbcep-3, 0x1.403c54d0c9102p-57 }, { -0x1.3318476b373b2p+3, 0.0 }, { 0x1.b098293893e7bp+28, 0x1.e8a0db4b0f378p-26, 0x1.9afb4e6eb39dfp-80, 0x1.d71f1bb12eab4p-135 } },
+        { { 0x1.b03607e670a75p-3, -0x1.158b8b1b19a06p-57 }, { -0x1.8aac4f7afac01p+4, 0.0 }, { 0x1.493b5faa81350p+55, -0x1.06d71deeeb414p+1, -0x1.4393370012a99p-53, 0x1.7b7b8ec00dfb7p-107 } },
+        { { 0x1.f4086b93d7e85p+0, 0x1.907b7712a7fdcp-55 }, { 0x1.9cd65356d68c0p+4, 0.0 }, { 0x1.e507994b48037p+24, 0x1.61b997b35b454p-30, -0x1.3e8f67737da54p-88, 0x1.3b7d9fa88ade4p-142 } },
+        { { 0x1.ce10d16179b24p-4, 0x1.b5aa09f7e6c13p-58 }, { 0x1.c82f002f9af58p+2, 0.0 }, { 0x1.79b643b432b55p-23, 0x1.3b77fde46a2b0p-81, -0x1.38495df119d44p-136, -0x1.26463ca71d23ap-190 } },
+        { { 0x1.59479941b2b46p+5, 0x1.554853144c481p-49 }, { 0x1.f5f81337f84a4p+4, 0.0 }, { 0x1.5358f68362ef1p+170, -0x1.12cb4180a8fafp+115, 0x1.893a6941e3a36p+61, -0x1.96a9da1d621e9p+6 } },
+        { { 0x1.dc05a0c669b7dp+2, 0x1.11aaf354b8694p-53 }, { 0x1.7abedec34298cp+3, 0.0 }, { 0x1.3340200bc102fp+34, 0x1.f9e71c681d96dp-22, -0x1.58d20ed92f3dcp-76, 0x1.f70f68cbbe035p-130 } },
+        { { 0x1.6a9cd259e160ep+0, -0x1.2f6296de1e511p-61 }, { 0x1.b982257dca928p+4, 0.0 }, { 0x1.d0b66f0559b96p+13, -0x1.a399ffbd08ab1p-42, 0x1.83169340b6a3ep-97, 0x1.52e34a9bde192p-152 } },
+        { { 0x1.1c90e78c608b5p+1, -0x1.bd85cdfb6aff5p-55 }, { 0x1.4b06c7d133daep+4, 0.0 }, { 0x1.cc650676d001ep+23, -0x1.d7549f5c22cf9p-32, 0x1.b0b73919ee06ep-86, 0x1.9c81e19a19dacp-140 } },
+        { { 0x1.0bf1ad5d324dfp+1, 0x1.8d486bedcee53p-53 }, { -0x1.6b6994911e9dap+4, 0.0 }, { 0x1.bb663f4cdcfc0p-25, -0x1.61d2246574e61p-79, 0x1.9275f82308ad7p-133, -0x1.6b9b9fa913d01p-187 } },
+        { { 0x1.7faedf67c35f0p-5, -0x1.6daf8d73371fep-59 }, { -0x1.072840c5eb5e0p+5, 0.0 }, { 0x1.34c119a49e8bdp+145, -0x1.cb5d9ee8493ffp+89, 0x1.c2cf09f6f7422p+31, 0x1.028274aa790a7p-24 } },
+        { { 0x1.1be5ce6897474p+0, -0x1.541a2cdd79b07p-56 }, { -0x1.b5b37e9e5ae6fp+4, 0.0 }, { 0x1.e39b623570f34p-5, -0x1.08b938f889c57p-59, 0x1.fc73a62e37fb1p-113, -0x1.406609cc6404ap-168 } },
+        { { 0x1.100a2ba2a8b9ap+1, -0x1.4b43e2fa2539dp-55 }, { -0x1.36ff3cbcf97c0p+0, 0.0 }, { 0x1.99c44c443c544p-2, 0x1.481d6e6215e00p-57, 0x1.38a2c22994b91p-112, 0x1.28fa677736518p-166 } },
+        { { 0x1.ef6a07def61d7p-2, -0x1.78b7e77d0eaa6p-56 }, { 0x1.24df3e63c4048p+5, 0.0 }, { 0x1.9231d6fb085ecp-39, 0x1.4f6f8ba0c1abfp-97, -0x1.45c4bf951d6dep-152, -0x1.7c63eb5f6dee1p-206 } },
+        { { 0x1.94576f143b033p-1, -0x1.0b02250ea799cp-55 }, { -0x1.a72b7b2f9ddc0p+4, 0.0 }, { 0x1.0151dce5a4832p+9, 0x1.67feb1a6d1de4p-45, -0x1.3bc23802effa4p-101, -0x1.7d0efb6181a84p-155 } },
+        { { 0x1.91fec78cc4938p-1, 0x1.55e7cb44e3a12p-55 }, { -0x1.ba2875e48fcd0p+4, 0.0 }, { 0x1.8fef027d412aap+9, 0x1.b5884a9142481p-45, -0x1.e9f5858c007b0p-99, 0x1.6433516b47dc3p-155 } },
+        { { 0x1.89ef5af4f79c9p+2, -0x1.900139205afb8p-53 }, { -0x1.1ba598faa8a79p+5, 0.0 }, { 0x1.077148abf38cfp-93, 0x1.e1f388ea46b2ap-149, -0x1.dcf417abd8f12p-203, 0x1.8d90d480198cap-258 } },
+        { { 0x1.835597dc70abap-1, -0x1.957016fa2324ep-55 }, { -0x1.6ad0fa61029c0p-1, 0.0 }, { 0x1.37f889ada6839p+0, -0x1.f8aa9831236eap-54, 0x1.a3d32120936a5p-108, 0x1.c99b367b6e98bp-162 } },
+        { { 0x1.29a7ef42c2978p-1, 0x1.06295512c7ce3p-55 }, { 0x1.ba6d548d4c260p+1, 0.0 }, { 0x1.3a2751edaeab1p-3, 0x1.85f7b2f14ab94p-60, 0x1.dedee33aaabbcp-116, 0x1.41b049c3f38ffp-173 } },
+        { { 0x1.607bf9556a968p+4, -0x1.2cbd3d7031a0dp-56 }, { 0x1.8fdde55c34594p+4, 0.0 }, { 0x1.699849e947a33p+111, -0x1.61c1d51e65841p+56, -0x1.03845ca7763d3p+2, 0x1.c13f755eef02bp-52 } },
+        { { 0x1.32d63118d3c71p+5, 0x1.ac05d78c2ab74p-50 }, { 0x1.89fc202057580p+3, 0.0 }, { 0x1.b6db07c02d4c0p+64, 0x1.964e7f1980b58p+9, -0x1.8ef92deff9714p-45, -0x1.c822ae3bd4afbp-99 } },
+        { { 0x1.c783a479d33c1p-4, 0x1.5149d69f3160fp-59 }, { -0x1.e2bc33712fdc8p+3, 0.0 }, { 0x1.bde46f9bb93b3p+47, -0x1.5aa07b2721cdcp-7, -0x1.90b1985f57dfdp-64, -0x1.b7d4b2abeb056p-118 } },
+        { { 0x1.a5cd7f075d21fp-2, -0x1.3a84fd8b79443p-56 }, { 0x1.fcaeb156629ecp+4, 0.0 }, { 0x1.3f54a600b4fecp-41, 0x1.afbbaea73273dp-95, 0x1.df37d08187c1ap-149, -0x1.51bf226d2d844p-208 } },
+        { { 0x1.9e912ff866f6fp+0, -0x1.4e2834d8a8c2cp-55 }, { -0x1.0a7efc33f608bp+5, 0.0 }, { 0x1.c7f627fdf3cfep-24, 0x1.6f9451bce057ap-78, -0x1.46136870c9e7cp-132, -0x1.72eae84591944p-187 } },
+        { { 0x1.7c7e4d04c0b98p+1, 0x1.ca61ae04d1843p-53 }, { 0x1.dea20c186f1ccp+4, 0.0 }, { 0x1.03219df9b5121p+47, 0x1.3c8a4dc0d5255p-7, 0x1.a413198040e8dp-66, -0x1.397ea262bf1bep-121 } },
+        { { 0x1.cd4e1ff30e789p-7, -0x1.0116ea7978edfp-61 }, { 0x1.d2aafc7479710p+3, 0.0 }, { 0x1.3c8236be330b8p-90, 0x1.24af59a99a1bfp-145, 0x1.a111361f922dep-201, -0x1.b8c015ddc24a7p-255 } },
+        { { 0x1.d16e48645d358p+3, 0x1.e75e8bb735592p-53 }, { 0x1.350829d31fd96p+5, 0.0 }, { 0x1.265e45fe9cd6cp+149, 0x1.52b375d29b0a6p+95, 0x1.02548fe0733e7p+41, -0x1.2f31b382141e4p-15 } },
+        { { 0x1.158644b44ff53p-6, 0x1.80b64865e7532p-63 }, { -0x1.3c881735187abp+4, 0.0 }, { 0x1.50aa82c49e9cfp+116, -0x1.ea792d780079ep+61, 0x1.a72b707a6a724p+7, 0x1.c779971d53b70p-48 } },
+        { { 0x1.0e358b4f15bd7p+4, -0x1.7a356ce5557c3p-50 }, { -0x1.c9109be3ca823p+4, 0.0 }, { 0x1.6bed9d9294b71p-117, 0x1.8dae51b29a047p-171, 0x1.e610f25847484p-226, 0x1.e5d40d2977be5p-280 } },
+        { { 0x1.3dea14e0a4c96p-2, 0x1.4e238161abd2fp-59 }, { -0x1.0dd22a4a13947p+5, 0.0 }, { 0x1.e2e354988629cp+56, 0x1.1586669d8b35ep+2, -0x1.b9b064cb02f2dp-52, 0x1.d489d6b2e5a96p-110 } },
+        { { 0x1.f42e098b91c71p-7, -0x1.f58e506a98e90p-63 }, { -0x1.f0dfbfbf74260p+3, 0.0 }, { 0x1.9c2bee1bbcad6p+93, -0x1.ed042d4a5b95dp+39, -0x1.89218dcf68017p-15, -0x1.2d804153b8305p-70 } },
+        { { 0x1.3ed39ff7c54c2p+0, 0x1.ff0f14ac88687p-56 }, { -0x1.c1c734f5fe0bfp+4, 0.0 }, { 0x1.123986e7fbb10p-9, -0x1.6c552272fa989p-66, -0x1.620b2055e35cbp-120, -0x1.b53a30bfc80eep-174 } },
+        { { 0x1.a379f9a518777p-7, 0x1.e3625ac1ed79dp-63 }, { 0x1.9278cb5762a88p+4, 0.0 }, { 0x1.ca2f06bbefa1cp-159, -0x1.4889eab030af9p-213, 0x1.e9c2ccda800cbp-268, -0x1.8f5b02a417046p-322 } },
+        { { 0x1.73270b1b00b37p-6, 0x1.ae2dc350f3172p-60 }, { 0x1.3de4c7012ef40p+5, 0.0 }, { 0x1.d4fc12a39a8c6p-218, -0x1.5aef0d4b1b8b0p-272, -0x1.e78a5cf89fd25p-326, -0x1.c50b3a42119aap-380 } },
+        { { 0x1.aaae705cf4f07p+1, -0x1.8a64a0931220dp-55 }, { 0x1.20b23e89c4a66p+4, 0.0 }, { 0x1.44740600bb67fp+31, -0x1.34bcaf655a945p-23, -0x1.ff6409682d2f4p-78, -0x1.d6ec76d406ca5p-132 } },
+        { { 0x1.cdaed472ec634p-7, 0x1.893e78afddc39p-61 }, { -0x1.ee895f45babc1p+4, 0.0 }, { 0x1.0b9fb4b758e5cp+190, 0x1.690c586ab882ap+135, 0x1.6528db05ce507p+81, -0x1.039f04cf994dap+26 } },
+        { { 0x1.bd5f0a0bd3cd9p-4, 0x1.5e68a4b781483p-59 }, { 0x1.d4606e040d380p+3, 0.0 }, { 0x1.1b350585b2554p-47, 0x1.9d3bcae766b3bp-101, -0x1.e6e7e8034b162p-155, -0x1.865ad66fa9512p-211 } },
+        { { 0x1.33dbb0985c9f0p-1, 0x1.2a8782843c4e9p-56 }, { -0x1.b5cfe7b2a567ep+4, 0.0 }, { 0x1.0ed6d55dae855p+20, 0x1.5fb574d2b5abcp-34, 0x1.c28e4b74094ebp-92, 0x1.fe58eb919f790p-147 } },
+        { { 0x1.a63643eb07162p-6, -0x1.8999fb40f4101p-61 }, { 0x1.4290a30e59862p+4, 0.0 }, { 0x1.816dbb848db22p-107, -0x1.0ba1707416e31p-166, 0x1.c5b55f2e6dc0fp-221, -0x1.0840d56cce418p-275 } },
+        { { 0x1.dca9e11a88c20p-3, 0x1.369f4ec239c48p-58 }, { 0x1.ce0e6690477c4p+4, 0.0 }, { 0x1.334cc396f86d0p-61, 0x1.02f0c0d245674p-115, 0x1.870f4159c754bp-170, -0x1.9549581196d27p-228 } },
+        { { 0x1.8f078b6007959p-3, -0x1.b26a1987d0c24p-58 }, { 0x1.ad0e247e77314p+4, 0.0 }, { 0x1.a6c8b52f91236p-64, 0x1.f61d48952e300p-120, -0x1.14ddf011a704bp-176, 0x1.38059fe851e51p-230 } },
+        { { 0x1.47efb288ebafep-2, 0x1.6b0f1df90ccccp-57 }, { -0x1.05943bd8e1ff8p+2, 0.0 }, { 0x1.a3f6231df6b5ep+6, -0x1.226e26211a591p-49, 0x1.5e394ca3d6a8fp-103, 0x1.4eb8966042013p-158 } },
+    };
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/fltx/f128_simd.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    bool sameBits(double a, double b)
+    {
+        // NaNs compare by payload-agnostic NaN-ness, everything else bitwise (incl. signed zero)
+        if (std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    bool sameBits(f128 a, f128 b)
+    {
+        return sameBits(a.hi, b.hi) && sameBits(a.lo, b.lo);
+    }
+
+    std::vector<f128> sampleValues(int count)
+    {
+        std::mt19937_64 rng(1234);
+        std::uniform_real_distribution<double> mant(-1.0, 1.0);
+        std::uniform_int_distribution<int> expo(-60, 60);
+
+        std::vector<f128> out;
+        for (int i = 0; i < count; i++)
+        {
+            const double hi = std::ldexp(mant(rng), expo(rng));
+            const double lo = hi * 0x1p-54 * mant(rng);
+            out.push_back(renorm(hi, lo));
+        }
+
+        // edge cases
+        out.push_back(f128{ 0.0, 0.0 });
+        out.push_back(f128{ -0.0, 0.0 });
+        out.push_back(f128{ 1.0, 0.0 });
+        out.push_back(f128{ -2.5, 1e-17 });
+        out.push_back(f128{ 1e-300, 0.0 });
+        out.push_back(f128{ 1e300, 0.0 });
+        return out;
+    }
+
+    template<class V>
+    void checkBitExact()
+    {
+        constexpr int L = V::lanes;
+        const auto vals = sampleValues(4000);
+
+        for (size_t i = 0; i + 2 * L <= vals.size(); i += L)
+        {
+            const f128* a = &vals[i];
+            const f128* b = &vals[i + L];
+
+            V va = V::load(a);
+            V vb = V::load(b);
+
+            f128 add[L], sub[L], mul[L], div[L], sq[L];
+            (va + vb).store(add);
+            (va - vb).store(sub);
+            (va * vb).store(mul);
+            (va / vb).store(div);
+            V::sqrt(V::abs(va)).store(sq);
+
+            auto lt = va < vb, le = va <= vb, eq = va == vb, gt = va > vb;
+            V picked = V::blend(lt, va, vb);
+
+            for (int l = 0; l < L; l++)
+            {
+                REQUIRE(sameBits(add[l], a[l] + b[l]));
+                REQUIRE(sameBits(sub[l], a[l] - b[l]));
+                REQUIRE(sameBits(mul[l], a[l] * b[l]));
+                if (!iszero(b[l]))
+                    REQUIRE(sameBits(div[l], a[l] / b[l]));
+                REQUIRE(sameBits(sq[l], sqrt(abs(a[l]))));
+
+                REQUIRE(lt[l] == (a[l] < b[l]));
+                REQUIRE(le[l] == (a[l] <= b[l]));
+                REQUIRE(eq[l] == (a[l] == b[l]));
+                REQUIRE(gt[l] == (a[l] > b[l]));
+                REQUIRE(sameBits(picked.lane(l), (a[l] < b[l]) ? a[l] : b[l]));
+            }
+        }
+    }
+}
+
+TEST_CASE("f128x2 matches scalar f128 bit-for-bit")
+{
+    checkBitExact<simd2::f128x2>();
+}
+
+TEST_CASE("f128x4 matches scalar f128 bit-for-bit")
+{
+    checkBitExact<simd2::f128x4>();
+}
+
+TEST_CASE("packed f128 sqrt handles zero and negative lanes like scalar")
+{
+    const f128 in[4] = { f128{ 0.0, 0.0 }, f128{ -1.0, 0.0 }, f128{ 2.0, 0.0 }, f128{ 1e-20, 0.0 } };
+    f128 out[4];
+    simd2::f128x4::sqrt(simd2::f128x4::load(in)).store(out);
+
+    for (int i = 0; i < 4; i++)
+        REQUIRE(sameBits(out[i], sqrt(in[i])));
+}
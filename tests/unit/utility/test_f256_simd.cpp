@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/fltx/f256_simd.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    bool sameBits(double a, double b)
+    {
+        if (std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    bool sameBits(const f256& a, const f256& b)
+    {
+        return sameBits(a.x0, b.x0) && sameBits(a.x1, b.x1) && sameBits(a.x2, b.x2) && sameBits(a.x3, b.x3);
+    }
+
+    std::vector<f256> sampleValues(int count, uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> mant(-1.0, 1.0);
+        std::uniform_int_distribution<int> expo(-60, 60);
+
+        std::vector<f256> out;
+        for (int i = 0; i < count; i++)
+        {
+            const double x0 = std::ldexp(mant(rng), expo(rng));
+            out.push_back(f256::from_limbs(x0, x0 * 0x1p-54 * mant(rng), x0 * 0x1p-108 * mant(rng), x0 * 0x1p-162 * mant(rng)));
+        }
+
+        out.push_back(f256(0.0));
+        out.push_back(f256(-0.0));
+        out.push_back(f256(1.0));
+        out.push_back(f256(-2.5, 1e-17, 0.0, 0.0));
+        out.push_back(f256(1e-300));
+        out.push_back(f256(1e300));
+        return out;
+    }
+
+    template<class V>
+    void checkBitExact()
+    {
+        constexpr int L = V::lanes;
+        const auto vals = sampleValues(4000, 256);
+
+        for (size_t i = 0; i + 2 * L <= vals.size(); i += L)
+        {
+            const f256* a = &vals[i];
+            const f256* b = &vals[i + L];
+
+            V va = V::load(a);
+            V vb = V::load(b);
+
+            f256 add[L], sub[L], mul[L], muld[L], sq[L];
+            (va + vb).store(add);
+            (va - vb).store(sub);
+            (va * vb).store(mul);
+            (va * b[0].x0).store(muld);
+            sqr(va).store(sq);
+
+            auto lt = va < vb, eq = va == vb, ge = va >= vb;
+            V picked = V::blend(lt, va, vb);
+
+            for (int l = 0; l < L; l++)
+            {
+                REQUIRE(sameBits(add[l], f256::add_sloppy(a[l], b[l])));
+                REQUIRE(sameBits(sub[l], f256::add_sloppy(a[l], -b[l])));
+                REQUIRE(sameBits(mul[l], a[l] * b[l]));
+                REQUIRE(sameBits(muld[l], a[l] * b[0].x0));
+                REQUIRE(sameBits(sq[l], sqr(a[l])));
+
+                REQUIRE(lt[l] == (a[l] < b[l]));
+                REQUIRE(eq[l] == (a[l] == b[l]));
+                REQUIRE(ge[l] == (a[l] >= b[l]));
+                REQUIRE(sameBits(picked.lane(l), (a[l] < b[l]) ? a[l] : b[l]));
+            }
+        }
+    }
+}
+
+TEST_CASE("f256x2 matches scalar f256 bit-for-bit")
+{
+    checkBitExact<simd2::f256x2>();
+}
+
+TEST_CASE("f256x4 matches scalar f256 bit-for-bit")
+{
+    checkBitExact<simd2::f256x4>();
+}
+
+TEST_CASE("f256_batch ops match the scalar sequences for any length")
+{
+    const auto a = sampleValues(37, 1);
+    const auto b = sampleValues(37, 2);
+    const auto c = sampleValues(37, 3);
+    const size_t n = a.size();
+
+    std::vector<f256> out(n);
+
+    f256_batch::add(a.data(), b.data(), out.data(), n);
+    for (size_t i = 0; i < n; i++) REQUIRE(sameBits(out[i], f256::add_sloppy(a[i], b[i])));
+
+    f256_batch::mul(a.data(), b.data(), out.data(), n);
+    for (size_t i = 0; i < n; i++) REQUIRE(sameBits(out[i], a[i] * b[i]));
+
+    f256_batch::sqr(a.data(), out.data(), n);
+    for (size_t i = 0; i < n; i++) REQUIRE(sameBits(out[i], sqr(a[i])));
+
+    f256_batch::mul_add(a.data(), b.data(), c.data(), out.data(), n);
+    for (size_t i = 0; i < n; i++) REQUIRE(sameBits(out[i], f256::add_sloppy(a[i] * b[i], c[i])));
+
+    // in place
+    out = a;
+    f256_batch::scale(out.data(), 3.0, out.data(), n);
+    for (size_t i = 0; i < n; i++) REQUIRE(sameBits(out[i], a[i] * 3.0));
+}
+
+TEST_CASE("f256 multiply and square keep quad-double precision")
+{
+    const auto vals = sampleValues(2000, 7);
+    for (size_t i = 0; i + 1 < vals.size(); i++)
+    {
+        const f256& a = vals[i];
+        const f256& b = vals[i + 1];
+        if (a.x0 == 0.0 || b.x0 == 0.0 || std::fabs(a.x0) < 1e-200 || std::fabs(a.x0) > 1e200) continue;
+
+        // exact product of the two expansions, truncated to 4 limbs by the accurate add
+        const f256 p = a * b;
+        const f256 q = (a * b.x0 + a * b.x1) + (a * b.x2 + a * b.x3);
+        REQUIRE(std::fabs((p - q).x0 / p.x0) <= 0x1p-205);
+
+        const f256 s = sqr(a);
+        REQUIRE(std::fabs((s - a * a).x0 / s.x0) <= 0x1p-205);
+    }
+}
+
+TEST_CASE("f256 sloppy and accurate add agree without cancellation")
+{
+    const auto vals = sampleValues(2000, 9);
+    for (size_t i = 0; i + 1 < vals.size(); i++)
+    {
+        const f256 a = abs(vals[i]);
+        const f256 b = abs(vals[i + 1]);
+        if (a.x0 == 0.0 || b.x0 == 0.0) continue;
+
+        const f256 s = f256::add_sloppy(a, b);
+        const f256 t = f256::add_accurate(a, b);
+        REQUIRE(std::fabs((s - t).x0 / t.x0) <= 0x1p-208);
+    }
+
+    // cancellation: the accurate add keeps the low limbs the sloppy one may lose
+    const f256 x(1.0, 0x1p-60, 0x1p-130, 0x1p-190);
+    const f256 y(-1.0, -0x1p-60, 0.0, 0.0);
+    const f256 d = f256::add_accurate(x, y);
+    REQUIRE(d.x0 == 0x1p-130);
+    REQUIRE(d.x1 == 0x1p-190);
+}
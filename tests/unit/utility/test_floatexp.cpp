@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/fltx/fltx.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace bl;
+
+namespace {
+    bool close(double a, double b, double rel = 1e-15)
+    {
+        return std::fabs(a - b) <= rel * std::max(std::fabs(a), std::fabs(b));
+    }
+}
+
+TEST_CASE("floatexp round-trips doubles and matches double arithmetic in range")
+{
+    std::mt19937_64 rng(99);
+    std::uniform_real_distribution<double> mant(-1.0, 1.0);
+    std::uniform_int_distribution<int> expo(-200, 200);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        const double a = std::ldexp(mant(rng), expo(rng));
+        const double b = std::ldexp(mant(rng), expo(rng));
+        const floatexp fa = a, fb = b;
+
+        REQUIRE(static_cast<double>(fa) == a);
+        REQUIRE(std::fabs(fa.m) >= 1.0);
+        REQUIRE(std::fabs(fa.m) < 2.0);
+
+        // products/quotients are exact roundings of the same mantissa product
+        REQUIRE(static_cast<double>(fa * fb) == a * b);
+        REQUIRE(static_cast<double>(fa / fb) == a / b);
+        REQUIRE((close(static_cast<double>(fa + fb), a + b, 1e-15) || std::fabs(a + b) < 1e-300));
+        REQUIRE((close(static_cast<double>(fa - fb), a - b, 1e-15) || std::fabs(a - b) < 1e-300));
+
+        REQUIRE((fa < fb) == (a < b));
+        REQUIRE((fa > fb) == (a > b));
+        REQUIRE((fa == fb) == (a == b));
+    }
+}
+
+TEST_CASE("floatexp keeps values far outside double's exponent range")
+{
+    floatexp tiny = 1e-300;
+    for (int i = 0; i < 10; ++i)
+        tiny *= floatexp(1e-300);
+
+    // 1e-3300
+    REQUIRE(!iszero(tiny));
+    REQUIRE(static_cast<double>(tiny) == 0.0);
+    REQUIRE(std::fabs(log10(tiny) + 3300.0) < 1e-9);
+    REQUIRE(to_string(tiny, 4) == "1.0000e-3300");
+
+    // and back again
+    floatexp back = tiny;
+    for (int i = 0; i < 10; ++i)
+        back /= floatexp(1e-300);
+    REQUIRE(close(static_cast<double>(back), 1e-300, 1e-13));
+
+    // ordering across huge exponent gaps, including sign and zero
+    const floatexp huge = floatexp(1.0) / tiny;
+    REQUIRE(tiny < huge);
+    REQUIRE(-huge < -tiny);
+    REQUIRE(floatexp(0) < tiny);
+    REQUIRE(-tiny < floatexp(0));
+    REQUIRE(tiny + huge == huge);
+    REQUIRE(sqrt(tiny * tiny) == tiny);
+}
+
+TEST_CASE("floatexp handles zero, cancellation and f128 conversion")
+{
+    REQUIRE(iszero(floatexp(0.0)));
+    REQUIRE(iszero(floatexp(3.0) - floatexp(3.0)));
+    REQUIRE(floatexp(0.0) + floatexp(5.0) == floatexp(5.0));
+    REQUIRE(iszero(floatexp(0.0) * floatexp(1e300) * floatexp(1e300)));
+
+    // the trailing limb survives as far as a double mantissa allows
+    const f128 v = f128{ 1.0, 0x1p-53 };
+    REQUIRE(static_cast<double>(floatexp(v)) == static_cast<double>(v));
+    REQUIRE(floatexp(f128{ -2.5, 0.0 }) == floatexp(-2.5));
+
+    REQUIRE(ldexp(floatexp(1.0), -5000) * ldexp(floatexp(1.0), 5000) == floatexp(1.0));
+}
@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/fltx/f128.h>
+#include <bitloop/util/fltx/f256.h>
+
+#include <cmath>
+#include <span>
+
+#include "fltx_math_reference.h"
+
+using namespace bl;
+using fltx_math_reference::Case;
+
+namespace {
+    f256 reference(const Case& c) { return f256(c.ref[0], c.ref[1], c.ref[2], c.ref[3]); }
+    f128 inputX128(const Case& c) { return { c.x[0], c.x[1] }; }
+    f128 inputY128(const Case& c) { return { c.y[0], c.y[1] }; }
+    f256 inputX256(const Case& c) { return f256(c.x[0], c.x[1], 0.0, 0.0); }
+    f256 inputY256(const Case& c) { return f256(c.y[0], c.y[1], 0.0, 0.0); }
+
+    // |got - ref| / |ref|, resolved well past f128 precision
+    double relErr(const f256& got, const f256& ref)
+    {
+        return std::fabs((got - ref).x0 / ref.x0);
+    }
+
+    double relErr(const f128& got, const f256& ref)
+    {
+        return relErr(f256(got.hi, got.lo, 0.0, 0.0), ref);
+    }
+
+    // |y * log(x)|: the exponent exp() sees in pow, its absolute error becomes pow's relative error
+    double powExponent(const Case& c)
+    {
+        return std::fabs(c.y[0] * std::log(std::fabs(c.x[0])));
+    }
+
+    template<class F>
+    void checkF128(std::span<const Case> cases, F fn, double ulps)
+    {
+        for (const Case& c : cases)
+        {
+            INFO("x = " << c.x[0] << " y = " << c.y[0]);
+            REQUIRE(relErr(fn(c), reference(c)) <= ulps * 0x1p-106);
+        }
+    }
+
+    template<class F>
+    void checkF256(std::span<const Case> cases, F fn, double tol)
+    {
+        for (const Case& c : cases)
+        {
+            INFO("x = " << c.x[0] << " y = " << c.y[0]);
+            REQUIRE(relErr(fn(c), reference(c)) <= tol);
+        }
+    }
+}
+
+TEST_CASE("f128 transcendentals against mpmath reference")
+{
+    using namespace fltx_math_reference;
+
+    checkF128(exp_cases, [](const Case& c) { return exp(inputX128(c)); }, 4.0);
+    checkF128(log_cases, [](const Case& c) { return log(inputX128(c)); }, 4.0);
+    checkF128(sin_cases, [](const Case& c) { return sin(inputX128(c)); }, 4.0);
+    checkF128(cos_cases, [](const Case& c) { return cos(inputX128(c)); }, 4.0);
+    checkF128(atan2_cases, [](const Case& c) { return atan2(inputX128(c), inputY128(c)); }, 4.0);
+
+    for (const Case& c : pow_cases)
+    {
+        INFO("x = " << c.x[0] << " y = " << c.y[0]);
+        const f128 r = pow(inputX128(c), inputY128(c));
+        REQUIRE(relErr(r, reference(c)) <= (4.0 + 4.0 * powExponent(c)) * 0x1p-106);
+    }
+}
+
+TEST_CASE("f128 sincos matches sin and cos")
+{
+    for (const Case& c : fltx_math_reference::sin_cases)
+    {
+        f128 s, co;
+        sincos(inputX128(c), s, co);
+        REQUIRE(s == sin(inputX128(c)));
+        REQUIRE(co == cos(inputX128(c)));
+    }
+}
+
+TEST_CASE("f256 transcendentals against mpmath reference")
+{
+    using namespace fltx_math_reference;
+
+    checkF256(exp_cases, [](const Case& c) { return exp(inputX256(c)); }, 0x1p-200);
+    checkF256(log_cases, [](const Case& c) { return log(inputX256(c)); }, 0x1p-200);
+    checkF256(atan2_cases, [](const Case& c) { return atan2(inputX256(c), inputY256(c)); }, 0x1p-200);
+
+    // the pi/2 reduction costs log2|x| bits, measured against the result's scale (|sin|, |cos| <= 1)
+    auto checkTrig = [](std::span<const Case> cases, bool want_sin)
+    {
+        for (const Case& c : cases)
+        {
+            INFO("x = " << c.x[0]);
+            f256 s, co;
+            sincos(inputX256(c), s, co);
+            const f256 err = (want_sin ? s : co) - reference(c);
+            REQUIRE(std::fabs(err.x0) <= 0x1p-200 * std::fmax(1.0, std::fabs(c.x[0])));
+        }
+    };
+    checkTrig(sin_cases, true);
+    checkTrig(cos_cases, false);
+
+    for (const Case& c : pow_cases)
+    {
+        INFO("x = " << c.x[0] << " y = " << c.y[0]);
+        const f256 r = pow(inputX256(c), inputY256(c));
+        REQUIRE(relErr(r, reference(c)) <= (1.0 + powExponent(c)) * 0x1p-200);
+    }
+}
+
+TEST_CASE("fltx transcendental special values")
+{
+    REQUIRE(exp(f128(0.0)) == f128(1.0));
+    REQUIRE(log(f128(1.0)) == f128(0.0));
+    REQUIRE(std::isinf(log(f128(0.0)).hi));
+    REQUIRE(std::isnan(log(f128(-1.0)).hi));
+    REQUIRE(exp(f128(-800.0)) == f128(0.0));
+    REQUIRE(pow(f128(-2.0), f128(3.0)) == f128(-8.0));
+    REQUIRE(std::isnan(pow(f128(-2.0), f128(0.5)).hi));
+    REQUIRE(atan2(f128(0.0), f128(1.0)) == f128(0.0));
+
+    REQUIRE(exp(f256(0.0)) == f256(1.0));
+    REQUIRE(log(f256(1.0)) == f256(0.0));
+    REQUIRE(std::isinf(log(f256(0.0)).x0));
+    REQUIRE(std::isnan(log(f256(-1.0)).x0));
+    REQUIRE(std::isinf(exp(f256(710.0)).x0));
+    REQUIRE(exp(f256(-800.0)) == f256(0.0));
+    REQUIRE(pow(f256(-2.0), f256(3.0)) == f256(-8.0));
+    REQUIRE(std::isnan(pow(f256(-2.0), f256(0.5)).x0));
+
+    const f256 pi(3.141592653589793116e+00, 1.224646799147353207e-16, -2.994769809718339666e-33, 1.112454220863365282e-49);
+    REQUIRE(std::fabs((atan(f256(1.0)) * 4.0 - pi).x0) <= 0x1p-208);
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/frame_pacer.h>
+
+using namespace bl;
+using namespace std::chrono_literals;
+
+TEST_CASE("FramePacer deadlines are absolute and don't drift")
+{
+    FramePacer pacer(100.0); // 10ms
+    const auto t0 = FramePacer::clock::now();
+
+    REQUIRE(pacer.schedule(t0) == t0 + 10ms);
+
+    // frames finishing at varying points within their slot never shift later deadlines
+    REQUIRE(pacer.schedule(t0 + 13ms) == t0 + 20ms);
+    REQUIRE(pacer.schedule(t0 + 20ms) == t0 + 30ms);
+    REQUIRE(pacer.schedule(t0 + 21ms) == t0 + 40ms);
+    REQUIRE(pacer.overrunCount() == 0);
+}
+
+TEST_CASE("FramePacer overrun never produces a wrapped delay")
+{
+    FramePacer pacer(100.0, FrameOverrunPolicy::SKIP);
+    const auto t0 = FramePacer::clock::now();
+    pacer.schedule(t0);
+
+    // frame finishes 35ms after its deadline: deadline lands on the next slot after 'now'
+    const auto now = t0 + 45ms;
+    const auto d = pacer.schedule(now);
+    REQUIRE(d > now);
+    REQUIRE(d - now <= 10ms);
+    REQUIRE(d == t0 + 50ms);
+    REQUIRE(pacer.overrunCount() == 1);
+    REQUIRE(pacer.skippedFrames() == 3);
+}
+
+TEST_CASE("FramePacer catch-up keeps missed slots until too far behind")
+{
+    FramePacer pacer(100.0, FrameOverrunPolicy::CATCH_UP);
+    pacer.setMaxCatchUp(3);
+    const auto t0 = FramePacer::clock::now();
+    pacer.schedule(t0);
+
+    // one slot behind: deadline stays in the past so the next frame runs immediately
+    REQUIRE(pacer.schedule(t0 + 25ms) == t0 + 20ms);
+    REQUIRE(pacer.schedule(t0 + 26ms) == t0 + 30ms);
+
+    // hopelessly behind: re-anchor on now
+    REQUIRE(pacer.schedule(t0 + 100ms) == t0 + 100ms);
+    REQUIRE(pacer.schedule(t0 + 101ms) == t0 + 110ms);
+}
+
+TEST_CASE("FPSTimer reports frame-interval percentiles")
+{
+    FPSTimer timer(10);
+    for (int i = 1; i <= 100; ++i)
+        timer.push(static_cast<double>(i));
+
+    REQUIRE(timer.p50() == 50.0);
+    REQUIRE(timer.p95() == 95.0);
+    REQUIRE(timer.p99() == 99.0);
+    REQUIRE(timer.jitter() == 49.0);
+}
+
+TEST_CASE("FramePacer intervals forwarded with FPSTimer::push match the pacer's own stats")
+{
+    FramePacer pacer(200.0); // 5ms
+    FPSTimer displayed{ 30 };
+
+    REQUIRE(pacer.lastIntervalMs() == 0);
+    for (int i = 0; i < 6; i++)
+    {
+        pacer.wait();
+        if (pacer.lastIntervalMs() > 0)
+            displayed.push(pacer.lastIntervalMs());
+    }
+
+    REQUIRE(pacer.lastIntervalMs() > 0);
+    REQUIRE(displayed.p50() == pacer.timer().p50());
+    REQUIRE(displayed.p99() == pacer.timer().p99());
+    REQUIRE(displayed.getFPS() == pacer.timer().getFPS());
+}
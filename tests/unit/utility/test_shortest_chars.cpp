@@ -0,0 +1,187 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/fltx/shortest_chars.h>
+
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+
+using namespace bl;
+
+namespace {
+    std::string shortest(const f128& x, bool fixed = false, bool scientific = false)
+    {
+        char buf[96];
+        const auto r = to_chars_shortest(buf, buf + sizeof(buf), x, fixed, scientific);
+        REQUIRE(r.ok);
+        return std::string(buf, r.ptr);
+    }
+
+    std::string capped(double x, int max_sig, int max_frac)
+    {
+        fltx_decimal d;
+        shortest_decimal(x, d, max_sig, max_frac);
+        char buf[64];
+        const auto r = decimal_to_chars(buf, buf + sizeof(buf), d, true, false);
+        REQUIRE(r.ok);
+        return std::string(buf, r.ptr);
+    }
+
+    // exact value of the digits as f256 (15-digit chunks are exact, the scale good to ~2^-210).
+    // Only for |exponents| inside the power table, so the low limbs never go subnormal.
+    f256 decimalValue(const fltx_decimal& d)
+    {
+        const int k = d.exp10 - (d.count - 1);
+        REQUIRE(std::abs(k) <= shortest_detail::pow10_f256_table::range);
+
+        f256 v(0.0);
+        for (int i = 0; i < d.count; i += 15)
+        {
+            const int n = std::min(15, d.count - i);
+            double chunk = 0.0, scale = 1.0;
+            for (int k = 0; k < n; k++) { chunk = chunk * 10.0 + (d.digits[i + k] - '0'); scale *= 10.0; }
+            v = v * scale + f256(chunk);
+        }
+        v = v * shortest_detail::pow10_table()[k];
+        return d.neg ? -v : v;
+    }
+
+    // |digits - x| < half an ulp of x's leading limb
+    bool withinHalfUlp(const fltx_decimal& d, const f256& x, int bits)
+    {
+        const f256 err = decimalValue(d) - x;
+        const double half_ulp = std::ldexp(1.0, std::ilogb(x.x0) - bits);
+        return std::fabs(err.x0) < half_ulp;
+    }
+}
+
+TEST_CASE("shortest_decimal(double) matches std::to_chars")
+{
+    std::mt19937_64 rng(18);
+    std::uniform_real_distribution<double> mant(1.0, 2.0);
+    std::uniform_int_distribution<int> expo(-600, 600);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const double x = std::ldexp(mant(rng), expo(rng)) * ((i & 1) ? -1.0 : 1.0);
+
+        char want[64];
+        const auto w = std::to_chars(want, want + sizeof(want), x, std::chars_format::scientific);
+        const std::string ref(want, w.ptr);
+        const size_t ref_digits = ref.find('e') - (x < 0 ? 2 : 1) - (ref.find('.') != std::string::npos ? 1 : 0);
+
+        fltx_decimal d;
+        shortest_decimal(x, d);
+        INFO("x = " << ref);
+        REQUIRE(d.neg == (x < 0));
+        REQUIRE(withinHalfUlp(d, f256(x), 53));
+
+        // boundaries are exclusive, so where std::to_chars is shorter it must be sitting exactly
+        // on a half-ulp tie (common for large integer-valued doubles)
+        REQUIRE((size_t)d.count >= ref_digits);
+        if ((size_t)d.count == ref_digits)
+        {
+            char got[64];
+            const auto g = decimal_to_chars(got, got + sizeof(got), d, false, true);
+            REQUIRE(std::strtod(std::string(got, g.ptr).c_str(), nullptr) == x);
+        }
+        else
+        {
+            fltx_decimal tie;
+            shortest_decimal(x, tie, (int)ref_digits);
+            REQUIRE_FALSE(withinHalfUlp(tie, f256(x), 53));
+        }
+    }
+}
+
+TEST_CASE("shortest_decimal(f128) is within half an ulp and never longer than needed")
+{
+    std::mt19937_64 rng(128);
+    std::uniform_real_distribution<double> mant(1.0, 2.0);
+    std::uniform_real_distribution<double> low(-1.0, 1.0);
+    std::uniform_int_distribution<int> expo(-600, 600);
+
+    for (int i = 0; i < 5000; i++)
+    {
+        const double hi = std::ldexp(mant(rng), expo(rng));
+        const f128 x = renorm(hi, (i % 7) ? hi * 0x1p-53 * low(rng) : 0.0);
+
+        fltx_decimal d;
+        shortest_decimal(x, d);
+        INFO("x = " << shortest(x));
+        REQUIRE(d.count >= 1);
+        REQUIRE(d.count <= 33);
+        REQUIRE(withinHalfUlp(d, f256(x.hi, x.lo, 0.0, 0.0), 106));
+
+        // one digit fewer (either rounding) must not identify x
+        if (d.count > 1)
+        {
+            fltx_decimal shorter;
+            shortest_decimal(x, shorter, d.count - 1);
+            REQUIRE_FALSE(withinHalfUlp(shorter, f256(x.hi, x.lo, 0.0, 0.0), 106));
+        }
+    }
+}
+
+TEST_CASE("to_chars_shortest prints short decimals back as written")
+{
+    for (const char* s : { "0.1", "123.456", "-7.25e-30", "1e+20", "0.5", "-2" })
+    {
+        f128 x;
+        REQUIRE(parse_flt128(s, x));
+        REQUIRE(shortest(x) == s);
+    }
+
+    REQUIRE(shortest(f128(0.0)) == "0");
+    REQUIRE(shortest(f128(-0.0)) == "0");
+    REQUIRE(shortest(f128(1.5), false, true) == "1.5e+00");
+    REQUIRE(shortest(f128(0x1p-20), true, false) == "0.00000095367431640625");
+    REQUIRE(shortest(f128(1234.0), false, true) == "1.234e+03");
+    REQUIRE(shortest(f128(std::numeric_limits<double>::quiet_NaN())) == "nan");
+    REQUIRE(shortest(f128(-INFINITY)) == "-inf");
+
+    // the double nearest 0.1 is not the f128 nearest 0.1, so it needs all its digits
+    REQUIRE(shortest(f128(0.1)) == "0.100000000000000005551115123125783");
+
+    // general mode picks the shorter layout, fixed on ties
+    REQUIRE(shortest(f128(10000.0)) == "10000");
+    REQUIRE(shortest(f128(100000.0)) == "1e+05");
+    REQUIRE(shortest(f128(0.0625)) == "0.0625");
+    REQUIRE(shortest(f128(0x1p-20)) == "9.5367431640625e-07");
+
+    char tiny[3];
+    REQUIRE_FALSE(to_chars_shortest(tiny, tiny + sizeof(tiny), f128(123.25)).ok);
+}
+
+TEST_CASE("shortest_decimal caps round to nearest")
+{
+    REQUIRE(capped(0.1 + 0.2, 0, 3) == "0.3");
+    REQUIRE(capped(0.006, 0, 2) == "0.01");
+    REQUIRE(capped(0.004, 0, 2) == "0");
+    REQUIRE(capped(0.4, 0, 0) == "0");
+    REQUIRE(capped(0.6, 0, 0) == "1");
+    REQUIRE(capped(9.96, 0, 1) == "10");
+    REQUIRE(capped(12345.678, 3, INT_MAX) == "12300");
+    REQUIRE(capped(-1.25, 0, 1) == "-1.2"); // exact tie, to even
+    REQUIRE(capped(2.5, 0, 5) == "2.5");    // shortest already fits the cap
+}
+
+TEST_CASE("to_chars_shortest(f256) uses the extra precision")
+{
+    const f256 third = f256(1.0) / 3.0;
+    char buf[96];
+    const auto r = to_chars_shortest(buf, buf + sizeof(buf), third);
+    REQUIRE(r.ok);
+    const std::string s(buf, r.ptr);
+    REQUIRE(s.size() > 2 + 60);
+    REQUIRE(s.find_first_not_of('3', 2) == std::string::npos);
+
+    const auto h = to_chars_shortest(buf, buf + sizeof(buf), f256(0.5));
+    REQUIRE(std::string(buf, h.ptr) == "0.5");
+
+    // quad-double arithmetic itself must hold ~2^-200 for the printer's scaling
+    const f256 back = third * 3.0 - f256(1.0);
+    REQUIRE(std::fabs(back.x0) < 0x1p-200);
+}
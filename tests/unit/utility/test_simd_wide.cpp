@@ -0,0 +1,209 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/simd_wide.h>
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace bl;
+
+namespace {
+    template<class T>
+    bool sameBits(T a, T b)
+    {
+        if (std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    template<class T>
+    std::vector<T> sampleValues(int count, uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> mant(-1.0, 1.0);
+        std::uniform_int_distribution<int> expo(-20, 20);
+
+        std::vector<T> out;
+        for (int i = 0; i < count; i++)
+            out.push_back(static_cast<T>(std::ldexp(mant(rng), expo(rng))));
+
+        // edge cases (incl. equal neighbours so == / <= lanes get exercised)
+        for (T x : { T(0), T(-0.0), T(1), T(1), T(-2.5), std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::infinity(), T(3) })
+            out.push_back(x);
+        return out;
+    }
+
+    // halving tree, the order every backend reduces in
+    template<class T, class Op>
+    T treeReduce(std::vector<T> v, Op op)
+    {
+        for (size_t w = v.size() / 2; w >= 1; w /= 2)
+            for (size_t i = 0; i < w; i++) v[i] = op(v[i], v[i + w]);
+        return v[0];
+    }
+
+    template<class V>
+    void checkAgainstScalar()
+    {
+        using T = typename V::value_type;
+        constexpr int L = V::lanes;
+
+        const auto as = sampleValues<T>(64 * L, 11);
+        const auto bs = sampleValues<T>(64 * L, 12);
+
+        for (size_t off = 0; off + L <= as.size(); off += L)
+        {
+            const T* a = &as[off];
+            const T* b = &bs[(off + L) % (bs.size() - L + 1)];
+            const V va = V::load(a), vb = V::load(b);
+
+            T add[L], sub[L], mul[L], div[L], sq[L], mn[L], mx[L], ng[L], ab[L], fm[L], picked[L];
+            (va + vb).store(add);
+            (va - vb).store(sub);
+            (va * vb).store(mul);
+            (va / vb).store(div);
+            V::sqrt(V::abs(va)).store(sq);
+            V::min(va, vb).store(mn);
+            V::max(va, vb).store(mx);
+            (-va).store(ng);
+            V::abs(va).store(ab);
+            V::fma(va, vb, va).store(fm);
+
+            const auto lt = va < vb, le = va <= vb, gt = va > vb, ge = va >= vb, eq = va == vb, ne = va != vb;
+            V::blend(lt, va, vb).store(picked);
+
+            for (int l = 0; l < L; l++)
+            {
+                INFO("lane " << l << " a=" << a[l] << " b=" << b[l]);
+                REQUIRE(sameBits(add[l], T(a[l] + b[l])));
+                REQUIRE(sameBits(sub[l], T(a[l] - b[l])));
+                REQUIRE(sameBits(mul[l], T(a[l] * b[l])));
+                REQUIRE(sameBits(div[l], T(a[l] / b[l])));
+                REQUIRE(sameBits(sq[l], T(std::sqrt(std::fabs(a[l])))));
+                REQUIRE(sameBits(mn[l], a[l] < b[l] ? a[l] : b[l]));
+                REQUIRE(sameBits(mx[l], a[l] > b[l] ? a[l] : b[l]));
+                REQUIRE(sameBits(ng[l], T(-a[l])));
+                REQUIRE(sameBits(ab[l], T(std::fabs(a[l]))));
+
+                // fused or not depending on the ISA
+                const T fused = std::fma(a[l], b[l], a[l]);
+                const T unfused = a[l] * b[l] + a[l];
+                REQUIRE((sameBits(fm[l], fused) || sameBits(fm[l], unfused)));
+
+                REQUIRE(lt[l] == (a[l] <  b[l]));
+                REQUIRE(le[l] == (a[l] <= b[l]));
+                REQUIRE(gt[l] == (a[l] >  b[l]));
+                REQUIRE(ge[l] == (a[l] >= b[l]));
+                REQUIRE(eq[l] == (a[l] == b[l]));
+                REQUIRE(ne[l] == (a[l] != b[l]));
+                REQUIRE((lt & ne)[l] == (lt[l] && ne[l]));
+                REQUIRE((lt | eq)[l] == (lt[l] || eq[l]));
+                REQUIRE((!lt)[l] == !lt[l]);
+                REQUIRE(sameBits(picked[l], (a[l] < b[l]) ? a[l] : b[l]));
+            }
+
+            // reductions (skip NaN batches, min/max order rules make them position dependent)
+            const std::vector<T> lanes(a, a + L);
+            bool has_nan = false;
+            for (T x : lanes) has_nan |= std::isnan(x);
+            if (!has_nan)
+            {
+                REQUIRE(sameBits(va.hsum(), treeReduce(lanes, [](T x, T y) { return T(x + y); })));
+                REQUIRE(sameBits(va.hmin(), treeReduce(lanes, [](T x, T y) { return x < y ? x : y; })));
+                REQUIRE(sameBits(va.hmax(), treeReduce(lanes, [](T x, T y) { return x > y ? x : y; })));
+            }
+        }
+    }
+
+    template<class V>
+    void checkMemoryOps()
+    {
+        using T = typename V::value_type;
+        constexpr int L = V::lanes;
+
+        std::vector<T> table(100);
+        for (int i = 0; i < 100; i++) table[i] = T(i) * T(0.5);
+
+        int32_t idx[L];
+        for (int l = 0; l < L; l++) idx[l] = (l * 37 + 5) % 100;
+        const V g = V::gather(table.data(), idx);
+        for (int l = 0; l < L; l++)
+            REQUIRE(g.lane(l) == table[idx[l]]);
+
+        for (int n = 0; n <= L; n++)
+        {
+            const V p = V::loadPartial(table.data() + 1, n, T(-1));
+            for (int l = 0; l < L; l++)
+                REQUIRE(p.lane(l) == (l < n ? table[1 + l] : T(-1)));
+
+            std::vector<T> out(L + 1, T(7));
+            V::broadcast(T(2)).storePartial(out.data(), n);
+            for (int l = 0; l <= L; l++)
+                REQUIRE(out[l] == (l < n ? T(2) : T(7)));
+
+            const auto m = V::mask::firstN(n);
+            REQUIRE(m.bits() == (1 << n) - 1);
+            REQUIRE(m.any() == (n > 0));
+            REQUIRE(m.none() == (n == 0));
+            REQUIRE(m.all() == (n == L));
+        }
+    }
+
+    template<class V>
+    void checkComplexMultiply()
+    {
+        using T = typename V::value_type;
+        constexpr int L = V::lanes;
+
+        const auto as = sampleValues<T>(L * 16, 21);
+        const auto bs = sampleValues<T>(L * 16, 22);
+
+        for (int off = 0; off + L <= L * 16; off += L)
+        {
+            T out[L];
+            V::cmul(V::load(&as[off]), V::load(&bs[off])).store(out);
+
+            for (int l = 0; l < L; l += 2)
+            {
+                const T ar = as[off + l], ai = as[off + l + 1];
+                const T br = bs[off + l], bi = bs[off + l + 1];
+                const T re = ar * br - ai * bi;
+                const T im = ar * bi + ai * br;
+
+                // allow for contraction in the reference expression
+                const T tol_re = (std::fabs(ar * br) + std::fabs(ai * bi)) * std::numeric_limits<T>::epsilon();
+                const T tol_im = (std::fabs(ar * bi) + std::fabs(ai * br)) * std::numeric_limits<T>::epsilon();
+                REQUIRE(std::fabs(out[l] - re) <= tol_re);
+                REQUIRE(std::fabs(out[l + 1] - im) <= tol_im);
+            }
+        }
+    }
+}
+
+TEST_CASE("simd::v4d matches scalar double per lane")
+{
+    checkAgainstScalar<simd::v4d>();
+    checkMemoryOps<simd::v4d>();
+    checkComplexMultiply<simd::v4d>();
+}
+
+TEST_CASE("simd::v8f matches scalar float per lane")
+{
+    checkAgainstScalar<simd::v8f>();
+    checkMemoryOps<simd::v8f>();
+    checkComplexMultiply<simd::v8f>();
+}
+
+TEST_CASE("simd::v8d matches scalar double per lane")
+{
+    checkAgainstScalar<simd::v8d>();
+    checkMemoryOps<simd::v8d>();
+    checkComplexMultiply<simd::v8d>();
+}
+
+TEST_CASE("simd::native_lanes fits the wide types")
+{
+    STATIC_REQUIRE(simd::native_lanes<double> >= 1);
+    STATIC_REQUIRE(simd::native_lanes<double> <= simd::v8d::lanes);
+    STATIC_REQUIRE(simd::native_lanes<float> <= simd::v8f::lanes);
+}
@@ -0,0 +1,217 @@
+#include <catch2/catch_test_macros.hpp>
+#include <bitloop/util/thread_queue.h>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // counts destructions, to check closures and retired objects are released exactly once
+    struct Tracked
+    {
+        std::atomic<int>* destroyed;
+        explicit Tracked(std::atomic<int>* d) : destroyed(d) {}
+        Tracked(Tracked&& o) noexcept : destroyed(std::exchange(o.destroyed, nullptr)) {}
+        ~Tracked() { if (destroyed) destroyed->fetch_add(1); }
+    };
+
+    // run everything posted so far, until 'done' holds
+    template<typename Pred>
+    void pumpUntil(ThreadQueue& q, Pred&& done)
+    {
+        while (!done())
+        {
+            q.drain();
+            std::this_thread::yield();
+        }
+    }
+}
+
+TEST_CASE("ThreadQueue runs each producer's posts in order")
+{
+    constexpr int producers = 4;
+    constexpr int posts = 5000; // several times the pool, so heap nodes are mixed in
+
+    ThreadQueue q;
+    std::vector<int> last(producers, -1);
+    std::atomic<int> out_of_order{ 0 };
+    int ran = 0;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&, p]
+        {
+            for (int i = 0; i < posts; ++i)
+            {
+                q.post([&, p, i]
+                {
+                    if (i != last[p] + 1) out_of_order.fetch_add(1);
+                    last[p] = i;
+                    ++ran;
+                });
+            }
+        });
+    }
+
+    pumpUntil(q, [&] { return ran == producers * posts; });
+    for (auto& t : threads) t.join();
+
+    REQUIRE(out_of_order.load() == 0);
+    for (int p = 0; p < producers; ++p)
+        REQUIRE(last[p] == posts - 1);
+}
+
+TEST_CASE("ThreadQueue falls back to heap nodes once the pool is exhausted")
+{
+    constexpr int pool = 16;
+    ThreadQueue q(pool);
+
+    std::vector<int> order;
+    for (int round = 0; round < 3; ++round)
+    {
+        // nothing is pumped while posting, so most of these need a heap node
+        order.clear();
+        for (int i = 0; i < pool * 8; ++i)
+            q.post([&order, i] { order.push_back(i); });
+
+        q.drain();
+        REQUIRE(order.size() == size_t(pool * 8));
+        for (int i = 0; i < pool * 8; ++i)
+            REQUIRE(order[i] == i);
+    }
+
+    // anything still queued (pool or heap node) is destroyed, not run, with the queue
+    std::atomic<int> destroyed{ 0 };
+    int ran = 0;
+    {
+        ThreadQueue q2(pool);
+        for (int i = 0; i < pool * 4; ++i)
+            q2.post([&ran, t = Tracked(&destroyed)] { ++ran; });
+    }
+    REQUIRE(ran == 0);
+    REQUIRE(destroyed.load() == pool * 4);
+}
+
+TEST_CASE("ThreadQueue boxes closures larger than the inline capacity")
+{
+    ThreadQueue q;
+
+    std::array<unsigned char, 4 * ThreadQueue::inline_capacity> payload;
+    for (size_t i = 0; i < payload.size(); ++i)
+        payload[i] = static_cast<unsigned char>(i * 7);
+
+    std::atomic<int> destroyed{ 0 };
+    int checksum = -1;
+
+    std::thread producer([&]
+    {
+        q.post([&checksum, payload, t = Tracked(&destroyed)]
+        {
+            int sum = 0;
+            for (unsigned char c : payload) sum += c;
+            checksum = sum;
+        });
+    });
+    producer.join();
+
+    REQUIRE(destroyed.load() == 0);
+    q.drain();
+
+    int expected = 0;
+    for (unsigned char c : payload) expected += c;
+    REQUIRE(checksum == expected);
+    REQUIRE(destroyed.load() == 1);
+
+    // a boxed closure that never runs is still released
+    {
+        ThreadQueue q2;
+        q2.post([payload, t = Tracked(&destroyed)] { (void)payload; });
+    }
+    REQUIRE(destroyed.load() == 2);
+}
+
+TEST_CASE("ThreadQueue::invokeBlocking returns results and rethrows exceptions")
+{
+    ThreadQueue q;
+
+    // on the owner thread the call runs inline
+    REQUIRE(q.invokeBlocking([] { return 7; }) == 7);
+
+    std::atomic<int> finished{ 0 };
+    int value = 0;
+    bool caught = false;
+
+    std::thread caller([&]
+    {
+        value = q.invokeBlocking([] { return 42; });
+
+        try
+        {
+            q.invokeBlocking([]() -> int { throw std::runtime_error("owner failed"); });
+        }
+        catch (const std::runtime_error& e)
+        {
+            caught = std::string(e.what()) == "owner failed";
+        }
+        finished.store(1);
+    });
+
+    pumpUntil(q, [&] { return finished.load() == 1; });
+    caller.join();
+
+    REQUIRE(value == 42);
+    REQUIRE(caught);
+}
+
+TEST_CASE("ThreadQueue::invokeBlocking callers may exit straight after returning")
+{
+    ThreadQueue q;
+    constexpr int callers = 200;
+    std::atomic<int> finished{ 0 };
+
+    // each caller thread ends as soon as its call returns, while the owner is still signalling it
+    std::vector<std::thread> threads;
+    for (int i = 0; i < callers; ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            if (q.invokeBlocking([i] { return i; }) == i)
+                finished.fetch_add(1);
+        });
+    }
+
+    pumpUntil(q, [&] { return finished.load() == callers; });
+    for (auto& t : threads) t.join();
+    REQUIRE(finished.load() == callers);
+}
+
+TEST_CASE("ThreadQueue::retire deletes on the owner thread when pumped")
+{
+    ThreadQueue q;
+    std::atomic<int> destroyed{ 0 };
+
+    std::thread producer([&]
+    {
+        q.retire(new Tracked(&destroyed));
+        q.retire<Tracked>(nullptr); // ignored
+
+        auto p = make_deferred_unique<Tracked>(q, &destroyed);
+        p.reset();
+    });
+    producer.join();
+
+    REQUIRE(destroyed.load() == 0);
+    q.drain();
+    REQUIRE(destroyed.load() == 2);
+
+    // unpumped retirements are still released with the queue
+    {
+        ThreadQueue q2;
+        q2.retire(new Tracked(&destroyed));
+    }
+    REQUIRE(destroyed.load() == 3);
+}